@@ -0,0 +1,109 @@
+/**
+ * @file graph_plan.c
+ * @project Certifiable Inference Engine
+ * @brief Build a small CNN as a graph and report its arena plan.
+ *
+ * @details Declares a LeNet-style network once, lets the planner pack all
+ * intermediates into one arena, prints where every tensor lives and the
+ * peak arena size, then runs it. The peak is what a target must reserve
+ * for intermediates; compare it with the unshared sum that one static
+ * buffer per layer (as in xor_gate.c) would cost.
+ *
+ * @traceability SRS-009
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "graph.h"
+#include "fixed_point.h"
+#include <stdio.h>
+
+/* Weights (zero here; a real model loads trained values) */
+static fixed_t w1_buf[8 * 1 * 5 * 5];
+static fixed_t b1_buf[8];
+static fixed_t w2_buf[16 * 8 * 5 * 5];
+static fixed_t b2_buf[16];
+static fixed_t w3_buf[16 * 4 * 4 * 32];
+static fixed_t b3_buf[32];
+static fixed_t w4_buf[32 * 10];
+static fixed_t b4_buf[10];
+
+static fixed_t image[1 * 28 * 28];
+static fixed_t logits[10];
+static fixed_t arena[4096];
+
+static fx_graph_t graph;
+
+static const char* op_name(fx_graph_op_type_t type) {
+    switch (type) {
+    case FX_GRAPH_OP_CONV2D:         return "conv2d";
+    case FX_GRAPH_OP_DENSE:          return "dense";
+    case FX_GRAPH_OP_MAXPOOL_2X2:    return "maxpool";
+    case FX_GRAPH_OP_ACTIVATION:     return "activation";
+    case FX_GRAPH_OP_POOL2D:         return "pool2d";
+    case FX_GRAPH_OP_GLOBAL_AVGPOOL: return "gap";
+    case FX_GRAPH_OP_INPUT_CONVERT:  return "input";
+    default:                         return "?";
+    }
+}
+
+int main(void) {
+    fx_tensor_t w1, w2;
+    fx_matrix_t w3, b3, w4, b4;
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+    const fx_conv_epilogue_t relu_pool = { FX_ACT_RELU, FIXED_ZERO, true };
+    fx_tensor_id_t x, h1, h2, h3, y;
+    fx_graph_stats_t st;
+
+    fx_tensor_attach(&w1, w1_buf, 8, 1, 5, 5, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&w2, w2_buf, 16, 8, 5, 5, FX_LAYOUT_NCHW);
+    fx_matrix_attach(&w3, w3_buf, 16 * 4 * 4, 32);
+    fx_matrix_attach(&b3, b3_buf, 1, 32);
+    fx_matrix_attach(&w4, w4_buf, 32, 10);
+    fx_matrix_attach(&b4, b4_buf, 1, 10);
+
+    /* 1×28×28 → conv5 (ReLU, pool) → 8×12×12 → conv5 (ReLU, pool) → 16×4×4
+     * → dense 32 (ReLU) → dense 10 */
+    fx_graph_res_t res = fx_graph_init(&graph);
+    if (res == FX_GRAPH_OK) res = fx_graph_input(&graph, 1, 1, 28, 28, FX_LAYOUT_NCHW, &x);
+    if (res == FX_GRAPH_OK) res = fx_graph_conv2d(&graph, x, &w1, b1_buf, &p, &relu_pool, &h1);
+    if (res == FX_GRAPH_OK) res = fx_graph_conv2d(&graph, h1, &w2, b2_buf, &p, &relu_pool, &h2);
+    if (res == FX_GRAPH_OK) res = fx_graph_dense(&graph, h2, &w3, &b3, FX_ACT_RELU, FIXED_ZERO, &h3);
+    if (res == FX_GRAPH_OK) res = fx_graph_dense(&graph, h3, &w4, &b4, FX_ACT_NONE, FIXED_ZERO, &y);
+    if (res == FX_GRAPH_OK) res = fx_graph_output(&graph, y);
+    if (res == FX_GRAPH_OK) res = fx_graph_plan(&graph, &st);
+    if (res != FX_GRAPH_OK) {
+        printf("Graph construction failed (%d)\n", (int)res);
+        return 1;
+    }
+
+    printf("Execution plan:\n");
+    for (uint16_t i = 0; i < graph.op_count; i++) {
+        const fx_graph_op_t* op = &graph.ops[i];
+        const fx_graph_tensor_t* t = &graph.tensors[op->out];
+        if (t->kind == FX_GRAPH_TENSOR_INTERMEDIATE) {
+            printf("  %2u %-10s -> t%-2u %2u×%2u×%2u×%2u  arena[%5zu, %5zu)  live %u..%u\n",
+                   i, op_name(op->type), op->out, t->n, t->c, t->h, t->w,
+                   t->offset, t->offset + (size_t)t->n * t->c * t->h * t->w, t->def, t->last);
+        } else {
+            printf("  %2u %-10s -> t%-2u %2u×%2u×%2u×%2u  (graph output)\n",
+                   i, op_name(op->type), op->out, t->n, t->c, t->h, t->w);
+        }
+    }
+    printf("\nPeak arena: %zu elements (%zu bytes)\n", st.arena_len, st.arena_len * sizeof(fixed_t));
+    printf("Unshared:   %zu elements (%zu bytes)\n", st.unshared_len, st.unshared_len * sizeof(fixed_t));
+
+    if (st.arena_len > sizeof(arena) / sizeof(arena[0])) {
+        printf("Arena buffer too small\n");
+        return 1;
+    }
+
+    (void)fx_graph_bind(&graph, x, image);
+    (void)fx_graph_bind(&graph, y, logits);
+    res = fx_graph_run(&graph, arena, sizeof(arena) / sizeof(arena[0]));
+    printf("Run: %s\n", res == FX_GRAPH_OK ? "ok" : "failed");
+
+    return res == FX_GRAPH_OK ? 0 : 1;
+}
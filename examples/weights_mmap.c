@@ -0,0 +1,82 @@
+/**
+ * @file weights_mmap.c
+ * @project Certifiable Inference Engine
+ * @brief Map a weight container read-only and list its tensors.
+ *
+ * @details The file is mapped, never read into a buffer: fx_weights_open()
+ * validates the header and table in place and matrices attached from it
+ * point straight into the mapping. Pages of weight data are faulted in
+ * only when a layer first touches them, so open time does not grow with
+ * the model. Pass --verify to also check the CRC-32 (reads every byte).
+ *
+ * On bare metal the same code applies with the mapping replaced by the
+ * flash address of the linked-in image.
+ *
+ * Usage: weights_mmap model.ciew [--verify]
+ *
+ * @traceability SRS-010
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "weights.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printf("Usage: %s model.ciew [--verify]\n", argv[0]);
+        return 1;
+    }
+    const uint32_t flags = (argc > 2 && strcmp(argv[2], "--verify") == 0) ? FX_WEIGHTS_VERIFY : 0u;
+
+    int fd = open(argv[1], O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || st.st_size <= 0) {
+        printf("Cannot open %s\n", argv[1]);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return 1;
+    }
+
+    /* Page-aligned, read-only: writes through an attached matrix fault */
+    const size_t len = (size_t)st.st_size;
+    void* image = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (image == MAP_FAILED) {
+        printf("mmap failed\n");
+        return 1;
+    }
+
+    fx_weights_t wf;
+    fx_weights_res_t res = fx_weights_open(&wf, image, len, flags);
+    if (res != FX_WEIGHTS_OK) {
+        printf("Invalid weight file (%d)\n", (int)res);
+        munmap(image, len);
+        return 1;
+    }
+
+    printf("%s: format %u.%u, %u tensors, %zu bytes%s\n", argv[1],
+           wf.header->version_major, wf.header->version_minor, wf.count, len,
+           flags ? ", CRC-32 ok" : "");
+    for (uint32_t i = 0; i < wf.count; i++) {
+        const fx_weights_entry_t* e = &wf.table[i];
+        printf("  %-31s Q%u.%u  [", e->name, 32u - e->frac_bits, e->frac_bits);
+        for (uint8_t d = 0; d < e->rank; d++) {
+            printf(d ? " × %u" : "%u", e->dims[d]);
+        }
+        printf("]  @%llu\n", (unsigned long long)e->offset);
+    }
+
+    munmap(image, len);
+    return 0;
+}
@@ -43,6 +43,21 @@
  */
 void fx_relu(fx_matrix_t* mat);
 
+/**
+ * @brief Reference (scalar) ReLU, retained as the SIMD verification oracle.
+ *
+ * @param[in,out] mat Matrix to apply ReLU to (modified in-place)
+ *
+ * @pre mat is valid pointer with allocated data
+ * @post mat->data[i] = max(0, mat->data[i]) for all i
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.1, SRS-004.2, SRS-003.10
+ */
+void fx_relu_ref(fx_matrix_t* mat);
+
 /**
  * @brief Leaky ReLU activation function.
  *
@@ -66,6 +81,102 @@ void fx_relu(fx_matrix_t* mat);
  */
 void fx_leaky_relu(fx_matrix_t* mat, fixed_t alpha);
 
+/**
+ * @brief Reference (scalar) Leaky ReLU, retained as the SIMD verification oracle.
+ *
+ * @param[in,out] mat Matrix to apply Leaky ReLU to (modified in-place)
+ * @param[in] alpha Slope for negative values
+ *
+ * @pre mat is valid pointer with allocated data
+ * @post mat->data[i] = original if >= 0, else fixed_mul(original, alpha)
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect (uses fixed_mul from SRS-002)
+ *
+ * @traceability SRS-004.1, SRS-004.2, SRS-004.4, SRS-003.10
+ */
+void fx_leaky_relu_ref(fx_matrix_t* mat, fixed_t alpha);
+
+/**
+ * @brief Logistic sigmoid, in-place, via fixed_sigmoid().
+ *
+ * @details Table-interpolated (see lut.h); error < 1.5 LSB against the
+ * exact function for every Q16.16 input.
+ *
+ * @param[in,out] mat Matrix to apply sigmoid to (modified in-place)
+ *
+ * @pre mat is valid pointer with allocated data
+ * @post mat->data[i] = fixed_sigmoid(original) for all i
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect across all platforms (integer only)
+ *
+ * @traceability SRS-004.10
+ */
+void fx_sigmoid(fx_matrix_t* mat);
+
+/**
+ * @brief Hyperbolic tangent, in-place, via fixed_tanh().
+ *
+ * @details Error < 2.5 LSB against the exact function.
+ *
+ * @param[in,out] mat Matrix to apply tanh to (modified in-place)
+ *
+ * @pre mat is valid pointer with allocated data
+ * @post mat->data[i] = fixed_tanh(original) for all i
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect across all platforms (integer only)
+ *
+ * @traceability SRS-004.10
+ */
+void fx_tanh(fx_matrix_t* mat);
+
+/**
+ * @brief GELU x · Φ(x), in-place, via fixed_gelu().
+ *
+ * @details Error < 2.5 LSB against the exact (erf) definition.
+ *
+ * @param[in,out] mat Matrix to apply GELU to (modified in-place)
+ *
+ * @pre mat is valid pointer with allocated data
+ * @post mat->data[i] = fixed_gelu(original) for all i
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect across all platforms (integer only)
+ *
+ * @traceability SRS-004.10
+ */
+void fx_gelu(fx_matrix_t* mat);
+
+/**
+ * @brief Row-wise softmax, in-place.
+ *
+ * @details Each row is shifted by its maximum before exponentiation, so
+ * every exponent is ≤ 0 and no input range can overflow:
+ *
+ *   e_i = 2^-((max − x_i) · log2 e)      (fx_exp2_neg(), Q2.30)
+ *   p_i = round(e_i · 2^16 / Σ e_j)      (one 64-bit division per element)
+ *
+ * The largest entry contributes exactly 2^30, so Σ e_j ≥ 2^30 and the
+ * division is always defined. Sums are exact (uint64); the result depends
+ * only on the row contents, not on evaluation order.
+ *
+ * Error: each p_i is within 1 LSB of the exact softmax, and the row sums
+ * to FIXED_ONE within cols / 2 LSB.
+ *
+ * @param[in,out] mat Logits, one distribution per row (modified in-place)
+ *
+ * @pre mat is valid pointer with allocated data
+ * @post each row holds probabilities in [0, FIXED_ONE]
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect across all platforms (integer only)
+ *
+ * @traceability SRS-004.11
+ */
+void fx_softmax(fx_matrix_t* mat);
+
 /**
  * @brief Identity activation (no operation).
  *
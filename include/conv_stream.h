@@ -0,0 +1,153 @@
+/**
+ * @file conv_stream.h
+ * @project Certifiable Inference Engine
+ * @brief Incremental (sliding-window) convolution over streamed rows.
+ *
+ * @details A stream receives its input one row at a time: a line-scan
+ * camera line, or one time step of an audio or radar signal. The rows
+ * pushed so far form an NHWC tensor 1 × C_in × H × W that grows in H.
+ * The stream keeps the last span = dilation_h × (KH − 1) + 1 rows in a
+ * ring and, when a row completes a receptive field, computes only that
+ * output row:
+ *
+ *   cost per row = C_out × OW × C_in × KH × KW multiplies
+ *
+ * instead of the OH times as much spent re-running fx_conv2d_multi()
+ * over the whole window.
+ *
+ * Output row k is bit-identical to row k of fx_conv2d_multi() on all
+ * rows pushed so far, with the same params. pad_h zero rows are placed
+ * before the first row only, since a stream has no last row:
+ * - Row-incremental 2D (line scan): pad_h = 0, any stride_h.
+ * - Causal 1D (time series): W = KW = 1, pad_h = dilation_h × (KH − 1),
+ *   stride_h = 1; output t depends on inputs t − pad_h … t only and is
+ *   produced by the push of input t.
+ *
+ * ```c
+ * // 2 channels, causal, kernel 3 with dilation 4 → 5 filters
+ * fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+ * p.dilation_h = 4;
+ * p.pad_h = 8;
+ * fx_tensor_attach(&w, w_buf, 5, 2, 3, 1, FX_LAYOUT_NCHW);
+ * fx_conv_stream_init(&s, &w, bias, &p, 1, ring,
+ *                     fx_conv_stream_size(&w, &p, 1));
+ * for (;;) {
+ *     read_samples(frame, hop);                 // hop × 2 samples
+ *     fx_conv_stream_push(&s, frame, hop, out, &produced);
+ * }
+ * ```
+ *
+ * @traceability SRS-006.14
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef CONV_STREAM_H
+#define CONV_STREAM_H
+
+#include "convolution.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Streaming convolution state.
+ *
+ * @details The ring holds each of the last span rows twice, at slot s
+ * and s + span, so the span rows ending at the newest one are always
+ * contiguous: an NHWC tensor of height span that the direct convolution
+ * reads in place.
+ */
+typedef struct {
+    const fx_tensor_t* weights;  /**< C_out × C_in × KH × KW (caller owned) */
+    const fixed_t* bias;         /**< C_out values, or NULL */
+    fx_conv_params_t window;     /**< Geometry of one output row (stride_h 1, pad_h 0) */
+    uint16_t stride_h;           /**< Input rows between output rows */
+    uint16_t pad_h;              /**< Zero rows before the first row */
+    uint16_t width;              /**< Input row width W */
+    uint16_t out_width;          /**< Output row width OW */
+    uint16_t span;               /**< Input rows per output row */
+    uint16_t next;               /**< Ring slot the next row is written to */
+    uint32_t wait;               /**< Rows to push before the next output row */
+    size_t row_len;              /**< C_in × W elements per input row */
+    fixed_t* ring;               /**< 2 × span rows (caller owned) */
+} fx_conv_stream_t;
+
+/**
+ * @brief Ring length required by fx_conv_stream_init().
+ *
+ * @param[in] weights Filter tensor
+ * @param[in] params Geometry
+ * @param[in] width Input row width
+ *
+ * @return 2 × span × C_in × width fixed_t elements, or 0 if the
+ *         arguments are invalid
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-006.14
+ */
+size_t fx_conv_stream_size(const fx_tensor_t* weights, const fx_conv_params_t* params,
+                           uint16_t width);
+
+/**
+ * @brief Start a stream.
+ *
+ * @param[out] s Stream
+ * @param[in] weights Filter tensor (must outlive the stream)
+ * @param[in] bias C_out bias values, or NULL (must outlive the stream)
+ * @param[in] params Stride, padding and dilation; algo is ignored
+ * @param[in] width Input row width W
+ * @param[in] ring Caller storage of fx_conv_stream_size() elements
+ * @param[in] ring_len Length of ring in fixed_t elements
+ *
+ * @return FX_CONV_OK, FX_CONV_INVALID_PARAM (including pad_h ≥ span),
+ *         FX_CONV_DIM_MISMATCH (kernel wider than the padded row) or
+ *         FX_CONV_WORKSPACE_TOO_SMALL
+ *
+ * @complexity O(ring_len)
+ *
+ * @traceability SRS-006.14
+ */
+fx_conv_res_t fx_conv_stream_init(fx_conv_stream_t* s, const fx_tensor_t* weights,
+                                  const fixed_t* bias, const fx_conv_params_t* params,
+                                  uint16_t width, fixed_t* ring, size_t ring_len);
+
+/**
+ * @brief Restart a stream at row 0 (e.g. a new utterance or scan).
+ *
+ * @complexity O(ring length)
+ *
+ * @traceability SRS-006.14
+ */
+void fx_conv_stream_reset(fx_conv_stream_t* s);
+
+/**
+ * @brief Push rows and compute the output rows they complete.
+ *
+ * @details Each input row is W × C_in interleaved values (one NHWC row);
+ * each output row is OW × C_out interleaved values, written
+ * consecutively to @p out. At most ceil(count / stride_h) rows are
+ * produced; a causal stream (stride 1, pad_h = span − 1) produces
+ * exactly count.
+ *
+ * @param[in,out] s Stream
+ * @param[in] rows count input rows
+ * @param[in] count Rows to push
+ * @param[out] out Room for ceil(count / stride_h) output rows
+ * @param[out] produced Output rows written (may be NULL)
+ *
+ * @return FX_CONV_OK or FX_CONV_INVALID_PARAM
+ *
+ * @complexity O(count × C_in × W + produced × C_out × OW × C_in × KH × KW)
+ * @determinism Bit-identical to fx_conv2d_multi() over all pushed rows
+ *
+ * @traceability SRS-006.14
+ */
+fx_conv_res_t fx_conv_stream_push(fx_conv_stream_t* s, const fixed_t* rows, size_t count,
+                                  fixed_t* out, size_t* produced);
+
+#endif /* CONV_STREAM_H */
@@ -20,6 +20,8 @@
 #define CONVOLUTION_H
 
 #include "matrix.h"
+#include "tensor.h"
+#include <stdbool.h>
 
 /**
  * @brief Deterministic 2D Convolution with valid padding.
@@ -75,4 +77,420 @@
  */
 void fx_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out);
 
+/**
+ * @brief Reference (scalar) 2D convolution with valid padding.
+ *
+ * @details Explicit sliding-window loop retained as the verification
+ * oracle for the SIMD backends. fx_conv2d() must match it bit-for-bit.
+ *
+ * @param[in] in Input feature map (H×W matrix)
+ * @param[in] kernel Convolution kernel (KH×KW matrix)
+ * @param[out] out Output feature map ((H-KH+1)×(W-KW+1) matrix)
+ *
+ * @pre Same as fx_conv2d()
+ * @post out contains convolution result
+ *
+ * @complexity O(OH × OW × KH × KW)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-006.1, SRS-006.2, SRS-006.3, SRS-006.4, SRS-003.10
+ */
+void fx_conv2d_ref(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out);
+
+/**
+ * @brief Convolution algorithm used by fx_conv2d_layer().
+ */
+typedef enum {
+    FX_CONV_ALGO_DIRECT = 0,     /**< Filter-blocked sliding window, no workspace */
+    FX_CONV_ALGO_IM2COL          /**< im2col lowering onto the blocked GEMM */
+} fx_conv_algo_t;
+
+/**
+ * @brief Geometry of a multi-channel convolution layer.
+ *
+ * @details Padding is symmetric zero-padding of pad_h rows above and below
+ * and pad_w columns left and right. A dilation of d samples the input every
+ * d pixels under the kernel (d = 1 is ordinary convolution).
+ */
+typedef struct {
+    uint16_t stride_h;           /**< Vertical stride (≥ 1) */
+    uint16_t stride_w;           /**< Horizontal stride (≥ 1) */
+    uint16_t pad_h;              /**< Zero rows added above and below */
+    uint16_t pad_w;              /**< Zero columns added left and right */
+    uint16_t dilation_h;         /**< Vertical kernel dilation (≥ 1) */
+    uint16_t dilation_w;         /**< Horizontal kernel dilation (≥ 1) */
+    fx_conv_algo_t algo;         /**< Algorithm for fx_conv2d_layer() */
+} fx_conv_params_t;
+
+/** Stride 1, no padding, no dilation, direct: the geometry of fx_conv2d() */
+#define FX_CONV_PARAMS_DEFAULT { 1, 1, 0, 0, 1, 1, FX_CONV_ALGO_DIRECT }
+
+/** Filters accumulated together over one pass of the input */
+#define FX_CONV_OC_BLOCK 8
+
+/** Output pixels lowered per im2col tile (bounds the workspace) */
+#define FX_CONV_IM2COL_COLS 256
+
+/**
+ * @brief Result codes for multi-channel convolution.
+ */
+typedef enum {
+    FX_CONV_OK = 0,              /**< Output written */
+    FX_CONV_INVALID_PARAM,       /**< NULL pointer, zero stride or dilation */
+    FX_CONV_DIM_MISMATCH,        /**< Tensor shapes inconsistent with params */
+    FX_CONV_WORKSPACE_TOO_SMALL, /**< Workspace shorter than required */
+    FX_CONV_UNSUPPORTED,         /**< Geometry not supported by the algorithm */
+    FX_CONV_INEXACT              /**< Exactness cannot be guaranteed */
+} fx_conv_res_t;
+
+/**
+ * @brief Output extent of one spatial dimension.
+ *
+ * @details out = (in + 2·pad − dilation·(k − 1) − 1) / stride + 1
+ *
+ * @param[in] in Input extent
+ * @param[in] k Kernel extent
+ * @param[in] stride Stride (≥ 1)
+ * @param[in] pad Symmetric zero-padding
+ * @param[in] dilation Kernel dilation (≥ 1)
+ *
+ * @return Output extent, or 0 if the dilated kernel does not fit the
+ *         padded input, a parameter is zero, or the result exceeds 65535
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-006.7, SRS-006.9, SRS-006.10
+ */
+uint16_t fx_conv2d_out_dim(uint16_t in, uint16_t k, uint16_t stride,
+                           uint16_t pad, uint16_t dilation);
+
+/**
+ * @brief Multi-channel, batched 2D convolution with optional fused bias.
+ *
+ * @details Computes, for every batch b, filter o and output pixel (y, x):
+ *
+ *   out[b][o][y][x] = round(Σ(c,i,j) in[b][c][y·sh − ph + i·dh][x·sw − pw + j·dw]
+ *                                     × weights[o][c][i][j]) + bias[o]
+ *
+ * where input samples outside the image read as zero. Each output owns a
+ * single 64-bit accumulator over all C_in × KH × KW taps and is rounded
+ * once (SRS-006.3, SRS-006.4); the bias is added after rounding with
+ * fixed_add(), exactly as fx_conv2d() followed by a bias add would.
+ *
+ * Filters are processed in blocks of FX_CONV_OC_BLOCK that share one pass
+ * over the input: every input sample is loaded once per block and
+ * multiplied into all of the block's accumulators.
+ *
+ * Always uses FX_CONV_ALGO_DIRECT; params->algo is honoured by
+ * fx_conv2d_layer().
+ *
+ * Tensor roles (each tensor may use either layout):
+ * - in:      N × C_in × H × W
+ * - weights: C_out × C_in × KH × KW (n = filter, c = input channel)
+ * - out:     N × C_out × OH × OW with OH, OW from fx_conv2d_out_dim()
+ *
+ * @param[in] in Input tensor
+ * @param[in] weights Filter tensor
+ * @param[in] bias C_out bias values, or NULL for none
+ * @param[in] params Stride, padding and dilation
+ * @param[out] out Output tensor (caller-provided)
+ *
+ * @return FX_CONV_OK, FX_CONV_INVALID_PARAM or FX_CONV_DIM_MISMATCH;
+ *         out is untouched on error
+ *
+ * @pre out does not alias in, weights or bias
+ *
+ * @complexity O(N × C_out × OH × OW × C_in × KH × KW)
+ * @determinism Bit-perfect across all platforms (64-bit accumulator)
+ *
+ * @note No dynamic memory allocation (caller provides buffers)
+ *
+ * @traceability SRS-006.7, SRS-006.8, SRS-006.9, SRS-006.10
+ *
+ * @example
+ * ```c
+ * // 3-channel 32×32 image, 16 filters of 3×3, "same" padding
+ * fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+ * p.pad_h = 1;
+ * p.pad_w = 1;
+ * fx_tensor_attach(&in, in_buf, 1, 3, 32, 32, FX_LAYOUT_NCHW);
+ * fx_tensor_attach(&w, w_buf, 16, 3, 3, 3, FX_LAYOUT_NCHW);
+ * fx_tensor_attach(&out, out_buf, 1, 16, 32, 32, FX_LAYOUT_NCHW);
+ * fx_conv2d_multi(&in, &w, bias_buf, &p, &out);
+ * ```
+ */
+fx_conv_res_t fx_conv2d_multi(const fx_tensor_t* in, const fx_tensor_t* weights,
+                              const fixed_t* bias, const fx_conv_params_t* params,
+                              fx_tensor_t* out);
+
+/**
+ * @brief Reference multi-channel convolution (one filter at a time).
+ *
+ * @details Direct transcription of the definition above, retained as the
+ * verification oracle. fx_conv2d_multi() must match it bit-for-bit.
+ *
+ * @pre Same as fx_conv2d_multi()
+ *
+ * @complexity O(N × C_out × OH × OW × C_in × KH × KW)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-006.7, SRS-006.8, SRS-006.9, SRS-006.10
+ */
+fx_conv_res_t fx_conv2d_multi_ref(const fx_tensor_t* in, const fx_tensor_t* weights,
+                                  const fixed_t* bias, const fx_conv_params_t* params,
+                                  fx_tensor_t* out);
+
+/**
+ * @brief Workspace required by fx_conv2d_layer() for a layer.
+ *
+ * @details FX_CONV_ALGO_DIRECT needs none. FX_CONV_ALGO_IM2COL needs one
+ * K × T column tile, where K = C_in × KH × KW and T = min(OH × OW,
+ * FX_CONV_IM2COL_COLS), plus a C_out × T staging tile when out is NHWC.
+ * A 1×1, stride-1, unpadded layer on an NCHW input uses the input itself
+ * as the column matrix and needs only the staging tile.
+ *
+ * @param[in] in Input tensor
+ * @param[in] weights Filter tensor
+ * @param[in] params Layer geometry and algorithm
+ * @param[in] out Output tensor
+ *
+ * @return Number of fixed_t elements (0 if none is needed or arguments are invalid)
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-006.11
+ */
+size_t fx_conv2d_workspace_size(const fx_tensor_t* in, const fx_tensor_t* weights,
+                                const fx_conv_params_t* params, const fx_tensor_t* out);
+
+/**
+ * @brief Run one convolution layer with the algorithm chosen in params.
+ *
+ * @details Same operation, arguments and result as fx_conv2d_multi(),
+ * with the algorithm selected per layer by params->algo:
+ *
+ * - FX_CONV_ALGO_DIRECT: fx_conv2d_multi()
+ * - FX_CONV_ALGO_IM2COL: for each batch and each tile of output pixels,
+ *   the receptive fields are copied into a K × T column matrix in the
+ *   workspace (zeros for padding), and the C_out × K filter matrix is
+ *   multiplied by it with the blocked GEMM of SRS-003.9. Every output
+ *   still owns one 64-bit accumulator over the same K exact products
+ *   and is rounded once, so the result is bit-identical to the direct
+ *   algorithm.
+ *
+ * @param[in] in Input tensor
+ * @param[in] weights Filter tensor
+ * @param[in] bias C_out bias values, or NULL for none
+ * @param[in] params Geometry and algorithm
+ * @param[in,out] workspace Scratch buffer (may be NULL if none is needed)
+ * @param[in] workspace_len Workspace length in fixed_t elements
+ * @param[out] out Output tensor (caller-provided)
+ *
+ * @return FX_CONV_OK, FX_CONV_INVALID_PARAM, FX_CONV_DIM_MISMATCH or
+ *         FX_CONV_WORKSPACE_TOO_SMALL; out is untouched on error
+ *
+ * @pre workspace does not alias in, weights, bias or out
+ *
+ * @complexity O(N × C_out × OH × OW × C_in × KH × KW)
+ * @determinism Bit-identical for every algorithm
+ *
+ * @traceability SRS-006.8, SRS-006.11
+ */
+fx_conv_res_t fx_conv2d_layer(const fx_tensor_t* in, const fx_tensor_t* weights,
+                              const fixed_t* bias, const fx_conv_params_t* params,
+                              fixed_t* workspace, size_t workspace_len,
+                              fx_tensor_t* out);
+
+/*
+ * Winograd F(2×2, 3×3) (SRS-006.12)
+ */
+
+/**
+ * @brief Output stage fused into fx_conv2d_fused().
+ */
+typedef struct {
+    fx_activation_t act;         /**< Activation after the bias */
+    fixed_t alpha;               /**< Leaky ReLU slope (FX_ACT_LEAKY_RELU only) */
+    bool maxpool_2x2;            /**< 2×2 / stride-2 max pooling of each plane */
+} fx_conv_epilogue_t;
+
+/**
+ * @brief Convolution with bias, activation and optional 2×2 max pooling
+ *        fused into one pass.
+ *
+ * @details Computes, per output element, exactly
+ *
+ *   fx_conv2d_multi() → fx_relu() / fx_leaky_relu() → fx_maxpool_2x2()
+ *
+ * without writing the intermediate feature map. With pooling enabled the
+ * four conv outputs of each 2×2 window are accumulated, rounded, biased
+ * and activated in registers, and only their maximum is stored. The
+ * result is bit-identical to the sequential calls (SRS-004.9).
+ *
+ * @param[in] in Input tensor
+ * @param[in] weights Filter tensor
+ * @param[in] bias C_out bias values, or NULL for none
+ * @param[in] params Convolution geometry (algo is ignored: direct)
+ * @param[in] epi Fused output stage, or NULL for none
+ * @param[out] out Output tensor: the conv output shape, or half its
+ *                 height and width when epi->maxpool_2x2 is set
+ *
+ * @return FX_CONV_OK, FX_CONV_INVALID_PARAM or FX_CONV_DIM_MISMATCH
+ *         (including odd conv output dimensions with pooling);
+ *         out is untouched on error
+ *
+ * @pre out does not alias in, weights or bias
+ *
+ * @complexity O(N × C_out × OH × OW × C_in × KH × KW)
+ * @determinism Bit-identical to the unfused sequence
+ *
+ * @traceability SRS-004.9, SRS-006.8
+ */
+fx_conv_res_t fx_conv2d_fused(const fx_tensor_t* in, const fx_tensor_t* weights,
+                              const fixed_t* bias, const fx_conv_params_t* params,
+                              const fx_conv_epilogue_t* epi, fx_tensor_t* out);
+
+/**
+ * @brief Conv + bias + ReLU + 2×2 max pool, the common CNN block.
+ *
+ * @details Shorthand for fx_conv2d_fused() with
+ * { FX_ACT_RELU, 0, true }.
+ *
+ * @traceability SRS-004.9
+ */
+fx_conv_res_t fx_conv2d_bias_relu_maxpool(const fx_tensor_t* in, const fx_tensor_t* weights,
+                                          const fixed_t* bias, const fx_conv_params_t* params,
+                                          fx_tensor_t* out);
+
+/** Elements of one transformed 3×3 filter (4×4 tile) */
+#define FX_WINOGRAD_TILE 16
+
+/** Input bound admitting every fixed_t value (|x| ≤ 2^31) */
+#define FX_WINOGRAD_BOUND_ANY 0x80000000u
+
+/**
+ * @brief Prepared Winograd layer (transformed filters and proven bound).
+ *
+ * @note Produced by fx_winograd_plan(); fields are read-only for callers.
+ */
+typedef struct {
+    const int64_t* u;            /**< C_out × C_in × 16 transformed filters */
+    uint16_t cout;               /**< Output channels */
+    uint16_t cin;                /**< Input channels */
+    uint16_t pad_h;              /**< Zero rows above and below */
+    uint16_t pad_w;              /**< Zero columns left and right */
+    uint32_t input_bound;        /**< Proven-safe max |input| (raw Q16.16) */
+} fx_winograd_plan_t;
+
+/**
+ * @brief Storage required for a layer's transformed filters.
+ *
+ * @param[in] weights C_out × C_in × 3 × 3 filter tensor
+ *
+ * @return Number of int64_t elements (C_out × C_in × 16), 0 if weights is NULL
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-006.12
+ */
+size_t fx_winograd_filter_size(const fx_tensor_t* weights);
+
+/**
+ * @brief Prepare a 3×3 layer for Winograd F(2×2, 3×3), proving exactness.
+ *
+ * @details Transforms every filter with the integer matrix G' = 2G, so
+ * U' = G' g G'ᵀ = 4·U holds only integers and the output transform yields
+ * exactly 4 × the direct-convolution accumulator. All intermediates are
+ * int64.
+ *
+ * Exactness is then proven for the given weights: assuming every input
+ * satisfies |x| ≤ input_bound, worst-case magnitudes of the input
+ * transform, of the channel sums of U' ⊙ V and of the output transform
+ * are computed and checked against INT64_MAX. If any could overflow,
+ * the layer is rejected with FX_CONV_INEXACT and the caller must use
+ * the direct or im2col algorithm.
+ *
+ * @param[out] plan Prepared layer
+ * @param[in] weights C_out × C_in × 3 × 3 filter tensor (either layout)
+ * @param[in] params Geometry: stride 1 and dilation 1 required; any padding
+ * @param[in] input_bound Max |raw input value|, FX_WINOGRAD_BOUND_ANY for any
+ * @param[out] u_storage Transformed filter storage
+ * @param[in] u_len Length of u_storage in int64_t elements
+ *
+ * @return FX_CONV_OK, FX_CONV_INVALID_PARAM, FX_CONV_UNSUPPORTED (not
+ *         3×3 / stride 1 / dilation 1), FX_CONV_WORKSPACE_TOO_SMALL or
+ *         FX_CONV_INEXACT
+ *
+ * @complexity O(C_out × C_in)
+ * @determinism Decision depends only on weights and input_bound
+ *
+ * @traceability SRS-006.12
+ */
+fx_conv_res_t fx_winograd_plan(fx_winograd_plan_t* plan, const fx_tensor_t* weights,
+                               const fx_conv_params_t* params, uint32_t input_bound,
+                               int64_t* u_storage, size_t u_len);
+
+/**
+ * @brief Prepare a Winograd layer from filters transformed offline.
+ *
+ * @details @p u holds C_out × C_in × 16 values of U' = G' g G'ᵀ in the
+ * order fx_winograd_plan() writes them, as produced by
+ * tools/pack_weights.py (layout "winograd_2x2_3x3", SRS-010.6). The
+ * filter transform is skipped. Each U' is checked to be the transform of
+ * a 3×3 fixed_t filter (g is recovered from it and transformed again)
+ * and the exactness proof still runs, so a plan from a file carries the
+ * same guarantee as one built at run time.
+ *
+ * @param[out] plan Prepared layer
+ * @param[in] u Transformed filters, used in place (e.g. inside a mapped
+ *              weight file)
+ * @param[in] cout Output channels
+ * @param[in] cin Input channels
+ * @param[in] params Geometry: stride 1 and dilation 1 required; any padding
+ * @param[in] input_bound Max |raw input value|, FX_WINOGRAD_BOUND_ANY for any
+ *
+ * @return FX_CONV_OK, FX_CONV_INVALID_PARAM (also for a U' that is not
+ *         the transform of any filter), FX_CONV_UNSUPPORTED or
+ *         FX_CONV_INEXACT
+ *
+ * @complexity O(C_out × C_in)
+ * @determinism Same plan as fx_winograd_plan() on the untransformed filters
+ *
+ * @traceability SRS-006.12, SRS-006.13
+ */
+fx_conv_res_t fx_winograd_plan_transformed(fx_winograd_plan_t* plan, const int64_t* u,
+                                           uint16_t cout, uint16_t cin,
+                                           const fx_conv_params_t* params, uint32_t input_bound);
+
+/**
+ * @brief Run a prepared Winograd F(2×2, 3×3) layer.
+ *
+ * @details Each 2×2 output tile takes 16 multiplies per (filter, channel)
+ * instead of the direct method's 36. The result is bit-identical to
+ * fx_conv2d_multi() with the plan's geometry: the output transform
+ * reproduces 4 × the direct accumulator exactly, which is shifted right
+ * by 2 and rounded once. The bias, if given, is added after rounding.
+ *
+ * The input is first checked against the plan's input bound; a violation
+ * returns FX_CONV_INEXACT with out untouched, so the exactness proof can
+ * never be silently invalidated.
+ *
+ * @param[in] plan Plan from fx_winograd_plan() (filters must be unchanged)
+ * @param[in] in N × C_in × H × W input tensor
+ * @param[in] bias C_out bias values, or NULL for none
+ * @param[out] out N × C_out × OH × OW output tensor
+ *
+ * @return FX_CONV_OK, FX_CONV_INVALID_PARAM, FX_CONV_DIM_MISMATCH or
+ *         FX_CONV_INEXACT
+ *
+ * @complexity O(N × C_out × C_in × ⌈OH/2⌉ × ⌈OW/2⌉ × 16)
+ * @determinism Bit-identical to the direct algorithm
+ *
+ * @note No dynamic memory allocation; working storage is bounded on the stack
+ *
+ * @traceability SRS-006.12
+ */
+fx_conv_res_t fx_conv2d_winograd(const fx_winograd_plan_t* plan, const fx_tensor_t* in,
+                                 const fixed_t* bias, fx_tensor_t* out);
+
 #endif /* CONVOLUTION_H */
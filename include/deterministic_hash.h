@@ -7,6 +7,13 @@
  * zero dynamic allocation, and bit-perfect reproducibility across platforms.
  * Designed for integration into safety-critical ML inference pipelines.
  *
+ * The table is open-addressed with a power-of-two capacity and Robin Hood
+ * linear probing. The caller's buffer holds two arrays: the 32-bit hashes
+ * of the slots (0 = empty), which a probe scans 16 to a cache line, and
+ * the key/value records, read only when a stored hash matches. No entry
+ * lies more than D_TABLE_MAX_PROBE slots past its home slot, so a lookup
+ * inspects at most D_TABLE_MAX_PROBE + 1 hashes.
+ *
  * @traceability SRS-001-DETERMINISM, SRS-002-BOUNDED-MEMORY
  * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
  *
@@ -23,27 +30,40 @@
 #include <stddef.h>
 #include <stdbool.h>
 
+/** Key storage per entry: up to 31 characters and the terminator */
+#define D_TABLE_KEY_LEN 32
+
+/** Longest distance of an entry from its home slot (SRS-001.11) */
+#define D_TABLE_MAX_PROBE 32
+
+/** Keys hashed and prefetched ahead of resolution by the batch calls */
+#define D_TABLE_BATCH 16
+
+/** Buffer bytes for @p capacity slots (a power of two), plus alignment slack */
+#define D_TABLE_BUFFER_SIZE(capacity) \
+    ((size_t)(capacity) * (sizeof(uint32_t) + sizeof(d_entry_t)) + sizeof(uint32_t))
+
 /**
  * @brief Error codes for table operations.
  */
 typedef enum {
     D_TABLE_OK = 0,              /**< Operation successful */
-    D_TABLE_FULL,                /**< Table at capacity */
+    D_TABLE_FULL,                /**< Table at capacity or probe bound reached */
     D_TABLE_KEY_EXISTS,          /**< Key already present */
     D_TABLE_NOT_FOUND,           /**< Key not found */
     D_TABLE_INVALID_PARAM        /**< Invalid parameter */
 } d_table_res_t;
 
 /**
- * @brief Entry structure.
+ * @brief Entry record (36 bytes).
  *
  * @note Fixed-size keys (32 bytes) ensure deterministic memory alignment
- *       and eliminate pointer-based string dependencies.
+ *       and eliminate pointer-based string dependencies. Occupancy is in
+ *       the table's hash array, not in the record.
  */
 typedef struct {
-    char key[32];                /**< Fixed-size key (31 chars + null) */
+    char key[D_TABLE_KEY_LEN];   /**< Fixed-size key (31 chars + null) */
     int32_t value;               /**< Integer value */
-    bool occupied;               /**< Occupied flag */
 } d_entry_t;
 
 /**
@@ -53,8 +73,10 @@ typedef struct {
  *       O(1) space complexity and predictable behavior.
  */
 typedef struct {
-    d_entry_t* entries;          /**< Pre-allocated entry array */
-    size_t capacity;             /**< Maximum entries */
+    uint32_t* hashes;            /**< Stored hash per slot, 0 = empty */
+    d_entry_t* entries;          /**< Record per slot */
+    size_t capacity;             /**< Slots (a power of two) */
+    size_t mask;                 /**< capacity − 1 */
     size_t count;                /**< Current entries */
     uint32_t (*hash_fn)(const char* key);  /**< Hash function pointer */
 } d_table_t;
@@ -64,6 +86,9 @@ typedef struct {
  *
  * @details Prepares table for use with provided memory pool. Zeroes all
  * memory to ensure deterministic initial state with no uninitialized data.
+ * The capacity is the largest power of two whose hash and record arrays
+ * fit in the buffer after aligning its start to 4 bytes; use
+ * D_TABLE_BUFFER_SIZE() to size a buffer for a given capacity.
  *
  * @param[out] table Pointer to table structure
  * @param[in] buffer Pointer to pre-allocated memory pool
@@ -71,7 +96,7 @@ typedef struct {
  *
  * @return D_TABLE_OK on success, error code otherwise
  *
- * @pre table and buffer are valid pointers, buffer_size > sizeof(d_entry_t)
+ * @pre table and buffer are valid pointers, buffer_size ≥ D_TABLE_BUFFER_SIZE(1)
  * @post Table initialized and ready for use, all entries zeroed
  *
  * @complexity O(n) where n = buffer_size / sizeof(d_entry_t)
@@ -84,21 +109,25 @@ d_table_res_t d_table_init(d_table_t* table, void* buffer, size_t buffer_size);
 /**
  * @brief Insert a key-value pair.
  *
- * @details Inserts entry using Jenkins hash and linear probing for collision
- * resolution. Both hash function and probing are deterministic, ensuring
+ * @details Inserts entry using Jenkins hash and Robin Hood linear probing:
+ * walking from the home slot, the new entry takes the place of the first
+ * entry that is closer to its own home, which then moves on in the same
+ * way. Both hash function and probing are deterministic, ensuring
  * bit-perfect behavior across platforms and runs.
  *
  * @param[in,out] table Pointer to table
  * @param[in] key Key string (max 31 chars, will be truncated)
  * @param[in] value Integer value to store
  *
- * @return D_TABLE_OK on success, error code otherwise
+ * @return D_TABLE_OK on success, D_TABLE_KEY_EXISTS, or D_TABLE_FULL if the
+ *         table is at capacity or an entry would be moved more than
+ *         D_TABLE_MAX_PROBE slots past its home (the table is unchanged)
  *
  * @pre table initialized, key is valid string
  * @post Key-value pair inserted or error returned, table count updated
  *
- * @complexity O(1) average case, O(n) worst case with full table
- * @determinism Collision resolution via linear probing is deterministic
+ * @complexity O(1) average case, O(D_TABLE_MAX_PROBE) worst case
+ * @determinism Collision resolution via Robin Hood probing is deterministic
  *
  * @traceability SRS-001-DETERMINISM
  */
@@ -107,8 +136,10 @@ d_table_res_t d_table_insert(d_table_t* table, const char* key, int32_t value);
 /**
  * @brief Retrieve a value by key.
  *
- * @details Looks up key using same Jenkins hash and linear probing as insert,
- * guaranteeing consistent lookup behavior.
+ * @details Looks up key using same Jenkins hash and probing as insert,
+ * guaranteeing consistent lookup behavior. Slots whose stored hash
+ * differs are rejected without touching their key; the probe stops at an
+ * empty slot or at an entry closer to its home than the probe is.
  *
  * @param[in] table Pointer to table
  * @param[in] key Key string to look up
@@ -119,13 +150,98 @@ d_table_res_t d_table_insert(d_table_t* table, const char* key, int32_t value);
  * @pre table initialized, key and out_value are valid pointers
  * @post Value retrieved if key exists, out_value unchanged otherwise
  *
- * @complexity O(1) average case, O(n) worst case
+ * @complexity O(1) average case, O(D_TABLE_MAX_PROBE) worst case
  * @determinism Always returns same result for same key
  *
  * @traceability SRS-001-DETERMINISM
  */
 d_table_res_t d_table_get(const d_table_t* table, const char* key, int32_t* out_value);
 
+/**
+ * @brief Replace the value of an existing key.
+ *
+ * @param[in,out] table Pointer to table
+ * @param[in] key Key string
+ * @param[in] value New value
+ *
+ * @return D_TABLE_OK, or D_TABLE_NOT_FOUND (table unchanged)
+ *
+ * @complexity O(D_TABLE_MAX_PROBE) worst case
+ *
+ * @traceability SRS-001.12
+ */
+d_table_res_t d_table_update(d_table_t* table, const char* key, int32_t value);
+
+/**
+ * @brief Remove a key without tombstones.
+ *
+ * @details Backward-shift deletion: the entries after the removed one
+ * move back one slot each, up to the first empty slot or entry already
+ * at its home. The freed slot is zeroed. Lookups never pass over deleted
+ * slots, so a long-running process can remove and re-insert entries
+ * without the table degrading or needing a rebuild.
+ *
+ * @param[in,out] table Pointer to table
+ * @param[in] key Key string
+ *
+ * @return D_TABLE_OK, or D_TABLE_NOT_FOUND (table unchanged)
+ *
+ * @complexity O(D_TABLE_MAX_PROBE) worst case
+ * @determinism The resulting memory state depends only on the sequence of operations
+ *
+ * @traceability SRS-001.12
+ */
+d_table_res_t d_table_remove(d_table_t* table, const char* key);
+
+/**
+ * @brief Look up @p n keys.
+ *
+ * @details Works through the keys in groups of D_TABLE_BATCH: all keys of
+ * a group are hashed and their home slots prefetched first, then each is
+ * resolved, so the cache misses of a group overlap instead of following
+ * one another. Results equal those of d_table_get() key by key.
+ *
+ * @param[in] table Pointer to table
+ * @param[in] keys Array of @p n key strings
+ * @param[in] n Number of keys
+ * @param[out] values Value per key; entries of missing keys are unchanged
+ * @param[out] results Result per key, or NULL
+ *
+ * @return D_TABLE_OK if every key was found, else the first failure
+ *         (D_TABLE_NOT_FOUND, or D_TABLE_INVALID_PARAM for a NULL key);
+ *         D_TABLE_INVALID_PARAM on NULL arguments
+ *
+ * @complexity O(n · D_TABLE_MAX_PROBE) worst case
+ *
+ * @traceability SRS-001.12
+ */
+d_table_res_t d_table_get_batch(const d_table_t* table, const char* const* keys, size_t n,
+                                int32_t* values, d_table_res_t* results);
+
+/**
+ * @brief Insert @p n key-value pairs.
+ *
+ * @details Hashes and prefetches in groups of D_TABLE_BATCH, then inserts
+ * in array order. The table ends in the same state as after n calls of
+ * d_table_insert() in that order, including duplicates within the batch.
+ *
+ * @param[in,out] table Pointer to table
+ * @param[in] keys Array of @p n key strings
+ * @param[in] values Array of @p n values
+ * @param[in] n Number of pairs
+ * @param[out] results Result per pair, or NULL
+ *
+ * @return D_TABLE_OK if every pair was inserted, else the first failure
+ *         (D_TABLE_KEY_EXISTS, D_TABLE_FULL, or D_TABLE_INVALID_PARAM for
+ *         a NULL key); D_TABLE_INVALID_PARAM on NULL arguments
+ *
+ * @complexity O(n · D_TABLE_MAX_PROBE) worst case
+ *
+ * @traceability SRS-001.12
+ */
+d_table_res_t d_table_insert_batch(d_table_t* table, const char* const* keys,
+                                   const int32_t* values, size_t n, d_table_res_t* results);
+
 /**
  * @brief Deterministic iteration over all entries.
  *
@@ -0,0 +1,133 @@
+/**
+ * @file dispatch.h
+ * @project Certifiable Inference Engine
+ * @brief Runtime selection of the kernel backend behind the public API.
+ *
+ * @details fx_matrix_mul(), fx_vector_dot(), fx_conv2d(), fx_relu(),
+ * fx_leaky_relu() and fx_maxpool_2x2() execute through a table of kernels
+ * chosen once per process. By default the best backend compiled into the
+ * library and supported by the running CPU (CPUID/XGETBV on x86-64,
+ * HWCAP on ARM) is selected, so one binary runs on AVX-512 servers and
+ * AVX2-only rigs alike.
+ *
+ * Every backend is bit-identical to the scalar reference (SRS-003.10), so
+ * the choice affects timing only. Certification runs can nevertheless pin
+ * the exact code path they validated with fx_dispatch_pin() and record it
+ * with fx_dispatch_active().
+ *
+ * @traceability SRS-003.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef DISPATCH_H
+#define DISPATCH_H
+
+#include <stdbool.h>
+
+/**
+ * @brief Kernel backends.
+ */
+typedef enum {
+    FX_BACKEND_AUTO = 0,         /**< Best available (pin only) */
+    FX_BACKEND_SCALAR,           /**< Portable C99 reference kernels */
+    FX_BACKEND_AVX2,             /**< x86-64 AVX2 */
+    FX_BACKEND_AVX512,           /**< x86-64 AVX-512F */
+    FX_BACKEND_NEON,             /**< ARMv7 / AArch64 NEON */
+    FX_BACKEND_COUNT             /**< Number of enumerators */
+} fx_backend_t;
+
+/**
+ * @brief Result codes for dispatch operations.
+ */
+typedef enum {
+    FX_DISPATCH_OK = 0,          /**< Backend active */
+    FX_DISPATCH_UNAVAILABLE,     /**< Not compiled in or not supported by CPU */
+    FX_DISPATCH_INVALID_PARAM    /**< Unknown backend value */
+} fx_dispatch_res_t;
+
+/**
+ * @brief Select the best available backend (idempotent).
+ *
+ * @details Probes the CPU once and activates the fastest backend that is
+ * both compiled in and supported. Subsequent calls return the active
+ * backend without probing again. A backend pinned with fx_dispatch_pin()
+ * is not overridden.
+ *
+ * Primitives call this lazily on first use, from any thread: the table
+ * is published atomically and the first selection wins. Calling it (or
+ * fx_dispatch_pin()) before starting workers keeps the probe off them.
+ *
+ * @return The active backend
+ *
+ * @post fx_dispatch_active() != FX_BACKEND_AUTO
+ *
+ * @complexity O(1)
+ * @determinism Output bits independent of the backend chosen
+ *
+ * @traceability SRS-003.11
+ */
+fx_backend_t fx_dispatch_init(void);
+
+/**
+ * @brief Pin a specific backend for all subsequent calls.
+ *
+ * @details FX_BACKEND_AUTO discards any pin and re-runs detection.
+ * On failure the active backend is left unchanged.
+ *
+ * @param[in] backend Backend to activate
+ *
+ * @return FX_DISPATCH_OK on success,
+ *         FX_DISPATCH_UNAVAILABLE if not compiled in or not supported,
+ *         FX_DISPATCH_INVALID_PARAM for an unknown value
+ *
+ * @note Safe while primitives run on other threads: each primitive sees
+ *       the old or the new table, never none. To compare backends
+ *       bit-for-bit, pin between runs rather than during one.
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-003.11
+ */
+fx_dispatch_res_t fx_dispatch_pin(fx_backend_t backend);
+
+/**
+ * @brief Report the backend currently executing the primitives.
+ *
+ * @return Active backend (FX_BACKEND_AUTO only before first use)
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-003.11
+ */
+fx_backend_t fx_dispatch_active(void);
+
+/**
+ * @brief Check whether a backend can be activated on this CPU.
+ *
+ * @param[in] backend Backend to query
+ *
+ * @return true if compiled in and supported by the running CPU
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-003.11
+ */
+bool fx_backend_available(fx_backend_t backend);
+
+/**
+ * @brief Human-readable backend name ("scalar", "avx2", ...).
+ *
+ * @param[in] backend Backend to name
+ *
+ * @return Static string, "unknown" for invalid values
+ *
+ * @complexity O(1)
+ */
+const char* fx_backend_name(fx_backend_t backend);
+
+#endif /* DISPATCH_H */
@@ -0,0 +1,122 @@
+/**
+ * @file elementwise.h
+ * @project Certifiable Inference Engine
+ * @brief Element-wise op engine: enumerated ops and op chains over buffers.
+ *
+ * @details An element-wise pass is described as data, not as a function
+ * pointer: a short array of fx_ew_op_t (scale, add, clamp, activation)
+ * applied left to right to every element. The engine dispatches on the op
+ * once per block rather than once per element, and each op runs as one
+ * tight loop from the active kernel table (SIMD where the backend has it,
+ * SRS-003.10), so a chain costs one L1-resident pass per op instead of
+ * one indirect call per element:
+ *
+ *   for each block of FX_EW_BLOCK elements:
+ *       for each op: run op over the block       (vector kernel)
+ *
+ * Every op is a pure function of one element, so blocking cannot change
+ * any result: fx_ew_apply() is bit-identical to fx_ew_apply_ref(), which
+ * applies the chain element by element with scalar code, on every
+ * backend. Counts are size_t throughout.
+ *
+ * A user callback (FX_EW_CALL) may appear anywhere in a chain; it is the
+ * slow path (one indirect call per element) and its determinism is the
+ * caller's responsibility. fx_matrix_apply() remains as the callback-only
+ * form.
+ *
+ * @traceability SRS-015
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef ELEMENTWISE_H
+#define ELEMENTWISE_H
+
+#include "matrix.h"
+#include "epilogue.h"
+#include <stddef.h>
+
+/** Elements per block of a multi-op chain (4 KB of Q16.16, L1-resident) */
+#define FX_EW_BLOCK 1024
+
+/**
+ * @brief Element-wise operation kind.
+ */
+typedef enum {
+    FX_EW_SCALE = 0,             /**< fixed_mul(x, a) */
+    FX_EW_ADD,                   /**< x + a, saturated to [FIXED_MIN, FIXED_MAX] */
+    FX_EW_CLAMP,                 /**< min(max(x, a), b), a ≤ b */
+    FX_EW_ACTIVATION,            /**< fx_activate(x, act, a) */
+    FX_EW_CALL                   /**< fn(x): user callback, scalar fallback */
+} fx_ew_kind_t;
+
+/**
+ * @brief One operation of a chain.
+ */
+typedef struct {
+    fx_ew_kind_t kind;           /**< Operation */
+    fixed_t a;                   /**< Scale, addend, lower bound or Leaky ReLU slope */
+    fixed_t b;                   /**< Upper bound (FX_EW_CLAMP) */
+    fx_activation_t act;         /**< Activation (FX_EW_ACTIVATION) */
+    fixed_t (*fn)(fixed_t);      /**< Callback (FX_EW_CALL) */
+} fx_ew_op_t;
+
+/** Initializers for fx_ew_op_t */
+#define FX_EW_OP_SCALE(k)         { FX_EW_SCALE, (k), 0, FX_ACT_NONE, NULL }
+#define FX_EW_OP_ADD(k)           { FX_EW_ADD, (k), 0, FX_ACT_NONE, NULL }
+#define FX_EW_OP_CLAMP(lo, hi)    { FX_EW_CLAMP, (lo), (hi), FX_ACT_NONE, NULL }
+#define FX_EW_OP_ACT(act, alpha)  { FX_EW_ACTIVATION, (alpha), 0, (act), NULL }
+#define FX_EW_OP_CALL(fn)         { FX_EW_CALL, 0, 0, FX_ACT_NONE, (fn) }
+
+/**
+ * @brief Result codes for element-wise operations.
+ */
+typedef enum {
+    FX_EW_OK = 0,                /**< Success */
+    FX_EW_INVALID_PARAM          /**< NULL pointer, unknown op, NULL callback or lo > hi */
+} fx_ew_res_t;
+
+/**
+ * @brief Apply a chain of ops to n elements: dst[i] = ops(src[i]).
+ *
+ * @param[in] src Input (may equal dst for in-place)
+ * @param[out] dst Output (must not partially overlap src)
+ * @param[in] n Number of elements
+ * @param[in] ops Operations, applied in order
+ * @param[in] count Number of operations (0: copy)
+ *
+ * @return FX_EW_OK, or FX_EW_INVALID_PARAM with dst untouched
+ *
+ * @complexity O(n × count)
+ * @determinism Bit-identical to fx_ew_apply_ref() on every backend
+ *
+ * @traceability SRS-015.1, SRS-015.2, SRS-015.3
+ */
+fx_ew_res_t fx_ew_apply(const fixed_t* src, fixed_t* dst, size_t n,
+                        const fx_ew_op_t* ops, size_t count);
+
+/**
+ * @brief Reference: the chain applied element by element in scalar code.
+ *
+ * @details Defines the semantics of every op; retained as the
+ * verification oracle for fx_ew_apply().
+ *
+ * @traceability SRS-015.1, SRS-003.10
+ */
+fx_ew_res_t fx_ew_apply_ref(const fixed_t* src, fixed_t* dst, size_t n,
+                            const fx_ew_op_t* ops, size_t count);
+
+/**
+ * @brief Apply a chain of ops to every element of a matrix, in place.
+ *
+ * @return As fx_ew_apply()
+ *
+ * @traceability SRS-015.1
+ */
+fx_ew_res_t fx_matrix_apply_ops(fx_matrix_t* mat, const fx_ew_op_t* ops, size_t count);
+
+#endif /* ELEMENTWISE_H */
@@ -0,0 +1,81 @@
+/**
+ * @file epilogue.h
+ * @project Certifiable Inference Engine
+ * @brief Output stage (bias + activation) shared by the fused layer kernels.
+ *
+ * @details Fused kernels round each 64-bit accumulator once, then apply
+ * the epilogue to the value while it is still in a register, before the
+ * single store. The operations are exactly those of the separate passes
+ * they replace, in the same order:
+ *
+ *   v = round(acc)                   fx_matrix_mul() / fx_conv2d_multi()
+ *   v = fixed_add(v, bias)           fx_matrix_add_bias()
+ *   v = activation(v)                fx_relu() / fx_leaky_relu() / fx_sigmoid() …
+ *
+ * so a fused call is bit-identical to the unfused sequence.
+ *
+ * @traceability SRS-004.9, SRS-004.10
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef EPILOGUE_H
+#define EPILOGUE_H
+
+#include "fixed_point.h"
+#include "lut.h"
+
+/**
+ * @brief Activation applied by a fused epilogue.
+ */
+typedef enum {
+    FX_ACT_NONE = 0,             /**< Identity */
+    FX_ACT_RELU,                 /**< max(0, x), as fx_relu() */
+    FX_ACT_LEAKY_RELU,           /**< x < 0 ? fixed_mul(x, alpha) : x, as fx_leaky_relu() */
+    FX_ACT_SIGMOID,              /**< fixed_sigmoid(), as fx_sigmoid() */
+    FX_ACT_TANH,                 /**< fixed_tanh(), as fx_tanh() */
+    FX_ACT_GELU                  /**< fixed_gelu(), as fx_gelu() */
+} fx_activation_t;
+
+/**
+ * @brief Apply an activation to one value.
+ *
+ * @param[in] v Rounded (and biased) value
+ * @param[in] act Activation
+ * @param[in] alpha Leaky ReLU slope (ignored otherwise)
+ *
+ * @return Activated value
+ *
+ * @complexity O(1)
+ * @determinism Bit-identical to the in-place activation functions
+ *
+ * @traceability SRS-004.2, SRS-004.4, SRS-004.9, SRS-004.10
+ */
+static inline fixed_t fx_activate(fixed_t v, fx_activation_t act, fixed_t alpha) {
+    switch (act) {
+    case FX_ACT_SIGMOID:
+        return fixed_sigmoid(v);
+    case FX_ACT_TANH:
+        return fixed_tanh(v);
+    case FX_ACT_GELU:
+        return fixed_gelu(v);
+    default:
+        break;
+    }
+
+    if (v < 0) {
+        if (act == FX_ACT_RELU) {
+            return FIXED_ZERO;
+        }
+        if (act == FX_ACT_LEAKY_RELU) {
+            return fixed_mul(v, alpha);
+        }
+    }
+    return v;
+}
+
+#endif /* EPILOGUE_H */
@@ -0,0 +1,471 @@
+/**
+ * @file graph.h
+ * @project Certifiable Inference Engine
+ * @brief Static model graph and execution plan with arena buffer reuse.
+ *
+ * @details A model is declared once as a sequence of layer operations on
+ * tensor ids. fx_graph_plan() then computes each intermediate tensor's
+ * lifetime (the op that produces it to the last op that reads it) and packs
+ * all intermediates, plus per-op scratch, into one caller-provided arena,
+ * so buffers whose lifetimes do not overlap share memory. The peak arena
+ * size is known once the plan is built, before any inference runs, and
+ * can be reported or checked against a linker-placed buffer.
+ *
+ * Graph inputs and outputs live in caller buffers bound with
+ * fx_graph_bind(); only intermediates occupy the arena. A sensor input
+ * declared with fx_graph_input_staged() is converted from its frame
+ * format (input.h) by the first op, straight into the arena, and each
+ * new frame is bound with fx_graph_bind_frame().
+ *
+ * Typical usage:
+ * ```c
+ * static fx_graph_t g;
+ * fx_tensor_id_t x, h, y;
+ * fx_graph_stats_t st;
+ *
+ * fx_graph_init(&g);
+ * fx_graph_input(&g, 1, 3, 32, 32, FX_LAYOUT_NCHW, &x);
+ * fx_graph_conv2d(&g, x, &w1, b1, &p, &relu_pool, &h);
+ * fx_graph_dense(&g, h, &w2, &b2, FX_ACT_NONE, 0, &y);
+ * fx_graph_output(&g, y);
+ * fx_graph_plan(&g, &st);                  // st.arena_len: peak arena
+ *
+ * fx_graph_bind(&g, x, image);
+ * fx_graph_bind(&g, y, logits);
+ * fx_graph_run(&g, arena, arena_len);
+ * ```
+ *
+ * @traceability SRS-009-GRAPH
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include "convolution.h"
+#include "pooling.h"
+#include "input.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/** Maximum tensors (inputs, intermediates, outputs) per graph */
+#define FX_GRAPH_MAX_TENSORS 64
+
+/** Maximum operations per graph */
+#define FX_GRAPH_MAX_OPS 32
+
+/** Arena offset alignment in fixed_t elements (16 bytes) */
+#define FX_GRAPH_ALIGN 4
+
+/**
+ * @brief Tensor handle within a graph.
+ */
+typedef uint16_t fx_tensor_id_t;
+
+/**
+ * @brief Result codes for graph operations.
+ */
+typedef enum {
+    FX_GRAPH_OK = 0,             /**< Success */
+    FX_GRAPH_INVALID_PARAM,      /**< NULL pointer, unknown id or bad value */
+    FX_GRAPH_FULL,               /**< FX_GRAPH_MAX_TENSORS / _OPS exceeded */
+    FX_GRAPH_DIM_MISMATCH,       /**< Layer shape incompatible with its input */
+    FX_GRAPH_UNSUPPORTED,        /**< Layer configuration not supported */
+    FX_GRAPH_NOT_PLANNED,        /**< fx_graph_plan() not run since last change */
+    FX_GRAPH_UNBOUND,            /**< Input, output or staged frame not bound */
+    FX_GRAPH_ARENA_TOO_SMALL     /**< Arena shorter than the planned peak */
+} fx_graph_res_t;
+
+/**
+ * @brief Role of a tensor in the graph.
+ */
+typedef enum {
+    FX_GRAPH_TENSOR_INPUT = 0,   /**< Caller buffer, read only */
+    FX_GRAPH_TENSOR_INTERMEDIATE,/**< Arena resident */
+    FX_GRAPH_TENSOR_OUTPUT       /**< Caller buffer, written by its producer */
+} fx_graph_tensor_kind_t;
+
+/**
+ * @brief Layer operation types.
+ */
+typedef enum {
+    FX_GRAPH_OP_CONV2D = 0,      /**< fx_conv2d_fused() / fx_conv2d_layer() */
+    FX_GRAPH_OP_DENSE,           /**< fx_matrix_mul_fused() */
+    FX_GRAPH_OP_MAXPOOL_2X2,     /**< fx_maxpool_2x2() per plane */
+    FX_GRAPH_OP_ACTIVATION,      /**< Elementwise activation */
+    FX_GRAPH_OP_POOL2D,          /**< fx_pool2d() */
+    FX_GRAPH_OP_GLOBAL_AVGPOOL,  /**< fx_global_avgpool() */
+    FX_GRAPH_OP_INPUT_CONVERT    /**< fx_input_convert() of the bound frame */
+} fx_graph_op_type_t;
+
+/**
+ * @brief Tensor record (shape, role and planned placement).
+ */
+typedef struct {
+    uint16_t n, c, h, w;         /**< Shape */
+    fx_layout_t layout;          /**< Memory layout */
+    fx_graph_tensor_kind_t kind; /**< Role */
+    fixed_t* data;               /**< Bound buffer (inputs / outputs) */
+    uint16_t def;                /**< Producing op (inputs: 0) */
+    uint16_t last;               /**< Last reading op */
+    fx_tensor_id_t root;         /**< Arena owner when computed in place */
+    size_t offset;               /**< Arena offset (planned intermediates) */
+} fx_graph_tensor_t;
+
+/**
+ * @brief Operation record. Weight descriptors are copied; the weight
+ *        data they point to must outlive the graph.
+ */
+typedef struct {
+    fx_graph_op_type_t type;     /**< Operation */
+    fx_tensor_id_t in;           /**< Input tensor */
+    fx_tensor_id_t out;          /**< Output tensor */
+    fx_tensor_t conv_w;          /**< CONV2D: filters */
+    fx_conv_params_t conv;       /**< CONV2D: geometry and algorithm */
+    fx_conv_epilogue_t epi;      /**< CONV2D: fused output stage */
+    fx_matrix_t dense_w;         /**< DENSE: K × N weights */
+    fx_matrix_t dense_b;         /**< DENSE: 1 × N bias */
+    const fixed_t* bias;         /**< CONV2D / DENSE bias data, or NULL */
+    fx_pool2d_params_t pool;     /**< POOL2D: window, stride and reduction */
+    fx_activation_t act;         /**< DENSE / ACTIVATION */
+    fixed_t alpha;               /**< Leaky ReLU slope */
+    const fx_input_desc_t* input;/**< INPUT_CONVERT: frame descriptor (caller owned) */
+    const void* frame;           /**< INPUT_CONVERT: bound frame, or NULL */
+    size_t scratch_len;          /**< Scratch elements (live during this op only) */
+    size_t scratch_offset;       /**< Planned scratch offset */
+} fx_graph_op_t;
+
+/**
+ * @brief Model graph with its execution plan.
+ *
+ * @note Fixed capacity, no dynamic allocation. About 10 KB on 64-bit
+ *       hosts; declare static on small targets.
+ */
+typedef struct {
+    fx_graph_tensor_t tensors[FX_GRAPH_MAX_TENSORS];
+    fx_graph_op_t ops[FX_GRAPH_MAX_OPS];
+    uint16_t tensor_count;
+    uint16_t op_count;
+    size_t arena_len;            /**< Planned peak (valid when planned) */
+    bool planned;                /**< Plan matches the current graph */
+} fx_graph_t;
+
+/**
+ * @brief Memory report produced by fx_graph_plan().
+ */
+typedef struct {
+    size_t arena_len;            /**< Peak arena, fixed_t elements */
+    size_t unshared_len;         /**< Sum of all buffers without reuse */
+    size_t largest_len;          /**< Largest single buffer (lower bound) */
+    uint16_t buffers;            /**< Arena buffers after in-place merging */
+} fx_graph_stats_t;
+
+/**
+ * @brief Initialize an empty graph.
+ *
+ * @param[out] g Graph to initialize
+ *
+ * @return FX_GRAPH_OK or FX_GRAPH_INVALID_PARAM
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-009.1
+ */
+fx_graph_res_t fx_graph_init(fx_graph_t* g);
+
+/**
+ * @brief Declare a graph input.
+ *
+ * @param[in,out] g Graph
+ * @param[in] n Batch size
+ * @param[in] c Channels
+ * @param[in] h Height
+ * @param[in] w Width
+ * @param[in] layout Memory layout
+ * @param[out] id Handle of the new tensor
+ *
+ * @return FX_GRAPH_OK, FX_GRAPH_INVALID_PARAM or FX_GRAPH_FULL
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-009.1
+ */
+fx_graph_res_t fx_graph_input(fx_graph_t* g, uint16_t n, uint16_t c, uint16_t h, uint16_t w,
+                              fx_layout_t layout, fx_tensor_id_t* id);
+
+/**
+ * @brief Declare a sensor input converted inside the graph.
+ *
+ * @details Adds an op that converts the bound frame with
+ * fx_input_convert() into an arena-planned tensor of shape
+ * (1, channels, height, width) in @p layout. Layers read that tensor as
+ * they would a graph input; the conversion runs first, in the same pass
+ * over the arena, so no separate staging copy is needed. Dense,
+ * aligned Q16.16 frames need no conversion: declare them with
+ * fx_graph_input() and bind fx_input_view()'s data instead.
+ *
+ * @param[in,out] g Graph
+ * @param[in] desc Frame descriptor (must outlive the graph)
+ * @param[in] layout Layout of the converted tensor
+ * @param[out] id Handle of the converted tensor
+ *
+ * @return FX_GRAPH_OK, FX_GRAPH_INVALID_PARAM (including a descriptor
+ *         rejected by fx_input_desc_check()) or FX_GRAPH_FULL
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-018.6, SRS-009.1
+ */
+fx_graph_res_t fx_graph_input_staged(fx_graph_t* g, const fx_input_desc_t* desc,
+                                     fx_layout_t layout, fx_tensor_id_t* id);
+
+/**
+ * @brief Append a convolution layer.
+ *
+ * @details The output has the input's layout and the shape of
+ * fx_conv2d_fused() (halved by epi->maxpool_2x2). FX_CONV_ALGO_IM2COL is
+ * honoured when nothing is pooled; its workspace becomes op scratch in
+ * the arena. Other cases run the fused direct kernel.
+ *
+ * @param[in,out] g Graph
+ * @param[in] in Input tensor
+ * @param[in] weights Filter tensor (descriptor copied)
+ * @param[in] bias C_out bias values, or NULL
+ * @param[in] params Geometry and algorithm
+ * @param[in] epi Fused output stage, or NULL for none
+ * @param[out] out Handle of the output tensor
+ *
+ * @return FX_GRAPH_OK, FX_GRAPH_INVALID_PARAM, FX_GRAPH_FULL or
+ *         FX_GRAPH_DIM_MISMATCH
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-009.1, SRS-004.9, SRS-006.11
+ */
+fx_graph_res_t fx_graph_conv2d(fx_graph_t* g, fx_tensor_id_t in, const fx_tensor_t* weights,
+                               const fixed_t* bias, const fx_conv_params_t* params,
+                               const fx_conv_epilogue_t* epi, fx_tensor_id_t* out);
+
+/**
+ * @brief Append a dense layer: out = act(in × W + bias).
+ *
+ * @details The input is read as n rows of c × h × w values in memory
+ * order; the output has shape (n, N, 1, 1). The n samples form the rows
+ * of a single GEMM, so each packed weight panel is loaded once per
+ * block of 64 samples rather than once per sample.
+ *
+ * @param[in,out] g Graph
+ * @param[in] in Input tensor
+ * @param[in] weights K × N weight matrix, K = c × h × w (descriptor copied)
+ * @param[in] bias 1 × N bias, or NULL
+ * @param[in] act Activation
+ * @param[in] alpha Leaky ReLU slope
+ * @param[out] out Handle of the output tensor
+ *
+ * @return FX_GRAPH_OK, FX_GRAPH_INVALID_PARAM, FX_GRAPH_FULL or
+ *         FX_GRAPH_DIM_MISMATCH
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-009.1, SRS-004.9
+ */
+fx_graph_res_t fx_graph_dense(fx_graph_t* g, fx_tensor_id_t in, const fx_matrix_t* weights,
+                              const fx_matrix_t* bias, fx_activation_t act, fixed_t alpha,
+                              fx_tensor_id_t* out);
+
+/**
+ * @brief Append a 2×2 / stride-2 max pooling layer.
+ *
+ * @param[in,out] g Graph
+ * @param[in] in Input tensor (NCHW, even height and width)
+ * @param[out] out Handle of the output tensor
+ *
+ * @return FX_GRAPH_OK, FX_GRAPH_INVALID_PARAM, FX_GRAPH_FULL,
+ *         FX_GRAPH_DIM_MISMATCH or FX_GRAPH_UNSUPPORTED (NHWC; fuse the
+ *         pooling into the convolution instead)
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-009.1, SRS-008.1
+ */
+fx_graph_res_t fx_graph_maxpool_2x2(fx_graph_t* g, fx_tensor_id_t in, fx_tensor_id_t* out);
+
+/**
+ * @brief Append a k×k strided max or average pooling layer.
+ *
+ * @details The output keeps the input's layout; its extents follow
+ * fx_pool2d_out_dim(). The max-pool row pass becomes op scratch in the
+ * arena.
+ *
+ * @param[in,out] g Graph
+ * @param[in] in Input tensor
+ * @param[in] params Window, stride, padding and reduction (copied)
+ * @param[out] out Handle of the output tensor
+ *
+ * @return FX_GRAPH_OK, FX_GRAPH_INVALID_PARAM, FX_GRAPH_FULL or
+ *         FX_GRAPH_DIM_MISMATCH
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-009.1, SRS-008.9
+ */
+fx_graph_res_t fx_graph_pool2d(fx_graph_t* g, fx_tensor_id_t in, const fx_pool2d_params_t* params,
+                               fx_tensor_id_t* out);
+
+/**
+ * @brief Append global average pooling.
+ *
+ * @details The output has shape (n, c, 1, 1), which fx_graph_dense()
+ * reads as n rows of c features.
+ *
+ * @param[in,out] g Graph
+ * @param[in] in Input tensor
+ * @param[out] out Handle of the output tensor
+ *
+ * @return FX_GRAPH_OK, FX_GRAPH_INVALID_PARAM or FX_GRAPH_FULL
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-009.1, SRS-008.12
+ */
+fx_graph_res_t fx_graph_global_avgpool(fx_graph_t* g, fx_tensor_id_t in, fx_tensor_id_t* out);
+
+/**
+ * @brief Append an elementwise activation.
+ *
+ * @details When the input is an intermediate read by no later op, the
+ * planner computes the activation in place in the input's arena buffer.
+ *
+ * @param[in,out] g Graph
+ * @param[in] in Input tensor
+ * @param[in] act Activation
+ * @param[in] alpha Leaky ReLU slope
+ * @param[out] out Handle of the output tensor
+ *
+ * @return FX_GRAPH_OK, FX_GRAPH_INVALID_PARAM or FX_GRAPH_FULL
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-009.1, SRS-009.3
+ */
+fx_graph_res_t fx_graph_activation(fx_graph_t* g, fx_tensor_id_t in, fx_activation_t act,
+                                   fixed_t alpha, fx_tensor_id_t* out);
+
+/**
+ * @brief Mark a layer output as a graph output (caller buffer).
+ *
+ * @param[in,out] g Graph
+ * @param[in] id Tensor produced by an op
+ *
+ * @return FX_GRAPH_OK or FX_GRAPH_INVALID_PARAM (graph inputs cannot
+ *         be outputs)
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-009.1
+ */
+fx_graph_res_t fx_graph_output(fx_graph_t* g, fx_tensor_id_t id);
+
+/**
+ * @brief Compute lifetimes and pack all intermediates into one arena.
+ *
+ * @details Buffers are placed largest first, ties broken by id, each at
+ * the lowest aligned offset that does not overlap a placed buffer whose
+ * lifetime intersects its own. The plan is a pure function of the graph:
+ * the same declarations always give the same offsets.
+ *
+ * @param[in,out] g Graph
+ * @param[out] stats Memory report (may be NULL)
+ *
+ * @return FX_GRAPH_OK or FX_GRAPH_INVALID_PARAM
+ *
+ * @post g->arena_len holds the peak arena size in fixed_t elements
+ *
+ * @complexity O(B³) for B arena buffers (B ≤ tensors + ops)
+ * @determinism Offsets depend only on the graph declaration
+ *
+ * @traceability SRS-009.2, SRS-009.3, SRS-009.4
+ */
+fx_graph_res_t fx_graph_plan(fx_graph_t* g, fx_graph_stats_t* stats);
+
+/**
+ * @brief Bind a caller buffer to a graph input or output.
+ *
+ * @param[in,out] g Graph
+ * @param[in] id Input or output tensor
+ * @param[in] data Buffer of n × c × h × w elements
+ *
+ * @return FX_GRAPH_OK or FX_GRAPH_INVALID_PARAM
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-009.1
+ */
+fx_graph_res_t fx_graph_bind(fx_graph_t* g, fx_tensor_id_t id, fixed_t* data);
+
+/**
+ * @brief Bind the frame a staged input converts on the next run.
+ *
+ * @details The binding is a pointer only; it can be replaced for every
+ * frame (e.g. with fx_input_peek()) without replanning.
+ *
+ * @param[in,out] g Graph
+ * @param[in] id Tensor returned by fx_graph_input_staged()
+ * @param[in] frame Frame buffer satisfying fx_input_check()
+ *
+ * @return FX_GRAPH_OK or FX_GRAPH_INVALID_PARAM (other tensor, NULL or
+ *         misaligned frame)
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-018.6
+ */
+fx_graph_res_t fx_graph_bind_frame(fx_graph_t* g, fx_tensor_id_t id, const void* frame);
+
+/**
+ * @brief Run every op of a planned graph in declaration order.
+ *
+ * @param[in] g Planned graph with inputs, outputs and frames bound
+ * @param[in,out] arena Intermediate storage (at least g->arena_len elements)
+ * @param[in] arena_len Arena length in fixed_t elements
+ *
+ * @return FX_GRAPH_OK, FX_GRAPH_INVALID_PARAM, FX_GRAPH_NOT_PLANNED,
+ *         FX_GRAPH_UNBOUND or FX_GRAPH_ARENA_TOO_SMALL
+ *
+ * @pre arena does not alias bound buffers or weights
+ *
+ * @complexity Sum of the layer complexities
+ * @determinism Bit-identical to calling the layer functions in sequence
+ *
+ * @traceability SRS-009.5
+ */
+fx_graph_res_t fx_graph_run(const fx_graph_t* g, fixed_t* arena, size_t arena_len);
+
+/**
+ * @brief View a planned tensor as an fx_tensor_t for a given arena.
+ *
+ * @details Resolves intermediates to their arena placement and inputs /
+ * outputs to their bound buffers, e.g. to inspect a hidden activation.
+ *
+ * @param[in] g Planned graph
+ * @param[in] id Tensor
+ * @param[in] arena Arena passed to fx_graph_run()
+ * @param[out] view Tensor view
+ *
+ * @return FX_GRAPH_OK, FX_GRAPH_INVALID_PARAM, FX_GRAPH_NOT_PLANNED or
+ *         FX_GRAPH_UNBOUND
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-009.2
+ */
+fx_graph_res_t fx_graph_tensor(const fx_graph_t* g, fx_tensor_id_t id, fixed_t* arena,
+                               fx_tensor_t* view);
+
+#endif /* GRAPH_H */
@@ -0,0 +1,302 @@
+/**
+ * @file input.h
+ * @project Certifiable Inference Engine
+ * @brief Sensor frame staging: alignment and stride contract, buffer
+ *        rotation and fused conversion to Q16.16.
+ *
+ * @details A camera or DMA driver writes frames into buffers it owns. An
+ * fx_input_desc_t states what those buffers hold: element format (Q16.16,
+ * uint8 or IEEE-754 binary32), channel layout (interleaved NHWC or planar
+ * NCHW), extents, byte strides, and an optional per-channel scale and bias
+ * (e.g. mean / std normalisation). Every frame must start on a
+ * FX_INPUT_ALIGN-byte boundary; strides are validated once, when the
+ * descriptor is checked, not per frame.
+ *
+ * Frames reach the model without an intermediate copy:
+ * - A dense, aligned Q16.16 frame with identity normalisation is used in
+ *   place: fx_input_view() turns it into a tensor for fx_graph_bind().
+ * - Any other frame is converted by fx_input_convert(), which reads the
+ *   frame once and writes fixed-point values directly into the
+ *   destination tensor. Widening, scaling, bias and saturation are one
+ *   vector pass per FX_INPUT_BLOCK-element block (SRS-003.10).
+ *   fx_graph_input_staged() makes this conversion the first op of a
+ *   graph, writing into the arena.
+ *
+ * fx_input_ring_t rotates 1 … FX_INPUT_MAX_BUFFERS preregistered buffers
+ * (double / triple buffering) between the driver and the inference loop
+ * with the single-producer / single-consumer protocol of fx_ring_t:
+ *
+ * ```c
+ * void* f = fx_input_acquire(&ring);        // driver: NULL when all busy
+ * start_dma(f); ... fx_input_commit(&ring); // on DMA completion
+ *
+ * const void* frame = fx_input_peek(&ring); // inference: NULL when empty
+ * fx_graph_bind_frame(&g, x, frame);
+ * fx_graph_run(&g, arena, arena_len);
+ * fx_input_release(&ring);                  // buffer back to the driver
+ * ```
+ *
+ * Conversion uses integer arithmetic only (binary32 is decoded from its
+ * bit pattern), so it is bit-identical on every backend and needs no FPU.
+ *
+ * @traceability SRS-018
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef INPUT_H
+#define INPUT_H
+
+#include "tensor.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/** Required frame alignment in bytes (cache line, widest vector load) */
+#define FX_INPUT_ALIGN 64
+
+/** Maximum channels per frame (grey, RGB, RGBA) */
+#define FX_INPUT_MAX_CHANNELS 4
+
+/** Maximum buffers in an fx_input_ring_t */
+#define FX_INPUT_MAX_BUFFERS 4
+
+/** Elements per conversion block (multiple of 1 … 4 channels and 16 lanes) */
+#define FX_INPUT_BLOCK 480
+
+/** Largest |scale| for uint8 frames: 255 × scale stays within int32 */
+#define FX_INPUT_U8_SCALE_MAX ((1 << 23) - 1)
+
+/**
+ * @brief Element format of a frame.
+ */
+typedef enum {
+    FX_INPUT_Q16 = 0,            /**< fixed_t, Q16.16 */
+    FX_INPUT_U8,                 /**< uint8_t, raw sensor counts */
+    FX_INPUT_F32                 /**< IEEE-754 binary32, native byte order */
+} fx_input_format_t;
+
+/**
+ * @brief Result codes for input staging.
+ */
+typedef enum {
+    FX_INPUT_OK = 0,             /**< Success */
+    FX_INPUT_INVALID_PARAM,      /**< NULL pointer, bad format, extent, stride or scale */
+    FX_INPUT_MISALIGNED,         /**< Frame not on a FX_INPUT_ALIGN-byte boundary */
+    FX_INPUT_DIM_MISMATCH,       /**< Destination tensor shape differs from the frame */
+    FX_INPUT_UNSUPPORTED         /**< fx_input_view(): frame needs conversion */
+} fx_input_res_t;
+
+/**
+ * @brief Frame descriptor.
+ *
+ * @details Element (c, y, x) of a frame is at byte offset
+ * - NHWC: y × row_stride + (x × channels + c) × element size
+ * - NCHW: c × plane_stride + y × row_stride + x × element size
+ *
+ * Conversion computes, per channel c:
+ * - FX_INPUT_U8:  v × scale[c] + bias[c], saturated (v the raw count)
+ * - FX_INPUT_F32 / FX_INPUT_Q16: fixed_mul(v, scale[c]) + bias[c],
+ *   rounded once and saturated (v the value in Q16.16)
+ */
+typedef struct {
+    fx_input_format_t format;    /**< Element format */
+    fx_layout_t layout;          /**< FX_LAYOUT_NHWC interleaved or FX_LAYOUT_NCHW planar */
+    uint16_t channels;           /**< 1 … FX_INPUT_MAX_CHANNELS */
+    uint16_t height;             /**< Rows */
+    uint16_t width;              /**< Pixels per row */
+    size_t row_stride;           /**< Bytes from one row to the next */
+    size_t plane_stride;         /**< Bytes from one channel plane to the next (NCHW) */
+    fixed_t scale[FX_INPUT_MAX_CHANNELS]; /**< Per-channel scale (Q16.16) */
+    fixed_t bias[FX_INPUT_MAX_CHANNELS];  /**< Per-channel bias (Q16.16) */
+} fx_input_desc_t;
+
+/**
+ * @brief Rotation of preregistered frame buffers.
+ *
+ * @details head counts committed frames and is written by the producer
+ * only; tail counts released frames and is written by the consumer only,
+ * as in fx_ring_t. Both run modulo 2 × count, so rotation order is kept
+ * across counter wrap for any count.
+ */
+typedef struct {
+    void* buffers[FX_INPUT_MAX_BUFFERS]; /**< Caller frame buffers, in rotation order */
+    uint32_t count;              /**< Buffers, 1 … FX_INPUT_MAX_BUFFERS */
+    uint32_t head;               /**< Producer counter (atomic) */
+    uint32_t tail;               /**< Consumer counter (atomic) */
+} fx_input_ring_t;
+
+/**
+ * @brief Fill a descriptor with dense strides and identity normalisation.
+ *
+ * @param[out] desc Descriptor
+ * @param[in] format Element format
+ * @param[in] layout FX_LAYOUT_NHWC or FX_LAYOUT_NCHW
+ * @param[in] channels Channels (1 … FX_INPUT_MAX_CHANNELS)
+ * @param[in] height Rows
+ * @param[in] width Pixels per row
+ * @param[in] row_stride Bytes per row, or 0 for packed rows; the plane
+ *            stride is row_stride × height
+ *
+ * @return As fx_input_desc_check()
+ *
+ * @note scale[] is FIXED_ONE and bias[] zero: U8 values become whole
+ *       numbers 0 … 255, F32 values keep their magnitude.
+ *
+ * @traceability SRS-018.1
+ */
+fx_input_res_t fx_input_desc_init(fx_input_desc_t* desc, fx_input_format_t format,
+                                  fx_layout_t layout, uint16_t channels,
+                                  uint16_t height, uint16_t width, size_t row_stride);
+
+/**
+ * @brief Validate a descriptor.
+ *
+ * @details Strides must be multiples of the element size and must not
+ * make rows or planes overlap; uint8 scales must satisfy
+ * |scale| ≤ FX_INPUT_U8_SCALE_MAX.
+ *
+ * @return FX_INPUT_OK or FX_INPUT_INVALID_PARAM
+ *
+ * @complexity O(channels)
+ *
+ * @traceability SRS-018.1
+ */
+fx_input_res_t fx_input_desc_check(const fx_input_desc_t* desc);
+
+/**
+ * @brief Validate a descriptor and a frame address.
+ *
+ * @return FX_INPUT_OK, FX_INPUT_INVALID_PARAM or FX_INPUT_MISALIGNED
+ *
+ * @traceability SRS-018.1
+ */
+fx_input_res_t fx_input_check(const fx_input_desc_t* desc, const void* frame);
+
+/**
+ * @brief Bytes a frame spans, from its first to one past its last element.
+ *
+ * @return Span in bytes, or 0 if the descriptor is invalid
+ *
+ * @traceability SRS-018.1
+ */
+size_t fx_input_frame_bytes(const fx_input_desc_t* desc);
+
+/**
+ * @brief Use a Q16.16 frame in place, without conversion.
+ *
+ * @details Succeeds when the frame is FX_INPUT_Q16, aligned, densely
+ * packed and has identity normalisation; the view (n = 1) aliases the
+ * frame buffer.
+ *
+ * @param[in] desc Descriptor
+ * @param[in] frame Frame buffer
+ * @param[out] view Tensor over the frame
+ *
+ * @return FX_INPUT_OK, FX_INPUT_INVALID_PARAM, FX_INPUT_MISALIGNED or
+ *         FX_INPUT_UNSUPPORTED (use fx_input_convert())
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-018.2
+ */
+fx_input_res_t fx_input_view(const fx_input_desc_t* desc, void* frame, fx_tensor_t* view);
+
+/**
+ * @brief Convert a frame to Q16.16 in the destination tensor's layout.
+ *
+ * @details Runs block by block: each block is converted and normalised
+ * by the active backend's kernels and written straight to the tensor
+ * when the layouts agree; otherwise it is converted into an L1-resident
+ * buffer and scattered.
+ *
+ * @param[in] desc Descriptor
+ * @param[in] frame Frame buffer
+ * @param[out] dst Tensor of shape (1, channels, height, width), any layout
+ *
+ * @return FX_INPUT_OK, FX_INPUT_INVALID_PARAM, FX_INPUT_MISALIGNED or
+ *         FX_INPUT_DIM_MISMATCH, with dst untouched on error
+ *
+ * @complexity O(channels × height × width)
+ * @determinism Bit-identical to fx_input_convert_ref() on every backend
+ *
+ * @traceability SRS-018.3, SRS-018.4
+ */
+fx_input_res_t fx_input_convert(const fx_input_desc_t* desc, const void* frame,
+                                fx_tensor_t* dst);
+
+/**
+ * @brief Reference: element-by-element scalar conversion.
+ *
+ * @details Defines the conversion of every format; retained as the
+ * verification oracle for fx_input_convert().
+ *
+ * @traceability SRS-018.3, SRS-003.10
+ */
+fx_input_res_t fx_input_convert_ref(const fx_input_desc_t* desc, const void* frame,
+                                    fx_tensor_t* dst);
+
+/**
+ * @brief Register frame buffers for rotation.
+ *
+ * @param[out] ring Ring to initialize (empty)
+ * @param[in] desc Descriptor every buffer must satisfy
+ * @param[in] buffers count buffers of at least fx_input_frame_bytes(desc)
+ * @param[in] count Buffers (1 … FX_INPUT_MAX_BUFFERS; 2 for double buffering)
+ *
+ * @return FX_INPUT_OK, FX_INPUT_INVALID_PARAM or FX_INPUT_MISALIGNED
+ *
+ * @traceability SRS-018.5
+ */
+fx_input_res_t fx_input_ring_init(fx_input_ring_t* ring, const fx_input_desc_t* desc,
+                                  void* const* buffers, uint32_t count);
+
+/**
+ * @brief Producer: next buffer to fill, or NULL while all are in use.
+ *
+ * @details Repeated calls return the same buffer until fx_input_commit().
+ *
+ * @complexity O(1), lock-free
+ *
+ * @traceability SRS-018.5
+ */
+void* fx_input_acquire(fx_input_ring_t* ring);
+
+/**
+ * @brief Producer: publish the buffer returned by fx_input_acquire().
+ *
+ * @pre fx_input_acquire() returned a buffer since the last commit
+ *
+ * @traceability SRS-018.5
+ */
+void fx_input_commit(fx_input_ring_t* ring);
+
+/**
+ * @brief Consumer: oldest committed frame, or NULL when none is ready.
+ *
+ * @complexity O(1), lock-free
+ *
+ * @traceability SRS-018.5
+ */
+const void* fx_input_peek(fx_input_ring_t* ring);
+
+/**
+ * @brief Consumer: hand the frame returned by fx_input_peek() back.
+ *
+ * @pre fx_input_peek() returned a frame since the last release
+ *
+ * @traceability SRS-018.5
+ */
+void fx_input_release(fx_input_ring_t* ring);
+
+/**
+ * @brief Committed frames not yet released.
+ *
+ * @traceability SRS-018.5
+ */
+uint32_t fx_input_count(fx_input_ring_t* ring);
+
+#endif /* INPUT_H */
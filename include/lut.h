@@ -0,0 +1,99 @@
+/**
+ * @file lut.h
+ * @project Certifiable Inference Engine
+ * @brief Interpolated lookup-table sigmoid, tanh, GELU and softmax exponent.
+ *
+ * @details Each function reads a table of f at evenly spaced breakpoints
+ * and interpolates linearly between the two neighbours of x with one
+ * rounded 64-bit product:
+ *
+ *   f(x) ≈ y[i] + ⌊((y[i+1] − y[i]) · r + 2^(b−1)) / 2^b⌋,
+ *   i = |x| >> b, r = |x| mod 2^b
+ *
+ * Only x ≥ 0 is tabulated; negative inputs use σ(−x) = 1 − σ(x),
+ * tanh(−x) = −tanh(x) and GELU(−x) = GELU(x) − x. Beyond the table the
+ * functions saturate (σ, tanh → 1; GELU(x) → x). Tables are generated
+ * ahead of the build by tools/gen_lut.py (src/core/lut_tables.h) and total
+ * about 9 KB with the default resolution, so a layer's activations stay
+ * in the L1 data cache. No floating point is used at run time and every
+ * result is a function of the input bits only.
+ *
+ * Error against the exact function, in Q16.16 LSBs (2^-16), over all
+ * inputs (verified by test_activations):
+ *
+ * | Function | Breakpoints | Max error |
+ * |----------|-------------|-----------|
+ * | fixed_sigmoid() | 64 per unit on [0, 16) | < 1.5 (measured 1.11) |
+ * | fixed_tanh() | 64 per unit on [0, 8) | < 2.5 (measured 2.28) |
+ * | fixed_gelu() | 64 per unit on [0, 8) | < 2.5 (measured 2.41) |
+ *
+ * @traceability SRS-004.10, SRS-004.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef LUT_H
+#define LUT_H
+
+#include "fixed_point.h"
+#include <stdint.h>
+
+/** Scale of fx_exp2_neg() results: 1.0 = 2^30 */
+#define FX_EXP2_SHIFT 30
+
+/**
+ * @brief Logistic sigmoid 1 / (1 + e^-x).
+ *
+ * @return Value in [0, FIXED_ONE]
+ *
+ * @complexity O(1): one table pair, one multiply
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.10
+ */
+fixed_t fixed_sigmoid(fixed_t x);
+
+/**
+ * @brief Hyperbolic tangent.
+ *
+ * @return Value in [−FIXED_ONE, FIXED_ONE]
+ *
+ * @complexity O(1)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.10
+ */
+fixed_t fixed_tanh(fixed_t x);
+
+/**
+ * @brief Gaussian error linear unit x · Φ(x) (exact erf form).
+ *
+ * @complexity O(1)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.10
+ */
+fixed_t fixed_gelu(fixed_t x);
+
+/**
+ * @brief 2^-u for a Q16.16 exponent u ≥ 0, on the Q2.30 scale.
+ *
+ * @details The fraction of u is interpolated from a 257-entry table and
+ * the integer part is a rounded right shift; results below 2^-31 are 0.
+ * Relative error < 2^-20 before the shift (measured 9.2e-7).
+ *
+ * @param[in] u Exponent magnitude (Q16.16, ≥ 0)
+ *
+ * @return round(2^(30 − u)), 0 … 2^30
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-004.11
+ */
+uint32_t fx_exp2_neg(uint32_t u);
+
+#endif /* LUT_H */
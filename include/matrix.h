@@ -21,6 +21,7 @@
 #define MATRIX_H
 
 #include "fixed_point.h"
+#include "epilogue.h"
 #include <stdint.h>
 #include <stddef.h>
 
@@ -106,8 +107,17 @@ static inline void fx_matrix_attach(fx_matrix_t* mat, fixed_t* buffer,
  * @details Implements GEMM (General Matrix Multiply) with:
  * - 64-bit intermediate accumulators (prevents overflow)
  * - Proper rounding (minimizes quantization error)
- * - Sequential operations only (no SIMD, bit-perfect)
+ * - Cache blocking: NR-wide panels of B are packed into a contiguous
+ *   stack buffer and swept by a 4×4 register-tile micro-kernel
+ * - Integer SIMD micro-kernel selected at run time (SRS-003.11), which
+ *   performs the same 32×32→64 multiply-accumulates lane-parallel
  * - Row-major access pattern (cache-friendly)
+ * - Static split into row or column tiles over the worker pool when
+ *   one is running (SRS-013)
+ *
+ * Each output element still owns a single 64-bit accumulator over the
+ * full inner dimension and is rounded exactly once, so the result is
+ * bit-identical to fx_matrix_mul_ref().
  *
  * Dimension requirements: A(N×M) × B(M×P) = C(N×P)
  * Must have: A.cols == B.rows
@@ -125,11 +135,34 @@ static inline void fx_matrix_attach(fx_matrix_t* mat, fixed_t* buffer,
  * @determinism Bit-perfect across all platforms and compilers
  *
  * @note Returns early without modifying C if dimensions incompatible
+ * @note C must not alias A or B
+ * @note Uses ~6 KiB of stack for the packed panel and accumulator tile
  *
- * @traceability SRS-003.3, SRS-003.4, SRS-003.5, SRS-003.6
+ * @traceability SRS-003.3, SRS-003.4, SRS-003.5, SRS-003.6, SRS-003.9
  */
 void fx_matrix_mul(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C);
 
+/**
+ * @brief Reference matrix multiplication: C = A × B (naive i-j-k loop).
+ *
+ * @details Straightforward triple loop with one 64-bit accumulator per
+ * output element. Retained as the verification oracle for the blocked
+ * and accelerated GEMM paths; not intended for production use.
+ *
+ * @param[in] A First matrix (N×M)
+ * @param[in] B Second matrix (M×P)
+ * @param[out] C Result matrix (N×P), must be pre-allocated
+ *
+ * @pre Same as fx_matrix_mul()
+ * @post C contains A × B if dimensions compatible, unchanged otherwise
+ *
+ * @complexity O(N * M * P)
+ * @determinism Bit-perfect across all platforms and compilers
+ *
+ * @traceability SRS-003.3, SRS-003.4, SRS-003.5, SRS-003.6
+ */
+void fx_matrix_mul_ref(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C);
+
 /**
  * @brief Dot product of two fixed-point vectors.
  *
@@ -154,6 +187,25 @@ void fx_matrix_mul(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C);
  */
 fixed_t fx_vector_dot(const fixed_t* a, const fixed_t* b, uint16_t len);
 
+/**
+ * @brief Reference (scalar) dot product of two fixed-point vectors.
+ *
+ * @details Sequential scalar loop retained as the verification oracle for
+ * the SIMD backends. fx_vector_dot() must match it bit-for-bit.
+ *
+ * @param[in] a First vector
+ * @param[in] b Second vector
+ * @param[in] len Length of both vectors
+ *
+ * @return Dot product a·b in fixed-point format
+ *
+ * @complexity O(len)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-003.5, SRS-003.6, SRS-003.10
+ */
+fixed_t fx_vector_dot_ref(const fixed_t* a, const fixed_t* b, uint16_t len);
+
 /**
  * @brief Element-wise matrix addition: C = A + B
  *
@@ -179,8 +231,11 @@ void fx_matrix_add(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C);
 /**
  * @brief Apply function element-wise to matrix.
  *
- * @details Applies activation function to each element.
- * Used for ReLU, sigmoid, etc. in neural network layers.
+ * @details Applies a user callback to each element, one indirect call
+ * per element. This is the slow path: built-in operations (scale, add,
+ * clamp, activations) and chains of them run as vectorized loops through
+ * fx_matrix_apply_ops() (elementwise.h), which also accepts callbacks as
+ * one step of a chain.
  *
  * @param[in,out] mat Matrix to modify in-place
  * @param[in] fn Function to apply to each element
@@ -191,7 +246,7 @@ void fx_matrix_add(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C);
  * @complexity O(rows * cols)
  * @determinism Depends on fn determinism
  *
- * @traceability SRS-003.3
+ * @traceability SRS-003.3, SRS-015.4
  */
 void fx_matrix_apply(fx_matrix_t* mat, fixed_t (*fn)(fixed_t));
 
@@ -221,4 +276,121 @@ void fx_matrix_apply(fx_matrix_t* mat, fixed_t (*fn)(fixed_t));
  */
 void fx_matrix_add_bias(fx_matrix_t* mat, const fx_matrix_t* bias);
 
+/**
+ * @brief Dense layer in one pass: C = act(A × B + bias).
+ *
+ * @details The bias add and activation are applied to each output while
+ * it is still in a register, right after the single rounding of its
+ * 64-bit accumulator, so C is written once instead of three times. The
+ * result is bit-identical to
+ *
+ *   fx_matrix_mul(A, B, C); fx_matrix_add_bias(C, bias); fx_relu(C);
+ *
+ * (or fx_leaky_relu(C, alpha)), on every kernel backend.
+ *
+ * @param[in] A Left matrix (M×K)
+ * @param[in] B Right matrix (K×N)
+ * @param[in] bias Bias vector (1×N), or NULL for none
+ * @param[in] act Activation applied after the bias
+ * @param[in] alpha Leaky ReLU slope (ignored for other activations)
+ * @param[out] C Result matrix (M×N)
+ *
+ * @pre Same as fx_matrix_mul(); bias->rows == 1 and bias->cols == N
+ * @post C unchanged if dimensions are invalid
+ *
+ * @complexity O(M × N × K)
+ * @determinism Bit-identical to the unfused sequence
+ *
+ * @traceability SRS-003.9, SRS-004.3, SRS-004.9
+ */
+void fx_matrix_mul_fused(const fx_matrix_t* A, const fx_matrix_t* B, const fx_matrix_t* bias,
+                         fx_activation_t act, fixed_t alpha, fx_matrix_t* C);
+
+/**
+ * @brief Dense layer with ReLU: C = max(0, A × B + bias).
+ *
+ * @details Shorthand for fx_matrix_mul_fused() with FX_ACT_RELU.
+ *
+ * @traceability SRS-004.9
+ */
+void fx_matrix_mul_bias_relu(const fx_matrix_t* A, const fx_matrix_t* B,
+                             const fx_matrix_t* bias, fx_matrix_t* C);
+
+/** Columns per panel of a pre-packed GEMM operand (the micro-kernel's NR) */
+#define FX_MATRIX_PANEL_COLS 4
+
+/**
+ * @brief K×N right-hand operand stored in the GEMM's panel layout.
+ *
+ * @details Panel p holds columns [4p, 4p + 4) as K consecutive groups of
+ * four values, zero beyond the last column:
+ *
+ *   data[(p × K + k) × 4 + j] = B[k][4p + j]
+ *
+ * This is the layout fx_matrix_mul() builds on the stack on every call,
+ * so a packed operand is used in place with no packing step. Weights
+ * that never change are packed once: offline by tools/pack_weights.py
+ * (layout "gemm_panels", SRS-010.6) or at start-up by fx_matrix_pack().
+ *
+ * @note Memory managed by caller - no dynamic allocation.
+ */
+typedef struct {
+    const fixed_t* data;         /**< ⌈cols / 4⌉ panels of rows × 4 values */
+    uint16_t rows;               /**< K */
+    uint16_t cols;               /**< N, before padding to whole panels */
+} fx_matrix_packed_t;
+
+/**
+ * @brief Elements needed to pack a rows × cols operand.
+ *
+ * @return ⌈cols / 4⌉ × 4 × rows
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-003.12
+ */
+size_t fx_matrix_packed_size(uint16_t rows, uint16_t cols);
+
+/**
+ * @brief Pack B into panel layout.
+ *
+ * @param[in] B Matrix to pack (K×N)
+ * @param[out] storage At least fx_matrix_packed_size(K, N) elements
+ * @param[in] len Length of storage in elements
+ * @param[out] out Packed operand pointing into storage
+ *
+ * @post out unchanged if any pointer is NULL or storage is too small
+ *
+ * @complexity O(K × N)
+ *
+ * @traceability SRS-003.12
+ */
+void fx_matrix_pack(const fx_matrix_t* B, fixed_t* storage, size_t len, fx_matrix_packed_t* out);
+
+/**
+ * @brief C = A × B with B pre-packed.
+ *
+ * @pre A.cols == B.rows; C is A.rows × B.cols
+ * @post C unchanged if dimensions are invalid
+ *
+ * @complexity O(M × N × K)
+ * @determinism Bit-identical to fx_matrix_mul() on the unpacked B
+ *
+ * @traceability SRS-003.9, SRS-003.12
+ */
+void fx_matrix_mul_packed(const fx_matrix_t* A, const fx_matrix_packed_t* B, fx_matrix_t* C);
+
+/**
+ * @brief Dense layer C = act(A × B + bias) with B pre-packed.
+ *
+ * @details The packed counterpart of fx_matrix_mul_fused().
+ *
+ * @determinism Bit-identical to fx_matrix_mul_fused() on the unpacked B
+ *
+ * @traceability SRS-003.12, SRS-004.9
+ */
+void fx_matrix_mul_packed_fused(const fx_matrix_t* A, const fx_matrix_packed_t* B,
+                                const fx_matrix_t* bias, fx_activation_t act, fixed_t alpha,
+                                fx_matrix_t* C);
+
 #endif /* MATRIX_H */
@@ -0,0 +1,93 @@
+/**
+ * @file perfect_hash.h
+ * @project Certifiable Inference Engine
+ * @brief Read-only minimal perfect hash tables generated at build time.
+ *
+ * @details For key sets fixed at build time (layer names, op IDs, config
+ * keys), tools/gen_phash.py builds a minimal perfect hash with the CHD
+ * (compress, hash and displace) scheme and emits it as const C data:
+ * n records in n slots and two 16-bit displacements per bucket of about
+ * five keys. A lookup hashes the key once, reads one displacement pair
+ * and compares one record. There is no probe loop, no initialization and
+ * no writable state, so tables can sit in flash and be shared by threads.
+ *
+ * Keys are hashed and compared on their first D_TABLE_KEY_LEN − 1
+ * characters, as in d_table_t, and the records are d_entry_t.
+ *
+ *     h    = FNV-1a over the key bytes, offset basis XOR seed
+ *     g    = fmix32(h) % buckets
+ *     f1   = fmix32(h ^ 0x9E3779B9) % size
+ *     f2   = fmix32(h ^ 0x85EBCA6B) % size
+ *     slot = (f1 + d0[g] · f2 + d1[g]) % size
+ *
+ * @traceability SRS-017
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef PERFECT_HASH_H
+#define PERFECT_HASH_H
+
+#include "deterministic_hash.h"
+
+/** Largest key set; keeps displacements in 16 bits and slot arithmetic in 32 */
+#define D_PHASH_MAX_KEYS 65535u
+
+/**
+ * @brief Generated table (all storage const, emitted by tools/gen_phash.py).
+ */
+typedef struct {
+    const uint16_t* displace;    /**< d0, d1 per bucket (2 × buckets) */
+    const d_entry_t* entries;    /**< Record per slot */
+    uint32_t size;               /**< Keys = slots, 1 … D_PHASH_MAX_KEYS */
+    uint32_t buckets;            /**< Displacement pairs */
+    uint32_t seed;               /**< Hash seed chosen by the generator */
+} d_phash_t;
+
+/**
+ * @brief Slot of @p key.
+ *
+ * @return Slot in [0, size) if @p key is in the table, else table->size
+ *         (also for NULL arguments)
+ *
+ * @complexity O(1): one hash of at most 31 characters, one record compared
+ *
+ * @traceability SRS-017.2
+ */
+uint32_t d_phash_index(const d_phash_t* table, const char* key);
+
+/**
+ * @brief Look up the value of @p key.
+ *
+ * @return D_TABLE_OK, D_TABLE_NOT_FOUND, or D_TABLE_INVALID_PARAM on NULL
+ *         arguments; *value is written only on success
+ *
+ * @traceability SRS-017.2
+ */
+d_table_res_t d_phash_get(const d_phash_t* table, const char* key, int32_t* value);
+
+/**
+ * @brief Check that generated data is a perfect hash of its records.
+ *
+ * @details Every record must hash to its own slot, every displacement
+ * must be below size, and the sizes must be in range. Intended for a
+ * start-up or built-in self test.
+ *
+ * @return D_TABLE_OK, or D_TABLE_INVALID_PARAM if any check fails
+ *
+ * @complexity O(size)
+ *
+ * @traceability SRS-017.3
+ */
+d_table_res_t d_phash_verify(const d_phash_t* table);
+
+/**
+ * @brief The seeded key hash h (before mixing), as the generator computes it.
+ */
+uint32_t d_phash_hash(const char* key, uint32_t seed);
+
+#endif /* PERFECT_HASH_H */
@@ -0,0 +1,315 @@
+/**
+ * @file pipeline.h
+ * @project Certifiable Inference Engine
+ * @brief Multi-stage frame pipeline over lock-free SPSC ring buffers.
+ *
+ * @details A model is cut into stages (e.g. conv → pool → dense), each
+ * run by its own thread. Consecutive stages are joined by a
+ * single-producer / single-consumer ring of preallocated frame slots, so
+ * frame N+1 can be in the convolution stage while frame N is in the
+ * dense layers:
+ *
+ *   caller ──ring 0──▶ stage 0 ──ring 1──▶ stage 1 ── … ──ring S──▶ caller
+ *
+ * Slots live in caller storage and are handed over in place: a producer
+ * writes an acquired slot and commits it, and the consumer reads it and
+ * releases it. A ring holds at most its depth (≤ FX_PIPE_MAX_DEPTH)
+ * frames, so at most Σ depth + S frames are in flight. With a bounded
+ * per-stage time t_i the latency of a frame is bounded by
+ * Σ (depth_i + 1) · max t_i, and a full input ring is reported to the
+ * caller instead of growing a queue.
+ *
+ * Each stage processes frames in arrival order with the same stage
+ * function, so outputs are bit-identical to running the stages
+ * back-to-back on one thread (fx_pipeline_step()). Rings are lock-free:
+ * head and tail are each written by one side only, with release stores
+ * and acquire loads. A stage with no input or no output room yields the
+ * CPU and polls again; stages can be pinned to cores.
+ *
+ * Typical usage:
+ * ```c
+ * static fx_pipeline_t p;
+ * fx_pipeline_init(&p, in_slots, frame_len, 4);
+ * fx_pipeline_add_stage(&p, fx_graph_stage_run, &conv, conv_slots, conv_len, 2, 1);
+ * fx_pipeline_add_stage(&p, fx_graph_stage_run, &head, out_slots, out_len, 4, 2);
+ * fx_pipeline_start(&p);
+ *
+ * fixed_t* f = fx_ring_acquire(fx_pipeline_input(&p));    // NULL: full
+ * fill(f); fx_ring_commit(fx_pipeline_input(&p));
+ * const fixed_t* y = fx_ring_peek(fx_pipeline_output(&p)); // NULL: none yet
+ * use(y); fx_ring_release(fx_pipeline_output(&p));
+ * ```
+ *
+ * Threads are available when the library is built with CI_THREADS=ON on
+ * a POSIX platform; otherwise fx_pipeline_start() reports
+ * FX_PIPE_UNSUPPORTED and fx_pipeline_step() runs the stages serially.
+ *
+ * @traceability SRS-014-PIPELINE
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include "fixed_point.h"
+#include "graph.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/** Maximum stages per pipeline */
+#define FX_PIPE_MAX_STAGES 8
+
+/** Maximum slots per ring */
+#define FX_PIPE_MAX_DEPTH 32
+
+/** Bytes reserved for a platform thread handle */
+#define FX_PIPE_THREAD_HANDLE_SIZE 64
+
+/**
+ * @brief Result codes for pipeline operations.
+ */
+typedef enum {
+    FX_PIPE_OK = 0,              /**< Success (step: at least one stage ran) */
+    FX_PIPE_INVALID_PARAM,       /**< NULL pointer, zero length or bad depth */
+    FX_PIPE_FULL,                /**< FX_PIPE_MAX_STAGES exceeded */
+    FX_PIPE_IDLE,                /**< step: no stage had input and room */
+    FX_PIPE_BUSY,                /**< Threads running (or not running for stop) */
+    FX_PIPE_UNSUPPORTED,         /**< Built without thread support */
+    FX_PIPE_SYSTEM,              /**< Thread creation or CPU pinning failed */
+    FX_PIPE_STAGE_FAILED         /**< A stage function returned false */
+} fx_pipe_res_t;
+
+/**
+ * @brief Single-producer / single-consumer ring of fixed-size frame slots.
+ *
+ * @details head counts committed slots and is written by the producer
+ * only; tail counts released slots and is written by the consumer only.
+ * Both count modulo 2 × depth, so slot order survives counter wrap for
+ * any depth; (head − tail) mod 2 × depth is the fill level.
+ */
+typedef struct {
+    fixed_t* slots;              /**< depth × slot_len elements, caller storage */
+    size_t slot_len;             /**< Elements per slot */
+    uint32_t depth;              /**< Slots, 1 … FX_PIPE_MAX_DEPTH */
+    uint32_t head;               /**< Producer counter (atomic) */
+    uint32_t tail;               /**< Consumer counter (atomic) */
+} fx_ring_t;
+
+/**
+ * @brief Stage body: read one input frame, write one output frame.
+ *
+ * @param[in] ctx Stage context
+ * @param[in] in Input slot (previous ring)
+ * @param[out] out Output slot (next ring)
+ *
+ * @return false on failure; the pipeline then stops at this frame
+ */
+typedef bool (*fx_stage_fn)(void* ctx, const fixed_t* in, fixed_t* out);
+
+struct fx_pipeline;
+
+/**
+ * @brief Stage record.
+ */
+typedef struct {
+    fx_stage_fn fn;              /**< Stage body */
+    void* ctx;                   /**< Stage context */
+    int cpu;                     /**< Core to pin the stage thread to, or -1 */
+    uint16_t index;              /**< Position in the pipeline */
+    struct fx_pipeline* owner;   /**< Pipeline the stage belongs to */
+    union {
+        unsigned char bytes[FX_PIPE_THREAD_HANDLE_SIZE];
+        uint64_t align;
+    } thread;                    /**< Platform thread handle (opaque) */
+} fx_pipe_stage_t;
+
+/**
+ * @brief Pipeline: stages plus the rings between them.
+ *
+ * @note Fixed capacity, no dynamic allocation; declare static on small
+ *       targets. Ring i feeds stage i; ring stage_count is the output.
+ */
+typedef struct fx_pipeline {
+    fx_pipe_stage_t stages[FX_PIPE_MAX_STAGES];
+    fx_ring_t rings[FX_PIPE_MAX_STAGES + 1];
+    uint16_t stage_count;
+    bool running;                /**< Stage threads started */
+    uint32_t stop;               /**< Stop request (atomic) */
+    uint32_t failed;             /**< 1 + index of the first failed stage, or 0 (atomic) */
+} fx_pipeline_t;
+
+/**
+ * @brief Initialize a ring over caller storage.
+ *
+ * @param[out] ring Ring
+ * @param[in] slots Storage of depth × slot_len elements
+ * @param[in] slot_len Elements per slot (> 0)
+ * @param[in] depth Slots (1 … FX_PIPE_MAX_DEPTH, any value; slots are
+ *                  used in strict rotation)
+ *
+ * @return FX_PIPE_OK or FX_PIPE_INVALID_PARAM
+ *
+ * @traceability SRS-014.1
+ */
+fx_pipe_res_t fx_ring_init(fx_ring_t* ring, fixed_t* slots, size_t slot_len, uint32_t depth);
+
+/**
+ * @brief Producer: next free slot, or NULL when the ring is full.
+ *
+ * @details Repeated calls return the same slot until fx_ring_commit().
+ *
+ * @complexity O(1), lock-free
+ *
+ * @traceability SRS-014.1
+ */
+fixed_t* fx_ring_acquire(fx_ring_t* ring);
+
+/**
+ * @brief Producer: publish the slot returned by fx_ring_acquire().
+ *
+ * @pre fx_ring_acquire() returned a slot since the last commit
+ *
+ * @traceability SRS-014.1
+ */
+void fx_ring_commit(fx_ring_t* ring);
+
+/**
+ * @brief Consumer: oldest committed slot, or NULL when the ring is empty.
+ *
+ * @complexity O(1), lock-free
+ *
+ * @traceability SRS-014.1
+ */
+const fixed_t* fx_ring_peek(fx_ring_t* ring);
+
+/**
+ * @brief Consumer: return the slot returned by fx_ring_peek().
+ *
+ * @pre fx_ring_peek() returned a slot since the last release
+ *
+ * @traceability SRS-014.1
+ */
+void fx_ring_release(fx_ring_t* ring);
+
+/**
+ * @brief Committed frames not yet released.
+ *
+ * @traceability SRS-014.1
+ */
+uint32_t fx_ring_count(fx_ring_t* ring);
+
+/**
+ * @brief Initialize a pipeline and its input ring.
+ *
+ * @param[out] p Pipeline
+ * @param[in] in_slots Input ring storage (in_depth × frame_len elements)
+ * @param[in] frame_len Elements per input frame
+ * @param[in] in_depth Input ring slots
+ *
+ * @return FX_PIPE_OK or FX_PIPE_INVALID_PARAM
+ *
+ * @traceability SRS-014.2
+ */
+fx_pipe_res_t fx_pipeline_init(fx_pipeline_t* p, fixed_t* in_slots, size_t frame_len,
+                               uint32_t in_depth);
+
+/**
+ * @brief Append a stage and its output ring.
+ *
+ * @param[in,out] p Pipeline (not running)
+ * @param[in] fn Stage body
+ * @param[in] ctx Stage context
+ * @param[in] out_slots Output ring storage (out_depth × out_len elements)
+ * @param[in] out_len Elements per output frame
+ * @param[in] out_depth Output ring slots
+ * @param[in] cpu Core to pin the stage thread to, or -1
+ *
+ * @return FX_PIPE_OK, FX_PIPE_INVALID_PARAM, FX_PIPE_FULL or FX_PIPE_BUSY
+ *
+ * @traceability SRS-014.2
+ */
+fx_pipe_res_t fx_pipeline_add_stage(fx_pipeline_t* p, fx_stage_fn fn, void* ctx,
+                                    fixed_t* out_slots, size_t out_len, uint32_t out_depth,
+                                    int cpu);
+
+/**
+ * @brief Ring the caller fills with input frames.
+ */
+fx_ring_t* fx_pipeline_input(fx_pipeline_t* p);
+
+/**
+ * @brief Ring the caller drains of output frames.
+ */
+fx_ring_t* fx_pipeline_output(fx_pipeline_t* p);
+
+/**
+ * @brief Start one thread per stage.
+ *
+ * @return FX_PIPE_OK, FX_PIPE_INVALID_PARAM (no stages), FX_PIPE_BUSY,
+ *         FX_PIPE_UNSUPPORTED or FX_PIPE_SYSTEM (no thread left running)
+ *
+ * @traceability SRS-014.3
+ */
+fx_pipe_res_t fx_pipeline_start(fx_pipeline_t* p);
+
+/**
+ * @brief Stop and join the stage threads.
+ *
+ * @details Frames already in the rings stay there; a stage finishes the
+ * frame it is processing first. Stopping a stopped pipeline is a no-op.
+ *
+ * @return FX_PIPE_OK, or FX_PIPE_STAGE_FAILED if a stage failed
+ *
+ * @traceability SRS-014.3
+ */
+fx_pipe_res_t fx_pipeline_stop(fx_pipeline_t* p);
+
+/**
+ * @brief Run each stage that has an input frame and output room once,
+ *        last stage first, on the calling thread.
+ *
+ * @return FX_PIPE_OK if a stage ran, FX_PIPE_IDLE if none could,
+ *         FX_PIPE_BUSY while threads run, FX_PIPE_STAGE_FAILED
+ *
+ * @traceability SRS-014.4
+ */
+fx_pipe_res_t fx_pipeline_step(fx_pipeline_t* p);
+
+/**
+ * @brief Index of the first stage that failed, or -1.
+ *
+ * @traceability SRS-014.3
+ */
+int fx_pipeline_failed_stage(const fx_pipeline_t* p);
+
+/**
+ * @brief A planned graph run as one pipeline stage.
+ *
+ * @details The stage's input tensor is bound to the input slot and its
+ * output tensor to the output slot for each frame. The graph and arena
+ * belong to this stage alone.
+ */
+typedef struct {
+    fx_graph_t* graph;           /**< Planned graph */
+    fx_tensor_id_t in;           /**< Graph input */
+    fx_tensor_id_t out;          /**< Graph output */
+    fixed_t* arena;              /**< Stage arena (graph->arena_len elements) */
+    size_t arena_len;            /**< Arena length */
+} fx_graph_stage_t;
+
+/**
+ * @brief fx_stage_fn running an fx_graph_stage_t.
+ *
+ * @return true if fx_graph_run() succeeded
+ *
+ * @traceability SRS-014.2
+ */
+bool fx_graph_stage_run(void* ctx, const fixed_t* in, fixed_t* out);
+
+#endif /* PIPELINE_H */
@@ -1,11 +1,14 @@
 /**
  * @file pooling.h
  * @project Certifiable Inference Engine
- * @brief Bounded-resource, deterministic Max Pooling operations for CNNs.
+ * @brief Bounded-resource, deterministic pooling operations for CNNs.
  *
- * @details Implements max pooling layers for spatial dimension reduction
- * in convolutional neural networks. All operations are deterministic,
- * use pre-allocated memory, and have provable time complexity.
+ * @details Implements max and average pooling layers for spatial
+ * dimension reduction in convolutional neural networks: the 2×2 / stride-2
+ * max pool on a single plane, k×k strided max and average pooling on
+ * multi-channel tensors, and global average pooling into the classifier
+ * input. All operations are deterministic, use pre-allocated memory, and
+ * have provable time complexity.
  *
  * @traceability SRS-008-POOLING
  * @compliance DO-178C, ISO 26262, IEC 62304, IEC 61508
@@ -19,6 +22,9 @@
 #define POOLING_H
 
 #include "matrix.h"
+#include "tensor.h"
+#include <stdbool.h>
+#include <stddef.h>
 
 /**
  * @brief Deterministic 2×2 Max Pooling with stride 2.
@@ -75,4 +81,176 @@
  */
 void fx_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out);
 
+/**
+ * @brief Reference (scalar) 2×2 Max Pooling, retained as the SIMD
+ *        verification oracle.
+ *
+ * @param in Input feature map (must have even dimensions)
+ * @param out Output feature map (dimensions = in dimensions / 2)
+ *
+ * @precondition Same as fx_maxpool_2x2()
+ * @postcondition Bit-identical to fx_maxpool_2x2()
+ *
+ * @complexity Time: O(M×N) where M×N is input size
+ *
+ * @traceability SRS-008.1, SRS-008.2, SRS-003.10
+ */
+void fx_maxpool_2x2_ref(const fx_matrix_t* in, fx_matrix_t* out);
+
+/**
+ * @brief Pooling reduction.
+ */
+typedef enum {
+    FX_POOL2D_MAX = 0,           /**< Maximum of the window */
+    FX_POOL2D_AVG                /**< Rounded mean of the window */
+} fx_pool2d_mode_t;
+
+/**
+ * @brief Geometry of a pooling layer.
+ *
+ * @details Padding adds pad_h rows above and below and pad_w columns left
+ * and right. Padded positions never win a max. For averages they count as
+ * zeros when count_pad is set (divide by kernel_h × kernel_w); otherwise
+ * only the input samples under the window are counted. Padding must be
+ * smaller than the kernel, so every window covers at least one sample.
+ */
+typedef struct {
+    fx_pool2d_mode_t mode;       /**< Max or average */
+    uint16_t kernel_h;           /**< Window height (≥ 1) */
+    uint16_t kernel_w;           /**< Window width (≥ 1) */
+    uint16_t stride_h;           /**< Vertical stride (≥ 1) */
+    uint16_t stride_w;           /**< Horizontal stride (≥ 1) */
+    uint16_t pad_h;              /**< Rows added above and below (< kernel_h) */
+    uint16_t pad_w;              /**< Columns added left and right (< kernel_w) */
+    bool count_pad;              /**< AVG: padded positions count in the divisor */
+} fx_pool2d_params_t;
+
+/** 2×2 / stride-2 max pooling: the geometry of fx_maxpool_2x2() */
+#define FX_POOL2D_PARAMS_MAX_2X2 { FX_POOL2D_MAX, 2, 2, 2, 2, 0, 0, false }
+
+/** 3×3 / stride-2 max pooling, no padding */
+#define FX_POOL2D_PARAMS_MAX_3X3_S2 { FX_POOL2D_MAX, 3, 3, 2, 2, 0, 0, false }
+
+/** Channels accumulated together by fx_global_avgpool() on NHWC input */
+#define FX_POOL2D_CH_BLOCK 64
+
+/**
+ * @brief Result codes for tensor pooling.
+ */
+typedef enum {
+    FX_POOL2D_OK = 0,              /**< Output written */
+    FX_POOL2D_INVALID_PARAM,       /**< NULL pointer, zero kernel/stride, pad ≥ kernel */
+    FX_POOL2D_DIM_MISMATCH,        /**< Tensor shapes inconsistent with params */
+    FX_POOL2D_WORKSPACE_TOO_SMALL  /**< Workspace shorter than required */
+} fx_pool2d_res_t;
+
+/**
+ * @brief Output extent of one pooled dimension.
+ *
+ * @details out = (in + 2·pad − k) / stride + 1, rounded down: trailing
+ * samples that do not fill a window are dropped, so odd extents are
+ * accepted.
+ *
+ * @return Output extent, or 0 if the window does not fit or k, stride
+ *         is zero
+ *
+ * @traceability SRS-008.9, SRS-008.10
+ */
+uint16_t fx_pool2d_out_dim(uint16_t in, uint16_t k, uint16_t stride, uint16_t pad);
+
+/**
+ * @brief Workspace fx_pool2d() needs, in fixed_t elements.
+ *
+ * @details Max pooling keeps the row pass of one plane: in->h × out->w
+ * elements. Average pooling and the 2×2 / stride-2 NCHW case (which runs
+ * the fx_maxpool_2x2() kernel per plane) need none.
+ *
+ * @traceability SRS-008.11
+ */
+size_t fx_pool2d_workspace_size(const fx_tensor_t* in, const fx_pool2d_params_t* params,
+                                const fx_tensor_t* out);
+
+/**
+ * @brief k×k strided max or average pooling of every plane of a tensor.
+ *
+ * @details For every batch b, channel c and output pixel (y, x), with
+ * the window rows y·sh − ph … y·sh − ph + kh − 1 and columns likewise
+ * clipped to the input:
+ *
+ * - FX_POOL2D_MAX: out = max of the window.
+ * - FX_POOL2D_AVG: out = ⌊(Σ window + d/2) / d⌋, with d = kh·kw
+ *   (count_pad) or the number of samples in the window. The sum is exact
+ *   in 64 bits and rounded once, half up, like the >> rounding of the
+ *   other kernels.
+ *
+ * Max pooling is separable: a row pass takes the max of kw samples for
+ * every input row and output column into the workspace, and a column
+ * pass takes the max of kh of those. Each output then costs about
+ * sh·kw + kh comparisons instead of kh·kw.
+ *
+ * In and out may use either layout; out has the same N and C as in and
+ * OH, OW from fx_pool2d_out_dim().
+ *
+ * @param[in] in Input tensor
+ * @param[in] params Window, stride, padding and reduction
+ * @param[in,out] workspace Scratch buffer (may be NULL if none is needed)
+ * @param[in] workspace_len Workspace length in fixed_t elements
+ * @param[out] out Output tensor
+ *
+ * @return FX_POOL2D_OK, FX_POOL2D_INVALID_PARAM, FX_POOL2D_DIM_MISMATCH or
+ *         FX_POOL2D_WORKSPACE_TOO_SMALL; out is untouched on error
+ *
+ * @pre out and workspace do not alias in
+ *
+ * @complexity MAX: O(N × C × (H × OW × kw + OH × OW × kh));
+ *             AVG: O(N × C × OH × OW × kh × kw)
+ * @determinism Fixed iteration count; bit-perfect across platforms
+ *
+ * @traceability SRS-008.8, SRS-008.9, SRS-008.10, SRS-008.11
+ *
+ * @example
+ * ```c
+ * // 16×28×28 → 3×3 / stride-2 max pool → 16×13×13
+ * fx_pool2d_params_t p = FX_POOL2D_PARAMS_MAX_3X3_S2;
+ * fx_tensor_attach(&in, in_buf, 1, 16, 28, 28, FX_LAYOUT_NCHW);
+ * fx_tensor_attach(&out, out_buf, 1, 16, 13, 13, FX_LAYOUT_NCHW);
+ * fx_pool2d(&in, &p, ws, fx_pool2d_workspace_size(&in, &p, &out), &out);
+ * ```
+ */
+fx_pool2d_res_t fx_pool2d(const fx_tensor_t* in, const fx_pool2d_params_t* params,
+                          fixed_t* workspace, size_t workspace_len, fx_tensor_t* out);
+
+/**
+ * @brief Reference pooling that scans every window directly.
+ *
+ * @details Same arguments and results as fx_pool2d() without a
+ * workspace; retained as its verification oracle.
+ *
+ * @complexity O(N × C × OH × OW × kh × kw)
+ *
+ * @traceability SRS-008.8, SRS-008.9, SRS-008.10
+ */
+fx_pool2d_res_t fx_pool2d_ref(const fx_tensor_t* in, const fx_pool2d_params_t* params,
+                              fx_tensor_t* out);
+
+/**
+ * @brief Global average pooling straight into the classifier input.
+ *
+ * @details out[b][c] = ⌊(Σ(y,x) in[b][c][y][x] + HW/2) / HW⌋ with an
+ * exact 64-bit sum per channel, so flattening and averaging happen in one
+ * pass and the N × C result feeds fx_matrix_mul() or a dense layer
+ * without a reshape. NHWC input is read once, in memory order, for blocks
+ * of FX_POOL2D_CH_BLOCK channels.
+ *
+ * @param[in] in Input tensor (either layout)
+ * @param[out] out N × C matrix
+ *
+ * @return FX_POOL2D_OK, FX_POOL2D_INVALID_PARAM or FX_POOL2D_DIM_MISMATCH
+ *
+ * @complexity O(N × C × H × W)
+ *
+ * @traceability SRS-008.12
+ */
+fx_pool2d_res_t fx_global_avgpool(const fx_tensor_t* in, fx_matrix_t* out);
+
 #endif /* POOLING_H */
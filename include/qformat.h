@@ -0,0 +1,285 @@
+/**
+ * @file qformat.h
+ * @project Certifiable Inference Engine
+ * @brief Configurable Qm.n fixed-point formats generated from one template.
+ *
+ * @details FIXED_SHIFT fixes the whole Q16.16 API at 16 fractional bits.
+ * This header provides the same arithmetic for any format as a family of
+ * macro-generated variants, so a layer's storage and precision can be
+ * chosen per tensor. Examples are Q8.24 for small activations that need
+ * precision, Q24.8 for range, and int16 Q1.15 weights at half the
+ * storage.
+ *
+ * FX_QFORMAT_DECLARE(P, T, FRAC, MIN, MAX) generates, for storage type T
+ * with FRAC fractional bits:
+ *
+ * | Function | Operation |
+ * |----------|-----------|
+ * | P_from_int, P_to_int | Integer conversion (to_int floors, as fixed_to_int) |
+ * | P_from_q16, P_to_q16 | Conversion from / to Q16.16 |
+ * | P_add, P_sub, P_mul | Saturating arithmetic, products rounded once |
+ * | P_dot, P_matrix_mul | Kernels with 64-bit accumulation, rounded once |
+ * | P_qformat | The format's fx_qformat_t descriptor |
+ *
+ * FX_QFORMAT_DEFINE(...) with the same arguments emits the out-of-line
+ * kernels in exactly one translation unit. FX_QGEMM_DECLARE/FX_QGEMM_DEFINE
+ * produce matrix products of mixed formats (e.g. Q1.15 weights times
+ * Q16.16 activations). Because the shift is a compile-time constant,
+ * each variant is compiled as its own specialized kernel.
+ *
+ * All variants round half up (floor(x + 1/2), as fixed_mul()) with one
+ * rounding per output. Unlike the Q16.16 API they saturate to the storage
+ * range instead of wrapping, so a format that is too narrow degrades
+ * gracefully rather than overflowing. For in-range results fx_q16_16_*
+ * is bit-identical to fixed_mul(), fx_vector_dot() and fx_matrix_mul().
+ *
+ * Between layers of different formats, fx_qformat_rescale() converts a
+ * buffer by an integer shift with the same rounding and saturation.
+ *
+ * @traceability SRS-012-QFORMAT
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef QFORMAT_H
+#define QFORMAT_H
+
+#include "fixed_point.h"
+#include "trace.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/** Largest |shift| accepted by fx_qround() */
+#define FX_QSHIFT_MAX 62
+
+/** Output columns accumulated together by generated matrix kernels */
+#define FX_QGEMM_NB 64
+
+/**
+ * @brief Q-format of a tensor: storage width and fractional bits.
+ */
+typedef struct {
+    uint8_t bits;                /**< Storage width: 8, 16 or 32 */
+    uint8_t frac;                /**< Fractional bits, < bits */
+} fx_qformat_t;
+
+/**
+ * @brief Multiply by 2^-shift with round half up; saturating for shift < 0.
+ *
+ * @details shift > 0 returns floor(v / 2^shift + 1/2), computed without
+ * forming v + 2^(shift−1), so it cannot overflow. shift < 0 returns
+ * v · 2^-shift saturated to int64.
+ *
+ * @param[in] v Value
+ * @param[in] shift −FX_QSHIFT_MAX … FX_QSHIFT_MAX
+ *
+ * @return Rescaled value
+ *
+ * @complexity O(1)
+ * @determinism Integer only, platform independent
+ *
+ * @traceability SRS-012.2
+ */
+static inline int64_t fx_qround(int64_t v, int shift) {
+    if (shift > 0) {
+        const uint64_t mask = ((uint64_t)1 << shift) - 1u;
+        const uint64_t rem = (uint64_t)v & mask;
+        return (v >> shift) + (int64_t)((rem + ((uint64_t)1 << (shift - 1))) >> shift);
+    }
+    if (shift < 0) {
+        const int s = -shift;
+        if (v > (INT64_MAX >> s)) {
+            return INT64_MAX;
+        }
+        if (v < -(INT64_MAX >> s) - 1) {
+            return INT64_MIN;
+        }
+        return v * ((int64_t)1 << s);
+    }
+    return v;
+}
+
+/**
+ * @brief Clamp to [lo, hi].
+ */
+static inline int64_t fx_qsat(int64_t v, int64_t lo, int64_t hi) {
+    return (v < lo) ? lo : (v > hi) ? hi : v;
+}
+
+/**
+ * @brief Check that a format descriptor is usable.
+ *
+ * @return true for bits of 8, 16 or 32 and frac < bits
+ *
+ * @traceability SRS-012.1
+ */
+bool fx_qformat_valid(fx_qformat_t fmt);
+
+/**
+ * @brief Convert one value between formats.
+ *
+ * @param[in] v Value in format @p from
+ * @param[in] from Source format (valid)
+ * @param[in] to Target format (valid)
+ *
+ * @return v · 2^(to.frac − from.frac), rounded half up and saturated to
+ *         @p to; 0 for an invalid format
+ *
+ * @complexity O(1)
+ * @determinism Bit-perfect
+ *
+ * @traceability SRS-012.2
+ */
+int32_t fx_qformat_convert(int32_t v, fx_qformat_t from, fx_qformat_t to);
+
+/**
+ * @brief Rescale a buffer between layers of different formats.
+ *
+ * @details Reads int8/int16/int32 elements per @p from, converts each with
+ * fx_qformat_convert() and writes them per @p to.
+ *
+ * @param[in] in Source elements
+ * @param[in] from Source format
+ * @param[out] out Target elements (may equal @p in when the widths match;
+ *                 must not otherwise overlap it)
+ * @param[in] to Target format
+ * @param[in] n Element count
+ *
+ * @return false (nothing written) for NULL buffers or an invalid format
+ *
+ * @complexity O(n)
+ * @determinism Bit-perfect
+ *
+ * @traceability SRS-012.2
+ */
+bool fx_qformat_rescale(const void* in, fx_qformat_t from, void* out, fx_qformat_t to, size_t n);
+
+/**
+ * @brief Declare a mixed-format matrix product C = A × B.
+ *
+ * @details A is M×K, B is K×N, C is M×N, all row-major. Sums are exact in
+ * int64 and rounded once from FA + FB to FC fractional bits.
+ */
+#define FX_QGEMM_DECLARE(NAME, TA, TB, TC) \
+    void NAME(const TA* a, const TB* b, TC* c, size_t m, size_t k, size_t n)
+
+/**
+ * @brief Define a kernel declared with FX_QGEMM_DECLARE.
+ *
+ * @details Each call records one FX_TRACE_QGEMM event when CI_TRACE is
+ * defined in the translation unit holding the definition (SRS-007.12).
+ */
+#define FX_QGEMM_DEFINE(NAME, TA, FA, TB, FB, TC, FC, CMIN, CMAX) \
+    void NAME(const TA* a, const TB* b, TC* c, size_t m, size_t k, size_t n) { \
+        int64_t acc[FX_QGEMM_NB]; \
+        if (!a || !b || !c) { \
+            return; \
+        } \
+        FX_TRACE_BEGIN(FX_TRACE_QGEMM, m, n, k); \
+        for (size_t i = 0; i < m; i++) { \
+            for (size_t j0 = 0; j0 < n; j0 += FX_QGEMM_NB) { \
+                const size_t nb = (n - j0 < FX_QGEMM_NB) ? n - j0 : FX_QGEMM_NB; \
+                for (size_t j = 0; j < nb; j++) { \
+                    acc[j] = 0; \
+                } \
+                for (size_t p = 0; p < k; p++) { \
+                    const int64_t av = a[i * k + p]; \
+                    const TB* brow = b + p * n + j0; \
+                    for (size_t j = 0; j < nb; j++) { \
+                        acc[j] += av * brow[j]; \
+                    } \
+                } \
+                for (size_t j = 0; j < nb; j++) { \
+                    c[i * n + j0 + j] = (TC)fx_qsat(fx_qround(acc[j], (FA) + (FB) - (FC)), CMIN, CMAX); \
+                } \
+            } \
+        } \
+        FX_TRACE_END(); \
+    } \
+    struct NAME##_qgemm_defined_
+
+/**
+ * @brief Declare the type, inline arithmetic and kernels of one format.
+ *
+ * @param P Name prefix (e.g. fx_q8_24)
+ * @param T Storage type (int8_t, int16_t or int32_t)
+ * @param FRAC Fractional bits (< width of T)
+ * @param MIN Smallest value of T
+ * @param MAX Largest value of T
+ */
+#define FX_QFORMAT_DECLARE(P, T, FRAC, MIN, MAX) \
+    typedef T P##_t; \
+    static inline fx_qformat_t P##_qformat(void) { \
+        fx_qformat_t f; \
+        f.bits = (uint8_t)(sizeof(T) * 8u); \
+        f.frac = (uint8_t)(FRAC); \
+        return f; \
+    } \
+    static inline P##_t P##_sat(int64_t v) { \
+        return (P##_t)fx_qsat(v, MIN, MAX); \
+    } \
+    static inline P##_t P##_from_int(int32_t i) { \
+        return P##_sat(fx_qround(i, -(FRAC))); \
+    } \
+    static inline int32_t P##_to_int(P##_t v) { \
+        return (int32_t)(v >> (FRAC)); \
+    } \
+    static inline P##_t P##_from_q16(fixed_t v) { \
+        return P##_sat(fx_qround(v, FIXED_SHIFT - (FRAC))); \
+    } \
+    static inline fixed_t P##_to_q16(P##_t v) { \
+        return (fixed_t)fx_qsat(fx_qround(v, (FRAC) - FIXED_SHIFT), INT32_MIN, INT32_MAX); \
+    } \
+    static inline P##_t P##_add(P##_t a, P##_t b) { \
+        return P##_sat((int64_t)a + b); \
+    } \
+    static inline P##_t P##_sub(P##_t a, P##_t b) { \
+        return P##_sat((int64_t)a - b); \
+    } \
+    static inline P##_t P##_mul(P##_t a, P##_t b) { \
+        return P##_sat(fx_qround((int64_t)a * b, FRAC)); \
+    } \
+    P##_t P##_dot(const P##_t* a, const P##_t* b, size_t n); \
+    FX_QGEMM_DECLARE(P##_matrix_mul, P##_t, P##_t, P##_t)
+
+/**
+ * @brief Emit the out-of-line kernels of a format (one translation unit).
+ */
+#define FX_QFORMAT_DEFINE(P, T, FRAC, MIN, MAX) \
+    P##_t P##_dot(const P##_t* a, const P##_t* b, size_t n) { \
+        int64_t acc = 0; \
+        if (!a || !b) { \
+            return 0; \
+        } \
+        for (size_t i = 0; i < n; i++) { \
+            acc += (int64_t)a[i] * b[i]; \
+        } \
+        return P##_sat(fx_qround(acc, FRAC)); \
+    } \
+    FX_QGEMM_DEFINE(P##_matrix_mul, P##_t, FRAC, P##_t, FRAC, P##_t, FRAC, MIN, MAX)
+
+/*
+ * Library formats (kernels in qformat.c). Other formats are instantiated
+ * the same way in user code.
+ */
+FX_QFORMAT_DECLARE(fx_q16_16, int32_t, 16, INT32_MIN, INT32_MAX);  /**< Q16.16, as fixed_t */
+FX_QFORMAT_DECLARE(fx_q8_24, int32_t, 24, INT32_MIN, INT32_MAX);   /**< Q8.24: ±128, 6e-8 */
+FX_QFORMAT_DECLARE(fx_q24_8, int32_t, 8, INT32_MIN, INT32_MAX);    /**< Q24.8: ±8.4e6, 0.004 */
+FX_QFORMAT_DECLARE(fx_q8_8, int16_t, 8, INT16_MIN, INT16_MAX);     /**< Q8.8 in 16 bits */
+FX_QFORMAT_DECLARE(fx_q1_15, int16_t, 15, INT16_MIN, INT16_MAX);   /**< Q1.15 in 16 bits: [-1, 1) */
+
+/**
+ * @brief Q16.16 activations × Q1.15 weights → Q16.16.
+ *
+ * @details Dense layer with weights stored at half the size of fixed_t.
+ *
+ * @traceability SRS-012.3
+ */
+FX_QGEMM_DECLARE(fx_matrix_mul_q16_16_q1_15, fx_q16_16_t, fx_q1_15_t, fx_q16_16_t);
+
+#endif /* QFORMAT_H */
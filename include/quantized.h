@@ -0,0 +1,218 @@
+/**
+ * @file quantized.h
+ * @project Certifiable Inference Engine
+ * @brief Int8 and int16 quantized layers with integer-only requantization.
+ *
+ * @details A parallel family to the Q16.16 API for models quantized
+ * affinely: a real value r is stored as q = round(r / s) + z with a
+ * per-tensor scale s and zero point z. Weights are symmetric (z = 0) with
+ * one scale per output channel; activations have a scale and zero point
+ * per tensor.
+ *
+ * A layer computes exact integer sums
+ *
+ *   acc[o] = bias[o] + Σ (x − z_in) · w[o]
+ *
+ * (int32 for int8, int64 for int16) and maps them to the output scale
+ * with fx_requantize(): a fixed-point multiplier M and shift chosen
+ * offline so that M · 2^-(31+shift) ≈ s_in · s_w[o] / s_out. The
+ * activation is applied to the requantized value, then z_out is added
+ * and the result saturated to the storage type. No floating point is
+ * used at run time, so outputs are bit-identical on every platform and
+ * every SIMD backend.
+ *
+ * tools/quantize.py --int8 produces int8 weights, per-channel
+ * multipliers and bias in this format.
+ *
+ * @traceability SRS-011-QUANTIZED
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef QUANTIZED_H
+#define QUANTIZED_H
+
+#include "convolution.h"
+#include "epilogue.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Largest reduction length of an int8 layer.
+ *
+ * @details |x − z_in| ≤ 255 and |w| ≤ 128, so an int32 accumulator is
+ * exact for up to (2^31 − 1) / (255 · 128) = 65793 terms. Dense layers
+ * meet this by their 16-bit dimensions; conv layers with
+ * C_in · K_h · K_w above it are rejected.
+ */
+#define FX_Q8_MAX_K 65535u
+
+/** Largest filter row unit (K_h·K_w for OIHW, C_in for OHWI filters) of an int8 conv */
+#define FX_Q8_KC 1024u
+
+/** Rows (batch samples) of a quantized matmul that share each weight chunk */
+#define FX_Q_BATCH_ROWS 8u
+
+/**
+ * @brief Integer rescale factor M · 2^-(31 + shift).
+ */
+typedef struct {
+    int32_t multiplier;          /**< M in [2^30, 2^31), or 0 for a zero scale */
+    int32_t shift;               /**< -31 ≤ shift ≤ 31 (negative scales up) */
+} fx_requant_t;
+
+/**
+ * @brief Int8 matrix (row-major).
+ */
+typedef struct {
+    int8_t* data;                /**< Pointer to pre-allocated buffer */
+    uint16_t rows;               /**< Number of rows */
+    uint16_t cols;               /**< Number of columns */
+} fx_q8_matrix_t;
+
+/**
+ * @brief Int16 matrix (row-major).
+ */
+typedef struct {
+    int16_t* data;               /**< Pointer to pre-allocated buffer */
+    uint16_t rows;               /**< Number of rows */
+    uint16_t cols;               /**< Number of columns */
+} fx_q16_matrix_t;
+
+/**
+ * @brief Int8 4D tensor, indexed as fx_tensor_t.
+ */
+typedef struct {
+    int8_t* data;                /**< Pointer to pre-allocated buffer */
+    uint16_t n, c, h, w;         /**< Batch, channels, height, width */
+    fx_layout_t layout;          /**< Memory layout */
+} fx_q8_tensor_t;
+
+/**
+ * @brief Int16 4D tensor, indexed as fx_tensor_t.
+ */
+typedef struct {
+    int16_t* data;               /**< Pointer to pre-allocated buffer */
+    uint16_t n, c, h, w;         /**< Batch, channels, height, width */
+    fx_layout_t layout;          /**< Memory layout */
+} fx_q16_tensor_t;
+
+/**
+ * @brief Quantization parameters of one layer.
+ */
+typedef struct {
+    const fx_requant_t* scale;   /**< Accumulator → output rescale */
+    bool per_channel;            /**< scale has one entry per output channel (else one) */
+    const int32_t* bias;         /**< Per output channel at scale s_in·s_w[o], or NULL */
+    int32_t in_zero;             /**< Input zero point */
+    int32_t out_zero;            /**< Output zero point */
+    fx_activation_t act;         /**< Applied before out_zero is added (NONE/RELU/LEAKY_RELU) */
+    fixed_t alpha;               /**< Leaky ReLU slope (Q16.16) */
+} fx_qparams_t;
+
+/**
+ * @brief Rescale an exact accumulator: round(acc · M · 2^-(31+shift)).
+ *
+ * @details Computes floor((acc · M + 2^(s−1)) / 2^s) with s = 31 + shift,
+ * i.e. round half up as everywhere else in the engine, using a 96-bit
+ * intermediate built from 64-bit operations, and saturates to int32.
+ *
+ * @param[in] acc Accumulator
+ * @param[in] rq Rescale factor (multiplier ≥ 0, shift in range)
+ *
+ * @return Rescaled value, saturated; 0 for an out-of-range rq
+ *
+ * @complexity O(1)
+ * @determinism Integer only, platform independent
+ *
+ * @traceability SRS-011.3
+ */
+int32_t fx_requantize(int64_t acc, fx_requant_t rq);
+
+/**
+ * @brief Quantize Q16.16 values: q = sat(fx_requantize(x, rq) + zero).
+ *
+ * @param[in] rq 1 / (s · 2^16) for the target scale s
+ *
+ * @traceability SRS-011.4
+ */
+void fx_q8_quantize(const fixed_t* in, size_t n, fx_requant_t rq, int32_t zero, int8_t* out);
+void fx_q16_quantize(const fixed_t* in, size_t n, fx_requant_t rq, int32_t zero, int16_t* out);
+
+/**
+ * @brief Dequantize to Q16.16: x = fx_requantize(q − zero, rq).
+ *
+ * @param[in] rq s · 2^16 for the source scale s
+ *
+ * @traceability SRS-011.4
+ */
+void fx_q8_dequantize(const int8_t* in, size_t n, fx_requant_t rq, int32_t zero, fixed_t* out);
+void fx_q16_dequantize(const int16_t* in, size_t n, fx_requant_t rq, int32_t zero, fixed_t* out);
+
+/**
+ * @brief Quantized matrix multiplication C = requant(A × B).
+ *
+ * @details A (M×K) holds activations with zero point qp->in_zero, B (K×N)
+ * symmetric weights. Output channels are the columns of C: bias[j] and,
+ * when per_channel, scale[j]. The int8 form runs the dispatched kernels;
+ * the int16 form accumulates in int64.
+ *
+ * Rows are independent samples. They are processed in blocks of
+ * FX_Q_BATCH_ROWS, and each weight chunk is loaded once per block and
+ * reused by all its rows, so a batch costs one weight pass per block
+ * instead of one per sample. Every row equals the result of a one-row
+ * call on that sample.
+ *
+ * @param[in] A Activations
+ * @param[in] B Weights
+ * @param[in] qp Quantization parameters
+ * @param[out] C Result (M × N)
+ *
+ * @pre A->cols == B->rows, C is A->rows × B->cols; otherwise returns early
+ *
+ * @complexity O(M × N × K)
+ * @determinism Bit-identical across platforms and backends
+ *
+ * @traceability SRS-011.1, SRS-011.2
+ */
+void fx_q8_matrix_mul(const fx_q8_matrix_t* A, const fx_q8_matrix_t* B,
+                      const fx_qparams_t* qp, fx_q8_matrix_t* C);
+void fx_q16_matrix_mul(const fx_q16_matrix_t* A, const fx_q16_matrix_t* B,
+                       const fx_qparams_t* qp, fx_q16_matrix_t* C);
+
+/**
+ * @brief Quantized multi-channel 2D convolution.
+ *
+ * @details Geometry as fx_conv2d_multi() (stride, padding, dilation; the
+ * algo field is ignored). Padding holds the real value 0, i.e. in_zero.
+ * Filters are C_out × C_in × K_h × K_w in either layout; OHWI (NHWC)
+ * filters with NHWC activations is the fastest int8 combination.
+ *
+ * @param[in] in Input (N × C_in × H × W)
+ * @param[in] weights Filters (C_out × C_in × K_h × K_w)
+ * @param[in] p Geometry
+ * @param[in] qp Quantization parameters (per output channel)
+ * @param[out] out Output (N × C_out × OH × OW)
+ *
+ * @return FX_CONV_OK, FX_CONV_INVALID_PARAM, FX_CONV_DIM_MISMATCH, or
+ *         FX_CONV_UNSUPPORTED (int8: C_in·K_h·K_w > FX_Q8_MAX_K or a
+ *         filter row unit > FX_Q8_KC)
+ *
+ * @complexity O(N × C_out × OH × OW × C_in × K_h × K_w)
+ * @determinism Bit-identical across platforms, layouts and backends
+ *
+ * @traceability SRS-011.1, SRS-011.2
+ */
+fx_conv_res_t fx_q8_conv2d(const fx_q8_tensor_t* in, const fx_q8_tensor_t* weights,
+                           const fx_conv_params_t* p, const fx_qparams_t* qp,
+                           fx_q8_tensor_t* out);
+fx_conv_res_t fx_q16_conv2d(const fx_q16_tensor_t* in, const fx_q16_tensor_t* weights,
+                            const fx_conv_params_t* p, const fx_qparams_t* qp,
+                            fx_q16_tensor_t* out);
+
+#endif /* QUANTIZED_H */
@@ -0,0 +1,224 @@
+/**
+ * @file sparse.h
+ * @project Certifiable Inference Engine
+ * @brief Sparse and 2:4 structured-sparse weights for dense and
+ *        convolution layers.
+ *
+ * @details A pruned layer stores only its non-zero weights. The weights
+ * are held as an N × K matrix W: one row per output (a column of the
+ * dense layer's K × N operand B, or one conv filter flattened in
+ * (c, i, j) order), K the reduction length. Two formats:
+ *
+ * | Format | Storage per row | MACs per output |
+ * |--------|-----------------|-----------------|
+ * | FX_SPARSE_CSR | nnz values + nnz uint16 columns (+ one row offset) | nnz of the row |
+ * | FX_SPARSE_2_4 | ⌈K/4⌉ × 2 values + ⌈K/4⌉ metadata bytes | exactly ⌈K/4⌉ × 2 |
+ *
+ * 2:4 keeps at most two non-zeros in every group of four consecutive k.
+ * Each group stores exactly two values (a zero fills a group with fewer)
+ * and one byte holding their positions, bits [1:0] and [3:2], ascending.
+ * Work and memory access are then fixed by the shape alone, so the WCET
+ * argument of the dense kernels carries over at about half the
+ * multiplies and 56 % of the weight bytes.
+ *
+ * Every output is one 64-bit accumulator over its stored products in
+ * ascending k, rounded once. Skipped weights are exact zeros, so the
+ * results are bit-identical to fx_matrix_mul_fused() and
+ * fx_conv2d_multi() on the dense weights.
+ *
+ * Weights are packed offline by tools/quantize.py (--sparse csr|2:4),
+ * which emits an fx_sparse_matrix_t initializer, or at start-up by
+ * fx_sparse_pack().
+ *
+ * @traceability SRS-019
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef SPARSE_H
+#define SPARSE_H
+
+#include "matrix.h"
+#include "convolution.h"
+#include "epilogue.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/** Group width of the structured format */
+#define FX_SPARSE_GROUP 4
+
+/** Values stored per group of the structured format */
+#define FX_SPARSE_KEEP 2
+
+/** Groups per row of K reduction elements */
+#define FX_SPARSE_GROUPS(k) (((size_t)(k) + FX_SPARSE_GROUP - 1u) / FX_SPARSE_GROUP)
+
+/**
+ * @brief Storage format.
+ */
+typedef enum {
+    FX_SPARSE_CSR = 0,           /**< Compressed sparse rows */
+    FX_SPARSE_2_4                /**< Two of every four, fixed work */
+} fx_sparse_format_t;
+
+/**
+ * @brief Result codes for sparse operations.
+ */
+typedef enum {
+    FX_SPARSE_OK = 0,            /**< Success */
+    FX_SPARSE_INVALID_PARAM,     /**< NULL pointer, unknown format or bad geometry */
+    FX_SPARSE_DIM_MISMATCH,      /**< Operand shapes inconsistent */
+    FX_SPARSE_CORRUPT,           /**< Offsets or positions out of order or range */
+    FX_SPARSE_NOT_2_4,           /**< A group has more than two non-zeros */
+    FX_SPARSE_CAPACITY,          /**< Storage shorter than required */
+    FX_SPARSE_WORKSPACE_TOO_SMALL /**< Convolution workspace shorter than K */
+} fx_sparse_res_t;
+
+/**
+ * @brief N × K sparse weight matrix (all arrays caller owned, read only).
+ */
+typedef struct {
+    fx_sparse_format_t format;   /**< Storage format */
+    uint16_t rows;               /**< N: outputs (dense columns or conv filters) */
+    uint16_t cols;               /**< K: reduction length */
+    const fixed_t* values;       /**< CSR: row_ptr[N] values; 2:4: N × groups × 2 */
+    const uint16_t* col_idx;     /**< CSR: k of each value, ascending per row */
+    const uint32_t* row_ptr;     /**< CSR: N + 1 offsets, row_ptr[0] = 0 */
+    const uint8_t* meta;         /**< 2:4: N × groups position bytes */
+} fx_sparse_matrix_t;
+
+/**
+ * @brief Validate a sparse matrix before first use.
+ *
+ * @details CSR: offsets non-decreasing from 0, columns strictly
+ * ascending per row and below K. 2:4: both positions of a group
+ * ascending and inside K. Kernels assume a checked matrix.
+ *
+ * @return FX_SPARSE_OK, FX_SPARSE_INVALID_PARAM or FX_SPARSE_CORRUPT
+ *
+ * @complexity O(N + stored values)
+ *
+ * @traceability SRS-019.1, SRS-019.2
+ */
+fx_sparse_res_t fx_sparse_check(const fx_sparse_matrix_t* w);
+
+/**
+ * @brief Values a dense matrix needs in a format.
+ *
+ * @details Element (n, k) of the dense source is at
+ * src[n × row_stride + k × col_stride]: (K, 1) for an N × K row-major
+ * matrix or conv filters, (1, N) for the K × N operand of a dense layer.
+ *
+ * @return CSR: non-zeros; 2:4: N × ⌈K/4⌉ × 2; 0 on invalid arguments
+ *
+ * @complexity O(N × K) for CSR, O(1) for 2:4
+ *
+ * @traceability SRS-019.3
+ */
+size_t fx_sparse_values_size(const fixed_t* src, uint16_t rows, uint16_t cols,
+                             size_t row_stride, size_t col_stride, fx_sparse_format_t format);
+
+/**
+ * @brief Compress a dense matrix.
+ *
+ * @param[in] src Dense source (strides as fx_sparse_values_size())
+ * @param[in] rows N
+ * @param[in] cols K
+ * @param[in] row_stride Elements between rows of the source
+ * @param[in] col_stride Elements between columns of the source
+ * @param[in] format Target format
+ * @param[out] values At least fx_sparse_values_size() elements
+ * @param[in] values_len Length of values
+ * @param[out] col_idx CSR: values_len elements (NULL for 2:4)
+ * @param[out] row_ptr CSR: N + 1 elements (NULL for 2:4)
+ * @param[out] meta 2:4: N × ⌈K/4⌉ bytes (NULL for CSR)
+ * @param[out] out Matrix over the storage
+ *
+ * @return FX_SPARSE_OK, FX_SPARSE_INVALID_PARAM, FX_SPARSE_CAPACITY or
+ *         FX_SPARSE_NOT_2_4 (the source must already be pruned); the
+ *         storage and out are untouched on error
+ *
+ * @complexity O(N × K), plus one scan of the source for 2:4
+ *
+ * @traceability SRS-019.3
+ */
+fx_sparse_res_t fx_sparse_pack(const fixed_t* src, uint16_t rows, uint16_t cols,
+                               size_t row_stride, size_t col_stride, fx_sparse_format_t format,
+                               fixed_t* values, size_t values_len, uint16_t* col_idx,
+                               uint32_t* row_ptr, uint8_t* meta, fx_sparse_matrix_t* out);
+
+/**
+ * @brief C = A × Wᵀ for a dense layer with sparse weights.
+ *
+ * @param[in] A M × K activations
+ * @param[in] W N × K weights (fx_sparse_check() passed)
+ * @param[out] C M × N output
+ *
+ * @return FX_SPARSE_OK, FX_SPARSE_INVALID_PARAM or FX_SPARSE_DIM_MISMATCH;
+ *         C untouched on error
+ *
+ * @complexity O(M × stored values)
+ * @determinism Bit-identical to fx_matrix_mul(A, B) with B = Wᵀ dense
+ *
+ * @traceability SRS-019.4
+ */
+fx_sparse_res_t fx_sparse_matmul(const fx_matrix_t* A, const fx_sparse_matrix_t* W,
+                                 fx_matrix_t* C);
+
+/**
+ * @brief Dense layer C = act(A × Wᵀ + bias) with sparse weights.
+ *
+ * @param[in] bias 1 × N row, or NULL
+ *
+ * @determinism Bit-identical to fx_matrix_mul_fused() on the dense weights
+ *
+ * @traceability SRS-019.4, SRS-004.9
+ */
+fx_sparse_res_t fx_sparse_matmul_fused(const fx_matrix_t* A, const fx_sparse_matrix_t* W,
+                                       const fx_matrix_t* bias, fx_activation_t act,
+                                       fixed_t alpha, fx_matrix_t* C);
+
+/**
+ * @brief Workspace required by fx_sparse_conv2d(): one receptive field.
+ *
+ * @return W->cols elements, or 0 if W is NULL
+ *
+ * @traceability SRS-019.5
+ */
+size_t fx_sparse_conv2d_workspace_size(const fx_sparse_matrix_t* W);
+
+/**
+ * @brief Multi-channel convolution with sparse filters.
+ *
+ * @details Each output pixel's receptive field is gathered once into the
+ * workspace in (c, i, j) order, zeros for padding, and every filter takes
+ * its sparse dot product with it.
+ *
+ * @param[in] in N × C_in × H × W input, either layout
+ * @param[in] W C_out × (C_in × kh × kw) filters (fx_sparse_check() passed)
+ * @param[in] kh Kernel height
+ * @param[in] kw Kernel width
+ * @param[in] bias C_out values, or NULL
+ * @param[in] params Stride, padding and dilation (algo ignored)
+ * @param[in,out] workspace fx_sparse_conv2d_workspace_size() elements
+ * @param[in] workspace_len Length of workspace
+ * @param[out] out N × C_out × OH × OW, either layout
+ *
+ * @return FX_SPARSE_OK, FX_SPARSE_INVALID_PARAM, FX_SPARSE_DIM_MISMATCH
+ *         or FX_SPARSE_WORKSPACE_TOO_SMALL; out untouched on error
+ *
+ * @complexity O(N × OH × OW × (C_in × kh × kw + stored values))
+ * @determinism Bit-identical to fx_conv2d_multi() on the dense filters
+ *
+ * @traceability SRS-019.5
+ */
+fx_sparse_res_t fx_sparse_conv2d(const fx_tensor_t* in, const fx_sparse_matrix_t* W,
+                                 uint16_t kh, uint16_t kw, const fixed_t* bias,
+                                 const fx_conv_params_t* params, fixed_t* workspace,
+                                 size_t workspace_len, fx_tensor_t* out);
+
+#endif /* SPARSE_H */
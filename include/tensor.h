@@ -0,0 +1,128 @@
+/**
+ * @file tensor.h
+ * @project Certifiable Inference Engine
+ * @brief Four-dimensional fixed-point tensors for multi-channel layers.
+ *
+ * @details A tensor is a caller-owned buffer viewed as N×C×H×W elements
+ * (batch, channel, height, width) in one of two memory layouts:
+ * - FX_LAYOUT_NCHW: element (n,c,h,w) at ((n*C + c)*H + h)*W + w
+ * - FX_LAYOUT_NHWC: element (n,c,h,w) at ((n*H + h)*W + w)*C + c
+ *
+ * Layout is recorded in the tensor so producers and consumers can disagree
+ * without a copy; all indexing goes through fx_tensor_offset().
+ *
+ * @traceability SRS-006.8
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef TENSOR_H
+#define TENSOR_H
+
+#include "fixed_point.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Memory layout of a 4D tensor.
+ */
+typedef enum {
+    FX_LAYOUT_NCHW = 0,          /**< Channel planes (row-major per plane) */
+    FX_LAYOUT_NHWC               /**< Channels interleaved per pixel */
+} fx_layout_t;
+
+/**
+ * @brief 4D tensor structure for fixed-point data.
+ *
+ * @note Memory managed by caller - no dynamic allocation.
+ */
+typedef struct {
+    fixed_t* data;               /**< Pointer to pre-allocated buffer */
+    uint16_t n;                  /**< Batch size */
+    uint16_t c;                  /**< Channels */
+    uint16_t h;                  /**< Height */
+    uint16_t w;                  /**< Width */
+    fx_layout_t layout;          /**< Memory layout */
+} fx_tensor_t;
+
+/**
+ * @brief Initialize a tensor using a provided buffer (zeros buffer).
+ *
+ * @param[out] t Tensor structure to initialize
+ * @param[in] buffer Pre-allocated memory buffer
+ * @param[in] n Batch size
+ * @param[in] c Channels
+ * @param[in] h Height
+ * @param[in] w Width
+ * @param[in] layout Memory layout
+ *
+ * @pre buffer size >= n * c * h * w * sizeof(fixed_t)
+ * @post Tensor initialized and zeroed
+ *
+ * @complexity O(n * c * h * w) for zeroing
+ * @determinism Always produces same initial state
+ *
+ * @traceability SRS-006.8
+ */
+void fx_tensor_init(fx_tensor_t* t, fixed_t* buffer,
+                    uint16_t n, uint16_t c, uint16_t h, uint16_t w,
+                    fx_layout_t layout);
+
+/**
+ * @brief Attach a pre-populated buffer to a tensor (no zeroing).
+ *
+ * @param[out] t Tensor structure to initialize
+ * @param[in] buffer Pre-allocated memory buffer (contents preserved)
+ * @param[in] n Batch size
+ * @param[in] c Channels
+ * @param[in] h Height
+ * @param[in] w Width
+ * @param[in] layout Memory layout
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-006.8
+ */
+static inline void fx_tensor_attach(fx_tensor_t* t, fixed_t* buffer,
+                                    uint16_t n, uint16_t c, uint16_t h, uint16_t w,
+                                    fx_layout_t layout) {
+    if (!t || !buffer) {
+        return;
+    }
+    t->data = buffer;
+    t->n = n;
+    t->c = c;
+    t->h = h;
+    t->w = w;
+    t->layout = layout;
+}
+
+/**
+ * @brief Number of elements in a tensor.
+ *
+ * @complexity O(1)
+ */
+static inline size_t fx_tensor_size(const fx_tensor_t* t) {
+    return (size_t)t->n * t->c * t->h * t->w;
+}
+
+/**
+ * @brief Element offset of (n, c, h, w) in the tensor's layout.
+ *
+ * @pre Indices within the tensor dimensions
+ *
+ * @complexity O(1)
+ */
+static inline size_t fx_tensor_offset(const fx_tensor_t* t,
+                                      size_t n, size_t c, size_t h, size_t w) {
+    if (t->layout == FX_LAYOUT_NHWC) {
+        return ((n * t->h + h) * t->w + w) * t->c + c;
+    }
+    return ((n * t->c + c) * t->h + h) * t->w + w;
+}
+
+#endif /* TENSOR_H */
@@ -0,0 +1,162 @@
+/**
+ * @file threadpool.h
+ * @project Certifiable Inference Engine
+ * @brief Optional fixed-size worker pool for deterministic tiled kernels.
+ *
+ * @details fx_matrix_mul(), fx_matrix_mul_fused(), fx_conv2d(),
+ * fx_conv2d_multi(), fx_conv2d_fused() and the im2col path of
+ * fx_conv2d_layer() split their output into fixed tiles when a pool is
+ * running:
+ *
+ * | Primitive | Tile unit |
+ * |-----------|-----------|
+ * | GEMM (dense, im2col) | FX_GEMM_MR output rows, or FX_GEMM_NR columns when there are too few rows |
+ * | fx_conv2d | Output rows (input band of rows + kernel height − 1) |
+ * | fx_conv2d_multi / fx_conv2d_fused | Output rows of every batch and filter |
+ *
+ * The partition is static: the number of parts and the span of each
+ * depend only on the shape and the thread count, and part p always runs
+ * on thread p mod threads. Every output element is computed by exactly one
+ * thread with the same single 64-bit accumulator, in the same order, as
+ * the serial kernel, so results are bit-identical for any thread count,
+ * including 1. Work below FX_POOL_MIN_WORK multiply-accumulates per part
+ * is not split, which keeps small layers on the caller with no hand-off
+ * latency.
+ *
+ * The pool is created once with fx_pool_start() and reused by every call;
+ * running a task allocates nothing. All state is static. Only one task
+ * runs at a time: a call made while the pool is busy (from another
+ * application thread or from inside a task) executes its parts serially
+ * on the calling thread, which gives the same bits.
+ *
+ * Threads are available when the library is built with CI_THREADS=ON and
+ * the platform has POSIX threads; otherwise fx_pool_start() reports
+ * FX_POOL_UNSUPPORTED for more than one thread and everything runs
+ * serially.
+ *
+ * @traceability SRS-013-THREADING
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/** Largest pool size, counting the calling thread */
+#define FX_POOL_MAX_THREADS 64
+
+/** Minimum multiply-accumulates per part before a kernel is split */
+#define FX_POOL_MIN_WORK 32768u
+
+/**
+ * @brief Result codes for pool operations.
+ */
+typedef enum {
+    FX_POOL_OK = 0,              /**< Success */
+    FX_POOL_INVALID_PARAM,       /**< Thread count 0 or above FX_POOL_MAX_THREADS */
+    FX_POOL_UNSUPPORTED,         /**< Built without thread support */
+    FX_POOL_BUSY,                /**< Pool already running */
+    FX_POOL_SYSTEM               /**< Worker creation failed (pool left stopped) */
+} fx_pool_res_t;
+
+/**
+ * @brief Task body run once per part.
+ *
+ * @param[in] ctx Task context passed to fx_pool_run()
+ * @param[in] part Part index, 0 … parts − 1
+ * @param[in] parts Total number of parts
+ */
+typedef void (*fx_pool_task_fn)(void* ctx, unsigned part, unsigned parts);
+
+/**
+ * @brief Start the pool with @p threads threads, counting the caller.
+ *
+ * @details Creates threads − 1 workers that sleep until a task is posted.
+ * threads == 1 is valid and keeps every kernel serial.
+ *
+ * @param[in] threads 1 … FX_POOL_MAX_THREADS
+ *
+ * @return FX_POOL_OK, FX_POOL_INVALID_PARAM, FX_POOL_BUSY if already
+ *         started, FX_POOL_UNSUPPORTED for threads > 1 without thread
+ *         support, FX_POOL_SYSTEM if a worker could not be created
+ *
+ * @pre No primitive is executing concurrently
+ *
+ * @traceability SRS-013.1
+ */
+fx_pool_res_t fx_pool_start(unsigned threads);
+
+/**
+ * @brief Stop and join all workers (no-op if not started).
+ *
+ * @pre No primitive is executing concurrently
+ *
+ * @traceability SRS-013.1
+ */
+void fx_pool_stop(void);
+
+/**
+ * @brief Number of threads tasks are spread over.
+ *
+ * @return Pool size including the caller; 1 when not started
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-013.1
+ */
+unsigned fx_pool_threads(void);
+
+/**
+ * @brief Run fn(ctx, p, parts) for every p < parts and wait for all.
+ *
+ * @details Part p runs on thread p mod fx_pool_threads(); the caller is
+ * thread 0. Parts must write disjoint outputs. When the pool is not
+ * running or is busy, all parts run on the caller in ascending order.
+ *
+ * @param[in] fn Task body
+ * @param[in] ctx Task context
+ * @param[in] parts Number of parts (0 runs nothing)
+ *
+ * @complexity One wake-up and one join per call; no allocation
+ *
+ * @traceability SRS-013.2
+ */
+void fx_pool_run(fx_pool_task_fn fn, void* ctx, unsigned parts);
+
+/**
+ * @brief Number of parts to split a kernel into.
+ *
+ * @param[in] units Indivisible output tiles available
+ * @param[in] work Total multiply-accumulates of the kernel
+ *
+ * @return min(fx_pool_threads(), units, work / FX_POOL_MIN_WORK), at least 1
+ *
+ * @determinism Depends only on the arguments and the pool size
+ *
+ * @traceability SRS-013.3
+ */
+unsigned fx_pool_parts(size_t units, uint64_t work);
+
+/**
+ * @brief Span [begin, end) of @p units owned by @p part.
+ *
+ * @details Static even split: part p owns units ⌊p·units/parts⌋ up to
+ * ⌊(p+1)·units/parts⌋, so spans differ by at most one unit.
+ *
+ * @traceability SRS-013.3
+ */
+static inline void fx_pool_span(size_t units, unsigned part, unsigned parts,
+                                size_t* begin, size_t* end) {
+    *begin = (size_t)(((uint64_t)units * part) / parts);
+    *end = (size_t)(((uint64_t)units * (part + 1u)) / parts);
+}
+
+#endif /* THREADPOOL_H */
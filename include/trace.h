@@ -0,0 +1,262 @@
+/**
+ * @file trace.h
+ * @project Certifiable Inference Engine
+ * @brief Per-layer kernel tracing into a caller-provided ring buffer.
+ *
+ * @details With the library built with CI_TRACE, every public kernel in
+ * src/core records one event per call: kernel, layer, up to three
+ * dimensions, the active backend and counter values at entry and exit.
+ * Events go into a fixed-size ring owned by the caller; the hot path
+ * neither allocates nor prints, and when the ring wraps the oldest events
+ * are overwritten. fx_graph_run() adds one FX_TRACE_LAYER span per op and
+ * sets the layer ID of the kernels inside it to the op index.
+ *
+ * Without CI_TRACE (the default, and always in Release builds) the hook
+ * macros expand to nothing: no call, no load, no argument evaluation.
+ * The ring, fx_trace_begin() / fx_trace_end() for application spans and
+ * the exporters remain available either way.
+ *
+ * Exporters write into a caller buffer with snprintf() semantics:
+ * - fx_trace_export_chrome(): Chrome trace event JSON, for
+ *   chrome://tracing, Perfetto or speedscope
+ * - fx_trace_export_folded(): folded stacks ("layer 2;conv2d_im2col 1234"
+ *   in self ticks) for flamegraph.pl, inferno and `perf script` tooling
+ *
+ * @traceability SRS-007.12
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Nesting depth recorded per thread; deeper calls are not traced */
+#define FX_TRACE_MAX_DEPTH 8
+
+/** Layer ID of events outside any layer */
+#define FX_TRACE_NO_LAYER UINT32_MAX
+
+/**
+ * @brief Traced kernels and the meaning of their dimensions.
+ */
+typedef enum {
+    FX_TRACE_USER = 0,           /**< Application span (dims as given) */
+    FX_TRACE_LAYER,              /**< Graph op: C, H, W of its output */
+    FX_TRACE_MATMUL,             /**< fx_matrix_mul: M, N, K */
+    FX_TRACE_MATMUL_FUSED,       /**< fx_matrix_mul_fused: M, N, K */
+    FX_TRACE_MATMUL_PACKED,      /**< fx_matrix_mul_packed_fused: M, N, K */
+    FX_TRACE_VECTOR_DOT,         /**< fx_vector_dot: length */
+    FX_TRACE_CONV2D,             /**< fx_conv2d: out rows, out cols, kernel rows × cols */
+    FX_TRACE_CONV2D_DIRECT,      /**< Direct multi-channel: C_out, OH, OW */
+    FX_TRACE_CONV2D_IM2COL,      /**< im2col + GEMM: C_out, OH, OW */
+    FX_TRACE_CONV2D_WINOGRAD,    /**< Winograd F(2×2, 3×3): C_out, OH, OW */
+    FX_TRACE_MAXPOOL_2X2,        /**< fx_maxpool_2x2: in rows, in cols */
+    FX_TRACE_POOL2D,             /**< fx_pool2d: C, OH, OW */
+    FX_TRACE_GLOBAL_AVGPOOL,     /**< fx_global_avgpool: N, C, H × W */
+    FX_TRACE_RELU,               /**< Elements */
+    FX_TRACE_LEAKY_RELU,         /**< Elements */
+    FX_TRACE_SIGMOID,            /**< Elements */
+    FX_TRACE_TANH,               /**< Elements */
+    FX_TRACE_GELU,               /**< Elements */
+    FX_TRACE_SOFTMAX,            /**< Rows, cols */
+    FX_TRACE_ELEMENTWISE,        /**< fx_ew_apply: elements, ops */
+    FX_TRACE_Q8_MATMUL,          /**< fx_q8_matrix_mul: M, N, K */
+    FX_TRACE_Q16_MATMUL,         /**< fx_q16_matrix_mul: M, N, K */
+    FX_TRACE_Q8_CONV2D,          /**< fx_q8_conv2d: C_out, OH, OW */
+    FX_TRACE_Q16_CONV2D,         /**< fx_q16_conv2d: C_out, OH, OW */
+    FX_TRACE_VIEW_MATMUL,        /**< fx_view_matmul: M, N, K */
+    FX_TRACE_VIEW_CONV2D,        /**< fx_view_conv2d: out rows, out cols, kernel rows × cols */
+    FX_TRACE_VIEW_MAXPOOL_2X2,   /**< fx_view_maxpool_2x2: in rows, in cols */
+    FX_TRACE_INPUT_CONVERT,      /**< fx_input_convert: C, H, W */
+    FX_TRACE_SPARSE_MATMUL,      /**< fx_sparse_matmul(_fused): M, N, K */
+    FX_TRACE_SPARSE_CONV2D,      /**< fx_sparse_conv2d: C_out, OH, OW */
+    FX_TRACE_QGEMM,              /**< FX_QGEMM_DEFINE kernels: M, N, K */
+    FX_TRACE_KERNEL_COUNT        /**< Number of enumerators */
+} fx_trace_kernel_t;
+
+/**
+ * @brief One traced call (56 bytes).
+ */
+typedef struct {
+    uint64_t begin;              /**< fx_trace_clock() at entry */
+    uint64_t end;                /**< fx_trace_clock() at exit, 0 while open */
+    uint64_t nested;             /**< Ticks spent in traced calls made from this one */
+    uint64_t parent;             /**< Token of the enclosing event, 0 at top level */
+    uint32_t layer;              /**< Layer ID at entry or FX_TRACE_NO_LAYER */
+    uint32_t dims[3];            /**< Per fx_trace_kernel_t, unused = 0 */
+    uint16_t kernel;             /**< fx_trace_kernel_t */
+    uint8_t backend;             /**< fx_backend_t active at entry */
+    uint8_t thread;              /**< Small per-thread index, in order of first event */
+    uint32_t reserved;           /**< Zero */
+} fx_trace_event_t;
+
+/**
+ * @brief Event ring over caller storage.
+ * @note Memory managed by caller.
+ */
+typedef struct {
+    fx_trace_event_t* events;    /**< Storage of mask + 1 events */
+    uint32_t mask;               /**< Capacity − 1 (capacity is a power of two) */
+    uint64_t head;               /**< Events ever recorded; the next token */
+} fx_trace_ring_t;
+
+/**
+ * @brief Result codes for tracing operations.
+ */
+typedef enum {
+    FX_TRACE_OK = 0,             /**< Success */
+    FX_TRACE_INVALID_PARAM       /**< NULL storage or capacity not a power of two */
+} fx_trace_res_t;
+
+/*
+ * Kernel hooks. The library defines CI_TRACE privately when built with
+ * -DCI_TRACE=ON; an application may define it to trace its own code.
+ */
+#if defined(CI_TRACE)
+#define FX_TRACE_BEGIN(kernel, d0, d1, d2) \
+    const uint64_t fx_trace_token_ = fx_trace_begin((kernel), (uint32_t)(d0), \
+                                                    (uint32_t)(d1), (uint32_t)(d2))
+#define FX_TRACE_END() fx_trace_end(fx_trace_token_)
+#define FX_TRACE_SET_LAYER(layer) fx_trace_set_layer(layer)
+#else
+#define FX_TRACE_BEGIN(kernel, d0, d1, d2) ((void)0)
+#define FX_TRACE_END() ((void)0)
+#define FX_TRACE_SET_LAYER(layer) ((void)0)
+#endif
+
+/**
+ * @brief Initialize a ring over caller storage.
+ *
+ * @param[out] ring Ring to initialize
+ * @param[in] storage Array of @p capacity events
+ * @param[in] capacity Power of two, 1 … 2³¹
+ *
+ * @return FX_TRACE_OK or FX_TRACE_INVALID_PARAM
+ *
+ * @complexity O(capacity) (storage is zeroed)
+ *
+ * @traceability SRS-007.12
+ */
+fx_trace_res_t fx_trace_ring_init(fx_trace_ring_t* ring, fx_trace_event_t* storage,
+                                  uint32_t capacity);
+
+/**
+ * @brief Make @p ring the destination of every event (NULL stops tracing).
+ *
+ * @details One ring is active per process; hooks on every thread write
+ * into it. Detach before reading the ring while kernels may still run.
+ *
+ * @traceability SRS-007.12
+ */
+void fx_trace_attach(fx_trace_ring_t* ring);
+
+/**
+ * @brief True if the library was built with its kernel hooks (CI_TRACE).
+ */
+bool fx_trace_hooks_compiled(void);
+
+/**
+ * @brief Open an event on the calling thread.
+ *
+ * @return Token for fx_trace_end(), or 0 if nothing is recorded (no ring
+ *         attached, or the thread is FX_TRACE_MAX_DEPTH calls deep)
+ *
+ * @complexity O(1), lock-free
+ *
+ * @traceability SRS-007.12
+ */
+uint64_t fx_trace_begin(fx_trace_kernel_t kernel, uint32_t d0, uint32_t d1, uint32_t d2);
+
+/**
+ * @brief Close the innermost open event of the calling thread.
+ *
+ * @details Events must be closed in reverse order of opening. A token of
+ * 0 is ignored. If the ring has wrapped over the event meanwhile, the
+ * newer event in its slot is left untouched.
+ *
+ * @traceability SRS-007.12
+ */
+void fx_trace_end(uint64_t token);
+
+/**
+ * @brief Set the layer ID recorded by later events on the calling thread.
+ *
+ * @param[in] layer Layer ID, or FX_TRACE_NO_LAYER
+ */
+void fx_trace_set_layer(uint32_t layer);
+
+/** @brief Layer ID of the calling thread */
+uint32_t fx_trace_layer(void);
+
+/**
+ * @brief Trace counter: rdtsc on x86, cntvct_el0 on AArch64, else ns.
+ */
+uint64_t fx_trace_clock(void);
+
+/**
+ * @brief Counter ticks per µs, measured against CLOCK_MONOTONIC.
+ *
+ * @details Busy-waits about 10 ms; call once, outside the traced region.
+ */
+double fx_trace_ticks_per_us(void);
+
+/** @brief Events held by the ring (at most its capacity) */
+size_t fx_trace_count(const fx_trace_ring_t* ring);
+
+/** @brief Events overwritten since fx_trace_ring_init() */
+uint64_t fx_trace_lost(const fx_trace_ring_t* ring);
+
+/**
+ * @brief Event @p i of the ring, oldest first (entry order).
+ *
+ * @return The event, or NULL if i ≥ fx_trace_count()
+ */
+const fx_trace_event_t* fx_trace_event_at(const fx_trace_ring_t* ring, size_t i);
+
+/** @brief Short name of a kernel ("matmul", "conv2d_im2col", …) */
+const char* fx_trace_kernel_name(fx_trace_kernel_t kernel);
+
+/**
+ * @brief Write the closed events as Chrome trace event JSON.
+ *
+ * @details One complete ("X") event per call; ts and dur in µs relative
+ * to the earliest event, tid = fx_trace_event_t.thread, args with layer,
+ * dims, backend and ticks. Output is truncated to len − 1 bytes and
+ * NUL-terminated, as snprintf().
+ *
+ * @param[in] ticks_per_us From fx_trace_ticks_per_us()
+ *
+ * @return Length of the full output excluding the NUL
+ *
+ * @complexity O(count)
+ *
+ * @traceability SRS-007.12
+ */
+size_t fx_trace_export_chrome(const fx_trace_ring_t* ring, double ticks_per_us,
+                              char* buf, size_t len);
+
+/**
+ * @brief Write the closed events as folded stacks with self ticks.
+ *
+ * @details One line per event: its enclosing events and itself joined by
+ * ';' (a layer span as "layer N"), a space and the ticks not spent in
+ * nested events. Tools that merge identical stacks turn it into a flame
+ * graph. snprintf() semantics as fx_trace_export_chrome().
+ *
+ * @return Length of the full output excluding the NUL
+ *
+ * @complexity O(count × FX_TRACE_MAX_DEPTH)
+ *
+ * @traceability SRS-007.12
+ */
+size_t fx_trace_export_folded(const fx_trace_ring_t* ring, char* buf, size_t len);
+
+#endif /* TRACE_H */
@@ -0,0 +1,242 @@
+/**
+ * @file view.h
+ * @project Certifiable Inference Engine
+ * @brief Strided N-D views: wide dimensions, explicit strides, no copies.
+ *
+ * @details A view describes up to FX_VIEW_MAX_RANK dimensions of a
+ * caller-owned buffer by an origin pointer, a 32-bit extent per dimension
+ * and an element stride per dimension, outermost first:
+ *
+ *   element (i0, …, ik) at data + Σ i_d · stride[d]
+ *
+ * Sub-regions are views of the same storage. An ROI crop of an image is
+ * two fx_view_slice() calls, a channel of an NCHW or NHWC tensor is one
+ * fx_view_select(), and the interior of a padded buffer is a slice that
+ * a producer writes directly. Offsets are computed in size_t, so a single
+ * plane may exceed the 65535 × 65535 limit of fx_matrix_t (a 1920×1080
+ * frame, a 70000-wide row).
+ *
+ * The operations below accept any strides. Where every operand is
+ * contiguous along its innermost dimension the work goes through the
+ * same kernels as the matrix API (fx_gemm() with leading dimensions, the
+ * element-wise engine per row, fx_conv2d() / fx_maxpool_2x2() when the
+ * view is an ordinary matrix), and the result is bit-identical to the
+ * matrix functions on a copy of the region. fx_matrix_t and fx_tensor_t
+ * remain the compact descriptors for whole buffers; fx_view_from_matrix()
+ * and fx_view_from_tensor() lift them.
+ *
+ * @traceability SRS-016
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef VIEW_H
+#define VIEW_H
+
+#include "matrix.h"
+#include "tensor.h"
+#include "elementwise.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Maximum number of dimensions of a view */
+#define FX_VIEW_MAX_RANK 4
+
+/**
+ * @brief Strided view of fixed-point elements.
+ * @note Memory managed by caller - a view never owns its data.
+ */
+typedef struct {
+    fixed_t* data;                       /**< Element (0, …, 0) */
+    unsigned rank;                       /**< Dimensions, 1 … FX_VIEW_MAX_RANK */
+    uint32_t shape[FX_VIEW_MAX_RANK];    /**< Extent per dimension, outermost first */
+    size_t stride[FX_VIEW_MAX_RANK];     /**< Elements between neighbours per dimension */
+} fx_view_t;
+
+/**
+ * @brief Result codes for view operations.
+ */
+typedef enum {
+    FX_VIEW_OK = 0,              /**< Success */
+    FX_VIEW_INVALID_PARAM,       /**< NULL pointer, bad rank or dimension index */
+    FX_VIEW_OUT_OF_RANGE,        /**< Slice or index outside the view */
+    FX_VIEW_DIM_MISMATCH         /**< Operand shapes do not agree */
+} fx_view_res_t;
+
+/**
+ * @brief Dense row-major view of a buffer.
+ *
+ * @param[out] v View to initialize
+ * @param[in] data Buffer of at least Π shape elements
+ * @param[in] rank Number of dimensions (1 … FX_VIEW_MAX_RANK)
+ * @param[in] shape Extent per dimension
+ *
+ * @return FX_VIEW_OK or FX_VIEW_INVALID_PARAM
+ *
+ * @complexity O(rank)
+ *
+ * @traceability SRS-016.1
+ */
+fx_view_res_t fx_view_init(fx_view_t* v, fixed_t* data, unsigned rank, const uint32_t* shape);
+
+/**
+ * @brief Two-dimensional view with an explicit row stride (pitch).
+ *
+ * @param[in] row_stride Elements from one row to the next, ≥ cols
+ *
+ * @return FX_VIEW_OK or FX_VIEW_INVALID_PARAM
+ *
+ * @traceability SRS-016.1
+ */
+fx_view_res_t fx_view_init_2d(fx_view_t* v, fixed_t* data, uint32_t rows, uint32_t cols,
+                              size_t row_stride);
+
+/**
+ * @brief View of a whole matrix (rank 2).
+ *
+ * @traceability SRS-016.1
+ */
+fx_view_res_t fx_view_from_matrix(fx_view_t* v, const fx_matrix_t* mat);
+
+/**
+ * @brief View of a whole tensor (rank 4, dimensions in N, C, H, W order).
+ *
+ * @details The strides follow the tensor's layout, so the same indices
+ * address the same element for NCHW and NHWC storage.
+ *
+ * @traceability SRS-016.1
+ */
+fx_view_res_t fx_view_from_tensor(fx_view_t* v, const fx_tensor_t* t);
+
+/**
+ * @brief Restrict one dimension to [start, start + len).
+ *
+ * @return FX_VIEW_OUT_OF_RANGE if the range leaves the view; out unchanged
+ *
+ * @complexity O(rank)
+ *
+ * @traceability SRS-016.2
+ */
+fx_view_res_t fx_view_slice(fx_view_t* out, const fx_view_t* in, unsigned dim,
+                            uint32_t start, uint32_t len);
+
+/**
+ * @brief Fix one dimension at @p index, dropping it (rank − 1 ≥ 1).
+ *
+ * @return FX_VIEW_OUT_OF_RANGE if index ≥ shape[dim]; out unchanged
+ *
+ * @traceability SRS-016.2
+ */
+fx_view_res_t fx_view_select(fx_view_t* out, const fx_view_t* in, unsigned dim, uint32_t index);
+
+/**
+ * @brief Number of elements in a view.
+ *
+ * @complexity O(rank)
+ */
+static inline size_t fx_view_size(const fx_view_t* v) {
+    size_t n = 1;
+    for (unsigned d = 0; d < v->rank; d++) {
+        n *= v->shape[d];
+    }
+    return n;
+}
+
+/**
+ * @brief True if the elements are dense and row-major (one memcpy range).
+ *
+ * @traceability SRS-016.1
+ */
+bool fx_view_is_contiguous(const fx_view_t* v);
+
+/**
+ * @brief Pointer to the element at @p idx (rank indices).
+ *
+ * @pre idx[d] < shape[d] for every d
+ *
+ * @complexity O(rank)
+ */
+static inline fixed_t* fx_view_at(const fx_view_t* v, const uint32_t* idx) {
+    size_t off = 0;
+    for (unsigned d = 0; d < v->rank; d++) {
+        off += (size_t)idx[d] * v->stride[d];
+    }
+    return v->data + off;
+}
+
+/**
+ * @brief Element-wise copy between views of the same shape.
+ *
+ * @details Views must not overlap unless identical.
+ *
+ * @traceability SRS-016.3
+ */
+fx_view_res_t fx_view_copy(fx_view_t* dst, const fx_view_t* src);
+
+/**
+ * @brief Set every element of a view to @p value.
+ *
+ * @traceability SRS-016.3
+ */
+fx_view_res_t fx_view_fill(fx_view_t* v, fixed_t value);
+
+/**
+ * @brief Apply an element-wise op chain (SRS-015) to every element, in place.
+ *
+ * @return FX_VIEW_OK, or FX_VIEW_INVALID_PARAM for a rejected chain
+ *
+ * @determinism Bit-identical to fx_ew_apply() on a dense copy
+ *
+ * @traceability SRS-016.3, SRS-015.1
+ */
+fx_view_res_t fx_view_apply_ops(fx_view_t* v, const fx_ew_op_t* ops, size_t count);
+
+/**
+ * @brief C = A × B on rank-2 views (M×K, K×N, M×N).
+ *
+ * @details Row-contiguous operands are passed to the blocked GEMM with
+ * their row strides as leading dimensions (SIMD, static threading);
+ * others use the scalar reference loop. Either way each output is one
+ * 64-bit accumulation rounded once, as fx_matrix_mul().
+ *
+ * @pre C does not overlap A or B
+ *
+ * @complexity O(M × N × K)
+ * @determinism Bit-identical to fx_matrix_mul() on copies of the operands
+ *
+ * @traceability SRS-016.4, SRS-003.9
+ */
+fx_view_res_t fx_view_matmul(const fx_view_t* A, const fx_view_t* B, fx_view_t* C);
+
+/**
+ * @brief Valid-padding, stride-1 2D convolution on rank-2 views.
+ *
+ * @details out must be (H − kh + 1) × (W − kw + 1).
+ *
+ * @pre out does not overlap in or kernel
+ *
+ * @complexity O(out_h × out_w × kh × kw)
+ * @determinism Bit-identical to fx_conv2d() on copies of the operands
+ *
+ * @traceability SRS-016.4, SRS-006.2
+ */
+fx_view_res_t fx_view_conv2d(const fx_view_t* in, const fx_view_t* kernel, fx_view_t* out);
+
+/**
+ * @brief 2×2 / stride-2 max pooling on rank-2 views (even extents).
+ *
+ * @pre out does not overlap in
+ *
+ * @complexity O(H × W)
+ * @determinism Bit-identical to fx_maxpool_2x2() on a copy of the input
+ *
+ * @traceability SRS-016.4, SRS-008.1
+ */
+fx_view_res_t fx_view_maxpool_2x2(const fx_view_t* in, fx_view_t* out);
+
+#endif /* VIEW_H */
@@ -0,0 +1,307 @@
+/**
+ * @file weights.h
+ * @project Certifiable Inference Engine
+ * @brief Versioned binary weight container, used in place (zero copy).
+ *
+ * @details A weight file is a little-endian image with three regions:
+ *
+ * | Region | Contents |
+ * |--------|----------|
+ * | Header (64 bytes) | Magic "CIEW", CRC-32, version, byte-order mark, region offsets |
+ * | Tensor table | One 72-byte entry per tensor: name, dtype, Q-format, layout, shape, offset |
+ * | Data | Tensor payloads, each starting on an `alignment` boundary |
+ *
+ * The file is never parsed into another structure. fx_weights_open()
+ * checks the header and every table entry against the image bounds, then
+ * the accessors return pointers straight into the image, so it can be
+ * mmap()ed read-only on a host or executed in place from flash on bare
+ * metal. Opening costs O(tensors), independent of the weight bytes; the
+ * optional CRC-32 check (FX_WEIGHTS_VERIFY) is the only O(bytes) step.
+ *
+ * Typical usage:
+ * ```c
+ * extern const uint8_t model_ciew[];       // linker-placed, or mmap()ed
+ * fx_weights_t wf;
+ * fx_matrix_t w1, b1;
+ *
+ * fx_weights_open(&wf, model_ciew, model_ciew_len, FX_WEIGHTS_VERIFY);
+ * fx_weights_attach_matrix(&wf, "fc1.weight", &w1);
+ * fx_weights_attach_matrix(&wf, "fc1.bias", &b1);
+ * ```
+ *
+ * Files are produced by tools/pack_weights.py.
+ *
+ * @traceability SRS-010-WEIGHTS
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef WEIGHTS_H
+#define WEIGHTS_H
+
+#include "matrix.h"
+#include "tensor.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/** Format version understood by this library (older minors are accepted) */
+#define FX_WEIGHTS_VERSION_MAJOR 1
+#define FX_WEIGHTS_VERSION_MINOR 1
+
+/** Byte-order mark, read back unchanged only on a little-endian host */
+#define FX_WEIGHTS_BYTE_ORDER 0x01020304u
+
+/** Maximum tensor name length including the terminating NUL */
+#define FX_WEIGHTS_NAME_LEN 32
+
+/** Maximum tensor rank */
+#define FX_WEIGHTS_MAX_RANK 4
+
+/** Largest layout tile size accepted */
+#define FX_WEIGHTS_MAX_TILE 256
+
+/** Required alignment of the image base address in bytes */
+#define FX_WEIGHTS_BASE_ALIGN 8
+
+/** fx_weights_open() flag: verify the CRC-32 over the whole image */
+#define FX_WEIGHTS_VERIFY 0x1u
+
+/**
+ * @brief Result codes for weight file operations.
+ */
+typedef enum {
+    FX_WEIGHTS_OK = 0,           /**< Success */
+    FX_WEIGHTS_INVALID_PARAM,    /**< NULL pointer or unknown flag */
+    FX_WEIGHTS_BAD_MAGIC,        /**< Not a weight file */
+    FX_WEIGHTS_BAD_VERSION,      /**< Unsupported format version */
+    FX_WEIGHTS_BAD_ENDIAN,       /**< Byte order differs from the host */
+    FX_WEIGHTS_MISALIGNED,       /**< Base address not FX_WEIGHTS_BASE_ALIGN aligned */
+    FX_WEIGHTS_TRUNCATED,        /**< Image shorter than the header's file size */
+    FX_WEIGHTS_CORRUPT,          /**< Header or table entry inconsistent */
+    FX_WEIGHTS_CHECKSUM,         /**< CRC-32 mismatch */
+    FX_WEIGHTS_NOT_FOUND,        /**< No tensor with that name */
+    FX_WEIGHTS_FORMAT,           /**< Element type or Q-format not usable as fixed_t */
+    FX_WEIGHTS_SHAPE             /**< Shape not representable by the target view */
+} fx_weights_res_t;
+
+/**
+ * @brief Element storage types.
+ */
+typedef enum {
+    FX_WEIGHTS_DTYPE_I32 = 1,    /**< int32, Q(32-frac_bits).frac_bits (Q16.16 for fixed_t) */
+    FX_WEIGHTS_DTYPE_I64 = 2     /**< int64 (Winograd-transformed filters) */
+} fx_weights_dtype_t;
+
+/**
+ * @brief Payload layouts (format 1.1).
+ *
+ * @details dims always give the logical shape; the layout and its tile
+ * size say how the payload is arranged, and so how many elements it has.
+ *
+ * | Layout | dims | tile | count | dtype |
+ * |--------|------|------|-------|-------|
+ * | DENSE | any | 0 | Π dims | any |
+ * | GEMM_PANELS | [K, N] | panel width | ⌈N / tile⌉ × tile × K | I32 |
+ * | WINOGRAD_2X2_3X3 | [C_out, C_in, 3, 3] | 2 (output tile) | C_out × C_in × 16 | I64 |
+ */
+typedef enum {
+    FX_WEIGHTS_LAYOUT_DENSE = 0,         /**< Row-major, as the shape reads */
+    FX_WEIGHTS_LAYOUT_GEMM_PANELS = 1,   /**< fx_matrix_packed_t panels (SRS-003.12) */
+    FX_WEIGHTS_LAYOUT_WINOGRAD_2X2_3X3 = 2 /**< U' = G' g G'ᵀ per filter (SRS-006.13) */
+} fx_weights_layout_t;
+
+/**
+ * @brief File header (64 bytes, little endian, at offset 0).
+ */
+typedef struct {
+    uint8_t magic[4];            /**< "CIEW" */
+    uint32_t checksum;           /**< CRC-32 (IEEE) of bytes [8, file_size) */
+    uint16_t version_major;      /**< Incompatible format changes */
+    uint16_t version_minor;      /**< Compatible additions */
+    uint32_t byte_order;         /**< FX_WEIGHTS_BYTE_ORDER */
+    uint32_t header_size;        /**< sizeof(fx_weights_header_t) */
+    uint32_t entry_size;         /**< sizeof(fx_weights_entry_t) */
+    uint32_t tensor_count;       /**< Table entries */
+    uint32_t alignment;          /**< Payload alignment in bytes (power of two ≥ 8) */
+    uint64_t table_offset;       /**< Tensor table offset */
+    uint64_t data_offset;        /**< First payload byte */
+    uint64_t file_size;          /**< Total image size */
+    uint8_t reserved[8];         /**< Zero */
+} fx_weights_header_t;
+
+/**
+ * @brief Tensor table entry (72 bytes).
+ */
+typedef struct {
+    char name[FX_WEIGHTS_NAME_LEN];  /**< NUL-terminated, unique */
+    uint8_t dtype;               /**< fx_weights_dtype_t */
+    uint8_t frac_bits;           /**< Q-format fractional bits */
+    uint8_t rank;                /**< 1 to FX_WEIGHTS_MAX_RANK */
+    uint8_t layout;              /**< fx_weights_layout_t (zero before format 1.1) */
+    uint32_t tile;               /**< Layout tile size, 0 for DENSE */
+    uint32_t dims[FX_WEIGHTS_MAX_RANK]; /**< Logical shape, outermost first; unused dims 1 */
+    uint64_t offset;             /**< Payload offset from the image base */
+    uint64_t count;              /**< Stored elements (product of dims when DENSE) */
+} fx_weights_entry_t;
+
+/**
+ * @brief Open weight file: a validated view of a caller-owned image.
+ *
+ * @note Holds pointers only; the image must stay mapped and unchanged
+ *       while the view, or any matrix or tensor attached from it, is used.
+ */
+typedef struct {
+    const uint8_t* base;         /**< Image base */
+    const fx_weights_header_t* header; /**< Header, in place */
+    const fx_weights_entry_t* table;   /**< Tensor table, in place */
+    uint32_t count;              /**< Tensors */
+} fx_weights_t;
+
+/**
+ * @brief CRC-32 (IEEE 802.3, reflected, as zlib.crc32) of a byte range.
+ *
+ * @param[in] crc Previous value (0 to start)
+ * @param[in] data Bytes
+ * @param[in] len Byte count
+ *
+ * @return Updated CRC; chained calls equal one call over the concatenation
+ *
+ * @complexity O(len)
+ * @determinism Platform independent
+ *
+ * @traceability SRS-010.3
+ */
+uint32_t fx_weights_crc32(uint32_t crc, const void* data, size_t len);
+
+/**
+ * @brief Validate an image and open a view on it.
+ *
+ * @details Checks magic, version, byte order, base alignment, region
+ * bounds and every table entry (terminated unique name, known dtype,
+ * rank and layout, count matching the layout, aligned in-bounds
+ * payload). With FX_WEIGHTS_VERIFY the CRC-32 is also checked.
+ *
+ * @param[out] wf View (cleared unless FX_WEIGHTS_OK)
+ * @param[in] image Image base (FX_WEIGHTS_BASE_ALIGN aligned)
+ * @param[in] len Bytes available at image (≥ the header's file size)
+ * @param[in] flags 0 or FX_WEIGHTS_VERIFY
+ *
+ * @return FX_WEIGHTS_OK or the first failed check
+ *
+ * @complexity O(T²) in the tensor count T for name uniqueness; O(bytes)
+ *             more with FX_WEIGHTS_VERIFY
+ * @determinism Reads only; same image → same result
+ *
+ * @traceability SRS-010.1, SRS-010.2, SRS-010.3
+ */
+fx_weights_res_t fx_weights_open(fx_weights_t* wf, const void* image, size_t len, uint32_t flags);
+
+/**
+ * @brief Look up a tensor entry by name.
+ *
+ * @return Entry in the image, or NULL if absent
+ *
+ * @complexity O(T)
+ *
+ * @traceability SRS-010.4
+ */
+const fx_weights_entry_t* fx_weights_find(const fx_weights_t* wf, const char* name);
+
+/**
+ * @brief Payload of an entry as Q16.16 values.
+ *
+ * @return Pointer into the image, or NULL if the entry is not int32 with
+ *         FIXED_SHIFT fractional bits
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-010.4
+ */
+const fixed_t* fx_weights_data(const fx_weights_t* wf, const fx_weights_entry_t* e);
+
+/**
+ * @brief Attach a matrix to a named tensor, zero copy.
+ *
+ * @details Rank 2 [rows, cols] maps directly; rank 1 [n] becomes 1 × n
+ * (a bias row).
+ *
+ * @param[in] wf Open view
+ * @param[in] name Tensor name
+ * @param[out] mat Matrix whose data points into the image (read only)
+ *
+ * @return FX_WEIGHTS_OK, NOT_FOUND, FORMAT (also for packed layouts), or
+ *         SHAPE if the rank is higher or a dimension exceeds the matrix's
+ *         16-bit fields
+ *
+ * @complexity O(T)
+ *
+ * @traceability SRS-010.4
+ */
+fx_weights_res_t fx_weights_attach_matrix(const fx_weights_t* wf, const char* name, fx_matrix_t* mat);
+
+/**
+ * @brief Attach an NCHW tensor to a named tensor, zero copy.
+ *
+ * @details Dims are right-aligned onto N×C×H×W, so rank 4 [cout, cin,
+ * kh, kw] conv filters map directly and lower ranks get leading 1s.
+ *
+ * @param[in] wf Open view
+ * @param[in] name Tensor name
+ * @param[out] t Tensor whose data points into the image (read only)
+ *
+ * @return FX_WEIGHTS_OK, NOT_FOUND, FORMAT (also for packed layouts) or SHAPE
+ *
+ * @complexity O(T)
+ *
+ * @traceability SRS-010.4
+ */
+fx_weights_res_t fx_weights_attach_tensor(const fx_weights_t* wf, const char* name, fx_tensor_t* t);
+
+/**
+ * @brief Attach a pre-packed GEMM operand, zero copy.
+ *
+ * @details The entry must have layout GEMM_PANELS with a tile equal to
+ * FX_MATRIX_PANEL_COLS; the result goes straight to
+ * fx_matrix_mul_packed() / fx_matrix_mul_packed_fused().
+ *
+ * @param[in] wf Open view
+ * @param[in] name Tensor name
+ * @param[out] b Packed operand whose data points into the image
+ *
+ * @return FX_WEIGHTS_OK, NOT_FOUND, FORMAT (other layout, tile or dtype)
+ *         or SHAPE
+ *
+ * @complexity O(T)
+ *
+ * @traceability SRS-010.6
+ */
+fx_weights_res_t fx_weights_attach_packed(const fx_weights_t* wf, const char* name,
+                                          fx_matrix_packed_t* b);
+
+/**
+ * @brief Locate Winograd-transformed filters, zero copy.
+ *
+ * @details The entry must have layout WINOGRAD_2X2_3X3, dtype I64 and
+ * FIXED_SHIFT fractional bits. Pass the results to
+ * fx_winograd_plan_transformed(), which proves exactness before use.
+ *
+ * @param[in] wf Open view
+ * @param[in] name Tensor name
+ * @param[out] u C_out × C_in × 16 transformed filters in the image
+ * @param[out] cout Output channels
+ * @param[out] cin Input channels
+ *
+ * @return FX_WEIGHTS_OK, NOT_FOUND, FORMAT or SHAPE
+ *
+ * @complexity O(T)
+ *
+ * @traceability SRS-010.6
+ */
+fx_weights_res_t fx_weights_attach_winograd(const fx_weights_t* wf, const char* name,
+                                            const int64_t** u, uint16_t* cout, uint16_t* cin);
+
+#endif /* WEIGHTS_H */
@@ -3,10 +3,15 @@
  * @project Certifiable Inference Engine
  * @brief Bounded-resource, bit-perfect hash table implementation.
  *
- * @details This module implements a linear-probing hash table with
- * guaranteed deterministic iteration order. It adheres to MISRA-C:2012
+ * @details This module implements a Robin Hood linear-probing hash table
+ * with guaranteed deterministic iteration order. It adheres to MISRA-C:2012
  * guidelines for safety-critical systems.
  *
+ * Slot i is empty when hashes[i] is 0; a key whose hash is 0 is stored as
+ * 1. An entry's distance from home is (i − hash) & mask, so Robin Hood
+ * needs no storage beyond the hash. Keys are compared on at most
+ * D_TABLE_KEY_LEN − 1 characters, the part that insert stores.
+ *
  * @traceability SRS-001-DETERMINISM, SRS-002-BOUNDED-MEMORY
  * @compliance MISRA-C:2012, ISO 26262, IEC 62304
  *
@@ -22,6 +27,13 @@
 #include "deterministic_hash.h"
 #include <string.h>
 
+/* Read hint for a slot a batch will probe; no effect on results */
+#if defined(__GNUC__)
+#define D_PREFETCH(p) __builtin_prefetch((p), 0, 1)
+#else
+#define D_PREFETCH(p) ((void)(p))
+#endif
+
 /**
  * @brief Jenkins One-at-a-Time Hash.
  *
@@ -36,8 +48,8 @@
  */
 static uint32_t jenkins_hash(const char* key) {
     uint32_t hash = 0;
-    while (*key) {
-        hash += (uint32_t)(*key++);
+    for (size_t i = 0; i < D_TABLE_KEY_LEN - 1u && key[i]; i++) {
+        hash += (uint32_t)key[i];
         hash += (hash << 10);
         hash ^= (hash >> 6);
     }
@@ -47,77 +59,163 @@ static uint32_t jenkins_hash(const char* key) {
     return hash;
 }
 
+/* Stored form of a key's hash: never 0, which marks an empty slot */
+static uint32_t stored_hash(const d_table_t* table, const char* key) {
+    const uint32_t hash = table->hash_fn(key);
+    return hash ? hash : 1u;
+}
+
+/* Length of the stored part of @p key */
+static size_t key_length(const char* key) {
+    size_t len = 0;
+    while (len < D_TABLE_KEY_LEN - 1u && key[len]) {
+        len++;
+    }
+    return len;
+}
+
+static bool key_equal(const d_entry_t* e, const char* key, size_t len) {
+    return memcmp(e->key, key, len) == 0 && e->key[len] == '\0';
+}
+
+/* Distance of the entry in @p slot from its home slot */
+static size_t probe_distance(const d_table_t* table, size_t slot) {
+    return (slot - (size_t)table->hashes[slot]) & table->mask;
+}
+
+/**
+ * @brief Slot holding @p key, or capacity if absent.
+ *
+ * @details Robin Hood invariant: along a probe sequence, distances never
+ * drop by more than the step, so an occupant closer to its home than the
+ * probe means the key is not in the table.
+ */
+static size_t find_slot(const d_table_t* table, const char* key, uint32_t hash) {
+    const size_t len = key_length(key);
+    size_t slot = (size_t)hash & table->mask;
+
+    for (size_t dist = 0; dist <= D_TABLE_MAX_PROBE && dist < table->capacity; dist++) {
+        const uint32_t h = table->hashes[slot];
+        if (h == 0 || probe_distance(table, slot) < dist) {
+            break;
+        }
+        if (h == hash && key_equal(&table->entries[slot], key, len)) {
+            return slot;
+        }
+        slot = (slot + 1u) & table->mask;
+    }
+    return table->capacity;
+}
+
 d_table_res_t d_table_init(d_table_t* table, void* buffer, size_t buffer_size) {
     if (!table || !buffer) {
         return D_TABLE_INVALID_PARAM;
     }
 
-    table->capacity = buffer_size / sizeof(d_entry_t);
-    if (table->capacity == 0) {
+    /* Align the hash array; records follow it at a multiple of 4 bytes */
+    const size_t skip = (size_t)(-(uintptr_t)buffer & (sizeof(uint32_t) - 1u));
+    if (buffer_size < skip) {
+        return D_TABLE_INVALID_PARAM;
+    }
+    const size_t slot_bytes = sizeof(uint32_t) + sizeof(d_entry_t);
+    const size_t fit = (buffer_size - skip) / slot_bytes;
+    if (fit == 0) {
         return D_TABLE_INVALID_PARAM;
     }
 
-    table->entries = (d_entry_t*)buffer;
-    table->count = 0;
-    table->hash_fn = jenkins_hash;
+    size_t capacity = 1;
+    while (capacity <= fit / 2u) {
+        capacity *= 2u;
+    }
 
     /* Explicitly zero out the memory pool for determinism */
-    memset(table->entries, 0, buffer_size);
+    memset(buffer, 0, buffer_size);
+
+    table->hashes = (uint32_t*)(void*)((uint8_t*)buffer + skip);
+    table->entries = (d_entry_t*)(void*)(table->hashes + capacity);
+    table->capacity = capacity;
+    table->mask = capacity - 1u;
+    table->count = 0;
+    table->hash_fn = jenkins_hash;
 
     return D_TABLE_OK;
 }
 
-d_table_res_t d_table_insert(d_table_t* table, const char* key, int32_t value) {
-    if (!table || !key) {
-        return D_TABLE_INVALID_PARAM;
+/* d_table_insert() with the stored hash already computed */
+static d_table_res_t insert_hashed(d_table_t* table, const char* key, uint32_t hash,
+                                   int32_t value) {
+    if (find_slot(table, key, hash) != table->capacity) {
+        return D_TABLE_KEY_EXISTS;
     }
-
     if (table->count >= table->capacity) {
         return D_TABLE_FULL;
     }
 
-    uint32_t hash = table->hash_fn(key);
-    size_t index = (size_t)(hash % table->capacity);
-
-    /* Linear Probing: Deterministic collision resolution */
-    while (table->entries[index].occupied) {
-        if (strncmp(table->entries[index].key, key, 32) == 0) {
-            return D_TABLE_KEY_EXISTS;
+    /* Dry run of the displacement chain: every entry it moves, including
+     * the new one, must stay within D_TABLE_MAX_PROBE of its home */
+    size_t slot = (size_t)hash & table->mask;
+    size_t dist = 0;
+    while (table->hashes[slot] != 0) {
+        const size_t resident = probe_distance(table, slot);
+        if (resident < dist) {
+            dist = resident;     /* The resident is carried on from here */
+        }
+        slot = (slot + 1u) & table->mask;
+        if (++dist > D_TABLE_MAX_PROBE) {
+            return D_TABLE_FULL;
         }
-        index = (index + 1) % table->capacity;
     }
 
-    /* Insert entry */
-    strncpy(table->entries[index].key, key, 31);
-    table->entries[index].key[31] = '\0'; /* Ensure null termination */
-    table->entries[index].value = value;
-    table->entries[index].occupied = true;
+    /* SRS-001.11: Robin Hood placement, taking from the rich */
+    d_entry_t carry;
+    memset(&carry, 0, sizeof(carry));
+    memcpy(carry.key, key, key_length(key));
+    carry.value = value;
+    uint32_t carry_hash = hash;
+
+    slot = (size_t)hash & table->mask;
+    dist = 0;
+    while (table->hashes[slot] != 0) {
+        const size_t resident = probe_distance(table, slot);
+        if (resident < dist) {
+            const d_entry_t e = table->entries[slot];
+            const uint32_t h = table->hashes[slot];
+            table->entries[slot] = carry;
+            table->hashes[slot] = carry_hash;
+            carry = e;
+            carry_hash = h;
+            dist = resident;
+        }
+        slot = (slot + 1u) & table->mask;
+        dist++;
+    }
+    table->entries[slot] = carry;
+    table->hashes[slot] = carry_hash;
     table->count++;
 
     return D_TABLE_OK;
 }
 
+d_table_res_t d_table_insert(d_table_t* table, const char* key, int32_t value) {
+    if (!table || !key) {
+        return D_TABLE_INVALID_PARAM;
+    }
+
+    return insert_hashed(table, key, stored_hash(table, key), value);
+}
+
 d_table_res_t d_table_get(const d_table_t* table, const char* key, int32_t* out_value) {
     if (!table || !key || !out_value) {
         return D_TABLE_INVALID_PARAM;
     }
 
-    uint32_t hash = table->hash_fn(key);
-    size_t index = (size_t)(hash % table->capacity);
-    size_t start_index = index;
-
-    while (table->entries[index].occupied) {
-        if (strncmp(table->entries[index].key, key, 32) == 0) {
-            *out_value = table->entries[index].value;
-            return D_TABLE_OK;
-        }
-        index = (index + 1) % table->capacity;
-        if (index == start_index) {
-            break; /* Wrapped around */
-        }
+    const size_t slot = find_slot(table, key, stored_hash(table, key));
+    if (slot == table->capacity) {
+        return D_TABLE_NOT_FOUND;
     }
 
-    return D_TABLE_NOT_FOUND;
+    *out_value = table->entries[slot].value;
+    return D_TABLE_OK;
 }
 
 void d_table_iterate(const d_table_t* table, void (*callback)(const char* key, int32_t value)) {
@@ -128,8 +226,127 @@ void d_table_iterate(const d_table_t* table, void (*callback)(const char* key, i
     /* Iteration is strictly by table index, ensuring the same order
      * across all runs for a given set of insertions. */
     for (size_t i = 0; i < table->capacity; i++) {
-        if (table->entries[i].occupied) {
+        if (table->hashes[i] != 0) {
             callback(table->entries[i].key, table->entries[i].value);
         }
     }
 }
+
+d_table_res_t d_table_update(d_table_t* table, const char* key, int32_t value) {
+    if (!table || !key) {
+        return D_TABLE_INVALID_PARAM;
+    }
+
+    const size_t slot = find_slot(table, key, stored_hash(table, key));
+    if (slot == table->capacity) {
+        return D_TABLE_NOT_FOUND;
+    }
+
+    table->entries[slot].value = value;
+    return D_TABLE_OK;
+}
+
+d_table_res_t d_table_remove(d_table_t* table, const char* key) {
+    if (!table || !key) {
+        return D_TABLE_INVALID_PARAM;
+    }
+
+    size_t slot = find_slot(table, key, stored_hash(table, key));
+    if (slot == table->capacity) {
+        return D_TABLE_NOT_FOUND;
+    }
+
+    /* SRS-001.12: backward shift until an empty slot or an entry at home */
+    size_t next = (slot + 1u) & table->mask;
+    while (table->hashes[next] != 0 && probe_distance(table, next) > 0) {
+        table->hashes[slot] = table->hashes[next];
+        table->entries[slot] = table->entries[next];
+        slot = next;
+        next = (next + 1u) & table->mask;
+    }
+    table->hashes[slot] = 0;
+    memset(&table->entries[slot], 0, sizeof(d_entry_t));
+    table->count--;
+
+    return D_TABLE_OK;
+}
+
+/* Hash up to D_TABLE_BATCH keys and prefetch their home slots */
+static size_t batch_prepare(const d_table_t* table, const char* const* keys, size_t n,
+                            uint32_t hashes[D_TABLE_BATCH]) {
+    const size_t len = n < D_TABLE_BATCH ? n : D_TABLE_BATCH;
+
+    for (size_t i = 0; i < len; i++) {
+        hashes[i] = keys[i] ? stored_hash(table, keys[i]) : 0u;
+        const size_t home = (size_t)hashes[i] & table->mask;
+        D_PREFETCH(&table->hashes[home]);
+        D_PREFETCH(&table->entries[home]);
+    }
+    return len;
+}
+
+d_table_res_t d_table_get_batch(const d_table_t* table, const char* const* keys, size_t n,
+                                int32_t* values, d_table_res_t* results) {
+    if (!table || (n > 0 && (!keys || !values))) {
+        return D_TABLE_INVALID_PARAM;
+    }
+
+    d_table_res_t first = D_TABLE_OK;
+    uint32_t hashes[D_TABLE_BATCH];
+
+    for (size_t base = 0; base < n; ) {
+        const size_t len = batch_prepare(table, keys + base, n - base, hashes);
+
+        for (size_t i = 0; i < len; i++) {
+            const size_t k = base + i;
+            d_table_res_t res = D_TABLE_INVALID_PARAM;
+
+            if (keys[k]) {
+                const size_t slot = find_slot(table, keys[k], hashes[i]);
+                res = slot == table->capacity ? D_TABLE_NOT_FOUND : D_TABLE_OK;
+                if (res == D_TABLE_OK) {
+                    values[k] = table->entries[slot].value;
+                }
+            }
+            if (results) {
+                results[k] = res;
+            }
+            if (first == D_TABLE_OK) {
+                first = res;
+            }
+        }
+        base += len;
+    }
+    return first;
+}
+
+d_table_res_t d_table_insert_batch(d_table_t* table, const char* const* keys,
+                                   const int32_t* values, size_t n, d_table_res_t* results) {
+    if (!table || (n > 0 && (!keys || !values))) {
+        return D_TABLE_INVALID_PARAM;
+    }
+
+    d_table_res_t first = D_TABLE_OK;
+    uint32_t hashes[D_TABLE_BATCH];
+
+    for (size_t base = 0; base < n; ) {
+        const size_t len = batch_prepare(table, keys + base, n - base, hashes);
+
+        /* Array order, so duplicates resolve as in sequential inserts */
+        for (size_t i = 0; i < len; i++) {
+            const size_t k = base + i;
+            const d_table_res_t res = keys[k]
+                ? insert_hashed(table, keys[k], hashes[i], values[k])
+                : D_TABLE_INVALID_PARAM;
+
+            if (results) {
+                results[k] = res;
+            }
+            if (first == D_TABLE_OK) {
+                first = res;
+            }
+        }
+        base += len;
+    }
+    return first;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file perfect_hash.c
+ * @project Certifiable Inference Engine
+ * @brief Lookup in generated minimal perfect hash tables.
+ *
+ * @details All arithmetic is on uint32_t. With size ≤ 65535 the slot sum
+ * f1 + d0 · f2 + d1 stays below 2³², so no step wraps and the generator
+ * (tools/gen_phash.py) reproduces it with plain integers.
+ *
+ * @traceability SRS-017
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "perfect_hash.h"
+#include <string.h>
+
+#define FNV_OFFSET 0x811C9DC5u
+#define FNV_PRIME 0x01000193u
+#define F1_SALT 0x9E3779B9u
+#define F2_SALT 0x85EBCA6Bu
+
+/* MurmurHash3 finalizer: every input bit affects every output bit */
+static uint32_t fmix32(uint32_t h) {
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+uint32_t d_phash_hash(const char* key, uint32_t seed) {
+    uint32_t h = FNV_OFFSET ^ seed;
+    for (size_t i = 0; i < D_TABLE_KEY_LEN - 1u && key[i]; i++) {
+        h ^= (uint32_t)(unsigned char)key[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+static bool table_valid(const d_phash_t* table) {
+    return table->displace && table->entries && table->size > 0 &&
+           table->size <= D_PHASH_MAX_KEYS && table->buckets > 0;
+}
+
+/* Slot of any key with hash h; the caller compares the record */
+static uint32_t slot_of(const d_phash_t* table, uint32_t h) {
+    const uint32_t g = fmix32(h) % table->buckets;
+    const uint32_t f1 = fmix32(h ^ F1_SALT) % table->size;
+    const uint32_t f2 = fmix32(h ^ F2_SALT) % table->size;
+    const uint32_t d0 = table->displace[2u * g];
+    const uint32_t d1 = table->displace[2u * g + 1u];
+    return (f1 + d0 * f2 + d1) % table->size;
+}
+
+/* Same rule as d_table_t: the first D_TABLE_KEY_LEN − 1 characters */
+static bool key_equal(const d_entry_t* e, const char* key) {
+    size_t len = 0;
+    while (len < D_TABLE_KEY_LEN - 1u && key[len]) {
+        len++;
+    }
+    return memcmp(e->key, key, len) == 0 && e->key[len] == '\0';
+}
+
+uint32_t d_phash_index(const d_phash_t* table, const char* key) {
+    if (!table || !key || !table_valid(table)) {
+        return table ? table->size : 0u;
+    }
+
+    const uint32_t slot = slot_of(table, d_phash_hash(key, table->seed));
+    return key_equal(&table->entries[slot], key) ? slot : table->size;
+}
+
+d_table_res_t d_phash_get(const d_phash_t* table, const char* key, int32_t* value) {
+    if (!table || !key || !value || !table_valid(table)) {
+        return D_TABLE_INVALID_PARAM;
+    }
+
+    const uint32_t slot = d_phash_index(table, key);
+    if (slot == table->size) {
+        return D_TABLE_NOT_FOUND;
+    }
+
+    *value = table->entries[slot].value;
+    return D_TABLE_OK;
+}
+
+d_table_res_t d_phash_verify(const d_phash_t* table) {
+    if (!table || !table_valid(table)) {
+        return D_TABLE_INVALID_PARAM;
+    }
+
+    for (uint32_t i = 0; i < 2u * table->buckets; i++) {
+        if (table->displace[i] >= table->size) {
+            return D_TABLE_INVALID_PARAM;
+        }
+    }
+    /* Records hash to their own slots, so no two keys share one */
+    for (uint32_t i = 0; i < table->size; i++) {
+        const d_entry_t* e = &table->entries[i];
+        if (memchr(e->key, '\0', D_TABLE_KEY_LEN) == NULL ||
+            slot_of(table, d_phash_hash(e->key, table->seed)) != i) {
+            return D_TABLE_INVALID_PARAM;
+        }
+    }
+    return D_TABLE_OK;
+}
@@ -16,40 +16,153 @@
  */
 
 #include "activations.h"
+#include "kernels.h"
+#include "lut.h"
+#include "trace.h"
+
+/** round(log2(e) · 2^30) */
+#define LOG2E_Q30 INT64_C(1549082005)
+
+/** Exponent clamp: 2^-31 rounds to zero at Q2.30 */
+#define SOFTMAX_MAX_EXP2 ((int64_t)(FX_EXP2_SHIFT + 1) << FIXED_SHIFT)
 
 void fx_relu(fx_matrix_t* mat) {
+    if (!mat || !mat->data) {
+        return;
+    }
+
+    /* SRS-003.10, SRS-003.11: max(0, x) per lane is exactly the scalar comparison */
+    const size_t n = (size_t)mat->rows * mat->cols;
+    FX_TRACE_BEGIN(FX_TRACE_RELU, n, 0, 0);
+    fx_kernels()->relu(mat->data, n);
+    FX_TRACE_END();
+}
+
+void fx_relu_ref(fx_matrix_t* mat) {
     /* SRS-004.1: Operate in-place to minimize memory footprint */
     if (!mat || !mat->data) {
         return;
     }
 
-    size_t total_elements = (size_t)mat->rows * mat->cols;
+    fx_scalar_relu(mat->data, (size_t)mat->rows * mat->cols);
+}
 
+void fx_scalar_relu(fixed_t* data, size_t n) {
     /* SRS-004.2: Deterministic max(0, x) implementation
      * Sequential iteration ensures consistent behavior across platforms */
-    for (size_t i = 0; i < total_elements; i++) {
+    for (size_t i = 0; i < n; i++) {
         /* Simple comparison - deterministic on all architectures */
-        if (mat->data[i] < 0) {
-            mat->data[i] = FIXED_ZERO;
+        if (data[i] < 0) {
+            data[i] = FIXED_ZERO;
         }
         /* Positive values remain unchanged */
     }
 }
 
 void fx_leaky_relu(fx_matrix_t* mat, fixed_t alpha) {
+    if (!mat || !mat->data) {
+        return;
+    }
+
+    /* SRS-003.10, SRS-003.11: Lane-parallel fixed_mul() with identical rounding */
+    const size_t n = (size_t)mat->rows * mat->cols;
+    FX_TRACE_BEGIN(FX_TRACE_LEAKY_RELU, n, 0, 0);
+    fx_kernels()->leaky_relu(mat->data, n, alpha);
+    FX_TRACE_END();
+}
+
+void fx_leaky_relu_ref(fx_matrix_t* mat, fixed_t alpha) {
     /* SRS-004.1: Operate in-place */
     if (!mat || !mat->data) {
         return;
     }
 
-    size_t total_elements = (size_t)mat->rows * mat->cols;
+    fx_scalar_leaky_relu(mat->data, (size_t)mat->rows * mat->cols, alpha);
+}
 
+void fx_scalar_leaky_relu(fixed_t* data, size_t n, fixed_t alpha) {
     /* SRS-004.2 & SRS-004.4: Deterministic leaky ReLU with fixed-point multiply */
-    for (size_t i = 0; i < total_elements; i++) {
-        if (mat->data[i] < 0) {
+    for (size_t i = 0; i < n; i++) {
+        if (data[i] < 0) {
             /* Use fixed_mul from SRS-002 for deterministic multiplication */
-            mat->data[i] = fixed_mul(mat->data[i], alpha);
+            data[i] = fixed_mul(data[i], alpha);
         }
         /* Positive values remain unchanged */
     }
 }
+
+void fx_sigmoid(fx_matrix_t* mat) {
+    if (!mat || !mat->data) {
+        return;
+    }
+
+    const size_t n = (size_t)mat->rows * mat->cols;
+    FX_TRACE_BEGIN(FX_TRACE_SIGMOID, n, 0, 0);
+    for (size_t i = 0; i < n; i++) {
+        mat->data[i] = fixed_sigmoid(mat->data[i]);
+    }
+    FX_TRACE_END();
+}
+
+void fx_tanh(fx_matrix_t* mat) {
+    if (!mat || !mat->data) {
+        return;
+    }
+
+    const size_t n = (size_t)mat->rows * mat->cols;
+    FX_TRACE_BEGIN(FX_TRACE_TANH, n, 0, 0);
+    for (size_t i = 0; i < n; i++) {
+        mat->data[i] = fixed_tanh(mat->data[i]);
+    }
+    FX_TRACE_END();
+}
+
+void fx_gelu(fx_matrix_t* mat) {
+    if (!mat || !mat->data) {
+        return;
+    }
+
+    const size_t n = (size_t)mat->rows * mat->cols;
+    FX_TRACE_BEGIN(FX_TRACE_GELU, n, 0, 0);
+    for (size_t i = 0; i < n; i++) {
+        mat->data[i] = fixed_gelu(mat->data[i]);
+    }
+    FX_TRACE_END();
+}
+
+void fx_softmax(fx_matrix_t* mat) {
+    if (!mat || !mat->data || mat->cols == 0) {
+        return;
+    }
+
+    FX_TRACE_BEGIN(FX_TRACE_SOFTMAX, mat->rows, mat->cols, 0);
+    for (size_t r = 0; r < mat->rows; r++) {
+        fixed_t* row = mat->data + r * mat->cols;
+
+        fixed_t max = row[0];
+        for (size_t c = 1; c < mat->cols; c++) {
+            if (row[c] > max) {
+                max = row[c];
+            }
+        }
+
+        /* SRS-004.11: exponents of x − max ≤ 0, stored over the logits */
+        uint64_t sum = 0;
+        for (size_t c = 0; c < mat->cols; c++) {
+            const int64_t d = (int64_t)max - row[c];
+            int64_t u = (d * LOG2E_Q30 + (INT64_C(1) << 29)) >> 30;
+            if (u > SOFTMAX_MAX_EXP2) {
+                u = SOFTMAX_MAX_EXP2;
+            }
+            const uint32_t e = fx_exp2_neg((uint32_t)u);
+            row[c] = (fixed_t)e;
+            sum += e;
+        }
+
+        for (size_t c = 0; c < mat->cols; c++) {
+            const uint64_t e = (uint64_t)(uint32_t)row[c];
+            row[c] = (fixed_t)(((e << FIXED_SHIFT) + sum / 2u) / sum);
+        }
+    }
+    FX_TRACE_END();
+}
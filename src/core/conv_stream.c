@@ -0,0 +1,154 @@
+/**
+ * @file conv_stream.c
+ * @project Certifiable Inference Engine
+ * @brief Incremental convolution over streamed rows.
+ *
+ * @details Each pushed row is written to two ring slots, s and s + span.
+ * After the write the oldest retained row sits at slot next, so rows
+ * [next, next + span) of the ring are the receptive field of the next
+ * output row, oldest first, as an NHWC tensor. That tensor is handed to
+ * fx_conv2d_multi() with stride 1 and no vertical padding, which yields
+ * exactly one output row with the per-pixel accumulation order of the
+ * full convolution. Zero rows primed for pad_h multiply to zero where
+ * the full convolution skips the padding taps, so the sums are equal.
+ *
+ * @traceability SRS-006.14
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "conv_stream.h"
+#include <string.h>
+
+/**
+ * @brief Shared argument validation; reports span and output width.
+ */
+static fx_conv_res_t stream_check(const fx_tensor_t* weights, const fx_conv_params_t* p,
+                                  uint16_t width, uint16_t* span, uint16_t* out_width) {
+    if (!weights || !weights->data || !p || width == 0 ||
+        weights->n == 0 || weights->c == 0 || weights->h == 0 || weights->w == 0) {
+        return FX_CONV_INVALID_PARAM;
+    }
+    if (p->stride_h == 0 || p->stride_w == 0 || p->dilation_h == 0 || p->dilation_w == 0) {
+        return FX_CONV_INVALID_PARAM;
+    }
+
+    /* SRS-006.14: Rows of one receptive field; top padding within it */
+    const uint32_t extent = (uint32_t)p->dilation_h * (weights->h - 1u) + 1u;
+    if (extent > UINT16_MAX || p->pad_h >= extent) {
+        return FX_CONV_INVALID_PARAM;
+    }
+
+    const uint16_t ow = fx_conv2d_out_dim(width, weights->w, p->stride_w, p->pad_w,
+                                          p->dilation_w);
+    if (ow == 0) {
+        return FX_CONV_DIM_MISMATCH;
+    }
+
+    *span = (uint16_t)extent;
+    *out_width = ow;
+    return FX_CONV_OK;
+}
+
+size_t fx_conv_stream_size(const fx_tensor_t* weights, const fx_conv_params_t* params,
+                           uint16_t width) {
+    uint16_t span, ow;
+    if (stream_check(weights, params, width, &span, &ow) != FX_CONV_OK) {
+        return 0;
+    }
+
+    return 2u * (size_t)span * weights->c * width;
+}
+
+fx_conv_res_t fx_conv_stream_init(fx_conv_stream_t* s, const fx_tensor_t* weights,
+                                  const fixed_t* bias, const fx_conv_params_t* params,
+                                  uint16_t width, fixed_t* ring, size_t ring_len) {
+    uint16_t span, ow;
+    if (!s || !ring) {
+        return FX_CONV_INVALID_PARAM;
+    }
+
+    const fx_conv_res_t res = stream_check(weights, params, width, &span, &ow);
+    if (res != FX_CONV_OK) {
+        return res;
+    }
+    if (ring_len < fx_conv_stream_size(weights, params, width)) {
+        return FX_CONV_WORKSPACE_TOO_SMALL;
+    }
+
+    s->weights = weights;
+    s->bias = bias;
+    s->window = *params;
+    s->window.stride_h = 1;
+    s->window.pad_h = 0;
+    s->window.algo = FX_CONV_ALGO_DIRECT;
+    s->stride_h = params->stride_h;
+    s->pad_h = params->pad_h;
+    s->width = width;
+    s->out_width = ow;
+    s->span = span;
+    s->row_len = (size_t)weights->c * width;
+    s->ring = ring;
+    fx_conv_stream_reset(s);
+    return FX_CONV_OK;
+}
+
+void fx_conv_stream_reset(fx_conv_stream_t* s) {
+    if (!s || !s->ring) {
+        return;
+    }
+
+    /* The pad_h rows before row 0 are the zeros already in the ring */
+    memset(s->ring, 0, 2u * (size_t)s->span * s->row_len * sizeof(fixed_t));
+    s->next = s->pad_h;
+    s->wait = (uint32_t)s->span - s->pad_h;
+}
+
+fx_conv_res_t fx_conv_stream_push(fx_conv_stream_t* s, const fixed_t* rows, size_t count,
+                                  fixed_t* out, size_t* produced) {
+    size_t done = 0;
+
+    if (produced) {
+        *produced = 0;
+    }
+    if (!s || !s->ring || (count > 0 && (!rows || !out))) {
+        return FX_CONV_INVALID_PARAM;
+    }
+
+    const size_t out_len = (size_t)s->weights->n * s->out_width;
+    for (size_t r = 0; r < count; r++) {
+        const fixed_t* row = rows + r * s->row_len;
+
+        /* Both copies, so the window never wraps */
+        memcpy(s->ring + (size_t)s->next * s->row_len, row, s->row_len * sizeof(fixed_t));
+        memcpy(s->ring + ((size_t)s->next + s->span) * s->row_len, row,
+               s->row_len * sizeof(fixed_t));
+        s->next = (uint16_t)((s->next + 1u) % s->span);
+
+        if (--s->wait > 0) {
+            continue;
+        }
+        s->wait = s->stride_h;
+
+        /* SRS-006.14: Only the output row this input row completes */
+        fx_tensor_t window, dst;
+        fx_tensor_attach(&window, s->ring + (size_t)s->next * s->row_len, 1, s->weights->c,
+                         s->span, s->width, FX_LAYOUT_NHWC);
+        fx_tensor_attach(&dst, out + done * out_len, 1, s->weights->n, 1, s->out_width,
+                         FX_LAYOUT_NHWC);
+        const fx_conv_res_t res = fx_conv2d_multi(&window, s->weights, s->bias, &s->window, &dst);
+        if (res != FX_CONV_OK) {
+            return res;
+        }
+        done++;
+        if (produced) {
+            *produced = done;
+        }
+    }
+
+    return FX_CONV_OK;
+}
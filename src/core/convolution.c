@@ -16,16 +16,27 @@
  */
 
 #include "convolution.h"
+#include "kernels.h"
+#include "threadpool.h"
+#include "trace.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
 
-void fx_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out) {
+/**
+ * @brief Shared argument validation for the 2D convolution entry points.
+ *
+ * @return true if out is exactly the valid-padding result shape
+ */
+static bool conv2d_dims_ok(const fx_matrix_t* in, const fx_matrix_t* kernel, const fx_matrix_t* out) {
     /* SRS-006.1: Dimension validation */
     if (!in || !kernel || !out || !in->data || !kernel->data || !out->data) {
-        return;
+        return false;
     }
 
     /* Verify kernel fits within input */
     if (kernel->rows > in->rows || kernel->cols > in->cols) {
-        return;
+        return false;
     }
 
     /* Calculate expected output dimensions (valid padding) */
@@ -34,26 +45,87 @@ void fx_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* ou
 
     /* Verify output buffer has correct dimensions */
     if (out->rows != expected_out_rows || out->cols != expected_out_cols) {
+        return false;
+    }
+
+    return true;
+}
+
+typedef struct {
+    const fx_kernel_table_t* kernels;
+    const fx_matrix_t* in;
+    const fx_matrix_t* kernel;
+    fx_matrix_t* out;
+} conv2d_band_job_t;
+
+/**
+ * @brief Convolve output rows [r0, r1) from input rows [r0, r1 + kh − 1).
+ */
+static void conv2d_band(void* ctx, unsigned part, unsigned parts) {
+    const conv2d_band_job_t* job = (const conv2d_band_job_t*)ctx;
+    const fx_matrix_t* in = job->in;
+    const fx_matrix_t* out = job->out;
+    size_t r0, r1;
+
+    fx_pool_span(out->rows, part, parts, &r0, &r1);
+    if (r0 >= r1) {
+        return;
+    }
+
+    fx_matrix_t in_band, out_band;
+    fx_matrix_attach(&in_band, in->data + r0 * in->cols,
+                     (uint16_t)(r1 - r0 + job->kernel->rows - 1u), in->cols);
+    fx_matrix_attach(&out_band, out->data + r0 * out->cols, (uint16_t)(r1 - r0), out->cols);
+    job->kernels->conv2d(&in_band, job->kernel, &out_band);
+}
+
+void fx_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out) {
+    if (!conv2d_dims_ok(in, kernel, out)) {
         return;
     }
 
+    /* SRS-003.10, SRS-003.11: Active backend computes adjacent output
+     * columns with the same per-pixel accumulation as the reference */
+    conv2d_band_job_t job = { fx_kernels(), in, kernel, out };
+    const unsigned parts = fx_pool_parts(out->rows, (uint64_t)out->rows * out->cols *
+                                                    kernel->rows * kernel->cols);
+
+    FX_TRACE_BEGIN(FX_TRACE_CONV2D, out->rows, out->cols, kernel->rows * kernel->cols);
+    if (parts <= 1) {
+        job.kernels->conv2d(in, kernel, out);
+    } else {
+        /* SRS-013.3: Bands of output rows, each a valid conv in its own right */
+        fx_pool_run(conv2d_band, &job, parts);
+    }
+    FX_TRACE_END();
+}
+
+void fx_conv2d_ref(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out) {
+    if (!conv2d_dims_ok(in, kernel, out)) {
+        return;
+    }
+
+    fx_scalar_conv2d(in, kernel, out);
+}
+
+void fx_scalar_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out) {
     /* SRS-006.2: Sliding window implementation with explicit loops
      * SRS-006.5: Bounded execution time (depends only on dimensions) */
 
     /* Iterate over each output position */
-    for (uint16_t out_row = 0; out_row < out->rows; out_row++) {
-        for (uint16_t out_col = 0; out_col < out->cols; out_col++) {
+    for (size_t out_row = 0; out_row < out->rows; out_row++) {
+        for (size_t out_col = 0; out_col < out->cols; out_col++) {
 
             /* SRS-006.3: 64-bit accumulator to prevent overflow */
             int64_t accumulator = 0;
 
             /* Sliding window: compute dot product of kernel with input patch */
-            for (uint16_t ker_row = 0; ker_row < kernel->rows; ker_row++) {
-                for (uint16_t ker_col = 0; ker_col < kernel->cols; ker_col++) {
+            for (size_t ker_row = 0; ker_row < kernel->rows; ker_row++) {
+                for (size_t ker_col = 0; ker_col < kernel->cols; ker_col++) {
 
                     /* Input position for this kernel element */
-                    uint16_t in_row = out_row + ker_row;
-                    uint16_t in_col = out_col + ker_col;
+                    size_t in_row = out_row + ker_row;
+                    size_t in_col = out_col + ker_col;
 
                     /* Get values (row-major layout) */
                     fixed_t input_val = in->data[in_row * in->cols + in_col];
@@ -72,3 +144,889 @@ void fx_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* ou
         }
     }
 }
+
+/*
+ * Multi-channel convolution (SRS-006.7 - SRS-006.10)
+ */
+
+uint16_t fx_conv2d_out_dim(uint16_t in, uint16_t k, uint16_t stride,
+                           uint16_t pad, uint16_t dilation) {
+    if (k == 0 || stride == 0 || dilation == 0) {
+        return 0;
+    }
+
+    /* Dilated kernel extent must fit within the padded input */
+    const uint32_t padded = (uint32_t)in + 2u * pad;
+    const uint32_t extent = (uint32_t)dilation * (k - 1u) + 1u;
+    if (extent > padded) {
+        return 0;
+    }
+
+    const uint32_t out = (padded - extent) / stride + 1u;
+    return out > UINT16_MAX ? 0 : (uint16_t)out;
+}
+
+/**
+ * @brief Element strides of a tensor's four dimensions.
+ */
+typedef struct {
+    size_t n, c, h, w;
+} conv_strides_t;
+
+static conv_strides_t tensor_strides(const fx_tensor_t* t) {
+    conv_strides_t s;
+
+    if (t->layout == FX_LAYOUT_NHWC) {
+        s.c = 1;
+        s.w = t->c;
+        s.h = (size_t)t->w * t->c;
+        s.n = (size_t)t->h * s.h;
+    } else {
+        s.w = 1;
+        s.h = t->w;
+        s.c = (size_t)t->h * t->w;
+        s.n = (size_t)t->c * s.c;
+    }
+    return s;
+}
+
+/**
+ * @brief Shared argument validation for the multi-channel entry points.
+ */
+static fx_conv_res_t conv2d_multi_check(const fx_tensor_t* in, const fx_tensor_t* weights,
+                                        const fx_conv_params_t* p, const fx_tensor_t* out) {
+    if (!in || !weights || !p || !out || !in->data || !weights->data || !out->data) {
+        return FX_CONV_INVALID_PARAM;
+    }
+    if (p->stride_h == 0 || p->stride_w == 0 || p->dilation_h == 0 || p->dilation_w == 0) {
+        return FX_CONV_INVALID_PARAM;
+    }
+
+    /* Channel and batch agreement */
+    if (weights->c != in->c || out->c != weights->n || out->n != in->n) {
+        return FX_CONV_DIM_MISMATCH;
+    }
+
+    const uint16_t oh = fx_conv2d_out_dim(in->h, weights->h, p->stride_h, p->pad_h, p->dilation_h);
+    const uint16_t ow = fx_conv2d_out_dim(in->w, weights->w, p->stride_w, p->pad_w, p->dilation_w);
+    if (oh == 0 || ow == 0 || out->h != oh || out->w != ow) {
+        return FX_CONV_DIM_MISMATCH;
+    }
+
+    return FX_CONV_OK;
+}
+
+/**
+ * @brief Round a Q32.32 accumulator and apply the optional bias.
+ */
+static inline fixed_t conv_finish(int64_t acc, const fixed_t* bias, size_t o) {
+    /* SRS-006.4: Single round-to-nearest per output */
+    fixed_t v = (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+    return bias ? fixed_add(v, bias[o]) : v;
+}
+
+/**
+ * @brief Accumulate filters [o0, o0 + ob) at conv output pixel (y, x).
+ *
+ * @details SRS-006.8: Each input sample is loaded once and multiplied into
+ * all ob accumulators. Taps in the zero padding are skipped (SRS-006.7).
+ */
+static inline void conv_pixel_block(const fixed_t* src, const conv_strides_t* si,
+                                    const fx_tensor_t* in, const fx_tensor_t* weights,
+                                    const conv_strides_t* sk, const fx_conv_params_t* p,
+                                    size_t o0, size_t ob, size_t y, size_t x,
+                                    int64_t acc[FX_CONV_OC_BLOCK]) {
+    const int32_t H = in->h, W = in->w;
+    const int32_t iy0 = (int32_t)(y * p->stride_h) - p->pad_h;
+    const int32_t ix0 = (int32_t)(x * p->stride_w) - p->pad_w;
+    const fixed_t* ker = weights->data + o0 * sk->n;
+
+    /* SRS-006.3: One 64-bit accumulator per output */
+    for (size_t f = 0; f < FX_CONV_OC_BLOCK; f++) {
+        acc[f] = 0;
+    }
+
+    for (size_t c = 0; c < in->c; c++) {
+        for (size_t i = 0; i < weights->h; i++) {
+            /* SRS-006.7: Rows in the zero padding contribute nothing */
+            const int32_t iy = iy0 + (int32_t)(i * p->dilation_h);
+            if (iy < 0 || iy >= H) {
+                continue;
+            }
+
+            for (size_t j = 0; j < weights->w; j++) {
+                const int32_t ix = ix0 + (int32_t)(j * p->dilation_w);
+                if (ix < 0 || ix >= W) {
+                    continue;
+                }
+
+                /* Load the input sample once for the whole block */
+                const int64_t v = src[c * si->c + (size_t)iy * si->h + (size_t)ix * si->w];
+                const fixed_t* k = ker + c * sk->c + i * sk->h + j * sk->w;
+
+                for (size_t f = 0; f < ob; f++) {
+                    acc[f] += v * k[f * sk->n];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief One direct multi-channel convolution and its row partition.
+ */
+typedef struct {
+    const fx_tensor_t* in;
+    const fx_tensor_t* weights;
+    const fixed_t* bias;
+    const fx_conv_params_t* params;
+    const fx_conv_epilogue_t* epi;   /* NULL: fx_conv2d_multi(), else fx_conv2d_fused() */
+    fx_tensor_t* out;
+} conv_job_t;
+
+/**
+ * @brief fx_conv2d_multi() over output rows [y0, y1) of every batch.
+ */
+static void conv_multi_rows(const conv_job_t* job, size_t y0, size_t y1) {
+    const fx_tensor_t* in = job->in;
+    const fx_tensor_t* weights = job->weights;
+    const fixed_t* bias = job->bias;
+    fx_tensor_t* out = job->out;
+    const conv_strides_t si = tensor_strides(in);
+    const conv_strides_t sk = tensor_strides(weights);
+    const conv_strides_t so = tensor_strides(out);
+
+    /* SRS-006.8: A block of filters shares each pass over the input.
+     * The block stays resident for the whole batch */
+    for (size_t o0 = 0; o0 < out->c; o0 += FX_CONV_OC_BLOCK) {
+        const size_t ob = (out->c - o0 < FX_CONV_OC_BLOCK) ? out->c - o0 : FX_CONV_OC_BLOCK;
+
+        for (size_t b = 0; b < in->n; b++) {
+            const fixed_t* src = in->data + b * si.n;
+
+            for (size_t y = y0; y < y1; y++) {
+                for (size_t x = 0; x < out->w; x++) {
+                    int64_t acc[FX_CONV_OC_BLOCK];
+                    conv_pixel_block(src, &si, in, weights, &sk, job->params, o0, ob, y, x, acc);
+
+                    fixed_t* dst = out->data + b * so.n + y * so.h + x * so.w;
+                    for (size_t f = 0; f < ob; f++) {
+                        dst[(o0 + f) * so.c] = conv_finish(acc[f], bias, o0 + f);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief fx_conv2d_fused() over (pooled) output rows [y0, y1) of every batch.
+ */
+static void conv_fused_rows(const conv_job_t* job, size_t y0, size_t y1) {
+    const fx_tensor_t* in = job->in;
+    const fx_tensor_t* weights = job->weights;
+    const fixed_t* bias = job->bias;
+    const fx_conv_epilogue_t* epi = job->epi;
+    fx_tensor_t* out = job->out;
+    const size_t pool = epi->maxpool_2x2 ? 2 : 1;
+    const conv_strides_t si = tensor_strides(in);
+    const conv_strides_t sk = tensor_strides(weights);
+    const conv_strides_t so = tensor_strides(out);
+
+    /* SRS-006.8: Filter block outermost, reused across the batch */
+    for (size_t o0 = 0; o0 < out->c; o0 += FX_CONV_OC_BLOCK) {
+        const size_t ob = (out->c - o0 < FX_CONV_OC_BLOCK) ? out->c - o0 : FX_CONV_OC_BLOCK;
+
+        for (size_t b = 0; b < in->n; b++) {
+            const fixed_t* src = in->data + b * si.n;
+
+            for (size_t y = y0; y < y1; y++) {
+                for (size_t x = 0; x < out->w; x++) {
+                    fixed_t best[FX_CONV_OC_BLOCK];
+
+                    /* SRS-004.9: Conv outputs of the window never leave registers */
+                    for (size_t q = 0; q < pool * pool; q++) {
+                        int64_t acc[FX_CONV_OC_BLOCK];
+                        conv_pixel_block(src, &si, in, weights, &sk, job->params, o0, ob,
+                                         y * pool + q / pool, x * pool + q % pool, acc);
+
+                        for (size_t f = 0; f < ob; f++) {
+                            const fixed_t v = fx_activate(conv_finish(acc[f], bias, o0 + f),
+                                                          epi->act, epi->alpha);
+                            /* SRS-008.2: Max of the window, as fx_maxpool_2x2() */
+                            if (q == 0 || v > best[f]) {
+                                best[f] = v;
+                            }
+                        }
+                    }
+
+                    fixed_t* dst = out->data + b * so.n + y * so.h + x * so.w;
+                    for (size_t f = 0; f < ob; f++) {
+                        dst[(o0 + f) * so.c] = best[f];
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void conv_rows_part(void* ctx, unsigned part, unsigned parts) {
+    const conv_job_t* job = (const conv_job_t*)ctx;
+    size_t y0, y1;
+
+    fx_pool_span(job->out->h, part, parts, &y0, &y1);
+    if (job->epi) {
+        conv_fused_rows(job, y0, y1);
+    } else {
+        conv_multi_rows(job, y0, y1);
+    }
+}
+
+/**
+ * @brief Run a direct convolution, split by output rows when a pool is up.
+ *
+ * @details SRS-013.3: Output rows are independent, so each part computes
+ * whole rows of every batch and filter with the serial loop nest.
+ */
+static void conv_run(conv_job_t* job) {
+    const size_t pool = (job->epi && job->epi->maxpool_2x2) ? 4 : 1;
+    const uint64_t work = (uint64_t)job->in->n * job->out->h * job->out->w * pool *
+                          job->out->c * job->in->c * job->weights->h * job->weights->w;
+
+    fx_pool_run(conv_rows_part, job, fx_pool_parts(job->out->h, work));
+}
+
+fx_conv_res_t fx_conv2d_multi(const fx_tensor_t* in, const fx_tensor_t* weights,
+                              const fixed_t* bias, const fx_conv_params_t* params,
+                              fx_tensor_t* out) {
+    fx_conv_res_t res = conv2d_multi_check(in, weights, params, out);
+    if (res != FX_CONV_OK) {
+        return res;
+    }
+
+    conv_job_t job = { in, weights, bias, params, NULL, out };
+    FX_TRACE_BEGIN(FX_TRACE_CONV2D_DIRECT, out->c, out->h, out->w);
+    conv_run(&job);
+    FX_TRACE_END();
+    return FX_CONV_OK;
+}
+
+fx_conv_res_t fx_conv2d_fused(const fx_tensor_t* in, const fx_tensor_t* weights,
+                              const fixed_t* bias, const fx_conv_params_t* params,
+                              const fx_conv_epilogue_t* epi, fx_tensor_t* out) {
+    static const fx_conv_epilogue_t none = { FX_ACT_NONE, FIXED_ZERO, false };
+    if (!epi) {
+        epi = &none;
+    }
+    if (!out) {
+        return FX_CONV_INVALID_PARAM;
+    }
+
+    /* Validate against the (unpooled) conv output shape */
+    const size_t pool = epi->maxpool_2x2 ? 2 : 1;
+    fx_tensor_t conv = *out;
+    if ((size_t)out->h * pool > UINT16_MAX || (size_t)out->w * pool > UINT16_MAX) {
+        return FX_CONV_DIM_MISMATCH;
+    }
+    conv.h = (uint16_t)(out->h * pool);
+    conv.w = (uint16_t)(out->w * pool);
+
+    fx_conv_res_t res = conv2d_multi_check(in, weights, params, &conv);
+    if (res != FX_CONV_OK) {
+        return res;
+    }
+
+    conv_job_t job = { in, weights, bias, params, epi, out };
+    FX_TRACE_BEGIN(FX_TRACE_CONV2D_DIRECT, out->c, out->h, out->w);
+    conv_run(&job);
+    FX_TRACE_END();
+    return FX_CONV_OK;
+}
+
+fx_conv_res_t fx_conv2d_bias_relu_maxpool(const fx_tensor_t* in, const fx_tensor_t* weights,
+                                          const fixed_t* bias, const fx_conv_params_t* params,
+                                          fx_tensor_t* out) {
+    const fx_conv_epilogue_t epi = { FX_ACT_RELU, FIXED_ZERO, true };
+    return fx_conv2d_fused(in, weights, bias, params, &epi, out);
+}
+
+fx_conv_res_t fx_conv2d_multi_ref(const fx_tensor_t* in, const fx_tensor_t* weights,
+                                  const fixed_t* bias, const fx_conv_params_t* params,
+                                  fx_tensor_t* out) {
+    fx_conv_res_t res = conv2d_multi_check(in, weights, params, out);
+    if (res != FX_CONV_OK) {
+        return res;
+    }
+
+    for (size_t b = 0; b < in->n; b++) {
+        for (size_t o = 0; o < out->c; o++) {
+            for (size_t y = 0; y < out->h; y++) {
+                for (size_t x = 0; x < out->w; x++) {
+                    int64_t acc = 0;
+
+                    for (size_t c = 0; c < in->c; c++) {
+                        for (size_t i = 0; i < weights->h; i++) {
+                            for (size_t j = 0; j < weights->w; j++) {
+                                const int32_t iy = (int32_t)(y * params->stride_h + i * params->dilation_h)
+                                                 - params->pad_h;
+                                const int32_t ix = (int32_t)(x * params->stride_w + j * params->dilation_w)
+                                                 - params->pad_w;
+
+                                /* Zero padding */
+                                if (iy < 0 || iy >= in->h || ix < 0 || ix >= in->w) {
+                                    continue;
+                                }
+
+                                acc += (int64_t)in->data[fx_tensor_offset(in, b, c, (size_t)iy, (size_t)ix)]
+                                     * weights->data[fx_tensor_offset(weights, o, c, i, j)];
+                            }
+                        }
+                    }
+
+                    out->data[fx_tensor_offset(out, b, o, y, x)] = conv_finish(acc, bias, o);
+                }
+            }
+        }
+    }
+
+    return FX_CONV_OK;
+}
+
+/*
+ * im2col lowering onto the blocked GEMM (SRS-006.11)
+ */
+
+/**
+ * @brief True when the column matrix is the NCHW input plane itself.
+ */
+static bool im2col_is_identity(const fx_tensor_t* in, const fx_tensor_t* weights,
+                               const fx_conv_params_t* p) {
+    return in->layout == FX_LAYOUT_NCHW &&
+           weights->h == 1 && weights->w == 1 &&
+           p->stride_h == 1 && p->stride_w == 1 &&
+           p->pad_h == 0 && p->pad_w == 0;
+}
+
+size_t fx_conv2d_workspace_size(const fx_tensor_t* in, const fx_tensor_t* weights,
+                                const fx_conv_params_t* params, const fx_tensor_t* out) {
+    if (conv2d_multi_check(in, weights, params, out) != FX_CONV_OK ||
+        params->algo != FX_CONV_ALGO_IM2COL) {
+        return 0;
+    }
+
+    const size_t pixels = (size_t)out->h * out->w;
+    const size_t tile = pixels < FX_CONV_IM2COL_COLS ? pixels : FX_CONV_IM2COL_COLS;
+    const size_t k = (size_t)weights->c * weights->h * weights->w;
+    size_t len = 0;
+
+    if (!im2col_is_identity(in, weights, params)) {
+        len += k * tile;
+    }
+    if (out->layout == FX_LAYOUT_NHWC) {
+        len += (size_t)out->c * tile;
+    }
+    return len;
+}
+
+/**
+ * @brief Lower output pixels [p0, p0 + pt) of one batch into a K × pt tile.
+ *
+ * @details Row order matches the filter layout so the filter tensor can be
+ * used as the C_out × K GEMM operand in place: (c, i, j) for NCHW filters,
+ * (i, j, c) for NHWC filters. Samples that fall in the padding are zero.
+ */
+static void im2col_tile(const fixed_t* src, const conv_strides_t* si,
+                        const fx_tensor_t* in, const fx_tensor_t* weights,
+                        const fx_conv_params_t* p, size_t out_w,
+                        size_t p0, size_t pt, fixed_t* col) {
+    const int32_t H = in->h, W = in->w;
+
+    for (size_t c = 0; c < weights->c; c++) {
+        for (size_t i = 0; i < weights->h; i++) {
+            for (size_t j = 0; j < weights->w; j++) {
+                const size_t row = (weights->layout == FX_LAYOUT_NHWC)
+                                 ? (i * weights->w + j) * weights->c + c
+                                 : (c * weights->h + i) * weights->w + j;
+                fixed_t* dst = col + row * pt;
+                size_t y = p0 / out_w;
+                size_t x = p0 % out_w;
+
+                for (size_t q = 0; q < pt; q++) {
+                    const int32_t iy = (int32_t)(y * p->stride_h + i * p->dilation_h) - p->pad_h;
+                    const int32_t ix = (int32_t)(x * p->stride_w + j * p->dilation_w) - p->pad_w;
+
+                    /* SRS-006.7: Zero padding */
+                    dst[q] = (iy < 0 || iy >= H || ix < 0 || ix >= W)
+                           ? FIXED_ZERO
+                           : src[c * si->c + (size_t)iy * si->h + (size_t)ix * si->w];
+
+                    if (++x == out_w) {
+                        x = 0;
+                        y++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void conv2d_im2col(const fx_tensor_t* in, const fx_tensor_t* weights,
+                          const fixed_t* bias, const fx_conv_params_t* params,
+                          fixed_t* workspace, fx_tensor_t* out) {
+    const conv_strides_t si = tensor_strides(in);
+    const conv_strides_t so = tensor_strides(out);
+    const size_t pixels = (size_t)out->h * out->w;
+    const size_t k = (size_t)weights->c * weights->h * weights->w;
+    const size_t cout = out->c;
+    const bool identity = im2col_is_identity(in, weights, params);
+    const bool nhwc_out = out->layout == FX_LAYOUT_NHWC;
+    const size_t tile = pixels < FX_CONV_IM2COL_COLS ? pixels : FX_CONV_IM2COL_COLS;
+
+    const fx_gemm_epilogue_t epi = { bias, NULL, FX_ACT_NONE, FIXED_ZERO };
+
+    /* Workspace: [column tile (K × T)] [staging tile (C_out × T), NHWC only] */
+    fixed_t* col = workspace;
+    fixed_t* stage = identity ? workspace : workspace + k * tile;
+
+    for (size_t b = 0; b < in->n; b++) {
+        const fixed_t* src = in->data + b * si.n;
+
+        for (size_t p0 = 0; p0 < pixels; p0 += tile) {
+            const size_t pt = (pixels - p0 < tile) ? pixels - p0 : tile;
+            const fixed_t* b_data = col;
+            size_t ldb = pt;
+
+            if (identity) {
+                /* 1×1 stride-1: row c of the column matrix is plane c */
+                b_data = src + p0;
+                ldb = pixels;
+            } else {
+                im2col_tile(src, &si, in, weights, params, out->w, p0, pt, col);
+            }
+
+            /* SRS-003.9: Filters (C_out × K, used in place) × columns (K × pt) */
+            if (!nhwc_out) {
+                /* SRS-004.9: Per-filter bias applied in the GEMM epilogue */
+                fx_gemm(cout, pt, k, weights->data, k, b_data, ldb,
+                        out->data + b * so.n + p0, pixels, &epi);
+            } else {
+                fixed_t* dst = out->data + b * so.n + p0 * so.w;
+
+                fx_gemm(cout, pt, k, weights->data, k, b_data, ldb, stage, pt, NULL);
+                for (size_t q = 0; q < pt; q++) {
+                    for (size_t o = 0; o < cout; o++) {
+                        const fixed_t v = stage[o * pt + q];
+                        dst[q * so.w + o] = bias ? fixed_add(v, bias[o]) : v;
+                    }
+                }
+            }
+        }
+    }
+}
+
+fx_conv_res_t fx_conv2d_layer(const fx_tensor_t* in, const fx_tensor_t* weights,
+                              const fixed_t* bias, const fx_conv_params_t* params,
+                              fixed_t* workspace, size_t workspace_len,
+                              fx_tensor_t* out) {
+    fx_conv_res_t res = conv2d_multi_check(in, weights, params, out);
+    if (res != FX_CONV_OK) {
+        return res;
+    }
+
+    switch (params->algo) {
+    case FX_CONV_ALGO_DIRECT:
+        return fx_conv2d_multi(in, weights, bias, params, out);
+
+    case FX_CONV_ALGO_IM2COL: {
+        const size_t needed = fx_conv2d_workspace_size(in, weights, params, out);
+        if (needed > 0 && (!workspace || workspace_len < needed)) {
+            return FX_CONV_WORKSPACE_TOO_SMALL;
+        }
+        FX_TRACE_BEGIN(FX_TRACE_CONV2D_IM2COL, out->c, out->h, out->w);
+        conv2d_im2col(in, weights, bias, params, workspace, out);
+        FX_TRACE_END();
+        return FX_CONV_OK;
+    }
+
+    default:
+        return FX_CONV_INVALID_PARAM;
+    }
+}
+
+/*
+ * Winograd F(2×2, 3×3) with integer transforms (SRS-006.12)
+ *
+ *   Bᵀ = | 1  0 -1  0 |   G' = 2G = | 2  0  0 |   Aᵀ = | 1  1  1  0 |
+ *        | 0  1  1  0 |             | 1  1  1 |        | 0  1 -1 -1 |
+ *        | 0 -1  1  0 |             | 1 -1  1 |
+ *        | 0  1  0 -1 |             | 0  0  2 |
+ *
+ *   Y' = Aᵀ [ Σc (G' g G'ᵀ) ⊙ (Bᵀ d B) ] A = 4 · Σc (d ⋆ g)
+ */
+
+#define WINO_OC_BLOCK 8          /* Filters per pass over a tile */
+#define WINO_IC_BLOCK 16         /* Input transforms held at once */
+
+size_t fx_winograd_filter_size(const fx_tensor_t* weights) {
+    if (!weights) {
+        return 0;
+    }
+    return (size_t)weights->n * weights->c * FX_WINOGRAD_TILE;
+}
+
+/**
+ * @brief U' = G' g G'ᵀ for one 3×3 filter.
+ */
+static void wino_filter_transform(int64_t g[3][3], int64_t u[FX_WINOGRAD_TILE]) {
+    int64_t t[4][3];
+
+    for (size_t j = 0; j < 3; j++) {
+        t[0][j] = 2 * g[0][j];
+        t[1][j] = g[0][j] + g[1][j] + g[2][j];
+        t[2][j] = g[0][j] - g[1][j] + g[2][j];
+        t[3][j] = 2 * g[2][j];
+    }
+    for (size_t i = 0; i < 4; i++) {
+        u[i * 4 + 0] = 2 * t[i][0];
+        u[i * 4 + 1] = t[i][0] + t[i][1] + t[i][2];
+        u[i * 4 + 2] = t[i][0] - t[i][1] + t[i][2];
+        u[i * 4 + 3] = 2 * t[i][2];
+    }
+}
+
+/** |U'| ≤ 9 · max|g| for a fixed_t filter (rows of |G'| sum to at most 3) */
+#define WINO_U_MAX (9 * ((int64_t)1 << 31))
+
+/**
+ * @brief True if U' = G' g G'ᵀ for a 3×3 fixed_t filter g.
+ *
+ * @details The 16 entries over-determine the 9 of g: the corners give
+ * 4·g00, 4·g02, 4·g20, 4·g22 and differences of the edge entries the
+ * rest. g is recovered from those and transformed again; U' must match
+ * in every entry, otherwise the inverse transform's exact division by 4
+ * no longer holds.
+ */
+static bool wino_filter_consistent(const int64_t u[FX_WINOGRAD_TILE]) {
+    int64_t g[3][3], v[FX_WINOGRAD_TILE];
+
+    for (size_t e = 0; e < FX_WINOGRAD_TILE; e++) {
+        if (u[e] > WINO_U_MAX || u[e] < -WINO_U_MAX) {
+            return false;
+        }
+    }
+
+    g[0][0] = u[0] / 4;
+    g[0][2] = u[3] / 4;
+    g[2][0] = u[12] / 4;
+    g[2][2] = u[15] / 4;
+    g[0][1] = (u[1] - u[2]) / 4;
+    g[2][1] = (u[13] - u[14]) / 4;
+    g[1][0] = (u[4] - u[8]) / 4;
+    g[1][2] = (u[7] - u[11]) / 4;
+    g[1][1] = ((u[5] - u[6]) - (u[9] - u[10])) / 4;
+
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            if (g[i][j] > FIXED_MAX || g[i][j] < FIXED_MIN) {
+                return false;
+            }
+        }
+    }
+
+    wino_filter_transform(g, v);
+    return memcmp(u, v, sizeof(v)) == 0;
+}
+
+/**
+ * @brief V = Bᵀ d B for one 4×4 input patch.
+ */
+static void wino_input_transform(int64_t d[4][4], int64_t v[FX_WINOGRAD_TILE]) {
+    int64_t t[4][4];
+
+    for (size_t j = 0; j < 4; j++) {
+        t[0][j] = d[0][j] - d[2][j];
+        t[1][j] = d[1][j] + d[2][j];
+        t[2][j] = d[2][j] - d[1][j];
+        t[3][j] = d[1][j] - d[3][j];
+    }
+    for (size_t i = 0; i < 4; i++) {
+        v[i * 4 + 0] = t[i][0] - t[i][2];
+        v[i * 4 + 1] = t[i][1] + t[i][2];
+        v[i * 4 + 2] = t[i][2] - t[i][1];
+        v[i * 4 + 3] = t[i][1] - t[i][3];
+    }
+}
+
+/**
+ * @brief Y' = Aᵀ M A for one accumulated tile.
+ */
+static void wino_output_transform(const int64_t m[FX_WINOGRAD_TILE], int64_t y[2][2]) {
+    int64_t t[2][4] = { { 0 } };
+
+    for (size_t j = 0; j < 4; j++) {
+        t[0][j] = m[0 * 4 + j] + m[1 * 4 + j] + m[2 * 4 + j];
+        t[1][j] = m[1 * 4 + j] - m[2 * 4 + j] - m[3 * 4 + j];
+    }
+    for (size_t r = 0; r < 2; r++) {
+        y[r][0] = t[r][0] + t[r][1] + t[r][2];
+        y[r][1] = t[r][1] - t[r][2] - t[r][3];
+    }
+}
+
+/* Overflow-checked arithmetic on non-negative magnitude bounds */
+static bool bound_add(int64_t a, int64_t b, int64_t* r) {
+    if (a > INT64_MAX - b) {
+        return false;
+    }
+    *r = a + b;
+    return true;
+}
+
+static bool bound_add3(int64_t a, int64_t b, int64_t c, int64_t* r) {
+    int64_t ab;
+    return bound_add(a, b, &ab) && bound_add(ab, c, r);
+}
+
+static bool bound_mul(int64_t a, int64_t b, int64_t* r) {
+    if (a != 0 && b > INT64_MAX / a) {
+        return false;
+    }
+    *r = a * b;
+    return true;
+}
+
+/**
+ * @brief Prove that filter o cannot overflow int64 for |x| ≤ bound.
+ *
+ * @details Every intermediate is a signed sum of terms, so the sum of
+ * their magnitudes bounds both the value and every partial sum.
+ * |V| ≤ 4·bound because each row of Bᵀ has two unit entries.
+ */
+static bool wino_filter_exact(const int64_t* u, size_t cin, uint32_t bound) {
+    int64_t s[FX_WINOGRAD_TILE] = {0};
+    int64_t m[FX_WINOGRAD_TILE];
+    int64_t t[2][4];
+    int64_t y;
+    const int64_t vb = 4 * (int64_t)bound;
+
+    /* Σc |U'| per tile element */
+    for (size_t c = 0; c < cin; c++) {
+        for (size_t e = 0; e < FX_WINOGRAD_TILE; e++) {
+            const int64_t a = u[c * FX_WINOGRAD_TILE + e];
+            if (!bound_add(s[e], a < 0 ? -a : a, &s[e])) {
+                return false;
+            }
+        }
+    }
+
+    /* Channel sums of U' ⊙ V */
+    for (size_t e = 0; e < FX_WINOGRAD_TILE; e++) {
+        if (!bound_mul(s[e], vb, &m[e])) {
+            return false;
+        }
+    }
+
+    /* Output transform: |Aᵀ| rows have three unit entries */
+    for (size_t j = 0; j < 4; j++) {
+        if (!bound_add3(m[0 * 4 + j], m[1 * 4 + j], m[2 * 4 + j], &t[0][j]) ||
+            !bound_add3(m[1 * 4 + j], m[2 * 4 + j], m[3 * 4 + j], &t[1][j])) {
+            return false;
+        }
+    }
+    for (size_t r = 0; r < 2; r++) {
+        if (!bound_add3(t[r][0], t[r][1], t[r][2], &y) ||
+            !bound_add3(t[r][1], t[r][2], t[r][3], &y)) {
+            return false;
+        }
+    }
+
+    /* Y'/4 + FIXED_HALF then stays far inside int64 */
+    return true;
+}
+
+/* Geometry Winograd F(2×2, 3×3) supports (the 3×3 filter is checked by the caller) */
+static bool wino_params_ok(const fx_conv_params_t* params) {
+    return params->stride_h == 1 && params->stride_w == 1 &&
+           params->dilation_h == 1 && params->dilation_w == 1;
+}
+
+fx_conv_res_t fx_winograd_plan(fx_winograd_plan_t* plan, const fx_tensor_t* weights,
+                               const fx_conv_params_t* params, uint32_t input_bound,
+                               int64_t* u_storage, size_t u_len) {
+    if (!plan || !weights || !weights->data || !params || !u_storage) {
+        return FX_CONV_INVALID_PARAM;
+    }
+    if (input_bound > FX_WINOGRAD_BOUND_ANY) {
+        return FX_CONV_INVALID_PARAM;
+    }
+    if (weights->h != 3 || weights->w != 3 || !wino_params_ok(params)) {
+        return FX_CONV_UNSUPPORTED;
+    }
+    if (u_len < fx_winograd_filter_size(weights)) {
+        return FX_CONV_WORKSPACE_TOO_SMALL;
+    }
+
+    /* Transform every filter: u[(o·C_in + c)·16 + e] */
+    for (size_t o = 0; o < weights->n; o++) {
+        for (size_t c = 0; c < weights->c; c++) {
+            int64_t g[3][3];
+
+            for (size_t i = 0; i < 3; i++) {
+                for (size_t j = 0; j < 3; j++) {
+                    g[i][j] = weights->data[fx_tensor_offset(weights, o, c, i, j)];
+                }
+            }
+            wino_filter_transform(g, &u_storage[(o * weights->c + c) * FX_WINOGRAD_TILE]);
+        }
+    }
+
+    return fx_winograd_plan_transformed(plan, u_storage, weights->n, weights->c,
+                                        params, input_bound);
+}
+
+fx_conv_res_t fx_winograd_plan_transformed(fx_winograd_plan_t* plan, const int64_t* u,
+                                           uint16_t cout, uint16_t cin,
+                                           const fx_conv_params_t* params, uint32_t input_bound) {
+    if (!plan || !u || !params || input_bound > FX_WINOGRAD_BOUND_ANY) {
+        return FX_CONV_INVALID_PARAM;
+    }
+    if (!wino_params_ok(params)) {
+        return FX_CONV_UNSUPPORTED;
+    }
+
+    /* SRS-006.13: Every U' must be the transform of a real filter */
+    for (size_t f = 0; f < (size_t)cout * cin; f++) {
+        if (!wino_filter_consistent(&u[f * FX_WINOGRAD_TILE])) {
+            return FX_CONV_INVALID_PARAM;
+        }
+    }
+
+    /* Setup-time exactness proof, filter by filter (SRS-006.13: also for
+     * filters transformed offline) */
+    for (size_t o = 0; o < cout; o++) {
+        if (!wino_filter_exact(&u[o * cin * FX_WINOGRAD_TILE], cin, input_bound)) {
+            return FX_CONV_INEXACT;
+        }
+    }
+
+    plan->u = u;
+    plan->cout = cout;
+    plan->cin = cin;
+    plan->pad_h = params->pad_h;
+    plan->pad_w = params->pad_w;
+    plan->input_bound = input_bound;
+    return FX_CONV_OK;
+}
+
+/**
+ * @brief Load a 4×4 input patch with zero padding.
+ */
+static void wino_load_patch(const fixed_t* src, const conv_strides_t* si,
+                            int32_t H, int32_t W, int32_t iy0, int32_t ix0,
+                            int64_t d[4][4]) {
+    for (int32_t i = 0; i < 4; i++) {
+        const int32_t iy = iy0 + i;
+
+        for (int32_t j = 0; j < 4; j++) {
+            const int32_t ix = ix0 + j;
+
+            d[i][j] = (iy < 0 || iy >= H || ix < 0 || ix >= W)
+                    ? 0
+                    : src[(size_t)iy * si->h + (size_t)ix * si->w];
+        }
+    }
+}
+
+fx_conv_res_t fx_conv2d_winograd(const fx_winograd_plan_t* plan, const fx_tensor_t* in,
+                                 const fixed_t* bias, fx_tensor_t* out) {
+    if (!plan || !plan->u || !in || !out || !in->data || !out->data) {
+        return FX_CONV_INVALID_PARAM;
+    }
+    if (in->c != plan->cin || out->c != plan->cout || out->n != in->n) {
+        return FX_CONV_DIM_MISMATCH;
+    }
+
+    const uint16_t oh = fx_conv2d_out_dim(in->h, 3, 1, plan->pad_h, 1);
+    const uint16_t ow = fx_conv2d_out_dim(in->w, 3, 1, plan->pad_w, 1);
+    if (oh == 0 || ow == 0 || out->h != oh || out->w != ow) {
+        return FX_CONV_DIM_MISMATCH;
+    }
+
+    /* The proof assumed |x| ≤ input_bound: enforce it before writing */
+    const size_t total = fx_tensor_size(in);
+    for (size_t i = 0; i < total; i++) {
+        const int64_t x = in->data[i];
+        if ((uint64_t)(x < 0 ? -x : x) > plan->input_bound) {
+            return FX_CONV_INEXACT;
+        }
+    }
+
+    FX_TRACE_BEGIN(FX_TRACE_CONV2D_WINOGRAD, out->c, oh, ow);
+    const conv_strides_t si = tensor_strides(in);
+    const conv_strides_t so = tensor_strides(out);
+    const int32_t H = in->h, W = in->w;
+    const size_t cin = plan->cin;
+
+    /* SRS-003.1: Bounded stack storage */
+    int64_t v[WINO_IC_BLOCK][FX_WINOGRAD_TILE];
+    int64_t m[WINO_OC_BLOCK][FX_WINOGRAD_TILE] = { { 0 } };
+
+    for (size_t b = 0; b < in->n; b++) {
+        const fixed_t* src_b = in->data + b * si.n;
+
+        for (size_t ty = 0; ty < oh; ty += 2) {
+            for (size_t tx = 0; tx < ow; tx += 2) {
+                const int32_t iy0 = (int32_t)ty - plan->pad_h;
+                const int32_t ix0 = (int32_t)tx - plan->pad_w;
+
+                for (size_t o0 = 0; o0 < plan->cout; o0 += WINO_OC_BLOCK) {
+                    const size_t ob = (plan->cout - o0 < WINO_OC_BLOCK) ? plan->cout - o0 : WINO_OC_BLOCK;
+
+                    for (size_t f = 0; f < ob; f++) {
+                        for (size_t e = 0; e < FX_WINOGRAD_TILE; e++) {
+                            m[f][e] = 0;
+                        }
+                    }
+
+                    for (size_t c0 = 0; c0 < cin; c0 += WINO_IC_BLOCK) {
+                        const size_t cb = (cin - c0 < WINO_IC_BLOCK) ? cin - c0 : WINO_IC_BLOCK;
+
+                        for (size_t c = 0; c < cb; c++) {
+                            int64_t d[4][4] = { { 0 } };
+                            wino_load_patch(src_b + (c0 + c) * si.c, &si, H, W, iy0, ix0, d);
+                            wino_input_transform(d, v[c]);
+                        }
+
+                        /* 16 exact 64-bit multiplies per (filter, channel) */
+                        for (size_t f = 0; f < ob; f++) {
+                            const int64_t* u = &plan->u[((o0 + f) * cin + c0) * FX_WINOGRAD_TILE];
+
+                            for (size_t c = 0; c < cb; c++) {
+                                for (size_t e = 0; e < FX_WINOGRAD_TILE; e++) {
+                                    m[f][e] += u[c * FX_WINOGRAD_TILE + e] * v[c][e];
+                                }
+                            }
+                        }
+                    }
+
+                    for (size_t f = 0; f < ob; f++) {
+                        int64_t y[2][2];
+                        wino_output_transform(m[f], y);
+
+                        for (size_t r = 0; r < 2 && ty + r < oh; r++) {
+                            for (size_t s = 0; s < 2 && tx + s < ow; s++) {
+                                /* Y' = 4 × direct accumulator, exactly */
+                                fixed_t* dst = out->data + b * so.n + (o0 + f) * so.c
+                                             + (ty + r) * so.h + (tx + s) * so.w;
+                                *dst = conv_finish(y[r][s] / 4, bias, o0 + f);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    FX_TRACE_END();
+    return FX_CONV_OK;
+}
@@ -0,0 +1,255 @@
+/**
+ * @file dispatch.c
+ * @project Certifiable Inference Engine
+ * @brief Runtime CPU feature detection and kernel table selection.
+ *
+ * @details The CPU is probed once (CPUID + XGETBV on x86-64, HWCAP on
+ * Linux/ARM) and the fastest compiled-in backend it supports becomes the
+ * active kernel table. Backends are only ever entered after the probe has
+ * confirmed both the instruction set and, on x86, that the OS saves the
+ * corresponding register state, so a single binary is safe on every CPU
+ * of the architecture.
+ *
+ * @traceability SRS-003.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "dispatch.h"
+#include "kernels.h"
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#define FX_ARCH_X86 1
+#endif
+
+#if (defined(__aarch64__) || defined(__arm__)) && defined(__linux__)
+#include <sys/auxv.h>
+#define FX_ARCH_ARM_LINUX 1
+#endif
+
+/* CPU feature bits (internal) */
+#define FX_CPU_PROBED  (1u << 0)
+#define FX_CPU_AVX2    (1u << 1)
+#define FX_CPU_AVX512  (1u << 2)
+#define FX_CPU_NEON    (1u << 3)
+
+const fx_kernel_table_t fx_kernels_scalar = {
+    FX_BACKEND_SCALAR,
+    fx_scalar_vector_dot,
+    fx_scalar_gemm_4x4,
+    fx_scalar_conv2d,
+    fx_scalar_relu,
+    fx_scalar_leaky_relu,
+    fx_scalar_maxpool_2x2,
+    fx_scalar_q8_dot,
+    fx_scalar_q8_gemm_row,
+    fx_scalar_scale,
+    fx_scalar_add_sat,
+    fx_scalar_clamp,
+    fx_scalar_convert_u8,
+    fx_scalar_convert_f32,
+    fx_scalar_affine
+};
+
+/* Read and written with __atomic builtins only: kernels on pool and
+ * pipeline threads load it while another thread may init or pin */
+const fx_kernel_table_t* fx_active_kernels = NULL;
+
+static uint32_t g_cpu_features = 0;
+
+#if defined(FX_ARCH_X86)
+/**
+ * @brief Read XCR0 to confirm the OS saves YMM/ZMM state on context switch.
+ */
+static uint64_t read_xcr0(void) {
+    uint32_t eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+}
+
+static uint32_t probe_x86(void) {
+    unsigned int eax, ebx, ecx, edx;
+    uint32_t features = 0;
+
+    /* Leaf 1: ECX.OSXSAVE[27] and ECX.AVX[28] gate any use of XGETBV */
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return 0;
+    }
+    if ((ecx & (1u << 27)) == 0 || (ecx & (1u << 28)) == 0) {
+        return 0;
+    }
+
+    const uint64_t xcr0 = read_xcr0();
+    const bool ymm_state = (xcr0 & 0x06u) == 0x06u;   /* SSE + AVX */
+    const bool zmm_state = (xcr0 & 0xE6u) == 0xE6u;   /* + opmask, ZMM */
+
+    /* Leaf 7 / subleaf 0: EBX.AVX2[5], EBX.AVX512F[16] */
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return 0;
+    }
+    if (ymm_state && (ebx & (1u << 5)) != 0) {
+        features |= FX_CPU_AVX2;
+    }
+    if (zmm_state && (ebx & (1u << 16)) != 0) {
+        features |= FX_CPU_AVX512;
+    }
+
+    return features;
+}
+#endif
+
+static uint32_t probe_arm(void) {
+#if defined(FX_ARCH_ARM_LINUX) && defined(__aarch64__)
+    /* HWCAP_ASIMD: Advanced SIMD reported by the kernel */
+    return (getauxval(AT_HWCAP) & (1ul << 1)) != 0 ? FX_CPU_NEON : 0;
+#elif defined(FX_ARCH_ARM_LINUX)
+    /* HWCAP_ARM_NEON */
+    return (getauxval(AT_HWCAP) & (1ul << 12)) != 0 ? FX_CPU_NEON : 0;
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+    /* Bare metal / non-Linux: Advanced SIMD is mandatory on AArch64 and
+     * __ARM_NEON means the toolchain was told the target has it */
+    return FX_CPU_NEON;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Probe the CPU once and cache the feature mask.
+ */
+static uint32_t cpu_features(void) {
+    uint32_t features = __atomic_load_n(&g_cpu_features, __ATOMIC_RELAXED);
+
+    /* Racing first calls compute the same mask; either store is correct */
+    if ((features & FX_CPU_PROBED) == 0) {
+        features = FX_CPU_PROBED;
+#if defined(FX_ARCH_X86)
+        features |= probe_x86();
+#endif
+        features |= probe_arm();
+        __atomic_store_n(&g_cpu_features, features, __ATOMIC_RELAXED);
+    }
+    return features;
+}
+
+/**
+ * @brief Kernel table for a backend if it was compiled in, else NULL.
+ */
+static const fx_kernel_table_t* table_for(fx_backend_t backend) {
+    switch (backend) {
+    case FX_BACKEND_SCALAR:
+        return &fx_kernels_scalar;
+#if defined(CI_HAVE_AVX2)
+    case FX_BACKEND_AVX2:
+        return &fx_kernels_avx2;
+#endif
+#if defined(CI_HAVE_AVX512)
+    case FX_BACKEND_AVX512:
+        return &fx_kernels_avx512;
+#endif
+#if defined(CI_HAVE_NEON)
+    case FX_BACKEND_NEON:
+        return &fx_kernels_neon;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+static bool cpu_supports(fx_backend_t backend) {
+    const uint32_t features = cpu_features();
+
+    switch (backend) {
+    case FX_BACKEND_SCALAR:
+        return true;
+    case FX_BACKEND_AVX2:
+        return (features & FX_CPU_AVX2) != 0;
+    case FX_BACKEND_AVX512:
+        return (features & FX_CPU_AVX512) != 0;
+    case FX_BACKEND_NEON:
+        return (features & FX_CPU_NEON) != 0;
+    default:
+        return false;
+    }
+}
+
+bool fx_backend_available(fx_backend_t backend) {
+    return table_for(backend) != NULL && cpu_supports(backend);
+}
+
+/**
+ * @brief Widest backend the CPU supports, in fixed preference order.
+ */
+static const fx_kernel_table_t* select_auto(void) {
+    static const fx_backend_t preference[] = {
+        FX_BACKEND_AVX512, FX_BACKEND_AVX2, FX_BACKEND_NEON
+    };
+
+    for (size_t i = 0; i < sizeof(preference) / sizeof(preference[0]); i++) {
+        const fx_kernel_table_t* table = table_for(preference[i]);
+        if (table && cpu_supports(preference[i])) {
+            return table;
+        }
+    }
+    return &fx_kernels_scalar;
+}
+
+fx_backend_t fx_dispatch_init(void) {
+    const fx_kernel_table_t* active = __atomic_load_n(&fx_active_kernels, __ATOMIC_ACQUIRE);
+    if (active) {
+        return active->backend;
+    }
+
+    /* Publish only if still unset, so a concurrent pin is not overwritten */
+    const fx_kernel_table_t* expected = NULL;
+    const fx_kernel_table_t* selected = select_auto();
+    if (!__atomic_compare_exchange_n(&fx_active_kernels, &expected, selected, false,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return expected->backend;
+    }
+    return selected->backend;
+}
+
+fx_dispatch_res_t fx_dispatch_pin(fx_backend_t backend) {
+    if ((int)backend < (int)FX_BACKEND_AUTO || backend >= FX_BACKEND_COUNT) {
+        return FX_DISPATCH_INVALID_PARAM;
+    }
+
+    /* The new table is chosen first; readers never observe NULL */
+    const fx_kernel_table_t* table = (backend == FX_BACKEND_AUTO) ? select_auto()
+                                                                   : table_for(backend);
+    if (!table || (backend != FX_BACKEND_AUTO && !cpu_supports(backend))) {
+        return FX_DISPATCH_UNAVAILABLE;
+    }
+
+    __atomic_store_n(&fx_active_kernels, table, __ATOMIC_RELEASE);
+    return FX_DISPATCH_OK;
+}
+
+fx_backend_t fx_dispatch_active(void) {
+    const fx_kernel_table_t* active = __atomic_load_n(&fx_active_kernels, __ATOMIC_ACQUIRE);
+    return active ? active->backend : FX_BACKEND_AUTO;
+}
+
+const char* fx_backend_name(fx_backend_t backend) {
+    switch (backend) {
+    case FX_BACKEND_AUTO:
+        return "auto";
+    case FX_BACKEND_SCALAR:
+        return "scalar";
+    case FX_BACKEND_AVX2:
+        return "avx2";
+    case FX_BACKEND_AVX512:
+        return "avx512";
+    case FX_BACKEND_NEON:
+        return "neon";
+    default:
+        return "unknown";
+    }
+}
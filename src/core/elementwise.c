@@ -0,0 +1,195 @@
+/**
+ * @file elementwise.c
+ * @project Certifiable Inference Engine
+ * @brief Element-wise op engine and its scalar reference kernels.
+ *
+ * @details Ops are validated once, then each block of the buffer is
+ * copied to dst (unless in place) and every op of the chain is run over
+ * it by the matching kernel. A single-op chain runs over the whole buffer
+ * at once; longer chains use FX_EW_BLOCK-element blocks so the data stays
+ * in L1 between ops.
+ *
+ * @traceability SRS-015
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "elementwise.h"
+#include "kernels.h"
+#include "trace.h"
+#include <stdbool.h>
+#include <string.h>
+
+/* ------------------------------------------------------------------------ */
+/* Scalar reference kernels                                                 */
+/* ------------------------------------------------------------------------ */
+
+static inline fixed_t add_sat(fixed_t x, fixed_t k) {
+    const int64_t s = (int64_t)x + k;
+    return s > FIXED_MAX ? FIXED_MAX : s < FIXED_MIN ? FIXED_MIN : (fixed_t)s;
+}
+
+static inline fixed_t clamp(fixed_t x, fixed_t lo, fixed_t hi) {
+    return x < lo ? lo : x > hi ? hi : x;
+}
+
+void fx_scalar_scale(fixed_t* data, size_t n, fixed_t k) {
+    for (size_t i = 0; i < n; i++) {
+        data[i] = fixed_mul(data[i], k);
+    }
+}
+
+void fx_scalar_add_sat(fixed_t* data, size_t n, fixed_t k) {
+    for (size_t i = 0; i < n; i++) {
+        data[i] = add_sat(data[i], k);
+    }
+}
+
+void fx_scalar_clamp(fixed_t* data, size_t n, fixed_t lo, fixed_t hi) {
+    for (size_t i = 0; i < n; i++) {
+        data[i] = clamp(data[i], lo, hi);
+    }
+}
+
+/* ------------------------------------------------------------------------ */
+/* Engine                                                                   */
+/* ------------------------------------------------------------------------ */
+
+static bool ops_valid(const fx_ew_op_t* ops, size_t count) {
+    if (count > 0 && !ops) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const fx_ew_op_t* op = &ops[i];
+        switch (op->kind) {
+        case FX_EW_SCALE:
+        case FX_EW_ADD:
+            break;
+        case FX_EW_CLAMP:
+            if (op->a > op->b) {
+                return false;
+            }
+            break;
+        case FX_EW_ACTIVATION:
+            if ((unsigned)op->act > (unsigned)FX_ACT_GELU) {
+                return false;
+            }
+            break;
+        case FX_EW_CALL:
+            if (!op->fn) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief One element through one op (reference semantics).
+ */
+static inline fixed_t op_eval(const fx_ew_op_t* op, fixed_t x) {
+    switch (op->kind) {
+    case FX_EW_SCALE:
+        return fixed_mul(x, op->a);
+    case FX_EW_ADD:
+        return add_sat(x, op->a);
+    case FX_EW_CLAMP:
+        return clamp(x, op->a, op->b);
+    case FX_EW_ACTIVATION:
+        return fx_activate(x, op->act, op->a);
+    default:
+        return op->fn(x);
+    }
+}
+
+/**
+ * @brief One op over a block, as one kernel call or one tight loop.
+ */
+static void op_run(const fx_kernel_table_t* k, const fx_ew_op_t* op, fixed_t* d, size_t n) {
+    switch (op->kind) {
+    case FX_EW_SCALE:
+        k->scale(d, n, op->a);
+        break;
+    case FX_EW_ADD:
+        k->add_sat(d, n, op->a);
+        break;
+    case FX_EW_CLAMP:
+        k->clamp(d, n, op->a, op->b);
+        break;
+    case FX_EW_ACTIVATION:
+        if (op->act == FX_ACT_RELU) {
+            k->relu(d, n);
+        } else if (op->act == FX_ACT_LEAKY_RELU) {
+            k->leaky_relu(d, n, op->a);
+        } else if (op->act != FX_ACT_NONE) {
+            for (size_t i = 0; i < n; i++) {
+                d[i] = fx_activate(d[i], op->act, op->a);
+            }
+        }
+        break;
+    default:
+        /* SRS-015.4: user callback, one indirect call per element */
+        for (size_t i = 0; i < n; i++) {
+            d[i] = op->fn(d[i]);
+        }
+        break;
+    }
+}
+
+fx_ew_res_t fx_ew_apply(const fixed_t* src, fixed_t* dst, size_t n,
+                        const fx_ew_op_t* ops, size_t count) {
+    if ((n > 0 && (!src || !dst)) || !ops_valid(ops, count)) {
+        return FX_EW_INVALID_PARAM;
+    }
+
+    const fx_kernel_table_t* k = fx_kernels();
+    const size_t block = count > 1 ? FX_EW_BLOCK : n;
+
+    /* SRS-015.2: dispatch once per op and block, never per element */
+    FX_TRACE_BEGIN(FX_TRACE_ELEMENTWISE, n, count, 0);
+    for (size_t start = 0; start < n; start += block) {
+        const size_t len = (n - start < block) ? n - start : block;
+        fixed_t* d = dst + start;
+
+        if (src != dst) {
+            memcpy(d, src + start, len * sizeof(fixed_t));
+        }
+        for (size_t o = 0; o < count; o++) {
+            op_run(k, &ops[o], d, len);
+        }
+    }
+    FX_TRACE_END();
+    return FX_EW_OK;
+}
+
+fx_ew_res_t fx_ew_apply_ref(const fixed_t* src, fixed_t* dst, size_t n,
+                            const fx_ew_op_t* ops, size_t count) {
+    if ((n > 0 && (!src || !dst)) || !ops_valid(ops, count)) {
+        return FX_EW_INVALID_PARAM;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        fixed_t v = src[i];
+        for (size_t o = 0; o < count; o++) {
+            v = op_eval(&ops[o], v);
+        }
+        dst[i] = v;
+    }
+    return FX_EW_OK;
+}
+
+fx_ew_res_t fx_matrix_apply_ops(fx_matrix_t* mat, const fx_ew_op_t* ops, size_t count) {
+    if (!mat || !mat->data) {
+        return FX_EW_INVALID_PARAM;
+    }
+
+    return fx_ew_apply(mat->data, mat->data, (size_t)mat->rows * mat->cols, ops, count);
+}
@@ -0,0 +1,655 @@
+/**
+ * @file graph.c
+ * @project Certifiable Inference Engine
+ * @brief Model graph declaration, liveness-based arena planning and execution.
+ *
+ * @details Planning is done once, off the inference path:
+ * 1. Lifetimes: an intermediate is live from the op that writes it to the
+ *    last op that reads it (inclusive). Op scratch is live for its op only.
+ * 2. In-place merging: an activation whose input dies at that op reuses
+ *    the input's buffer, extending the owner's lifetime.
+ * 3. Packing: buffers sorted largest first (ties by creation order) are
+ *    placed at the lowest aligned offset clear of every placed buffer
+ *    whose lifetime intersects theirs.
+ *
+ * @traceability SRS-009-GRAPH
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "graph.h"
+#include "pooling.h"
+#include "trace.h"
+#include <string.h>
+
+/* Non-NULL data for shape-only views passed to size queries (never read) */
+static fixed_t g_shape_probe;
+
+/**
+ * @brief Arena buffer awaiting placement.
+ */
+typedef struct {
+    size_t len;                  /**< Aligned length */
+    uint16_t first, last;        /**< Inclusive op-index lifetime */
+    uint16_t order;              /**< Creation order, deterministic tie-break */
+    size_t* offset;              /**< Where to record the placement */
+} plan_buf_t;
+
+static size_t align_up(size_t v) {
+    return (v + (FX_GRAPH_ALIGN - 1)) / FX_GRAPH_ALIGN * FX_GRAPH_ALIGN;
+}
+
+static size_t tensor_len(const fx_graph_tensor_t* t) {
+    return (size_t)t->n * t->c * t->h * t->w;
+}
+
+static bool valid_id(const fx_graph_t* g, fx_tensor_id_t id) {
+    return id < g->tensor_count;
+}
+
+static fx_graph_res_t new_tensor(fx_graph_t* g, uint16_t n, uint16_t c, uint16_t h, uint16_t w,
+                                 fx_layout_t layout, fx_graph_tensor_kind_t kind,
+                                 fx_tensor_id_t* id) {
+    if (g->tensor_count >= FX_GRAPH_MAX_TENSORS) {
+        return FX_GRAPH_FULL;
+    }
+
+    fx_graph_tensor_t* t = &g->tensors[g->tensor_count];
+    memset(t, 0, sizeof(*t));
+    t->n = n;
+    t->c = c;
+    t->h = h;
+    t->w = w;
+    t->layout = layout;
+    t->kind = kind;
+    t->def = g->op_count;
+    t->root = g->tensor_count;
+
+    *id = g->tensor_count++;
+    g->planned = false;
+    return FX_GRAPH_OK;
+}
+
+/**
+ * @brief Reserve an op slot and its output tensor together.
+ */
+static fx_graph_res_t new_op(fx_graph_t* g, fx_graph_op_type_t type, fx_tensor_id_t in,
+                             uint16_t n, uint16_t c, uint16_t h, uint16_t w,
+                             fx_layout_t layout, fx_graph_op_t** op, fx_tensor_id_t* out) {
+    if (g->op_count >= FX_GRAPH_MAX_OPS) {
+        return FX_GRAPH_FULL;
+    }
+
+    fx_graph_res_t res = new_tensor(g, n, c, h, w, layout, FX_GRAPH_TENSOR_INTERMEDIATE, out);
+    if (res != FX_GRAPH_OK) {
+        return res;
+    }
+
+    fx_graph_op_t* o = &g->ops[g->op_count++];
+    memset(o, 0, sizeof(*o));
+    o->type = type;
+    o->in = in;
+    o->out = *out;
+    *op = o;
+    return FX_GRAPH_OK;
+}
+
+/**
+ * @brief Shape-only fx_tensor_t for a graph tensor.
+ */
+static fx_tensor_t shape_view(const fx_graph_tensor_t* t) {
+    fx_tensor_t v;
+    fx_tensor_attach(&v, &g_shape_probe, t->n, t->c, t->h, t->w, t->layout);
+    return v;
+}
+
+fx_graph_res_t fx_graph_init(fx_graph_t* g) {
+    if (!g) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+    memset(g, 0, sizeof(*g));
+    return FX_GRAPH_OK;
+}
+
+fx_graph_res_t fx_graph_input(fx_graph_t* g, uint16_t n, uint16_t c, uint16_t h, uint16_t w,
+                              fx_layout_t layout, fx_tensor_id_t* id) {
+    if (!g || !id || n == 0 || c == 0 || h == 0 || w == 0 ||
+        (layout != FX_LAYOUT_NCHW && layout != FX_LAYOUT_NHWC)) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+    return new_tensor(g, n, c, h, w, layout, FX_GRAPH_TENSOR_INPUT, id);
+}
+
+fx_graph_res_t fx_graph_input_staged(fx_graph_t* g, const fx_input_desc_t* desc,
+                                     fx_layout_t layout, fx_tensor_id_t* id) {
+    if (!g || !id || fx_input_desc_check(desc) != FX_INPUT_OK ||
+        (layout != FX_LAYOUT_NCHW && layout != FX_LAYOUT_NHWC)) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+
+    fx_graph_op_t* op;
+    fx_graph_res_t res = new_op(g, FX_GRAPH_OP_INPUT_CONVERT, 0, 1, desc->channels,
+                                desc->height, desc->width, layout, &op, id);
+    if (res != FX_GRAPH_OK) {
+        return res;
+    }
+
+    /* No tensor input: reading its own output keeps lifetimes correct */
+    op->in = *id;
+    op->input = desc;
+    return FX_GRAPH_OK;
+}
+
+fx_graph_res_t fx_graph_conv2d(fx_graph_t* g, fx_tensor_id_t in, const fx_tensor_t* weights,
+                               const fixed_t* bias, const fx_conv_params_t* params,
+                               const fx_conv_epilogue_t* epi, fx_tensor_id_t* out) {
+    static const fx_conv_epilogue_t none = { FX_ACT_NONE, FIXED_ZERO, false };
+
+    if (!g || !weights || !weights->data || !params || !out || !valid_id(g, in)) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+    if (params->stride_h == 0 || params->stride_w == 0 ||
+        params->dilation_h == 0 || params->dilation_w == 0) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+    if (!epi) {
+        epi = &none;
+    }
+
+    const fx_graph_tensor_t* src = &g->tensors[in];
+    if (weights->c != src->c) {
+        return FX_GRAPH_DIM_MISMATCH;
+    }
+
+    uint16_t oh = fx_conv2d_out_dim(src->h, weights->h, params->stride_h,
+                                    params->pad_h, params->dilation_h);
+    uint16_t ow = fx_conv2d_out_dim(src->w, weights->w, params->stride_w,
+                                    params->pad_w, params->dilation_w);
+    if (oh == 0 || ow == 0) {
+        return FX_GRAPH_DIM_MISMATCH;
+    }
+    const uint16_t ch = oh, cw = ow;
+    if (epi->maxpool_2x2) {
+        if ((oh % 2) != 0 || (ow % 2) != 0) {
+            return FX_GRAPH_DIM_MISMATCH;
+        }
+        oh /= 2;
+        ow /= 2;
+    }
+
+    fx_graph_op_t* op;
+    fx_graph_res_t res = new_op(g, FX_GRAPH_OP_CONV2D, in, src->n, weights->n, oh, ow,
+                                src->layout, &op, out);
+    if (res != FX_GRAPH_OK) {
+        return res;
+    }
+
+    op->conv_w = *weights;
+    op->conv = *params;
+    op->epi = *epi;
+    op->bias = bias;
+
+    /* SRS-009.2: im2col workspace is planned as arena scratch */
+    if (params->algo == FX_CONV_ALGO_IM2COL && !epi->maxpool_2x2) {
+        const fx_tensor_t vin = shape_view(&g->tensors[in]);
+        fx_tensor_t vout = shape_view(&g->tensors[*out]);
+        vout.h = ch;
+        vout.w = cw;
+        op->scratch_len = fx_conv2d_workspace_size(&vin, weights, params, &vout);
+    } else {
+        op->conv.algo = FX_CONV_ALGO_DIRECT;
+    }
+    return FX_GRAPH_OK;
+}
+
+fx_graph_res_t fx_graph_dense(fx_graph_t* g, fx_tensor_id_t in, const fx_matrix_t* weights,
+                              const fx_matrix_t* bias, fx_activation_t act, fixed_t alpha,
+                              fx_tensor_id_t* out) {
+    if (!g || !weights || !weights->data || !out || !valid_id(g, in)) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+
+    const fx_graph_tensor_t* src = &g->tensors[in];
+    const size_t k = (size_t)src->c * src->h * src->w;
+    if (k != weights->rows) {
+        return FX_GRAPH_DIM_MISMATCH;
+    }
+    if (bias && (!bias->data || bias->rows != 1 || bias->cols != weights->cols)) {
+        return FX_GRAPH_DIM_MISMATCH;
+    }
+
+    fx_graph_op_t* op;
+    fx_graph_res_t res = new_op(g, FX_GRAPH_OP_DENSE, in, src->n, weights->cols, 1, 1,
+                                FX_LAYOUT_NCHW, &op, out);
+    if (res != FX_GRAPH_OK) {
+        return res;
+    }
+
+    op->dense_w = *weights;
+    if (bias) {
+        op->dense_b = *bias;
+        op->bias = bias->data;
+    }
+    op->act = act;
+    op->alpha = alpha;
+    return FX_GRAPH_OK;
+}
+
+fx_graph_res_t fx_graph_maxpool_2x2(fx_graph_t* g, fx_tensor_id_t in, fx_tensor_id_t* out) {
+    if (!g || !out || !valid_id(g, in)) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+
+    const fx_graph_tensor_t* src = &g->tensors[in];
+    if (src->layout != FX_LAYOUT_NCHW) {
+        return FX_GRAPH_UNSUPPORTED;
+    }
+    if ((src->h % 2) != 0 || (src->w % 2) != 0) {
+        return FX_GRAPH_DIM_MISMATCH;
+    }
+
+    fx_graph_op_t* op;
+    return new_op(g, FX_GRAPH_OP_MAXPOOL_2X2, in, src->n, src->c, src->h / 2, src->w / 2,
+                  src->layout, &op, out);
+}
+
+fx_graph_res_t fx_graph_pool2d(fx_graph_t* g, fx_tensor_id_t in, const fx_pool2d_params_t* params,
+                               fx_tensor_id_t* out) {
+    if (!g || !params || !out || !valid_id(g, in)) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+    if ((params->mode != FX_POOL2D_MAX && params->mode != FX_POOL2D_AVG) ||
+        params->stride_h == 0 || params->stride_w == 0 ||
+        params->pad_h >= params->kernel_h || params->pad_w >= params->kernel_w) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+
+    const fx_graph_tensor_t* src = &g->tensors[in];
+    const uint16_t oh = fx_pool2d_out_dim(src->h, params->kernel_h, params->stride_h,
+                                          params->pad_h);
+    const uint16_t ow = fx_pool2d_out_dim(src->w, params->kernel_w, params->stride_w,
+                                          params->pad_w);
+    if (oh == 0 || ow == 0) {
+        return FX_GRAPH_DIM_MISMATCH;
+    }
+
+    fx_graph_op_t* op;
+    fx_graph_res_t res = new_op(g, FX_GRAPH_OP_POOL2D, in, src->n, src->c, oh, ow,
+                                src->layout, &op, out);
+    if (res != FX_GRAPH_OK) {
+        return res;
+    }
+
+    op->pool = *params;
+
+    /* SRS-009.2: the max-pool row pass is planned as arena scratch */
+    const fx_tensor_t vin = shape_view(&g->tensors[in]);
+    const fx_tensor_t vout = shape_view(&g->tensors[*out]);
+    op->scratch_len = fx_pool2d_workspace_size(&vin, params, &vout);
+    return FX_GRAPH_OK;
+}
+
+fx_graph_res_t fx_graph_global_avgpool(fx_graph_t* g, fx_tensor_id_t in, fx_tensor_id_t* out) {
+    if (!g || !out || !valid_id(g, in)) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+
+    const fx_graph_tensor_t* src = &g->tensors[in];
+    fx_graph_op_t* op;
+    return new_op(g, FX_GRAPH_OP_GLOBAL_AVGPOOL, in, src->n, src->c, 1, 1,
+                  FX_LAYOUT_NCHW, &op, out);
+}
+
+fx_graph_res_t fx_graph_activation(fx_graph_t* g, fx_tensor_id_t in, fx_activation_t act,
+                                   fixed_t alpha, fx_tensor_id_t* out) {
+    if (!g || !out || !valid_id(g, in)) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+
+    const fx_graph_tensor_t* src = &g->tensors[in];
+    fx_graph_op_t* op;
+    fx_graph_res_t res = new_op(g, FX_GRAPH_OP_ACTIVATION, in, src->n, src->c, src->h, src->w,
+                                src->layout, &op, out);
+    if (res != FX_GRAPH_OK) {
+        return res;
+    }
+
+    op->act = act;
+    op->alpha = alpha;
+    return FX_GRAPH_OK;
+}
+
+fx_graph_res_t fx_graph_output(fx_graph_t* g, fx_tensor_id_t id) {
+    if (!g || !valid_id(g, id) || g->tensors[id].kind == FX_GRAPH_TENSOR_INPUT) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+    g->tensors[id].kind = FX_GRAPH_TENSOR_OUTPUT;
+    g->planned = false;
+    return FX_GRAPH_OK;
+}
+
+/**
+ * @brief Strict weak order: larger first, then earlier created.
+ */
+static bool plan_before(const plan_buf_t* a, const plan_buf_t* b) {
+    if (a->len != b->len) {
+        return a->len > b->len;
+    }
+    return a->order < b->order;
+}
+
+static bool lifetimes_overlap(const plan_buf_t* a, const plan_buf_t* b) {
+    return a->first <= b->last && b->first <= a->last;
+}
+
+fx_graph_res_t fx_graph_plan(fx_graph_t* g, fx_graph_stats_t* stats) {
+    if (!g) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+
+    plan_buf_t bufs[FX_GRAPH_MAX_TENSORS + FX_GRAPH_MAX_OPS];
+    size_t placed[FX_GRAPH_MAX_TENSORS + FX_GRAPH_MAX_OPS];
+    uint16_t count = 0;
+    fx_graph_stats_t st = { 0, 0, 0, 0 };
+
+    /* SRS-009.2: Lifetimes from declaration order (ops are topological) */
+    for (uint16_t t = 0; t < g->tensor_count; t++) {
+        g->tensors[t].last = g->tensors[t].def;
+        g->tensors[t].root = t;
+        g->tensors[t].offset = 0;
+    }
+    for (uint16_t i = 0; i < g->op_count; i++) {
+        g->tensors[g->ops[i].in].last = i;
+    }
+
+    /* SRS-009.3: Activations on a dying intermediate run in place */
+    for (uint16_t i = 0; i < g->op_count; i++) {
+        const fx_graph_op_t* op = &g->ops[i];
+        fx_graph_tensor_t* src = &g->tensors[op->in];
+        fx_graph_tensor_t* dst = &g->tensors[op->out];
+
+        if (op->type == FX_GRAPH_OP_ACTIVATION &&
+            src->kind == FX_GRAPH_TENSOR_INTERMEDIATE &&
+            dst->kind == FX_GRAPH_TENSOR_INTERMEDIATE && src->last == i) {
+            fx_graph_tensor_t* owner = &g->tensors[src->root];
+            dst->root = src->root;
+            if (dst->last > owner->last) {
+                owner->last = dst->last;
+            }
+        }
+    }
+
+    /* Collect arena buffers: intermediate owners, then op scratch */
+    for (uint16_t t = 0; t < g->tensor_count; t++) {
+        fx_graph_tensor_t* ten = &g->tensors[t];
+        if (ten->kind != FX_GRAPH_TENSOR_INTERMEDIATE) {
+            continue;
+        }
+        st.unshared_len += align_up(tensor_len(ten));
+        if (ten->root != t) {
+            continue;
+        }
+        bufs[count].len = align_up(tensor_len(ten));
+        bufs[count].first = ten->def;
+        bufs[count].last = ten->last;
+        bufs[count].order = count;
+        bufs[count].offset = &ten->offset;
+        count++;
+    }
+    for (uint16_t i = 0; i < g->op_count; i++) {
+        fx_graph_op_t* op = &g->ops[i];
+        op->scratch_offset = 0;
+        if (op->scratch_len == 0) {
+            continue;
+        }
+        st.unshared_len += align_up(op->scratch_len);
+        bufs[count].len = align_up(op->scratch_len);
+        bufs[count].first = i;
+        bufs[count].last = i;
+        bufs[count].order = count;
+        bufs[count].offset = &op->scratch_offset;
+        count++;
+    }
+
+    /* SRS-009.4: Deterministic order - insertion sort, largest first */
+    for (uint16_t i = 1; i < count; i++) {
+        const plan_buf_t key = bufs[i];
+        uint16_t j = i;
+        while (j > 0 && plan_before(&key, &bufs[j - 1])) {
+            bufs[j] = bufs[j - 1];
+            j--;
+        }
+        bufs[j] = key;
+    }
+
+    /* Lowest offset clear of every lifetime-overlapping placed buffer.
+     * Candidates are 0 and the end of each conflicting buffer. */
+    for (uint16_t i = 0; i < count; i++) {
+        size_t best = SIZE_MAX;
+
+        for (uint16_t c = 0; c <= i; c++) {
+            size_t cand;
+            if (c == i) {
+                cand = 0;
+            } else if (lifetimes_overlap(&bufs[i], &bufs[c])) {
+                cand = placed[c] + bufs[c].len;
+            } else {
+                continue;
+            }
+            if (cand >= best) {
+                continue;
+            }
+
+            bool clear = true;
+            for (uint16_t p = 0; p < i && clear; p++) {
+                if (lifetimes_overlap(&bufs[i], &bufs[p]) &&
+                    cand < placed[p] + bufs[p].len && placed[p] < cand + bufs[i].len) {
+                    clear = false;
+                }
+            }
+            if (clear) {
+                best = cand;
+            }
+        }
+
+        placed[i] = best;
+        *bufs[i].offset = best;
+        if (best + bufs[i].len > st.arena_len) {
+            st.arena_len = best + bufs[i].len;
+        }
+        if (bufs[i].len > st.largest_len) {
+            st.largest_len = bufs[i].len;
+        }
+    }
+    st.buffers = count;
+
+    /* Merged tensors share their owner's placement */
+    for (uint16_t t = 0; t < g->tensor_count; t++) {
+        fx_graph_tensor_t* ten = &g->tensors[t];
+        if (ten->kind == FX_GRAPH_TENSOR_INTERMEDIATE && ten->root != t) {
+            ten->offset = g->tensors[ten->root].offset;
+        }
+    }
+
+    g->arena_len = st.arena_len;
+    g->planned = true;
+    if (stats) {
+        *stats = st;
+    }
+    return FX_GRAPH_OK;
+}
+
+fx_graph_res_t fx_graph_bind(fx_graph_t* g, fx_tensor_id_t id, fixed_t* data) {
+    if (!g || !data || !valid_id(g, id) ||
+        g->tensors[id].kind == FX_GRAPH_TENSOR_INTERMEDIATE) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+    g->tensors[id].data = data;
+    return FX_GRAPH_OK;
+}
+
+fx_graph_res_t fx_graph_bind_frame(fx_graph_t* g, fx_tensor_id_t id, const void* frame) {
+    if (!g || !valid_id(g, id) || g->tensors[id].def >= g->op_count) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+
+    fx_graph_op_t* op = &g->ops[g->tensors[id].def];
+    if (op->type != FX_GRAPH_OP_INPUT_CONVERT || op->out != id ||
+        fx_input_check(op->input, frame) != FX_INPUT_OK) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+    op->frame = frame;
+    return FX_GRAPH_OK;
+}
+
+fx_graph_res_t fx_graph_tensor(const fx_graph_t* g, fx_tensor_id_t id, fixed_t* arena,
+                               fx_tensor_t* view) {
+    if (!g || !view || !valid_id(g, id)) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+    if (!g->planned) {
+        return FX_GRAPH_NOT_PLANNED;
+    }
+
+    const fx_graph_tensor_t* t = &g->tensors[id];
+    fixed_t* data;
+    if (t->kind == FX_GRAPH_TENSOR_INTERMEDIATE) {
+        if (!arena) {
+            return FX_GRAPH_INVALID_PARAM;
+        }
+        data = arena + t->offset;
+    } else {
+        data = t->data;
+    }
+    if (!data) {
+        return FX_GRAPH_UNBOUND;
+    }
+
+    fx_tensor_attach(view, data, t->n, t->c, t->h, t->w, t->layout);
+    return FX_GRAPH_OK;
+}
+
+static void activate_buffer(const fixed_t* src, fixed_t* dst, size_t len,
+                            fx_activation_t act, fixed_t alpha) {
+    for (size_t i = 0; i < len; i++) {
+        dst[i] = fx_activate(src[i], act, alpha);
+    }
+}
+
+/**
+ * @brief Execute one op on resolved tensor views.
+ */
+static fx_graph_res_t run_op(const fx_graph_op_t* op, const fx_tensor_t* in,
+                             fx_tensor_t* out, fixed_t* scratch) {
+    switch (op->type) {
+    case FX_GRAPH_OP_CONV2D: {
+        fx_conv_res_t res;
+        if (op->conv.algo == FX_CONV_ALGO_IM2COL) {
+            res = fx_conv2d_layer(in, &op->conv_w, op->bias, &op->conv,
+                                  scratch, op->scratch_len, out);
+            if (res == FX_CONV_OK && op->epi.act != FX_ACT_NONE) {
+                activate_buffer(out->data, out->data, fx_tensor_size(out),
+                                op->epi.act, op->epi.alpha);
+            }
+        } else {
+            res = fx_conv2d_fused(in, &op->conv_w, op->bias, &op->conv, &op->epi, out);
+        }
+        return res == FX_CONV_OK ? FX_GRAPH_OK : FX_GRAPH_DIM_MISMATCH;
+    }
+
+    case FX_GRAPH_OP_DENSE: {
+        fx_matrix_t a, c;
+        fx_matrix_attach(&a, in->data, in->n, op->dense_w.rows);
+        fx_matrix_attach(&c, out->data, out->n, op->dense_w.cols);
+        fx_matrix_mul_fused(&a, &op->dense_w, op->bias ? &op->dense_b : NULL,
+                            op->act, op->alpha, &c);
+        return FX_GRAPH_OK;
+    }
+
+    case FX_GRAPH_OP_MAXPOOL_2X2: {
+        const size_t plane_in = (size_t)in->h * in->w;
+        const size_t plane_out = (size_t)out->h * out->w;
+        for (size_t p = 0; p < (size_t)in->n * in->c; p++) {
+            fx_matrix_t a, c;
+            fx_matrix_attach(&a, in->data + p * plane_in, in->h, in->w);
+            fx_matrix_attach(&c, out->data + p * plane_out, out->h, out->w);
+            fx_maxpool_2x2(&a, &c);
+        }
+        return FX_GRAPH_OK;
+    }
+
+    case FX_GRAPH_OP_ACTIVATION:
+        activate_buffer(in->data, out->data, fx_tensor_size(out), op->act, op->alpha);
+        return FX_GRAPH_OK;
+
+    case FX_GRAPH_OP_POOL2D:
+        return fx_pool2d(in, &op->pool, scratch, op->scratch_len, out) == FX_POOL2D_OK
+               ? FX_GRAPH_OK : FX_GRAPH_DIM_MISMATCH;
+
+    case FX_GRAPH_OP_GLOBAL_AVGPOOL: {
+        fx_matrix_t c;
+        fx_matrix_attach(&c, out->data, out->n, out->c);
+        return fx_global_avgpool(in, &c) == FX_POOL2D_OK ? FX_GRAPH_OK : FX_GRAPH_DIM_MISMATCH;
+    }
+
+    case FX_GRAPH_OP_INPUT_CONVERT:
+        /* SRS-018.6: the frame is read once, converted into the arena */
+        return fx_input_convert(op->input, op->frame, out) == FX_INPUT_OK
+               ? FX_GRAPH_OK : FX_GRAPH_DIM_MISMATCH;
+
+    default:
+        return FX_GRAPH_UNSUPPORTED;
+    }
+}
+
+fx_graph_res_t fx_graph_run(const fx_graph_t* g, fixed_t* arena, size_t arena_len) {
+    if (!g) {
+        return FX_GRAPH_INVALID_PARAM;
+    }
+    if (!g->planned) {
+        return FX_GRAPH_NOT_PLANNED;
+    }
+    if (g->arena_len > 0 && (!arena || arena_len < g->arena_len)) {
+        return FX_GRAPH_ARENA_TOO_SMALL;
+    }
+
+    /* Every boundary tensor must be bound before anything is written */
+    for (uint16_t t = 0; t < g->tensor_count; t++) {
+        if (g->tensors[t].kind != FX_GRAPH_TENSOR_INTERMEDIATE && !g->tensors[t].data) {
+            return FX_GRAPH_UNBOUND;
+        }
+    }
+    for (uint16_t i = 0; i < g->op_count; i++) {
+        if (g->ops[i].type == FX_GRAPH_OP_INPUT_CONVERT && !g->ops[i].frame) {
+            return FX_GRAPH_UNBOUND;
+        }
+    }
+
+    /* SRS-009.5: Declaration order is execution order */
+    for (uint16_t i = 0; i < g->op_count; i++) {
+        const fx_graph_op_t* op = &g->ops[i];
+        fx_tensor_t in, out;
+
+        fx_graph_res_t res = fx_graph_tensor(g, op->in, arena, &in);
+        if (res == FX_GRAPH_OK) {
+            res = fx_graph_tensor(g, op->out, arena, &out);
+        }
+        if (res == FX_GRAPH_OK) {
+            /* SRS-007.12: one span per op; the kernels inside carry its index */
+            FX_TRACE_SET_LAYER(i);
+            FX_TRACE_BEGIN(FX_TRACE_LAYER, out.c, out.h, out.w);
+            res = run_op(op, &in, &out, op->scratch_len ? arena + op->scratch_offset : NULL);
+            FX_TRACE_END();
+        }
+        if (res != FX_GRAPH_OK) {
+            FX_TRACE_SET_LAYER(FX_TRACE_NO_LAYER);
+            return res;
+        }
+    }
+    FX_TRACE_SET_LAYER(FX_TRACE_NO_LAYER);
+    return FX_GRAPH_OK;
+}
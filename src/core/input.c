@@ -0,0 +1,445 @@
+/**
+ * @file input.c
+ * @project Certifiable Inference Engine
+ * @brief Frame descriptors, buffer rotation, input conversion and its
+ *        scalar reference kernels.
+ *
+ * @details Conversion walks the frame row by row in chunks of at most
+ * FX_INPUT_BLOCK elements. The per-channel scale and bias are expanded
+ * once into per-element arrays: for interleaved frames the pattern has
+ * period channels, which divides FX_INPUT_BLOCK, so every chunk starts
+ * on channel 0; planar frames use a constant pattern per plane. Each
+ * chunk is then one kernel call (two for binary32 with normalisation),
+ * written straight to the tensor, or through a block buffer and a
+ * scatter when the tensor's layout differs from the frame's.
+ *
+ * The binary32 decode works on the bit pattern: with exponent field e
+ * and significand m (implicit bit included), the value in Q16.16 is
+ * m × 2^(e − 134). Exponents from 142 up (|v| ≥ 32768), and infinities,
+ * saturate; NaN becomes 0; right shifts round half away from zero.
+ *
+ * @traceability SRS-018
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "input.h"
+#include "kernels.h"
+#include "trace.h"
+#include <stdbool.h>
+#include <string.h>
+
+/* ------------------------------------------------------------------------ */
+/* Scalar reference kernels                                                 */
+/* ------------------------------------------------------------------------ */
+
+static inline fixed_t sat32(int64_t v) {
+    return v > FIXED_MAX ? FIXED_MAX : v < FIXED_MIN ? FIXED_MIN : (fixed_t)v;
+}
+
+static inline fixed_t u8_to_fixed(uint8_t x, fixed_t scale, fixed_t bias) {
+    return sat32((int64_t)x * scale + bias);
+}
+
+static inline fixed_t f32_to_fixed(uint32_t u) {
+    const uint32_t e = (u >> 23) & 0xFFu;
+    const uint32_t frac = u & 0x7FFFFFu;
+    const uint32_t m = frac | 0x800000u;
+    uint32_t mag;
+
+    if (e == 0xFFu && frac != 0u) {
+        return 0;                                    /* NaN */
+    }
+    if (e >= 142u) {
+        return (u >> 31) ? FIXED_MIN : FIXED_MAX;    /* |v| ≥ 2^15, ±inf */
+    }
+    if (e >= 134u) {
+        mag = m << (e - 134u);
+    } else {
+        /* m < 2^24: shifts of 25 or more round to 0 (zero, subnormals) */
+        const uint32_t r = 134u - e;
+        mag = r <= 24u ? (m + (1u << (r - 1u))) >> r : 0u;
+    }
+    return (u >> 31) ? -(fixed_t)mag : (fixed_t)mag;
+}
+
+static inline fixed_t affine(fixed_t x, fixed_t scale, fixed_t bias) {
+    return sat32(((int64_t)x * scale + FIXED_HALF + (int64_t)bias * FIXED_ONE) >> FIXED_SHIFT);
+}
+
+void fx_scalar_convert_u8(const uint8_t* src, size_t n, const fixed_t* scale,
+                          const fixed_t* bias, fixed_t* dst) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = u8_to_fixed(src[i], scale[i], bias[i]);
+    }
+}
+
+void fx_scalar_convert_f32(const uint32_t* src, size_t n, fixed_t* dst) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = f32_to_fixed(src[i]);
+    }
+}
+
+void fx_scalar_affine(fixed_t* data, size_t n, const fixed_t* scale, const fixed_t* bias) {
+    for (size_t i = 0; i < n; i++) {
+        data[i] = affine(data[i], scale[i], bias[i]);
+    }
+}
+
+/* ------------------------------------------------------------------------ */
+/* Descriptors                                                              */
+/* ------------------------------------------------------------------------ */
+
+static size_t elem_size(fx_input_format_t format) {
+    return format == FX_INPUT_U8 ? sizeof(uint8_t) : sizeof(fixed_t);
+}
+
+static size_t row_bytes(const fx_input_desc_t* d) {
+    const size_t elems = d->layout == FX_LAYOUT_NHWC ? (size_t)d->width * d->channels
+                                                     : (size_t)d->width;
+    return elems * elem_size(d->format);
+}
+
+static bool norm_identity(const fx_input_desc_t* d) {
+    for (uint16_t c = 0; c < d->channels; c++) {
+        if (d->scale[c] != FIXED_ONE || d->bias[c] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+fx_input_res_t fx_input_desc_init(fx_input_desc_t* desc, fx_input_format_t format,
+                                  fx_layout_t layout, uint16_t channels,
+                                  uint16_t height, uint16_t width, size_t row_stride) {
+    if (!desc) {
+        return FX_INPUT_INVALID_PARAM;
+    }
+
+    memset(desc, 0, sizeof(*desc));
+    desc->format = format;
+    desc->layout = layout;
+    desc->channels = channels;
+    desc->height = height;
+    desc->width = width;
+    desc->row_stride = row_stride ? row_stride : row_bytes(desc);
+    desc->plane_stride = desc->row_stride * height;
+    for (size_t c = 0; c < FX_INPUT_MAX_CHANNELS; c++) {
+        desc->scale[c] = FIXED_ONE;
+    }
+    return fx_input_desc_check(desc);
+}
+
+fx_input_res_t fx_input_desc_check(const fx_input_desc_t* desc) {
+    if (!desc || (unsigned)desc->format > (unsigned)FX_INPUT_F32 ||
+        (desc->layout != FX_LAYOUT_NCHW && desc->layout != FX_LAYOUT_NHWC) ||
+        desc->channels == 0 || desc->channels > FX_INPUT_MAX_CHANNELS ||
+        desc->height == 0 || desc->width == 0) {
+        return FX_INPUT_INVALID_PARAM;
+    }
+
+    /* SRS-018.1: strides in whole elements, rows and planes disjoint */
+    const size_t es = elem_size(desc->format);
+    const size_t row = row_bytes(desc);
+    if (desc->row_stride % es != 0 || desc->row_stride < row) {
+        return FX_INPUT_INVALID_PARAM;
+    }
+    if (desc->layout == FX_LAYOUT_NCHW &&
+        (desc->plane_stride % es != 0 ||
+         desc->plane_stride < (desc->height - 1u) * desc->row_stride + row)) {
+        return FX_INPUT_INVALID_PARAM;
+    }
+
+    /* 255 × scale must be exact in the 32-bit vector multiply */
+    if (desc->format == FX_INPUT_U8) {
+        for (uint16_t c = 0; c < desc->channels; c++) {
+            if (desc->scale[c] > FX_INPUT_U8_SCALE_MAX || desc->scale[c] < -FX_INPUT_U8_SCALE_MAX) {
+                return FX_INPUT_INVALID_PARAM;
+            }
+        }
+    }
+    return FX_INPUT_OK;
+}
+
+fx_input_res_t fx_input_check(const fx_input_desc_t* desc, const void* frame) {
+    const fx_input_res_t res = fx_input_desc_check(desc);
+    if (res != FX_INPUT_OK) {
+        return res;
+    }
+    if (!frame) {
+        return FX_INPUT_INVALID_PARAM;
+    }
+    if ((uintptr_t)frame % FX_INPUT_ALIGN != 0) {
+        return FX_INPUT_MISALIGNED;
+    }
+    return FX_INPUT_OK;
+}
+
+size_t fx_input_frame_bytes(const fx_input_desc_t* desc) {
+    if (fx_input_desc_check(desc) != FX_INPUT_OK) {
+        return 0;
+    }
+
+    size_t span = (desc->height - 1u) * desc->row_stride + row_bytes(desc);
+    if (desc->layout == FX_LAYOUT_NCHW) {
+        span += (desc->channels - 1u) * desc->plane_stride;
+    }
+    return span;
+}
+
+fx_input_res_t fx_input_view(const fx_input_desc_t* desc, void* frame, fx_tensor_t* view) {
+    const fx_input_res_t res = fx_input_check(desc, frame);
+    if (res != FX_INPUT_OK) {
+        return res;
+    }
+    if (!view) {
+        return FX_INPUT_INVALID_PARAM;
+    }
+
+    /* SRS-018.2: only a dense Q16.16 frame already is a tensor */
+    const bool dense = desc->row_stride == row_bytes(desc) &&
+                       (desc->layout == FX_LAYOUT_NHWC || desc->channels == 1u ||
+                        desc->plane_stride == desc->row_stride * desc->height);
+    if (desc->format != FX_INPUT_Q16 || !dense || !norm_identity(desc)) {
+        return FX_INPUT_UNSUPPORTED;
+    }
+
+    fx_tensor_attach(view, (fixed_t*)frame, 1, desc->channels, desc->height, desc->width,
+                     desc->layout);
+    return FX_INPUT_OK;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Conversion                                                               */
+/* ------------------------------------------------------------------------ */
+
+static fx_input_res_t convert_check(const fx_input_desc_t* desc, const void* frame,
+                                    const fx_tensor_t* dst) {
+    const fx_input_res_t res = fx_input_check(desc, frame);
+    if (res != FX_INPUT_OK) {
+        return res;
+    }
+    if (!dst || !dst->data ||
+        (dst->layout != FX_LAYOUT_NCHW && dst->layout != FX_LAYOUT_NHWC)) {
+        return FX_INPUT_INVALID_PARAM;
+    }
+    if (dst->n != 1u || dst->c != desc->channels || dst->h != desc->height ||
+        dst->w != desc->width) {
+        return FX_INPUT_DIM_MISMATCH;
+    }
+    return FX_INPUT_OK;
+}
+
+/**
+ * @brief n consecutive frame elements to Q16.16, one kernel pass each.
+ */
+static void convert_run(const fx_kernel_table_t* k, const fx_input_desc_t* desc,
+                        const unsigned char* src, size_t n, const fixed_t* scale,
+                        const fixed_t* bias, bool identity, fixed_t* out) {
+    switch (desc->format) {
+    case FX_INPUT_U8:
+        /* Widen, scale, bias and saturate in one pass */
+        k->convert_u8(src, n, scale, bias, out);
+        return;
+    case FX_INPUT_F32:
+        k->convert_f32((const uint32_t*)(const void*)src, n, out);
+        break;
+    default:
+        memcpy(out, src, n * sizeof(fixed_t));
+        break;
+    }
+    /* Second pass while the block is still in L1 */
+    if (!identity) {
+        k->affine(out, n, scale, bias);
+    }
+}
+
+fx_input_res_t fx_input_convert(const fx_input_desc_t* desc, const void* frame,
+                                fx_tensor_t* dst) {
+    const fx_input_res_t res = convert_check(desc, frame, dst);
+    if (res != FX_INPUT_OK) {
+        return res;
+    }
+
+    const fx_kernel_table_t* k = fx_kernels();
+    const unsigned char* base = (const unsigned char*)frame;
+    const size_t es = elem_size(desc->format);
+    const size_t C = desc->channels, H = desc->height, W = desc->width;
+    const bool identity = norm_identity(desc);
+    fixed_t scale[FX_INPUT_BLOCK];
+    fixed_t bias[FX_INPUT_BLOCK];
+    fixed_t block[FX_INPUT_BLOCK];
+
+    FX_TRACE_BEGIN(FX_TRACE_INPUT_CONVERT, C, H, W);
+    if (desc->layout == FX_LAYOUT_NHWC) {
+        const size_t row = W * C;
+        for (size_t i = 0; i < FX_INPUT_BLOCK; i++) {
+            scale[i] = desc->scale[i % C];
+            bias[i] = desc->bias[i % C];
+        }
+        for (size_t y = 0; y < H; y++) {
+            const unsigned char* src = base + y * desc->row_stride;
+            for (size_t x0 = 0; x0 < row; x0 += FX_INPUT_BLOCK) {
+                const size_t len = (row - x0 < FX_INPUT_BLOCK) ? row - x0 : FX_INPUT_BLOCK;
+                if (dst->layout == FX_LAYOUT_NHWC) {
+                    convert_run(k, desc, src + x0 * es, len, scale, bias, identity,
+                                dst->data + y * row + x0);
+                    continue;
+                }
+                convert_run(k, desc, src + x0 * es, len, scale, bias, identity, block);
+                for (size_t j = 0; j < len; j++) {
+                    const size_t e = x0 + j;
+                    dst->data[fx_tensor_offset(dst, 0, e % C, y, e / C)] = block[j];
+                }
+            }
+        }
+    } else {
+        for (size_t c = 0; c < C; c++) {
+            const size_t fill = W < FX_INPUT_BLOCK ? W : FX_INPUT_BLOCK;
+            for (size_t i = 0; i < fill; i++) {
+                scale[i] = desc->scale[c];
+                bias[i] = desc->bias[c];
+            }
+            for (size_t y = 0; y < H; y++) {
+                const unsigned char* src = base + c * desc->plane_stride + y * desc->row_stride;
+                for (size_t x0 = 0; x0 < W; x0 += FX_INPUT_BLOCK) {
+                    const size_t len = (W - x0 < FX_INPUT_BLOCK) ? W - x0 : FX_INPUT_BLOCK;
+                    if (dst->layout == FX_LAYOUT_NCHW) {
+                        convert_run(k, desc, src + x0 * es, len, scale, bias, identity,
+                                    dst->data + (c * H + y) * W + x0);
+                        continue;
+                    }
+                    convert_run(k, desc, src + x0 * es, len, scale, bias, identity, block);
+                    for (size_t j = 0; j < len; j++) {
+                        dst->data[fx_tensor_offset(dst, 0, c, y, x0 + j)] = block[j];
+                    }
+                }
+            }
+        }
+    }
+    FX_TRACE_END();
+    return FX_INPUT_OK;
+}
+
+/**
+ * @brief Element (c, y, x) of a frame in Q16.16 (reference semantics).
+ */
+static fixed_t frame_element(const fx_input_desc_t* desc, const unsigned char* base,
+                             size_t c, size_t y, size_t x) {
+    const size_t es = elem_size(desc->format);
+    const size_t off = desc->layout == FX_LAYOUT_NHWC
+                       ? y * desc->row_stride + (x * desc->channels + c) * es
+                       : c * desc->plane_stride + y * desc->row_stride + x * es;
+
+    switch (desc->format) {
+    case FX_INPUT_U8:
+        return u8_to_fixed(base[off], desc->scale[c], desc->bias[c]);
+    case FX_INPUT_F32: {
+        uint32_t u;
+        memcpy(&u, base + off, sizeof(u));
+        return affine(f32_to_fixed(u), desc->scale[c], desc->bias[c]);
+    }
+    default: {
+        fixed_t v;
+        memcpy(&v, base + off, sizeof(v));
+        return affine(v, desc->scale[c], desc->bias[c]);
+    }
+    }
+}
+
+fx_input_res_t fx_input_convert_ref(const fx_input_desc_t* desc, const void* frame,
+                                    fx_tensor_t* dst) {
+    const fx_input_res_t res = convert_check(desc, frame, dst);
+    if (res != FX_INPUT_OK) {
+        return res;
+    }
+
+    for (size_t c = 0; c < desc->channels; c++) {
+        for (size_t y = 0; y < desc->height; y++) {
+            for (size_t x = 0; x < desc->width; x++) {
+                dst->data[fx_tensor_offset(dst, 0, c, y, x)] =
+                    frame_element(desc, (const unsigned char*)frame, c, y, x);
+            }
+        }
+    }
+    return FX_INPUT_OK;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Buffer rotation (SRS-018.5)                                              */
+/* ------------------------------------------------------------------------ */
+
+fx_input_res_t fx_input_ring_init(fx_input_ring_t* ring, const fx_input_desc_t* desc,
+                                  void* const* buffers, uint32_t count) {
+    if (!ring || !buffers || count == 0 || count > FX_INPUT_MAX_BUFFERS) {
+        return FX_INPUT_INVALID_PARAM;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        const fx_input_res_t res = fx_input_check(desc, buffers[i]);
+        if (res != FX_INPUT_OK) {
+            return res;
+        }
+    }
+
+    memset(ring->buffers, 0, sizeof(ring->buffers));
+    for (uint32_t i = 0; i < count; i++) {
+        ring->buffers[i] = buffers[i];
+    }
+    ring->count = count;
+    __atomic_store_n(&ring->head, 0u, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->tail, 0u, __ATOMIC_RELAXED);
+    return FX_INPUT_OK;
+}
+
+/*
+ * Counters run modulo 2 × count rather than 2^32, so head % count stays
+ * continuous when they wrap for any count (3 for triple buffering), and
+ * a full ring (fill = count) is distinct from an empty one.
+ */
+static uint32_t ring_fill(const fx_input_ring_t* ring, uint32_t head, uint32_t tail) {
+    return (head + 2u * ring->count - tail) % (2u * ring->count);
+}
+
+static uint32_t ring_next(const fx_input_ring_t* ring, uint32_t counter) {
+    return (counter + 1u) % (2u * ring->count);
+}
+
+void* fx_input_acquire(fx_input_ring_t* ring) {
+    const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    const uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+    if (ring_fill(ring, head, tail) >= ring->count) {
+        return NULL;
+    }
+    return ring->buffers[head % ring->count];
+}
+
+void fx_input_commit(fx_input_ring_t* ring) {
+    const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->head, ring_next(ring, head), __ATOMIC_RELEASE);
+}
+
+const void* fx_input_peek(fx_input_ring_t* ring) {
+    const uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    if (head == tail) {
+        return NULL;
+    }
+    return ring->buffers[tail % ring->count];
+}
+
+void fx_input_release(fx_input_ring_t* ring) {
+    const uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->tail, ring_next(ring, tail), __ATOMIC_RELEASE);
+}
+
+uint32_t fx_input_count(fx_input_ring_t* ring) {
+    const uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    return ring_fill(ring, head, tail);
+}
@@ -0,0 +1,206 @@
+/**
+ * @file kernels.h
+ * @project Certifiable Inference Engine
+ * @brief Internal interface between the public primitives and the kernel
+ *        backends.
+ *
+ * @details The public functions in matrix.c, convolution.c, activations.c,
+ * pooling.c, quantized.c, elementwise.c and input.c validate their arguments and
+ * then hand the raw buffers to the active kernel table. Every backend
+ * performs exactly the integer operations of the scalar reference
+ * (32×32→64 multiply, 64-bit accumulation, single round-to-nearest; exact
+ * int32 sums for the int8 kernels), only several lanes at a time, so
+ * results are bit-identical whichever table is active.
+ *
+ * Kernels receive pre-validated arguments and perform no checks.
+ *
+ * This header is private to the library and is not installed.
+ *
+ * @traceability SRS-003.10, SRS-003.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include "matrix.h"
+#include "epilogue.h"
+#include "dispatch.h"
+
+/*
+ * Blocking parameters for the cache-blocked GEMM (SRS-003.9).
+ *
+ * FX_GEMM_MR × FX_GEMM_NR is the register tile held in 64-bit accumulators
+ * by the micro-kernel. FX_GEMM_KC × FX_GEMM_NR is the packed panel of B
+ * (4 KiB, sized for L1). FX_GEMM_MC rows of A are streamed against each
+ * packed panel before it is replaced.
+ */
+#define FX_GEMM_MR 4
+#define FX_GEMM_NR 4
+#define FX_GEMM_MC 64
+#define FX_GEMM_KC 256
+
+/**
+ * @brief Output stage applied by fx_gemm() before each store (SRS-004.9).
+ *
+ * @details v = round(acc); v += row_bias[i]; v += col_bias[j];
+ * v = fx_activate(v). Either bias may be NULL.
+ */
+typedef struct {
+    const fixed_t* row_bias;     /**< Per output row (conv lowering: per filter) */
+    const fixed_t* col_bias;     /**< Per output column (dense layers) */
+    fx_activation_t act;         /**< Activation */
+    fixed_t alpha;               /**< Leaky ReLU slope */
+} fx_gemm_epilogue_t;
+
+/**
+ * @brief Blocked GEMM driver on raw strided buffers (SRS-003.9).
+ *
+ * @details C(M×N) = A(M×K) × B(K×N) with leading dimensions lda, ldb and
+ * ldc, one 64-bit accumulator and a single rounding per output, followed
+ * by the optional epilogue while the value is still in a register.
+ * fx_matrix_mul() validates and calls this; internal users (convolution
+ * lowering) call it directly to address sub-blocks and dimensions beyond
+ * the 16-bit range of fx_matrix_t. With a worker pool running, the output
+ * is split into static tiles of whole micro-kernel blocks (SRS-013.3).
+ *
+ * @param[in] epi Output stage, or NULL for plain rounding
+ */
+void fx_gemm(size_t M, size_t N, size_t K,
+             const fixed_t* a_data, size_t lda,
+             const fixed_t* b_data, size_t ldb,
+             fixed_t* c_data, size_t ldc,
+             const fx_gemm_epilogue_t* epi);
+
+/**
+ * @brief fx_gemm() with B already in panel layout (SRS-003.12).
+ *
+ * @details b_panels holds ⌈N/NR⌉ panels of K × NR values, as
+ * fx_matrix_pack() writes them; the per-call packing step is skipped and
+ * the micro-kernel reads the panels in place.
+ */
+void fx_gemm_packed(size_t M, size_t N, size_t K,
+                    const fixed_t* a_data, size_t lda,
+                    const fixed_t* b_panels,
+                    fixed_t* c_data, size_t ldc,
+                    const fx_gemm_epilogue_t* epi);
+
+/**
+ * @brief One complete set of kernels for a single instruction set.
+ */
+typedef struct {
+    fx_backend_t backend;
+
+    /** sum(a[i] * b[i]), rounded once */
+    fixed_t (*vector_dot)(const fixed_t* a, const fixed_t* b, size_t len);
+
+    /** acc[r][j] += Σk a[r*lda + k] × panel[k*NR + j] for a full MR×NR tile */
+    void (*gemm_4x4)(size_t kc, const fixed_t* a, size_t lda,
+                     const fixed_t* panel, int64_t acc[][FX_GEMM_NR]);
+
+    /** Valid-padding, stride-1 2D convolution (dimensions pre-validated) */
+    void (*conv2d)(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out);
+
+    /** In-place max(0, x) over n elements */
+    void (*relu)(fixed_t* data, size_t n);
+
+    /** In-place x < 0 ? fixed_mul(x, alpha) : x over n elements */
+    void (*leaky_relu)(fixed_t* data, size_t n, fixed_t alpha);
+
+    /** 2×2 / stride-2 max pooling (dimensions pre-validated) */
+    void (*maxpool_2x2)(const fx_matrix_t* in, fx_matrix_t* out);
+
+    /** Σ a[i] × b[i] in int32 (int8 layers; |a| ≤ 255, exact by FX_Q8_MAX_K) */
+    int32_t (*q8_dot)(const int16_t* a, const int8_t* b, size_t len);
+
+    /** acc[j] += Σk a[k] × b[k*ldb + j] in int32 for j < nb (int8 layers) */
+    void (*q8_gemm_row)(size_t kc, const int16_t* a, const int8_t* b, size_t ldb,
+                        size_t nb, int32_t* acc);
+
+    /** In-place fixed_mul(x, k) over n elements (SRS-015) */
+    void (*scale)(fixed_t* data, size_t n, fixed_t k);
+
+    /** In-place x + k saturated to [FIXED_MIN, FIXED_MAX] over n elements */
+    void (*add_sat)(fixed_t* data, size_t n, fixed_t k);
+
+    /** In-place min(max(x, lo), hi) over n elements, lo ≤ hi */
+    void (*clamp)(fixed_t* data, size_t n, fixed_t lo, fixed_t hi);
+
+    /** dst[i] = src[i] × scale[i] + bias[i] in int32, saturated (SRS-018;
+     *  |scale[i]| ≤ FX_INPUT_U8_SCALE_MAX, so the product is exact) */
+    void (*convert_u8)(const uint8_t* src, size_t n, const fixed_t* scale,
+                       const fixed_t* bias, fixed_t* dst);
+
+    /** dst[i] = IEEE-754 binary32 bits src[i] as Q16.16: rounded half away
+     *  from zero, saturated, NaN → 0 (integer decode, no FPU) */
+    void (*convert_f32)(const uint32_t* src, size_t n, fixed_t* dst);
+
+    /** In-place x × scale[i] + bias[i], rounded once and saturated */
+    void (*affine)(fixed_t* data, size_t n, const fixed_t* scale, const fixed_t* bias);
+} fx_kernel_table_t;
+
+/* Scalar reference kernels (matrix.c, convolution.c, activations.c, pooling.c) */
+fixed_t fx_scalar_vector_dot(const fixed_t* a, const fixed_t* b, size_t len);
+void fx_scalar_gemm_4x4(size_t kc, const fixed_t* a, size_t lda,
+                        const fixed_t* panel, int64_t acc[][FX_GEMM_NR]);
+void fx_scalar_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out);
+void fx_scalar_relu(fixed_t* data, size_t n);
+void fx_scalar_leaky_relu(fixed_t* data, size_t n, fixed_t alpha);
+void fx_scalar_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out);
+
+/* Scalar int8 kernels (quantized.c) */
+int32_t fx_scalar_q8_dot(const int16_t* a, const int8_t* b, size_t len);
+void fx_scalar_q8_gemm_row(size_t kc, const int16_t* a, const int8_t* b, size_t ldb,
+                           size_t nb, int32_t* acc);
+
+/* Scalar element-wise kernels (elementwise.c) */
+void fx_scalar_scale(fixed_t* data, size_t n, fixed_t k);
+void fx_scalar_add_sat(fixed_t* data, size_t n, fixed_t k);
+void fx_scalar_clamp(fixed_t* data, size_t n, fixed_t lo, fixed_t hi);
+
+/* Scalar input conversion kernels (input.c) */
+void fx_scalar_convert_u8(const uint8_t* src, size_t n, const fixed_t* scale,
+                          const fixed_t* bias, fixed_t* dst);
+void fx_scalar_convert_f32(const uint32_t* src, size_t n, fixed_t* dst);
+void fx_scalar_affine(fixed_t* data, size_t n, const fixed_t* scale, const fixed_t* bias);
+
+/* Per-ISA tables, present only when the backend is compiled in */
+extern const fx_kernel_table_t fx_kernels_scalar;
+#if defined(CI_HAVE_AVX2)
+extern const fx_kernel_table_t fx_kernels_avx2;
+#endif
+#if defined(CI_HAVE_AVX512)
+extern const fx_kernel_table_t fx_kernels_avx512;
+#endif
+#if defined(CI_HAVE_NEON)
+extern const fx_kernel_table_t fx_kernels_neon;
+#endif
+
+/**
+ * @brief Active kernel table (set by fx_dispatch_init() / fx_dispatch_pin()).
+ *
+ * @details Accessed atomically only; NULL until the first selection and
+ * never again after it.
+ */
+extern const fx_kernel_table_t* fx_active_kernels;
+
+/**
+ * @brief Return the active kernel table, selecting one on first use.
+ *
+ * @complexity O(1) after the first call
+ */
+static inline const fx_kernel_table_t* fx_kernels(void) {
+    const fx_kernel_table_t* active = __atomic_load_n(&fx_active_kernels, __ATOMIC_ACQUIRE);
+    if (!active) {
+        (void)fx_dispatch_init();
+        active = __atomic_load_n(&fx_active_kernels, __ATOMIC_ACQUIRE);
+    }
+    return active;
+}
+
+#endif /* KERNELS_H */
@@ -0,0 +1,81 @@
+/**
+ * @file lut.c
+ * @project Certifiable Inference Engine
+ * @brief Table interpolation for the transcendental activations.
+ *
+ * @details The tables in lut_tables.h are generated by tools/gen_lut.py;
+ * their resolution is read from the FX_LUT_*_FRAC_BITS macros, so a
+ * regenerated table of a different size needs no change here.
+ *
+ * @traceability SRS-004.10, SRS-004.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "lut.h"
+#include "lut_tables.h"
+
+/**
+ * @brief Linear interpolation of a table at magnitude a ≥ 0.
+ *
+ * @return y[segments] beyond the last breakpoint
+ */
+static inline int32_t lut_interp(const int32_t* y, unsigned frac_bits, uint32_t segments,
+                                 uint32_t a) {
+    const uint32_t i = a >> frac_bits;
+    if (i >= segments) {
+        return y[segments];
+    }
+
+    const uint32_t r = a & ((1u << frac_bits) - 1u);
+    const int64_t half = frac_bits > 0 ? ((int64_t)1 << (frac_bits - 1u)) : 0;
+    const int64_t dy = (int64_t)y[i + 1u] - y[i];
+    return (int32_t)(y[i] + ((dy * r + half) >> frac_bits));
+}
+
+/**
+ * @brief |x| without overflow (|INT32_MIN| = 2^31).
+ */
+static inline uint32_t magnitude(fixed_t x) {
+    return x < 0 ? 0u - (uint32_t)x : (uint32_t)x;
+}
+
+fixed_t fixed_sigmoid(fixed_t x) {
+    const int32_t s = lut_interp(fx_lut_sigmoid_y, FX_LUT_SIGMOID_FRAC_BITS,
+                                 FX_LUT_SIGMOID_SEGMENTS, magnitude(x));
+    return x < 0 ? FIXED_ONE - s : s;
+}
+
+fixed_t fixed_tanh(fixed_t x) {
+    const int32_t t = lut_interp(fx_lut_tanh_y, FX_LUT_TANH_FRAC_BITS,
+                                 FX_LUT_TANH_SEGMENTS, magnitude(x));
+    return x < 0 ? -t : t;
+}
+
+fixed_t fixed_gelu(fixed_t x) {
+    const uint32_t a = magnitude(x);
+    const uint32_t end = (uint32_t)FX_LUT_GELU_SEGMENTS << FX_LUT_GELU_FRAC_BITS;
+
+    /* Past the table Φ(x) rounds to 1: GELU(x) = x */
+    const int64_t g = a >= end ? (int64_t)a
+                               : lut_interp(fx_lut_gelu_y, FX_LUT_GELU_FRAC_BITS,
+                                            FX_LUT_GELU_SEGMENTS, a);
+
+    /* GELU(−a) = −a · Φ(−a) = a · Φ(a) − a */
+    return (fixed_t)(x < 0 ? g - (int64_t)a : g);
+}
+
+uint32_t fx_exp2_neg(uint32_t u) {
+    const uint32_t k = u >> FIXED_SHIFT;
+    if (k > FX_EXP2_SHIFT) {
+        return 0;
+    }
+
+    const uint32_t t = (uint32_t)lut_interp(fx_lut_exp2_y, FX_LUT_EXP2_FRAC_BITS,
+                                            FX_LUT_EXP2_SEGMENTS, u & ((uint32_t)FIXED_ONE - 1u));
+    return k == 0 ? t : (t + (1u << (k - 1u))) >> k;
+}
@@ -0,0 +1,334 @@
+/**
+ * @file lut_tables.h
+ * @brief Interpolation tables for the Q16.16 transcendental activations
+ *
+ * Automatically generated by SpeyTech Activation Table Generator (tools/gen_lut.py)
+ * DO NOT EDIT MANUALLY
+ *
+ * Footprint: 9232 bytes
+ *
+ * @traceability SRS-004.10
+ */
+
+#ifndef LUT_TABLES_H
+#define LUT_TABLES_H
+
+#include <stdint.h>
+
+#define FX_LUT_SIGMOID_FRAC_BITS 10
+#define FX_LUT_SIGMOID_SEGMENTS 1024
+
+static const int32_t fx_lut_sigmoid_y[FX_LUT_SIGMOID_SEGMENTS + 1] = {
+         32768,      33024,      33280,      33536,      33792,      34047,      34303,      34558,
+         34813,      35068,      35323,      35577,      35831,      36085,      36338,      36591,
+         36843,      37095,      37346,      37597,      37847,      38096,      38345,      38593,
+         38841,      39088,      39334,      39579,      39824,      40068,      40310,      40552,
+         40793,      41034,      41273,      41511,      41748,      41985,      42220,      42454,
+         42687,      42919,      43150,      43380,      43608,      43836,      44062,      44287,
+         44511,      44733,      44954,      45174,      45393,      45610,      45826,      46041,
+         46254,      46466,      46677,      46886,      47094,      47300,      47505,      47709,
+         47911,      48111,      48310,      48508,      48704,      48899,      49092,      49284,
+         49474,      49663,      49850,      50036,      50220,      50402,      50584,      50763,
+         50941,      51118,      51293,      51466,      51638,      51808,      51977,      52144,
+         52310,      52474,      52637,      52798,      52957,      53116,      53272,      53427,
+         53581,      53733,      53883,      54032,      54179,      54325,      54470,      54613,
+         54754,      54894,      55033,      55170,      55306,      55440,      55572,      55704,
+         55834,      55962,      56089,      56215,      56339,      56462,      56583,      56703,
+         56822,      56939,      57055,      57170,      57284,      57396,      57506,      57616,
+         57724,      57831,      57936,      58041,      58144,      58246,      58346,      58446,
+         58544,      58641,      58737,      58831,      58925,      59017,      59108,      59198,
+         59287,      59375,      59462,      59547,      59632,      59715,      59797,      59879,
+         59959,      60038,      60116,      60194,      60270,      60345,      60419,      60492,
+         60565,      60636,      60706,      60776,      60844,      60912,      60979,      61044,
+         61109,      61173,      61237,      61299,      61360,      61421,      61481,      61540,
+         61598,      61656,      61712,      61768,      61823,      61878,      61931,      61984,
+         62036,      62088,      62138,      62188,      62238,      62286,      62334,      62381,
+         62428,      62474,      62519,      62564,      62608,      62651,      62694,      62736,
+         62778,      62819,      62859,      62899,      62938,      62977,      63015,      63053,
+         63090,      63126,      63162,      63198,      63233,      63267,      63301,      63335,
+         63368,      63400,      63432,      63464,      63495,      63526,      63556,      63586,
+         63615,      63644,      63672,      63700,      63728,      63755,      63782,      63809,
+         63835,      63861,      63886,      63911,      63935,      63960,      63983,      64007,
+         64030,      64053,      64075,      64098,      64119,      64141,      64162,      64183,
+         64203,      64224,      64244,      64263,      64283,      64302,      64321,      64339,
+         64357,      64375,      64393,      64410,      64427,      64444,      64461,      64477,
+         64494,      64509,      64525,      64541,      64556,      64571,      64585,      64600,
+         64614,      64628,      64642,      64656,      64669,      64683,      64696,      64709,
+         64721,      64734,      64746,      64758,      64770,      64782,      64793,      64805,
+         64816,      64827,      64838,      64849,      64859,      64870,      64880,      64890,
+         64900,      64910,      64919,      64929,      64938,      64947,      64956,      64965,
+         64974,      64983,      64991,      64999,      65008,      65016,      65024,      65032,
+         65039,      65047,      65055,      65062,      65069,      65076,      65084,      65091,
+         65097,      65104,      65111,      65117,      65124,      65130,      65136,      65143,
+         65149,      65155,      65160,      65166,      65172,      65178,      65183,      65189,
+         65194,      65199,      65204,      65209,      65215,      65219,      65224,      65229,
+         65234,      65239,      65243,      65248,      65252,      65257,      65261,      65265,
+         65269,      65273,      65277,      65281,      65285,      65289,      65293,      65297,
+         65300,      65304,      65308,      65311,      65315,      65318,      65321,      65325,
+         65328,      65331,      65334,      65338,      65341,      65344,      65347,      65350,
+         65352,      65355,      65358,      65361,      65364,      65366,      65369,      65371,
+         65374,      65376,      65379,      65381,      65384,      65386,      65388,      65391,
+         65393,      65395,      65397,      65399,      65402,      65404,      65406,      65408,
+         65410,      65412,      65414,      65416,      65417,      65419,      65421,      65423,
+         65425,      65426,      65428,      65430,      65431,      65433,      65435,      65436,
+         65438,      65439,      65441,      65442,      65444,      65445,      65446,      65448,
+         65449,      65451,      65452,      65453,      65454,      65456,      65457,      65458,
+         65459,      65461,      65462,      65463,      65464,      65465,      65466,      65467,
+         65468,      65469,      65470,      65471,      65472,      65473,      65474,      65475,
+         65476,      65477,      65478,      65479,      65480,      65481,      65482,      65482,
+         65483,      65484,      65485,      65486,      65486,      65487,      65488,      65489,
+         65489,      65490,      65491,      65492,      65492,      65493,      65494,      65494,
+         65495,      65496,      65496,      65497,      65497,      65498,      65499,      65499,
+         65500,      65500,      65501,      65501,      65502,      65502,      65503,      65504,
+         65504,      65505,      65505,      65505,      65506,      65506,      65507,      65507,
+         65508,      65508,      65509,      65509,      65509,      65510,      65510,      65511,
+         65511,      65511,      65512,      65512,      65513,      65513,      65513,      65514,
+         65514,      65514,      65515,      65515,      65515,      65516,      65516,      65516,
+         65517,      65517,      65517,      65517,      65518,      65518,      65518,      65519,
+         65519,      65519,      65519,      65520,      65520,      65520,      65520,      65521,
+         65521,      65521,      65521,      65522,      65522,      65522,      65522,      65522,
+         65523,      65523,      65523,      65523,      65523,      65524,      65524,      65524,
+         65524,      65524,      65525,      65525,      65525,      65525,      65525,      65525,
+         65526,      65526,      65526,      65526,      65526,      65526,      65527,      65527,
+         65527,      65527,      65527,      65527,      65527,      65528,      65528,      65528,
+         65528,      65528,      65528,      65528,      65528,      65529,      65529,      65529,
+         65529,      65529,      65529,      65529,      65529,      65529,      65530,      65530,
+         65530,      65530,      65530,      65530,      65530,      65530,      65530,      65530,
+         65530,      65531,      65531,      65531,      65531,      65531,      65531,      65531,
+         65531,      65531,      65531,      65531,      65531,      65531,      65532,      65532,
+         65532,      65532,      65532,      65532,      65532,      65532,      65532,      65532,
+         65532,      65532,      65532,      65532,      65532,      65532,      65533,      65533,
+         65533,      65533,      65533,      65533,      65533,      65533,      65533,      65533,
+         65533,      65533,      65533,      65533,      65533,      65533,      65533,      65533,
+         65533,      65533,      65533,      65533,      65534,      65534,      65534,      65534,
+         65534,      65534,      65534,      65534,      65534,      65534,      65534,      65534,
+         65534,      65534,      65534,      65534,      65534,      65534,      65534,      65534,
+         65534,      65534,      65534,      65534,      65534,      65534,      65534,      65534,
+         65534,      65534,      65534,      65534,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,
+};
+
+#define FX_LUT_TANH_FRAC_BITS 10
+#define FX_LUT_TANH_SEGMENTS 512
+
+static const int32_t fx_lut_tanh_y[FX_LUT_TANH_SEGMENTS + 1] = {
+             0,       1024,       2047,       3070,       4091,       5110,       6126,       7140,
+          8150,       9156,      10157,      11154,      12146,      13132,      14112,      15085,
+         16051,      17010,      17961,      18904,      19838,      20764,      21681,      22588,
+         23485,      24373,      25250,      26117,      26973,      27818,      28652,      29474,
+         30285,      31085,      31873,      32648,      33412,      34164,      34904,      35631,
+         36346,      37049,      37740,      38418,      39084,      39738,      40379,      41008,
+         41625,      42230,      42823,      43404,      43972,      44530,      45075,      45609,
+         46131,      46642,      47142,      47630,      48108,      48575,      49031,      49477,
+         49912,      50337,      50752,      51157,      51552,      51937,      52314,      52681,
+         53038,      53387,      53727,      54059,      54382,      54697,      55003,      55302,
+         55593,      55876,      56152,      56421,      56683,      56937,      57185,      57426,
+         57660,      57888,      58110,      58326,      58536,      58741,      58939,      59132,
+         59320,      59502,      59680,      59852,      60019,      60182,      60340,      60494,
+         60643,      60789,      60929,      61066,      61199,      61328,      61454,      61576,
+         61694,      61809,      61920,      62029,      62134,      62236,      62335,      62431,
+         62524,      62615,      62703,      62788,      62871,      62951,      63029,      63105,
+         63179,      63250,      63319,      63386,      63451,      63514,      63576,      63635,
+         63693,      63749,      63803,      63855,      63907,      63956,      64004,      64051,
+         64096,      64140,      64182,      64224,      64263,      64302,      64340,      64376,
+         64412,      64446,      64479,      64512,      64543,      64573,      64603,      64631,
+         64659,      64686,      64712,      64737,      64761,      64785,      64808,      64830,
+         64852,      64873,      64893,      64913,      64932,      64950,      64968,      64986,
+         65003,      65019,      65035,      65050,      65065,      65079,      65093,      65107,
+         65120,      65133,      65145,      65157,      65169,      65180,      65191,      65202,
+         65212,      65222,      65231,      65241,      65250,      65259,      65267,      65275,
+         65283,      65291,      65299,      65306,      65313,      65320,      65327,      65333,
+         65339,      65345,      65351,      65357,      65362,      65368,      65373,      65378,
+         65383,      65387,      65392,      65396,      65401,      65405,      65409,      65413,
+         65417,      65420,      65424,      65427,      65431,      65434,      65437,      65440,
+         65443,      65446,      65449,      65451,      65454,      65456,      65459,      65461,
+         65464,      65466,      65468,      65470,      65472,      65474,      65476,      65478,
+         65480,      65481,      65483,      65485,      65486,      65488,      65489,      65491,
+         65492,      65493,      65495,      65496,      65497,      65498,      65500,      65501,
+         65502,      65503,      65504,      65505,      65506,      65507,      65508,      65508,
+         65509,      65510,      65511,      65512,      65512,      65513,      65514,      65515,
+         65515,      65516,      65516,      65517,      65518,      65518,      65519,      65519,
+         65520,      65520,      65521,      65521,      65522,      65522,      65523,      65523,
+         65523,      65524,      65524,      65525,      65525,      65525,      65526,      65526,
+         65526,      65526,      65527,      65527,      65527,      65528,      65528,      65528,
+         65528,      65529,      65529,      65529,      65529,      65529,      65530,      65530,
+         65530,      65530,      65530,      65531,      65531,      65531,      65531,      65531,
+         65531,      65532,      65532,      65532,      65532,      65532,      65532,      65532,
+         65532,      65533,      65533,      65533,      65533,      65533,      65533,      65533,
+         65533,      65533,      65533,      65533,      65534,      65534,      65534,      65534,
+         65534,      65534,      65534,      65534,      65534,      65534,      65534,      65534,
+         65534,      65534,      65534,      65534,      65534,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65535,      65535,      65535,      65535,      65535,      65535,      65535,      65535,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,      65536,      65536,      65536,      65536,      65536,      65536,      65536,
+         65536,
+};
+
+#define FX_LUT_GELU_FRAC_BITS 10
+#define FX_LUT_GELU_SEGMENTS 512
+
+static const int32_t fx_lut_gelu_y[FX_LUT_GELU_SEGMENTS + 1] = {
+             0,        518,       1050,       1593,       2150,       2719,       3301,       3896,
+          4503,       5123,       5756,       6401,       7058,       7727,       8409,       9103,
+          9809,      10527,      11257,      11999,      12752,      13517,      14294,      15081,
+         15880,      16690,      17511,      18343,      19185,      20038,      20901,      21774,
+         22658,      23551,      24454,      25366,      26288,      27219,      28159,      29108,
+         30065,      31031,      32005,      32987,      33977,      34975,      35981,      36993,
+         38013,      39039,      40073,      41113,      42159,      43211,      44270,      45334,
+         46404,      47479,      48559,      49644,      50734,      51829,      52928,      54031,
+         55138,      56250,      57365,      58483,      59605,      60730,      61858,      62988,
+         64122,      65258,      66396,      67536,      68678,      69823,      70969,      72116,
+         73265,      74415,      75567,      76719,      77872,      79026,      80181,      81336,
+         82492,      83647,      84803,      85959,      87115,      88271,      89427,      90582,
+         91737,      92891,      94044,      95197,      96350,      97501,      98652,      99801,
+        100950,     102097,     103243,     104388,     105532,     106674,     107816,     108955,
+        110094,     111231,     112366,     113500,     114632,     115763,     116892,     118019,
+        119145,     120269,     121391,     122512,     123631,     124748,     125864,     126978,
+        128090,     129201,     130309,     131416,     132521,     133625,     134727,     135827,
+        136925,     138022,     139117,     140211,     141302,     142393,     143481,     144568,
+        145653,     146737,     147820,     148900,     149980,     151057,     152134,     153209,
+        154282,     155354,     156425,     157495,     158563,     159630,     160695,     161759,
+        162823,     163885,     164945,     166005,     167063,     168121,     169177,     170232,
+        171287,     172340,     173392,     174444,     175494,     176544,     177592,     178640,
+        179687,     180733,     181778,     182823,     183867,     184910,     185953,     186994,
+        188035,     189076,     190116,     191155,     192194,     193232,     194269,     195306,
+        196343,     197379,     198414,     199449,     200484,     201518,     202552,     203585,
+        204618,     205651,     206683,     207715,     208746,     209777,     210808,     211839,
+        212869,     213899,     214929,     215958,     216988,     218017,     219045,     220074,
+        221102,     222131,     223158,     224186,     225214,     226241,     227269,     228296,
+        229323,     230349,     231376,     232403,     233429,     234455,     235482,     236508,
+        237534,     238560,     239585,     240611,     241637,     242662,     243688,     244713,
+        245738,     246764,     247789,     248814,     249839,     250864,     251889,     252914,
+        253938,     254963,     255988,     257013,     258037,     259062,     260087,     261111,
+        262136,     263160,     264185,     265209,     266234,     267258,     268282,     269307,
+        270331,     271355,     272380,     273404,     274428,     275452,     276477,     277501,
+        278525,     279549,     280573,     281598,     282622,     283646,     284670,     285694,
+        286718,     287742,     288766,     289791,     290815,     291839,     292863,     293887,
+        294911,     295935,     296959,     297983,     299007,     300031,     301055,     302079,
+        303103,     304127,     305152,     306176,     307200,     308224,     309248,     310272,
+        311296,     312320,     313344,     314368,     315392,     316416,     317440,     318464,
+        319488,     320512,     321536,     322560,     323584,     324608,     325632,     326656,
+        327680,     328704,     329728,     330752,     331776,     332800,     333824,     334848,
+        335872,     336896,     337920,     338944,     339968,     340992,     342016,     343040,
+        344064,     345088,     346112,     347136,     348160,     349184,     350208,     351232,
+        352256,     353280,     354304,     355328,     356352,     357376,     358400,     359424,
+        360448,     361472,     362496,     363520,     364544,     365568,     366592,     367616,
+        368640,     369664,     370688,     371712,     372736,     373760,     374784,     375808,
+        376832,     377856,     378880,     379904,     380928,     381952,     382976,     384000,
+        385024,     386048,     387072,     388096,     389120,     390144,     391168,     392192,
+        393216,     394240,     395264,     396288,     397312,     398336,     399360,     400384,
+        401408,     402432,     403456,     404480,     405504,     406528,     407552,     408576,
+        409600,     410624,     411648,     412672,     413696,     414720,     415744,     416768,
+        417792,     418816,     419840,     420864,     421888,     422912,     423936,     424960,
+        425984,     427008,     428032,     429056,     430080,     431104,     432128,     433152,
+        434176,     435200,     436224,     437248,     438272,     439296,     440320,     441344,
+        442368,     443392,     444416,     445440,     446464,     447488,     448512,     449536,
+        450560,     451584,     452608,     453632,     454656,     455680,     456704,     457728,
+        458752,     459776,     460800,     461824,     462848,     463872,     464896,     465920,
+        466944,     467968,     468992,     470016,     471040,     472064,     473088,     474112,
+        475136,     476160,     477184,     478208,     479232,     480256,     481280,     482304,
+        483328,     484352,     485376,     486400,     487424,     488448,     489472,     490496,
+        491520,     492544,     493568,     494592,     495616,     496640,     497664,     498688,
+        499712,     500736,     501760,     502784,     503808,     504832,     505856,     506880,
+        507904,     508928,     509952,     510976,     512000,     513024,     514048,     515072,
+        516096,     517120,     518144,     519168,     520192,     521216,     522240,     523264,
+        524288,
+};
+
+#define FX_LUT_EXP2_FRAC_BITS 8
+#define FX_LUT_EXP2_SEGMENTS 256
+
+static const int32_t fx_lut_exp2_y[FX_LUT_EXP2_SEGMENTS + 1] = {
+    1073741824, 1070838486, 1067942999, 1065055341, 1062175491, 1059303428, 1056439131, 1053582579,
+    1050733751, 1047892626, 1045059183, 1042233401, 1039415261, 1036604740, 1033801819, 1031006477,
+    1028218693, 1025438448, 1022665720, 1019900489, 1017142735, 1014392438, 1011649578, 1008914134,
+    1006186087, 1003465416, 1000752102,  998046124,  995347464,  992656100,  989972014,  987295185,
+     984625594,  981963222,  979308048,  976660054,  974019220,  971385527,  968758955,  966139485,
+     963527098,  960921775,  958323496,  955732243,  953147997,  950570738,  948000448,  945437108,
+     942880699,  940331203,  937788600,  935252872,  932724001,  930201967,  927686753,  925178340,
+     922676710,  920181844,  917693724,  915212331,  912737649,  910269657,  907808339,  905353676,
+     902905651,  900464244,  898029440,  895601218,  893179563,  890764456,  888355878,  885953814,
+     883558244,  881169153,  878786521,  876410331,  874040567,  871677210,  869320244,  866969651,
+     864625413,  862287515,  859955938,  857630665,  855311680,  852998965,  850692504,  848392279,
+     846098274,  843810471,  841528855,  839253408,  836984114,  834720956,  832463917,  830212982,
+     827968132,  825729353,  823496627,  821269938,  819049271,  816834607,  814625932,  812423229,
+     810226483,  808035676,  805850792,  803671817,  801498734,  799331526,  797170178,  795014675,
+     792865000,  790721137,  788583072,  786450787,  784324269,  782203500,  780088465,  777979150,
+     775875538,  773777614,  771685363,  769598769,  767517817,  765442492,  763372778,  761308661,
+     759250125,  757197155,  755149737,  753107854,  751071493,  749040637,  747015274,  744995386,
+     742980960,  740971982,  738968435,  736970306,  734977579,  732990241,  731008277,  729031671,
+     727060411,  725094480,  723133865,  721178552,  719228525,  717283772,  715344277,  713410026,
+     711481005,  709557200,  707638598,  705725183,  703816941,  701913860,  700015924,  698123120,
+     696235434,  694352853,  692475362,  690602947,  688735596,  686873293,  685016026,  683163781,
+     681316545,  679474303,  677637043,  675804750,  673977412,  672155015,  670337545,  668524990,
+     666717336,  664914570,  663116678,  661323648,  659535466,  657752119,  655973594,  654199878,
+     652430958,  650666822,  648907455,  647152846,  645402981,  643657847,  641917433,  640181724,
+     638450708,  636724373,  635002706,  633285695,  631573326,  629865587,  628162466,  626463950,
+     624770026,  623080683,  621395908,  619715688,  618040012,  616368866,  614702239,  613040119,
+     611382493,  609729349,  608080675,  606436459,  604796689,  603161352,  601530438,  599903933,
+     598281827,  596664106,  595050760,  593441776,  591837143,  590236848,  588640881,  587049229,
+     585461881,  583878825,  582300049,  580725543,  579155293,  577589290,  576027521,  574469975,
+     572916640,  571367506,  569822560,  568281792,  566745190,  565212742,  563684439,  562160268,
+     560640218,  559124278,  557612438,  556104685,  554601009,  553101399,  551605844,  550114332,
+     548626854,  547143398,  545663953,  544188508,  542717053,  541249576,  539786068,  538326517,
+     536870912,
+};
+
+#endif /* LUT_TABLES_H */
@@ -17,6 +17,10 @@
  */
 
 #include "matrix.h"
+#include "kernels.h"
+#include "threadpool.h"
+#include "trace.h"
+#include <stdbool.h>
 #include <string.h>
 
 void fx_matrix_init(fx_matrix_t* mat, fixed_t* buffer, uint16_t rows, uint16_t cols) {
@@ -32,25 +36,43 @@ void fx_matrix_init(fx_matrix_t* mat, fixed_t* buffer, uint16_t rows, uint16_t c
     memset(mat->data, 0, (size_t)rows * cols * sizeof(fixed_t));
 }
 
-void fx_matrix_mul(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C) {
-    /* SRS-003.4: Dimensional validation - safety first */
-    if (!A || !B || !C) {
-        return;
+/**
+ * @brief Shared dimension validation for the GEMM entry points.
+ *
+ * @return true if A(N×M) × B(M×P) = C(N×P) is well formed
+ */
+static bool matrix_mul_dims_ok(const fx_matrix_t* A, const fx_matrix_t* B, const fx_matrix_t* C) {
+    if (!A || !B || !C || !A->data || !B->data || !C->data) {
+        return false;
     }
 
+    /* Incompatible dimensions - safe failure mode */
     if (A->cols != B->rows) {
-        /* Incompatible dimensions - safe failure mode */
+        return false;
+    }
+
+    /* Output dimension mismatch */
+    if (C->rows != A->rows || C->cols != B->cols) {
+        return false;
+    }
+
+    return true;
+}
+
+void fx_matrix_mul_ref(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C) {
+    /* SRS-003.4: Dimensional validation - safety first */
+    if (!matrix_mul_dims_ok(A, B, C)) {
         return;
     }
 
     /* SRS-003.6: Bounded execution O(N*M*P) with no data-dependent branching */
-    for (uint16_t i = 0; i < A->rows; i++) {
-        for (uint16_t j = 0; j < B->cols; j++) {
+    for (size_t i = 0; i < A->rows; i++) {
+        for (size_t j = 0; j < B->cols; j++) {
             /* SRS-003.5: 64-bit accumulator prevents overflow */
             int64_t sum = 0;
 
             /* Inner loop: dot product of row i of A with column j of B */
-            for (uint16_t k = 0; k < A->cols; k++) {
+            for (size_t k = 0; k < A->cols; k++) {
                 /* SRS-003.2: Row-major access for cache efficiency
                  * A[i][k] = A.data[i * A.cols + k]
                  * B[k][j] = B.data[k * B.cols + j] */
@@ -71,16 +93,369 @@ void fx_matrix_mul(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C) {
     }
 }
 
+/**
+ * @brief Pack a KC×NR panel of B into contiguous storage.
+ *
+ * @details panel[k * NR + j] = B[pc + k][jc + j]. Columns beyond the
+ * right edge of B are zero-filled so the micro-kernel never branches on
+ * the tile width; zero products leave the accumulators unchanged.
+ */
+static void gemm_pack_b(const fixed_t* b, size_t ldb, size_t pc, size_t kc,
+                        size_t jc, size_t nr, fixed_t* panel) {
+    for (size_t k = 0; k < kc; k++) {
+        const fixed_t* src = &b[(pc + k) * ldb + jc];
+        fixed_t* dst = &panel[k * FX_GEMM_NR];
+
+        for (size_t j = 0; j < FX_GEMM_NR; j++) {
+            dst[j] = (j < nr) ? src[j] : FIXED_ZERO;
+        }
+    }
+}
+
+/**
+ * @brief MR×NR register-tile micro-kernel.
+ *
+ * @details acc[r][j] += Σk a[r][k] × panel[k][j] over one KC slice.
+ * The sixteen partial sums stay in local 64-bit accumulators for the
+ * whole slice and are written back once. Integer addition is exact and
+ * associative, so the split of K into slices cannot change the result.
+ */
+void fx_scalar_gemm_4x4(size_t kc, const fixed_t* a, size_t lda,
+                        const fixed_t* panel, int64_t acc[][FX_GEMM_NR]) {
+    const fixed_t* a0 = a;
+    const fixed_t* a1 = a + lda;
+    const fixed_t* a2 = a + 2 * lda;
+    const fixed_t* a3 = a + 3 * lda;
+
+    int64_t c00 = acc[0][0], c01 = acc[0][1], c02 = acc[0][2], c03 = acc[0][3];
+    int64_t c10 = acc[1][0], c11 = acc[1][1], c12 = acc[1][2], c13 = acc[1][3];
+    int64_t c20 = acc[2][0], c21 = acc[2][1], c22 = acc[2][2], c23 = acc[2][3];
+    int64_t c30 = acc[3][0], c31 = acc[3][1], c32 = acc[3][2], c33 = acc[3][3];
+
+    for (size_t k = 0; k < kc; k++) {
+        const fixed_t* b = &panel[k * FX_GEMM_NR];
+        const int64_t b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3];
+        const int64_t v0 = a0[k], v1 = a1[k], v2 = a2[k], v3 = a3[k];
+
+        c00 += v0 * b0; c01 += v0 * b1; c02 += v0 * b2; c03 += v0 * b3;
+        c10 += v1 * b0; c11 += v1 * b1; c12 += v1 * b2; c13 += v1 * b3;
+        c20 += v2 * b0; c21 += v2 * b1; c22 += v2 * b2; c23 += v2 * b3;
+        c30 += v3 * b0; c31 += v3 * b1; c32 += v3 * b2; c33 += v3 * b3;
+    }
+
+    acc[0][0] = c00; acc[0][1] = c01; acc[0][2] = c02; acc[0][3] = c03;
+    acc[1][0] = c10; acc[1][1] = c11; acc[1][2] = c12; acc[1][3] = c13;
+    acc[2][0] = c20; acc[2][1] = c21; acc[2][2] = c22; acc[2][3] = c23;
+    acc[3][0] = c30; acc[3][1] = c31; acc[3][2] = c32; acc[3][3] = c33;
+}
+
+/**
+ * @brief Edge micro-kernel for the last MR-block when rows % MR != 0.
+ */
+static void gemm_micro_edge(size_t mr, size_t kc, const fixed_t* a, size_t lda,
+                            const fixed_t* panel, int64_t acc[][FX_GEMM_NR]) {
+    for (size_t r = 0; r < mr; r++) {
+        const fixed_t* ar = a + r * lda;
+
+        for (size_t k = 0; k < kc; k++) {
+            const int64_t v = ar[k];
+            const fixed_t* b = &panel[k * FX_GEMM_NR];
+
+            for (size_t j = 0; j < FX_GEMM_NR; j++) {
+                acc[r][j] += v * b[j];
+            }
+        }
+    }
+}
+
+void fx_matrix_mul(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C) {
+    /* SRS-003.4: Dimensional validation - safety first */
+    if (!matrix_mul_dims_ok(A, B, C)) {
+        return;
+    }
+
+    FX_TRACE_BEGIN(FX_TRACE_MATMUL, A->rows, B->cols, A->cols);
+    fx_gemm(A->rows, B->cols, A->cols, A->data, A->cols, B->data, B->cols, C->data, C->cols, NULL);
+    FX_TRACE_END();
+}
+
+void fx_matrix_mul_fused(const fx_matrix_t* A, const fx_matrix_t* B, const fx_matrix_t* bias,
+                         fx_activation_t act, fixed_t alpha, fx_matrix_t* C) {
+    /* SRS-003.4: Dimensional validation - safety first */
+    if (!matrix_mul_dims_ok(A, B, C)) {
+        return;
+    }
+
+    /* SRS-004.3: Bias must be a row vector (1×N) matching output width */
+    if (bias && (!bias->data || bias->rows != 1 || bias->cols != C->cols)) {
+        return;
+    }
+
+    /* SRS-004.9: Bias and activation applied in registers before the store */
+    const fx_gemm_epilogue_t epi = { NULL, bias ? bias->data : NULL, act, alpha };
+    FX_TRACE_BEGIN(FX_TRACE_MATMUL_FUSED, A->rows, B->cols, A->cols);
+    fx_gemm(A->rows, B->cols, A->cols, A->data, A->cols, B->data, B->cols, C->data, C->cols, &epi);
+    FX_TRACE_END();
+}
+
+void fx_matrix_mul_bias_relu(const fx_matrix_t* A, const fx_matrix_t* B,
+                             const fx_matrix_t* bias, fx_matrix_t* C) {
+    fx_matrix_mul_fused(A, B, bias, FX_ACT_RELU, FIXED_ZERO, C);
+}
+
+/* The packed layout is the micro-kernel's panel layout */
+typedef char fx_matrix_panel_cols_check[(FX_MATRIX_PANEL_COLS == FX_GEMM_NR) ? 1 : -1];
+
+size_t fx_matrix_packed_size(uint16_t rows, uint16_t cols) {
+    const size_t panels = ((size_t)cols + FX_GEMM_NR - 1) / FX_GEMM_NR;
+    return panels * rows * FX_GEMM_NR;
+}
+
+void fx_matrix_pack(const fx_matrix_t* B, fixed_t* storage, size_t len, fx_matrix_packed_t* out) {
+    if (!B || !B->data || !storage || !out || len < fx_matrix_packed_size(B->rows, B->cols)) {
+        return;
+    }
+
+    /* SRS-003.12: each panel is the full-K run gemm_pack_b() builds per slice */
+    for (size_t jc = 0; jc < B->cols; jc += FX_GEMM_NR) {
+        const size_t nr = (B->cols - jc < FX_GEMM_NR) ? (B->cols - jc) : FX_GEMM_NR;
+        gemm_pack_b(B->data, B->cols, 0, B->rows, jc, nr, &storage[jc * B->rows]);
+    }
+
+    out->data = storage;
+    out->rows = B->rows;
+    out->cols = B->cols;
+}
+
+void fx_matrix_mul_packed(const fx_matrix_t* A, const fx_matrix_packed_t* B, fx_matrix_t* C) {
+    fx_matrix_mul_packed_fused(A, B, NULL, FX_ACT_NONE, FIXED_ZERO, C);
+}
+
+void fx_matrix_mul_packed_fused(const fx_matrix_t* A, const fx_matrix_packed_t* B,
+                                const fx_matrix_t* bias, fx_activation_t act, fixed_t alpha,
+                                fx_matrix_t* C) {
+    /* SRS-003.4: Dimensional validation - safety first */
+    if (!A || !B || !C || !A->data || !B->data || !C->data ||
+        A->cols != B->rows || C->rows != A->rows || C->cols != B->cols) {
+        return;
+    }
+    if (bias && (!bias->data || bias->rows != 1 || bias->cols != C->cols)) {
+        return;
+    }
+
+    /* SRS-004.9: same epilogue as fx_matrix_mul_fused() */
+    const fx_gemm_epilogue_t epi = { NULL, bias ? bias->data : NULL, act, alpha };
+    FX_TRACE_BEGIN(FX_TRACE_MATMUL_PACKED, A->rows, B->cols, A->cols);
+    fx_gemm_packed(A->rows, B->cols, A->cols, A->data, A->cols, B->data, C->data, C->cols, &epi);
+    FX_TRACE_END();
+}
+
+/**
+ * @brief Serial blocked GEMM over one output tile (SRS-003.9).
+ */
+static void gemm_tile(const fx_kernel_table_t* kernels, size_t M, size_t N, size_t K,
+                      const fixed_t* a_data, size_t lda,
+                      const fixed_t* b_data, size_t ldb, bool b_packed,
+                      fixed_t* c_data, size_t ldc,
+                      const fx_gemm_epilogue_t* epi) {
+    /* SRS-003.1: Working storage is bounded and lives on the stack */
+    fixed_t panel[FX_GEMM_KC * FX_GEMM_NR];
+    int64_t acc[FX_GEMM_MC][FX_GEMM_NR];
+
+    /* SRS-003.9: Loop nest jc → ic → pc → ir.
+     * Each NR-wide column panel of B is packed once per KC slice and
+     * swept by MC rows of A. Every output element owns exactly one
+     * 64-bit accumulator for the full K range (SRS-003.5) and is rounded
+     * exactly once at the end, matching fx_matrix_mul_ref() bit-for-bit. */
+    for (size_t jc = 0; jc < N; jc += FX_GEMM_NR) {
+        const size_t nr = (N - jc < FX_GEMM_NR) ? (N - jc) : FX_GEMM_NR;
+
+        for (size_t ic = 0; ic < M; ic += FX_GEMM_MC) {
+            const size_t mc = (M - ic < FX_GEMM_MC) ? (M - ic) : FX_GEMM_MC;
+
+            memset(acc, 0, sizeof(acc));
+
+            for (size_t pc = 0; pc < K; pc += FX_GEMM_KC) {
+                const size_t kc = (K - pc < FX_GEMM_KC) ? (K - pc) : FX_GEMM_KC;
+
+                /* SRS-003.12: a pre-packed operand already holds this panel */
+                const fixed_t* bp = panel;
+                if (b_packed) {
+                    bp = &b_data[jc * K + pc * FX_GEMM_NR];
+                } else {
+                    gemm_pack_b(b_data, ldb, pc, kc, jc, nr, panel);
+                }
+
+                for (size_t ir = 0; ir < mc; ir += FX_GEMM_MR) {
+                    const size_t mr = (mc - ir < FX_GEMM_MR) ? (mc - ir) : FX_GEMM_MR;
+                    const fixed_t* a = &a_data[(ic + ir) * lda + pc];
+
+                    if (mr == FX_GEMM_MR) {
+                        kernels->gemm_4x4(kc, a, lda, bp, &acc[ir]);
+                    } else {
+                        gemm_micro_edge(mr, kc, a, lda, bp, &acc[ir]);
+                    }
+                }
+            }
+
+            /* SRS-003.4: Single round-to-nearest per output element */
+            for (size_t r = 0; r < mc; r++) {
+                fixed_t* dst = &c_data[(ic + r) * ldc + jc];
+
+                for (size_t j = 0; j < nr; j++) {
+                    fixed_t v = (fixed_t)((acc[r][j] + FIXED_HALF) >> FIXED_SHIFT);
+
+                    /* SRS-004.9: Fused epilogue, same order as the separate passes */
+                    if (epi) {
+                        if (epi->row_bias) {
+                            v = fixed_add(v, epi->row_bias[ic + r]);
+                        }
+                        if (epi->col_bias) {
+                            v = fixed_add(v, epi->col_bias[jc + j]);
+                        }
+                        v = fx_activate(v, epi->act, epi->alpha);
+                    }
+                    dst[j] = v;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief One parallel GEMM: operands plus the static partition.
+ */
+typedef struct {
+    const fx_kernel_table_t* kernels;
+    size_t M, N, K;
+    const fixed_t* a_data;
+    size_t lda;
+    const fixed_t* b_data;
+    size_t ldb;
+    bool b_packed;               /* b_data holds panels (SRS-003.12) */
+    fixed_t* c_data;
+    size_t ldc;
+    const fx_gemm_epilogue_t* epi;
+    bool by_cols;                /* Split columns in NR units, else rows in MR units */
+    size_t units;
+} gemm_job_t;
+
+/**
+ * @brief Compute the output rows or columns owned by one part.
+ *
+ * @details The tile is an ordinary sub-GEMM: the same K loop, the same
+ * per-element accumulator and the epilogue with its bias offset by the
+ * tile origin (SRS-013.3).
+ */
+static void gemm_part(void* ctx, unsigned part, unsigned parts) {
+    const gemm_job_t* job = (const gemm_job_t*)ctx;
+    const size_t unit = job->by_cols ? FX_GEMM_NR : FX_GEMM_MR;
+    const size_t extent = job->by_cols ? job->N : job->M;
+    size_t u0, u1;
+
+    fx_pool_span(job->units, part, parts, &u0, &u1);
+
+    const size_t t0 = u0 * unit;
+    const size_t t1 = (u1 * unit < extent) ? u1 * unit : extent;
+    if (t0 >= t1) {
+        return;
+    }
+
+    fx_gemm_epilogue_t sub;
+    const fx_gemm_epilogue_t* epi = NULL;
+    if (job->epi) {
+        sub = *job->epi;
+        epi = &sub;
+    }
+
+    if (job->by_cols) {
+        if (epi && sub.col_bias) {
+            sub.col_bias += t0;
+        }
+        gemm_tile(job->kernels, job->M, t1 - t0, job->K, job->a_data, job->lda,
+                  job->b_data + (job->b_packed ? t0 * job->K : t0), job->ldb, job->b_packed,
+                  job->c_data + t0, job->ldc, epi);
+    } else {
+        if (epi && sub.row_bias) {
+            sub.row_bias += t0;
+        }
+        gemm_tile(job->kernels, t1 - t0, job->N, job->K, job->a_data + t0 * job->lda, job->lda,
+                  job->b_data, job->ldb, job->b_packed, job->c_data + t0 * job->ldc, job->ldc, epi);
+    }
+}
+
+/**
+ * @brief Shared driver: B as a strided matrix, or as panels if b_packed.
+ */
+static void gemm_run(size_t M, size_t N, size_t K,
+                     const fixed_t* a_data, size_t lda,
+                     const fixed_t* b_data, size_t ldb, bool b_packed,
+                     fixed_t* c_data, size_t ldc,
+                     const fx_gemm_epilogue_t* epi) {
+    /* SRS-003.11: Micro-kernel from the active backend table, resolved
+     * once on the calling thread */
+    const fx_kernel_table_t* kernels = fx_kernels();
+
+    /* SRS-013.3: Static split by whole register tiles; rows unless there
+     * are fewer row tiles than threads and more column tiles */
+    const size_t row_units = (M + FX_GEMM_MR - 1) / FX_GEMM_MR;
+    const size_t col_units = (N + FX_GEMM_NR - 1) / FX_GEMM_NR;
+    const bool by_cols = row_units < fx_pool_threads() && col_units > row_units;
+    const size_t units = by_cols ? col_units : row_units;
+    const unsigned parts = fx_pool_parts(units, (uint64_t)M * N * K);
+
+    if (parts <= 1) {
+        gemm_tile(kernels, M, N, K, a_data, lda, b_data, ldb, b_packed, c_data, ldc, epi);
+        return;
+    }
+
+    gemm_job_t job = { kernels, M, N, K, a_data, lda, b_data, ldb, b_packed, c_data, ldc,
+                       epi, by_cols, units };
+    fx_pool_run(gemm_part, &job, parts);
+}
+
+void fx_gemm(size_t M, size_t N, size_t K,
+             const fixed_t* a_data, size_t lda,
+             const fixed_t* b_data, size_t ldb,
+             fixed_t* c_data, size_t ldc,
+             const fx_gemm_epilogue_t* epi) {
+    gemm_run(M, N, K, a_data, lda, b_data, ldb, false, c_data, ldc, epi);
+}
+
+void fx_gemm_packed(size_t M, size_t N, size_t K,
+                    const fixed_t* a_data, size_t lda,
+                    const fixed_t* b_panels,
+                    fixed_t* c_data, size_t ldc,
+                    const fx_gemm_epilogue_t* epi) {
+    gemm_run(M, N, K, a_data, lda, b_panels, FX_GEMM_NR, true, c_data, ldc, epi);
+}
+
 fixed_t fx_vector_dot(const fixed_t* a, const fixed_t* b, uint16_t len) {
     if (!a || !b) {
         return FIXED_ZERO;
     }
 
+    /* SRS-003.10, SRS-003.11: Active backend accumulates the same exact products */
+    FX_TRACE_BEGIN(FX_TRACE_VECTOR_DOT, len, 0, 0);
+    const fixed_t dot = fx_kernels()->vector_dot(a, b, len);
+    FX_TRACE_END();
+    return dot;
+}
+
+fixed_t fx_vector_dot_ref(const fixed_t* a, const fixed_t* b, uint16_t len) {
+    if (!a || !b) {
+        return FIXED_ZERO;
+    }
+
+    return fx_scalar_vector_dot(a, b, len);
+}
+
+fixed_t fx_scalar_vector_dot(const fixed_t* a, const fixed_t* b, size_t len) {
     /* SRS-003.5: 64-bit accumulator for overflow protection */
     int64_t sum = 0;
 
     /* SRS-003.6: Sequential iteration, no data-dependent branching */
-    for (uint16_t i = 0; i < len; i++) {
+    for (size_t i = 0; i < len; i++) {
         int64_t prod = (int64_t)a[i] * b[i];
         sum += prod;
     }
@@ -105,20 +480,20 @@ void fx_matrix_add(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C) {
     }
 
     /* Element-wise addition */
-    uint16_t total_elements = A->rows * A->cols;
-    for (uint16_t i = 0; i < total_elements; i++) {
+    const size_t total_elements = (size_t)A->rows * A->cols;
+    for (size_t i = 0; i < total_elements; i++) {
         C->data[i] = fixed_add(A->data[i], B->data[i]);
     }
 }
 
 void fx_matrix_apply(fx_matrix_t* mat, fixed_t (*fn)(fixed_t)) {
-    if (!mat || !fn) {
+    if (!mat || !mat->data || !fn) {
         return;
     }
 
-    /* Apply function to each element */
-    uint16_t total_elements = mat->rows * mat->cols;
-    for (uint16_t i = 0; i < total_elements; i++) {
+    /* Apply function to each element (size_t: rows × cols exceeds 16 bits) */
+    const size_t total_elements = (size_t)mat->rows * mat->cols;
+    for (size_t i = 0; i < total_elements; i++) {
         mat->data[i] = fn(mat->data[i]);
     }
 }
@@ -135,8 +510,8 @@ void fx_matrix_add_bias(fx_matrix_t* mat, const fx_matrix_t* bias) {
     }
 
     /* SRS-004.4: Broadcast bias to each row using fixed-point addition */
-    for (uint16_t i = 0; i < mat->rows; i++) {
-        for (uint16_t j = 0; j < mat->cols; j++) {
+    for (size_t i = 0; i < mat->rows; i++) {
+        for (size_t j = 0; j < mat->cols; j++) {
             /* Add bias[j] to mat[i][j] */
             mat->data[i * mat->cols + j] = fixed_add(
                 mat->data[i * mat->cols + j],
@@ -0,0 +1,368 @@
+/**
+ * @file pipeline.c
+ * @project Certifiable Inference Engine
+ * @brief Stage threads and SPSC rings of the frame pipeline.
+ *
+ * @details Ring counters are accessed with the GCC/Clang __atomic
+ * builtins: each side loads its own counter relaxed, loads the other
+ * side's with acquire and publishes its own with release. The release on
+ * commit orders the frame writes before the consumer sees the slot, and
+ * the release on release orders the consumer's reads before the producer
+ * reuses it. Nothing here takes a lock or allocates.
+ *
+ * @traceability SRS-014-PIPELINE
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#if defined(CI_HAVE_THREADS)
+#if defined(__linux__)
+#define _GNU_SOURCE
+#else
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "pipeline.h"
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Rings
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+fx_pipe_res_t fx_ring_init(fx_ring_t* ring, fixed_t* slots, size_t slot_len, uint32_t depth) {
+    if (!ring || !slots || slot_len == 0 || depth == 0 || depth > FX_PIPE_MAX_DEPTH) {
+        return FX_PIPE_INVALID_PARAM;
+    }
+
+    ring->slots = slots;
+    ring->slot_len = slot_len;
+    ring->depth = depth;
+    __atomic_store_n(&ring->head, 0u, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->tail, 0u, __ATOMIC_RELAXED);
+    return FX_PIPE_OK;
+}
+
+/*
+ * Counters run modulo 2 × depth rather than 2^32, so the slot index
+ * stays continuous when they wrap for any depth (3 for triple
+ * buffering), and a full ring (fill = depth) is distinct from an empty
+ * one. Loads reduce them first, so equal counters at any start value
+ * describe an empty ring.
+ */
+static uint32_t ring_pos(const fx_ring_t* ring, uint32_t counter) {
+    return counter % (2u * ring->depth);
+}
+
+static uint32_t ring_fill(const fx_ring_t* ring, uint32_t head, uint32_t tail) {
+    return (ring_pos(ring, head) + 2u * ring->depth - ring_pos(ring, tail)) % (2u * ring->depth);
+}
+
+static uint32_t ring_next(const fx_ring_t* ring, uint32_t counter) {
+    return (ring_pos(ring, counter) + 1u) % (2u * ring->depth);
+}
+
+fixed_t* fx_ring_acquire(fx_ring_t* ring) {
+    const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    const uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+    if (ring_fill(ring, head, tail) >= ring->depth) {
+        return NULL;
+    }
+    return ring->slots + (size_t)(ring_pos(ring, head) % ring->depth) * ring->slot_len;
+}
+
+void fx_ring_commit(fx_ring_t* ring) {
+    const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->head, ring_next(ring, head), __ATOMIC_RELEASE);
+}
+
+const fixed_t* fx_ring_peek(fx_ring_t* ring) {
+    const uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    if (ring_fill(ring, head, tail) == 0) {
+        return NULL;
+    }
+    return ring->slots + (size_t)(ring_pos(ring, tail) % ring->depth) * ring->slot_len;
+}
+
+void fx_ring_release(fx_ring_t* ring) {
+    const uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->tail, ring_next(ring, tail), __ATOMIC_RELEASE);
+}
+
+uint32_t fx_ring_count(fx_ring_t* ring) {
+    const uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    return ring_fill(ring, head, tail);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Pipeline construction
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+fx_pipe_res_t fx_pipeline_init(fx_pipeline_t* p, fixed_t* in_slots, size_t frame_len,
+                               uint32_t in_depth) {
+    if (!p) {
+        return FX_PIPE_INVALID_PARAM;
+    }
+
+    const fx_pipe_res_t res = fx_ring_init(&p->rings[0], in_slots, frame_len, in_depth);
+    if (res != FX_PIPE_OK) {
+        return res;
+    }
+
+    p->stage_count = 0;
+    p->running = false;
+    __atomic_store_n(&p->stop, 0u, __ATOMIC_RELAXED);
+    __atomic_store_n(&p->failed, 0u, __ATOMIC_RELAXED);
+    return FX_PIPE_OK;
+}
+
+fx_pipe_res_t fx_pipeline_add_stage(fx_pipeline_t* p, fx_stage_fn fn, void* ctx,
+                                    fixed_t* out_slots, size_t out_len, uint32_t out_depth,
+                                    int cpu) {
+    if (!p || !fn) {
+        return FX_PIPE_INVALID_PARAM;
+    }
+    if (p->running) {
+        return FX_PIPE_BUSY;
+    }
+    if (p->stage_count >= FX_PIPE_MAX_STAGES) {
+        return FX_PIPE_FULL;
+    }
+
+    const uint16_t s = p->stage_count;
+    const fx_pipe_res_t res = fx_ring_init(&p->rings[s + 1u], out_slots, out_len, out_depth);
+    if (res != FX_PIPE_OK) {
+        return res;
+    }
+
+    p->stages[s].fn = fn;
+    p->stages[s].ctx = ctx;
+    p->stages[s].cpu = cpu;
+    p->stages[s].index = s;
+    p->stages[s].owner = p;
+    p->stage_count = (uint16_t)(s + 1u);
+    return FX_PIPE_OK;
+}
+
+fx_ring_t* fx_pipeline_input(fx_pipeline_t* p) {
+    return p ? &p->rings[0] : NULL;
+}
+
+fx_ring_t* fx_pipeline_output(fx_pipeline_t* p) {
+    return p ? &p->rings[p->stage_count] : NULL;
+}
+
+int fx_pipeline_failed_stage(const fx_pipeline_t* p) {
+    if (!p) {
+        return -1;
+    }
+    return (int)__atomic_load_n(&p->failed, __ATOMIC_ACQUIRE) - 1;
+}
+
+/**
+ * @brief Record the first failing stage.
+ */
+static void mark_failed(fx_pipeline_t* p, uint16_t s) {
+    uint32_t expected = 0;
+    (void)__atomic_compare_exchange_n(&p->failed, &expected, (uint32_t)s + 1u, false,
+                                      __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Move at most one frame through stage @p s.
+ *
+ * @return 1 if a frame was processed, 0 if the stage had no input or no
+ *         room, −1 if the stage function failed
+ */
+static int stage_once(fx_pipeline_t* p, uint16_t s) {
+    fx_ring_t* const rin = &p->rings[s];
+    fx_ring_t* const rout = &p->rings[s + 1u];
+
+    const fixed_t* in = fx_ring_peek(rin);
+    if (!in) {
+        return 0;
+    }
+    fixed_t* out = fx_ring_acquire(rout);
+    if (!out) {
+        return 0;
+    }
+
+    if (!p->stages[s].fn(p->stages[s].ctx, in, out)) {
+        mark_failed(p, s);
+        return -1;
+    }
+
+    fx_ring_commit(rout);
+    fx_ring_release(rin);
+    return 1;
+}
+
+fx_pipe_res_t fx_pipeline_step(fx_pipeline_t* p) {
+    if (!p || p->stage_count == 0) {
+        return FX_PIPE_INVALID_PARAM;
+    }
+    if (p->running) {
+        return FX_PIPE_BUSY;
+    }
+    if (fx_pipeline_failed_stage(p) >= 0) {
+        return FX_PIPE_STAGE_FAILED;
+    }
+
+    /* Last stage first, so each frame advances one stage per step and
+     * downstream room is made before upstream needs it */
+    bool ran = false;
+    for (uint16_t s = p->stage_count; s-- > 0;) {
+        const int r = stage_once(p, s);
+        if (r < 0) {
+            return FX_PIPE_STAGE_FAILED;
+        }
+        ran = ran || (r > 0);
+    }
+    return ran ? FX_PIPE_OK : FX_PIPE_IDLE;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Stage threads
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+#if defined(CI_HAVE_THREADS)
+
+/* The handle is stored in the opaque bytes of fx_pipe_stage_t */
+typedef char fx_pipe_thread_fits[(sizeof(pthread_t) <= FX_PIPE_THREAD_HANDLE_SIZE) ? 1 : -1];
+
+static pthread_t* stage_thread(fx_pipe_stage_t* st) {
+    return (pthread_t*)(void*)st->thread.bytes;
+}
+
+static void* stage_main(void* arg) {
+    fx_pipe_stage_t* const st = (fx_pipe_stage_t*)arg;
+    fx_pipeline_t* const p = st->owner;
+
+    while (!__atomic_load_n(&p->stop, __ATOMIC_ACQUIRE)) {
+        const int r = stage_once(p, st->index);
+        if (r < 0) {
+            /* A failed frame is never committed. Every stage stops at
+             * its next check, so frames already queued stay in the
+             * rings unprocessed */
+            __atomic_store_n(&p->stop, 1u, __ATOMIC_RELEASE);
+            break;
+        }
+        if (r == 0) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Stop and join stages [0, count).
+ */
+static void join_stages(fx_pipeline_t* p, uint16_t count) {
+    __atomic_store_n(&p->stop, 1u, __ATOMIC_RELEASE);
+    for (uint16_t s = 0; s < count; s++) {
+        pthread_join(*stage_thread(&p->stages[s]), NULL);
+    }
+}
+
+/**
+ * @brief Pin a stage thread to its core, if one was requested.
+ */
+static bool pin_stage(fx_pipe_stage_t* st) {
+    if (st->cpu < 0) {
+        return true;
+    }
+#if defined(__linux__)
+    if (st->cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(st->cpu, &set);
+    return pthread_setaffinity_np(*stage_thread(st), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+fx_pipe_res_t fx_pipeline_start(fx_pipeline_t* p) {
+    if (!p || p->stage_count == 0) {
+        return FX_PIPE_INVALID_PARAM;
+    }
+    if (p->running) {
+        return FX_PIPE_BUSY;
+    }
+
+    __atomic_store_n(&p->stop, 0u, __ATOMIC_RELEASE);
+
+    for (uint16_t s = 0; s < p->stage_count; s++) {
+        fx_pipe_stage_t* const st = &p->stages[s];
+        if (pthread_create(stage_thread(st), NULL, stage_main, st) != 0) {
+            join_stages(p, s);
+            return FX_PIPE_SYSTEM;
+        }
+        if (!pin_stage(st)) {
+            join_stages(p, (uint16_t)(s + 1u));
+            return FX_PIPE_SYSTEM;
+        }
+    }
+
+    p->running = true;
+    return FX_PIPE_OK;
+}
+
+fx_pipe_res_t fx_pipeline_stop(fx_pipeline_t* p) {
+    if (!p) {
+        return FX_PIPE_INVALID_PARAM;
+    }
+    if (p->running) {
+        join_stages(p, p->stage_count);
+        p->running = false;
+    }
+    return fx_pipeline_failed_stage(p) >= 0 ? FX_PIPE_STAGE_FAILED : FX_PIPE_OK;
+}
+
+#else /* !CI_HAVE_THREADS */
+
+fx_pipe_res_t fx_pipeline_start(fx_pipeline_t* p) {
+    if (!p || p->stage_count == 0) {
+        return FX_PIPE_INVALID_PARAM;
+    }
+    return FX_PIPE_UNSUPPORTED;
+}
+
+fx_pipe_res_t fx_pipeline_stop(fx_pipeline_t* p) {
+    if (!p) {
+        return FX_PIPE_INVALID_PARAM;
+    }
+    return fx_pipeline_failed_stage(p) >= 0 ? FX_PIPE_STAGE_FAILED : FX_PIPE_OK;
+}
+
+#endif /* CI_HAVE_THREADS */
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Graph stages
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+bool fx_graph_stage_run(void* ctx, const fixed_t* in, fixed_t* out) {
+    fx_graph_stage_t* const st = (fx_graph_stage_t*)ctx;
+
+    if (!st || !st->graph) {
+        return false;
+    }
+
+    /* Inputs are only read by the graph; the binding table is not const */
+    if (fx_graph_bind(st->graph, st->in, (fixed_t*)(uintptr_t)in) != FX_GRAPH_OK ||
+        fx_graph_bind(st->graph, st->out, out) != FX_GRAPH_OK) {
+        return false;
+    }
+    return fx_graph_run(st->graph, st->arena, st->arena_len) == FX_GRAPH_OK;
+}
@@ -1,11 +1,12 @@
 /**
  * @file pooling.c
  * @project Certifiable Inference Engine
- * @brief Implementation of deterministic max pooling operations.
+ * @brief Implementation of deterministic pooling operations.
  *
  * @details Implements 2×2 max pooling with stride 2 for CNN feature map
- * dimension reduction. Uses only fixed-point arithmetic and deterministic
- * comparisons.
+ * dimension reduction, and general k×k strided max / average pooling and
+ * global average pooling on tensors. Uses only fixed-point arithmetic,
+ * exact 64-bit sums and deterministic comparisons.
  *
  * @traceability SRS-008-POOLING
  * @compliance DO-178C, ISO 26262, IEC 62304, IEC 61508
@@ -16,8 +17,51 @@
  */
 
 #include "pooling.h"
+#include "kernels.h"
+#include "trace.h"
 #include <assert.h>
 
+/**
+ * @brief Precondition validation shared by the 2×2 pooling entry points.
+ */
+static void maxpool_2x2_check(const fx_matrix_t* in, const fx_matrix_t* out) {
+    /*
+     * Precondition Validation (SRS-008.3)
+     *
+     * Assert even dimensions to ensure non-overlapping 2×2 windows.
+     * Odd dimensions would leave partial windows, creating ambiguity.
+     */
+    assert(in != NULL && "Input matrix cannot be NULL");
+    assert(out != NULL && "Output matrix cannot be NULL");
+    assert(in->data != NULL && "Input data cannot be NULL");
+    assert(out->data != NULL && "Output data cannot be NULL");
+
+    assert(in->rows % 2 == 0 && "Input rows must be even for 2×2 pooling");
+    assert(in->cols % 2 == 0 && "Input cols must be even for 2×2 pooling");
+
+    assert(out->rows == in->rows / 2 && "Output rows must be half of input");
+    assert(out->cols == in->cols / 2 && "Output cols must be half of input");
+
+    /* Only referenced by assert(), which NDEBUG compiles out */
+    (void)in;
+    (void)out;
+}
+
+void fx_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
+    maxpool_2x2_check(in, out);
+
+    /* SRS-003.10, SRS-003.11: Lane-parallel max over the same 2×2 windows */
+    FX_TRACE_BEGIN(FX_TRACE_MAXPOOL_2X2, in->rows, in->cols, 0);
+    fx_kernels()->maxpool_2x2(in, out);
+    FX_TRACE_END();
+}
+
+void fx_maxpool_2x2_ref(const fx_matrix_t* in, fx_matrix_t* out) {
+    maxpool_2x2_check(in, out);
+
+    fx_scalar_maxpool_2x2(in, out);
+}
+
 /**
  * @brief Deterministic 2×2 Max Pooling with stride 2.
  *
@@ -48,24 +92,7 @@
  * @traceability SRS-008.1, SRS-008.2, SRS-008.3, SRS-008.4,
  *               SRS-008.5, SRS-008.6, SRS-008.7
  */
-void fx_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
-    /*
-     * Precondition Validation (SRS-008.3)
-     *
-     * Assert even dimensions to ensure non-overlapping 2×2 windows.
-     * Odd dimensions would leave partial windows, creating ambiguity.
-     */
-    assert(in != NULL && "Input matrix cannot be NULL");
-    assert(out != NULL && "Output matrix cannot be NULL");
-    assert(in->data != NULL && "Input data cannot be NULL");
-    assert(out->data != NULL && "Output data cannot be NULL");
-
-    assert(in->rows % 2 == 0 && "Input rows must be even for 2×2 pooling");
-    assert(in->cols % 2 == 0 && "Input cols must be even for 2×2 pooling");
-
-    assert(out->rows == in->rows / 2 && "Output rows must be half of input");
-    assert(out->cols == in->cols / 2 && "Output cols must be half of input");
-
+void fx_scalar_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
     /*
      * Pooling Loop (SRS-008.1, SRS-008.6, SRS-008.7)
      *
@@ -77,12 +104,12 @@ void fx_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
      * - Inner loop: Step by 2 through input columns
      * - Each iteration processes one 2×2 window
      */
-    uint16_t out_row = 0;
+    size_t out_row = 0;
 
-    for (uint16_t i = 0; i < in->rows; i += 2) {
-        uint16_t out_col = 0;
+    for (size_t i = 0; i < in->rows; i += 2) {
+        size_t out_col = 0;
 
-        for (uint16_t j = 0; j < in->cols; j += 2) {
+        for (size_t j = 0; j < in->cols; j += 2) {
             /*
              * Extract 2×2 Window (SRS-008.2)
              *
@@ -98,8 +125,8 @@ void fx_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
              * c = [i+1][j  ]
              * d = [i+1][j+1]
              */
-            const uint16_t row1_offset = i * in->cols;
-            const uint16_t row2_offset = (i + 1) * in->cols;
+            const size_t row1_offset = i * in->cols;
+            const size_t row2_offset = (i + 1) * in->cols;
 
             const fixed_t a = in->data[row1_offset + j];
             const fixed_t b = in->data[row1_offset + j + 1];
@@ -167,3 +194,294 @@ void fx_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
      * do not require explicit validation.
      */
 }
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Tensor pooling (SRS-008.8 – SRS-008.12)
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+/**
+ * @brief Element strides of one (batch, channel) plane of a tensor.
+ */
+typedef struct {
+    size_t row;                  /**< Between vertically adjacent samples */
+    size_t col;                  /**< Between horizontally adjacent samples */
+} plane_strides_t;
+
+static plane_strides_t plane_strides(const fx_tensor_t* t) {
+    plane_strides_t s;
+    if (t->layout == FX_LAYOUT_NHWC) {
+        s.row = (size_t)t->w * t->c;
+        s.col = t->c;
+    } else {
+        s.row = t->w;
+        s.col = 1;
+    }
+    return s;
+}
+
+static size_t plane_offset(const fx_tensor_t* t, uint16_t b, uint16_t c) {
+    if (t->layout == FX_LAYOUT_NHWC) {
+        return (size_t)b * t->h * t->w * t->c + c;
+    }
+    return ((size_t)b * t->c + c) * t->h * t->w;
+}
+
+/**
+ * @brief Input range [lo, hi) under output position o, clipped to the input.
+ */
+static void window_span(uint16_t o, uint16_t k, uint16_t stride, uint16_t pad, uint16_t in,
+                        uint16_t* lo, uint16_t* hi) {
+    const int32_t start = (int32_t)o * stride - pad;
+    const int32_t end = start + k;
+    *lo = (uint16_t)(start < 0 ? 0 : start);
+    *hi = (uint16_t)(end > in ? in : end);
+}
+
+/**
+ * @brief ⌊(sum + d/2) / d⌋: round half up, as (acc + FIXED_HALF) >> FIXED_SHIFT.
+ */
+static fixed_t div_round(int64_t sum, int64_t d) {
+    const int64_t num = sum + d / 2;
+    int64_t q = num / d;
+    if ((num % d) != 0 && num < 0) {
+        q--;
+    }
+    return (fixed_t)q;
+}
+
+/**
+ * @brief Shared argument validation; out shape must follow the params.
+ */
+static fx_pool2d_res_t pool2d_check(const fx_tensor_t* in, const fx_pool2d_params_t* p,
+                                    const fx_tensor_t* out) {
+    if (!in || !p || !out || !in->data || !out->data) {
+        return FX_POOL2D_INVALID_PARAM;
+    }
+    if ((p->mode != FX_POOL2D_MAX && p->mode != FX_POOL2D_AVG) ||
+        p->kernel_h == 0 || p->kernel_w == 0 || p->stride_h == 0 || p->stride_w == 0 ||
+        p->pad_h >= p->kernel_h || p->pad_w >= p->kernel_w) {
+        return FX_POOL2D_INVALID_PARAM;
+    }
+
+    const uint16_t oh = fx_pool2d_out_dim(in->h, p->kernel_h, p->stride_h, p->pad_h);
+    const uint16_t ow = fx_pool2d_out_dim(in->w, p->kernel_w, p->stride_w, p->pad_w);
+    if (oh == 0 || ow == 0 || out->n != in->n || out->c != in->c ||
+        out->h != oh || out->w != ow) {
+        return FX_POOL2D_DIM_MISMATCH;
+    }
+    return FX_POOL2D_OK;
+}
+
+/**
+ * @brief 2×2 / stride-2 NCHW planes with even extents: the lane-parallel
+ *        fx_maxpool_2x2() kernel applies as is.
+ */
+static bool pool2d_is_2x2(const fx_tensor_t* in, const fx_pool2d_params_t* p,
+                          const fx_tensor_t* out) {
+    return p->mode == FX_POOL2D_MAX && p->kernel_h == 2 && p->kernel_w == 2 &&
+           p->stride_h == 2 && p->stride_w == 2 && p->pad_h == 0 && p->pad_w == 0 &&
+           in->layout == FX_LAYOUT_NCHW && out->layout == FX_LAYOUT_NCHW &&
+           (in->h % 2) == 0 && (in->w % 2) == 0;
+}
+
+uint16_t fx_pool2d_out_dim(uint16_t in, uint16_t k, uint16_t stride, uint16_t pad) {
+    const uint32_t padded = (uint32_t)in + 2u * pad;
+    if (k == 0 || stride == 0 || padded < k) {
+        return 0;
+    }
+    const uint32_t out = (padded - k) / stride + 1u;
+    return out > UINT16_MAX ? 0 : (uint16_t)out;
+}
+
+size_t fx_pool2d_workspace_size(const fx_tensor_t* in, const fx_pool2d_params_t* params,
+                                const fx_tensor_t* out) {
+    if (!in || !params || !out || params->mode != FX_POOL2D_MAX ||
+        pool2d_is_2x2(in, params, out)) {
+        return 0;
+    }
+    return (size_t)in->h * out->w;
+}
+
+/**
+ * @brief Separable max of one plane: row pass into rows, then column pass.
+ */
+static void maxpool_plane(const fixed_t* src, plane_strides_t ss, uint16_t ih, uint16_t iw,
+                          const fx_pool2d_params_t* p, fixed_t* rows,
+                          fixed_t* dst, plane_strides_t ds, uint16_t oh, uint16_t ow) {
+    /* Row pass: rows[y][x] = max over the kw columns of output column x */
+    for (uint16_t y = 0; y < ih; y++) {
+        const fixed_t* row = src + (size_t)y * ss.row;
+        for (uint16_t x = 0; x < ow; x++) {
+            uint16_t lo, hi;
+            window_span(x, p->kernel_w, p->stride_w, p->pad_w, iw, &lo, &hi);
+            fixed_t m = row[(size_t)lo * ss.col];
+            for (uint16_t j = (uint16_t)(lo + 1u); j < hi; j++) {
+                const fixed_t v = row[(size_t)j * ss.col];
+                if (v > m) {
+                    m = v;
+                }
+            }
+            rows[(size_t)y * ow + x] = m;
+        }
+    }
+
+    /* Column pass: max over the kh row results of output row y */
+    for (uint16_t y = 0; y < oh; y++) {
+        uint16_t lo, hi;
+        window_span(y, p->kernel_h, p->stride_h, p->pad_h, ih, &lo, &hi);
+        fixed_t* orow = dst + (size_t)y * ds.row;
+        for (uint16_t x = 0; x < ow; x++) {
+            fixed_t m = rows[(size_t)lo * ow + x];
+            for (uint16_t i = (uint16_t)(lo + 1u); i < hi; i++) {
+                const fixed_t v = rows[(size_t)i * ow + x];
+                if (v > m) {
+                    m = v;
+                }
+            }
+            orow[(size_t)x * ds.col] = m;
+        }
+    }
+}
+
+/**
+ * @brief Direct window scan of one plane (average pooling and the reference).
+ */
+static void scan_plane(const fixed_t* src, plane_strides_t ss, uint16_t ih, uint16_t iw,
+                       const fx_pool2d_params_t* p,
+                       fixed_t* dst, plane_strides_t ds, uint16_t oh, uint16_t ow) {
+    for (uint16_t y = 0; y < oh; y++) {
+        uint16_t ylo, yhi;
+        window_span(y, p->kernel_h, p->stride_h, p->pad_h, ih, &ylo, &yhi);
+
+        for (uint16_t x = 0; x < ow; x++) {
+            uint16_t xlo, xhi;
+            window_span(x, p->kernel_w, p->stride_w, p->pad_w, iw, &xlo, &xhi);
+
+            fixed_t m = src[(size_t)ylo * ss.row + (size_t)xlo * ss.col];
+            int64_t sum = 0;
+            for (uint16_t i = ylo; i < yhi; i++) {
+                for (uint16_t j = xlo; j < xhi; j++) {
+                    const fixed_t v = src[(size_t)i * ss.row + (size_t)j * ss.col];
+                    if (v > m) {
+                        m = v;
+                    }
+                    sum += v;
+                }
+            }
+
+            if (p->mode == FX_POOL2D_AVG) {
+                const int64_t d = p->count_pad
+                    ? (int64_t)p->kernel_h * p->kernel_w
+                    : (int64_t)(yhi - ylo) * (xhi - xlo);
+                m = div_round(sum, d);
+            }
+            dst[(size_t)y * ds.row + (size_t)x * ds.col] = m;
+        }
+    }
+}
+
+fx_pool2d_res_t fx_pool2d(const fx_tensor_t* in, const fx_pool2d_params_t* params,
+                          fixed_t* workspace, size_t workspace_len, fx_tensor_t* out) {
+    fx_pool2d_res_t res = pool2d_check(in, params, out);
+    if (res != FX_POOL2D_OK) {
+        return res;
+    }
+
+    const size_t need = fx_pool2d_workspace_size(in, params, out);
+    if (need > 0 && (!workspace || workspace_len < need)) {
+        return FX_POOL2D_WORKSPACE_TOO_SMALL;
+    }
+
+    const plane_strides_t ss = plane_strides(in);
+    const plane_strides_t ds = plane_strides(out);
+    const bool two_by_two = pool2d_is_2x2(in, params, out);
+    const fx_kernel_table_t* kernels = two_by_two ? fx_kernels() : NULL;
+
+    FX_TRACE_BEGIN(FX_TRACE_POOL2D, out->c, out->h, out->w);
+    for (uint16_t b = 0; b < in->n; b++) {
+        for (uint16_t c = 0; c < in->c; c++) {
+            const fixed_t* src = in->data + plane_offset(in, b, c);
+            fixed_t* dst = out->data + plane_offset(out, b, c);
+
+            if (two_by_two) {
+                /* SRS-003.10: same windows as the fx_maxpool_2x2() kernel */
+                fx_matrix_t a, o;
+                fx_matrix_attach(&a, (fixed_t*)(uintptr_t)src, in->h, in->w);
+                fx_matrix_attach(&o, dst, out->h, out->w);
+                kernels->maxpool_2x2(&a, &o);
+            } else if (params->mode == FX_POOL2D_MAX) {
+                maxpool_plane(src, ss, in->h, in->w, params, workspace,
+                              dst, ds, out->h, out->w);
+            } else {
+                scan_plane(src, ss, in->h, in->w, params, dst, ds, out->h, out->w);
+            }
+        }
+    }
+    FX_TRACE_END();
+    return FX_POOL2D_OK;
+}
+
+fx_pool2d_res_t fx_pool2d_ref(const fx_tensor_t* in, const fx_pool2d_params_t* params,
+                              fx_tensor_t* out) {
+    fx_pool2d_res_t res = pool2d_check(in, params, out);
+    if (res != FX_POOL2D_OK) {
+        return res;
+    }
+
+    const plane_strides_t ss = plane_strides(in);
+    const plane_strides_t ds = plane_strides(out);
+
+    for (uint16_t b = 0; b < in->n; b++) {
+        for (uint16_t c = 0; c < in->c; c++) {
+            scan_plane(in->data + plane_offset(in, b, c), ss, in->h, in->w, params,
+                       out->data + plane_offset(out, b, c), ds, out->h, out->w);
+        }
+    }
+    return FX_POOL2D_OK;
+}
+
+fx_pool2d_res_t fx_global_avgpool(const fx_tensor_t* in, fx_matrix_t* out) {
+    if (!in || !out || !in->data || !out->data || in->h == 0 || in->w == 0) {
+        return FX_POOL2D_INVALID_PARAM;
+    }
+    if (out->rows != in->n || out->cols != in->c) {
+        return FX_POOL2D_DIM_MISMATCH;
+    }
+
+    const size_t hw = (size_t)in->h * in->w;
+
+    FX_TRACE_BEGIN(FX_TRACE_GLOBAL_AVGPOOL, in->n, in->c, hw);
+    for (uint16_t b = 0; b < in->n; b++) {
+        fixed_t* orow = out->data + (size_t)b * out->cols;
+
+        if (in->layout == FX_LAYOUT_NHWC) {
+            /* One pass over the pixels per block of channels */
+            const fixed_t* base = in->data + (size_t)b * hw * in->c;
+            for (uint32_t c0 = 0; c0 < in->c; c0 += FX_POOL2D_CH_BLOCK) {
+                const uint32_t cn = (in->c - c0) < FX_POOL2D_CH_BLOCK
+                                    ? (in->c - c0) : FX_POOL2D_CH_BLOCK;
+                int64_t acc[FX_POOL2D_CH_BLOCK] = { 0 };
+                for (size_t px = 0; px < hw; px++) {
+                    const fixed_t* v = base + px * in->c + c0;
+                    for (uint32_t k = 0; k < cn; k++) {
+                        acc[k] += v[k];
+                    }
+                }
+                for (uint32_t k = 0; k < cn; k++) {
+                    orow[c0 + k] = div_round(acc[k], (int64_t)hw);
+                }
+            }
+        } else {
+            for (uint16_t c = 0; c < in->c; c++) {
+                const fixed_t* v = in->data + ((size_t)b * in->c + c) * hw;
+                int64_t acc = 0;
+                for (size_t px = 0; px < hw; px++) {
+                    acc += v[px];
+                }
+                orow[c] = div_round(acc, (int64_t)hw);
+            }
+        }
+    }
+    FX_TRACE_END();
+    return FX_POOL2D_OK;
+}
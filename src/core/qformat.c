@@ -0,0 +1,70 @@
+/**
+ * @file qformat.c
+ * @project Certifiable Inference Engine
+ * @brief Kernels of the library Q-formats and buffer rescaling.
+ *
+ * @traceability SRS-012-QFORMAT
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "qformat.h"
+
+FX_QFORMAT_DEFINE(fx_q16_16, int32_t, 16, INT32_MIN, INT32_MAX);
+FX_QFORMAT_DEFINE(fx_q8_24, int32_t, 24, INT32_MIN, INT32_MAX);
+FX_QFORMAT_DEFINE(fx_q24_8, int32_t, 8, INT32_MIN, INT32_MAX);
+FX_QFORMAT_DEFINE(fx_q8_8, int16_t, 8, INT16_MIN, INT16_MAX);
+FX_QFORMAT_DEFINE(fx_q1_15, int16_t, 15, INT16_MIN, INT16_MAX);
+
+FX_QGEMM_DEFINE(fx_matrix_mul_q16_16_q1_15, fx_q16_16_t, 16, fx_q1_15_t, 15, fx_q16_16_t, 16,
+                INT32_MIN, INT32_MAX);
+
+bool fx_qformat_valid(fx_qformat_t fmt) {
+    return (fmt.bits == 8 || fmt.bits == 16 || fmt.bits == 32) && fmt.frac < fmt.bits;
+}
+
+int32_t fx_qformat_convert(int32_t v, fx_qformat_t from, fx_qformat_t to) {
+    if (!fx_qformat_valid(from) || !fx_qformat_valid(to)) {
+        return 0;
+    }
+
+    const int64_t hi = (to.bits == 32) ? INT32_MAX : ((int64_t)1 << (to.bits - 1)) - 1;
+    const int64_t r = fx_qround(v, (int)from.frac - (int)to.frac);
+
+    return (int32_t)fx_qsat(r, -hi - 1, hi);
+}
+
+static int32_t load_elem(const void* buf, uint8_t bits, size_t i) {
+    if (bits == 8) {
+        return ((const int8_t*)buf)[i];
+    }
+    if (bits == 16) {
+        return ((const int16_t*)buf)[i];
+    }
+    return ((const int32_t*)buf)[i];
+}
+
+static void store_elem(void* buf, uint8_t bits, size_t i, int32_t v) {
+    if (bits == 8) {
+        ((int8_t*)buf)[i] = (int8_t)v;
+    } else if (bits == 16) {
+        ((int16_t*)buf)[i] = (int16_t)v;
+    } else {
+        ((int32_t*)buf)[i] = v;
+    }
+}
+
+bool fx_qformat_rescale(const void* in, fx_qformat_t from, void* out, fx_qformat_t to, size_t n) {
+    if (!in || !out || !fx_qformat_valid(from) || !fx_qformat_valid(to)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        store_elem(out, to.bits, i, fx_qformat_convert(load_elem(in, from.bits, i), from, to));
+    }
+    return true;
+}
@@ -0,0 +1,488 @@
+/**
+ * @file quantized.c
+ * @project Certifiable Inference Engine
+ * @brief Int8 / int16 quantized layers and integer requantization.
+ *
+ * @details Int8 layers centre the activations (x − z_in, |·| ≤ 255) into
+ * a small int16 buffer and reduce against the int8 weights through the
+ * dispatched kernels (fx_kernel_table_t.q8_dot / q8_gemm_row), with exact
+ * int32 accumulation. Int16 layers accumulate in int64 with scalar code.
+ * Every output then goes through the same epilogue: bias, fx_requantize(),
+ * activation, output zero point, saturation.
+ *
+ * @traceability SRS-011-QUANTIZED
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "quantized.h"
+#include "kernels.h"
+#include "trace.h"
+
+/** Output columns (matmul) or filters (conv) per int8 accumulator block */
+#define Q_OUT_BLOCK 64
+
+/** Reduction rows per int16 weight chunk (Q16_KC × 64 × 2 bytes = 32 KiB) */
+#define Q16_KC 256
+
+int32_t fx_requantize(int64_t acc, fx_requant_t rq) {
+    if (rq.multiplier < 0 || rq.shift < -31 || rq.shift > 31) {
+        return 0;
+    }
+
+    const unsigned s = (unsigned)(31 + rq.shift);
+    const int64_t m = rq.multiplier;
+
+    /* acc · M as H · 2^32 + L, exact: acc = hi · 2^32 + lo with lo unsigned */
+    const int64_t hi = acc >> 32;
+    const uint64_t lo = (uint64_t)acc & 0xFFFFFFFFu;
+    uint64_t p_lo = lo * (uint64_t)m;
+    if (s > 0) {
+        p_lo += (uint64_t)1 << (s - 1);
+    }
+    const int64_t H = hi * m + (int64_t)(p_lo >> 32);
+    const uint64_t L = p_lo & 0xFFFFFFFFu;
+
+    /* floor((H · 2^32 + L) / 2^s) */
+    int64_t r;
+    if (s >= 32) {
+        r = H >> (s - 32);
+    } else if (H >= ((int64_t)1 << 31)) {
+        r = INT32_MAX;
+    } else if (H < -((int64_t)1 << 31)) {
+        r = INT32_MIN;
+    } else {
+        r = H * ((int64_t)1 << (32 - s)) + (int64_t)(L >> s);
+    }
+
+    if (r > INT32_MAX) {
+        return INT32_MAX;
+    }
+    if (r < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)r;
+}
+
+static inline int32_t clamp_i32(int64_t v, int32_t lo, int32_t hi) {
+    return (v < lo) ? lo : (v > hi) ? hi : (int32_t)v;
+}
+
+/**
+ * @brief Bias, rescale, activation, output zero point, saturation.
+ */
+static inline int32_t q_finish(int64_t acc, const fx_qparams_t* qp, size_t o,
+                               int32_t qmin, int32_t qmax) {
+    if (qp->bias) {
+        acc += qp->bias[o];
+    }
+    int32_t v = fx_requantize(acc, qp->scale[qp->per_channel ? o : 0]);
+    v = fx_activate(v, qp->act, qp->alpha);
+    return clamp_i32((int64_t)v + qp->out_zero, qmin, qmax);
+}
+
+static bool qparams_valid(const fx_qparams_t* qp, int32_t qmin, int32_t qmax) {
+    /* The table activations are defined on Q16.16, not on a quantized code */
+    return qp && qp->scale && qp->act <= FX_ACT_LEAKY_RELU &&
+           qp->in_zero >= qmin && qp->in_zero <= qmax &&
+           qp->out_zero >= qmin && qp->out_zero <= qmax;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Scalar reference kernels                                                 */
+/* ------------------------------------------------------------------------ */
+
+int32_t fx_scalar_q8_dot(const int16_t* a, const int8_t* b, size_t len) {
+    int32_t acc = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        acc += (int32_t)a[i] * b[i];
+    }
+    return acc;
+}
+
+void fx_scalar_q8_gemm_row(size_t kc, const int16_t* a, const int8_t* b, size_t ldb,
+                           size_t nb, int32_t* acc) {
+    for (size_t k = 0; k < kc; k++) {
+        const int32_t av = a[k];
+        const int8_t* row = b + k * ldb;
+
+        for (size_t j = 0; j < nb; j++) {
+            acc[j] += av * row[j];
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------ */
+/* Conversion                                                               */
+/* ------------------------------------------------------------------------ */
+
+void fx_q8_quantize(const fixed_t* in, size_t n, fx_requant_t rq, int32_t zero, int8_t* out) {
+    if (!in || !out) {
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (int8_t)clamp_i32((int64_t)fx_requantize(in[i], rq) + zero, INT8_MIN, INT8_MAX);
+    }
+}
+
+void fx_q16_quantize(const fixed_t* in, size_t n, fx_requant_t rq, int32_t zero, int16_t* out) {
+    if (!in || !out) {
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (int16_t)clamp_i32((int64_t)fx_requantize(in[i], rq) + zero, INT16_MIN, INT16_MAX);
+    }
+}
+
+void fx_q8_dequantize(const int8_t* in, size_t n, fx_requant_t rq, int32_t zero, fixed_t* out) {
+    if (!in || !out) {
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        out[i] = fx_requantize((int64_t)in[i] - zero, rq);
+    }
+}
+
+void fx_q16_dequantize(const int16_t* in, size_t n, fx_requant_t rq, int32_t zero, fixed_t* out) {
+    if (!in || !out) {
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        out[i] = fx_requantize((int64_t)in[i] - zero, rq);
+    }
+}
+
+/* ------------------------------------------------------------------------ */
+/* Matrix multiplication                                                    */
+/* ------------------------------------------------------------------------ */
+
+void fx_q8_matrix_mul(const fx_q8_matrix_t* A, const fx_q8_matrix_t* B,
+                      const fx_qparams_t* qp, fx_q8_matrix_t* C) {
+    if (!A || !B || !C || !A->data || !B->data || !C->data ||
+        !qparams_valid(qp, INT8_MIN, INT8_MAX)) {
+        return;
+    }
+    if (A->cols != B->rows || C->rows != A->rows || C->cols != B->cols) {
+        return;
+    }
+
+    const fx_kernel_table_t* kt = fx_kernels();
+    const size_t M = A->rows, K = A->cols, N = B->cols;
+    int16_t a16[FX_Q8_KC];
+    int32_t acc[FX_Q_BATCH_ROWS][Q_OUT_BLOCK];
+
+    /* SRS-011.5: Each KC × 64 weight chunk is loaded once per block of
+     * FX_Q_BATCH_ROWS rows (batch samples) and reused for all of them */
+    FX_TRACE_BEGIN(FX_TRACE_Q8_MATMUL, M, N, K);
+    for (size_t i0 = 0; i0 < M; i0 += FX_Q_BATCH_ROWS) {
+        const size_t rb = (M - i0 < FX_Q_BATCH_ROWS) ? M - i0 : FX_Q_BATCH_ROWS;
+
+        for (size_t j0 = 0; j0 < N; j0 += Q_OUT_BLOCK) {
+            const size_t nb = (N - j0 < Q_OUT_BLOCK) ? N - j0 : Q_OUT_BLOCK;
+
+            for (size_t r = 0; r < rb; r++) {
+                for (size_t j = 0; j < nb; j++) {
+                    acc[r][j] = 0;
+                }
+            }
+            for (size_t k0 = 0; k0 < K; k0 += FX_Q8_KC) {
+                const size_t kc = (K - k0 < FX_Q8_KC) ? K - k0 : FX_Q8_KC;
+                const int8_t* bchunk = B->data + k0 * N + j0;
+
+                for (size_t r = 0; r < rb; r++) {
+                    const int8_t* arow = A->data + (i0 + r) * K + k0;
+
+                    for (size_t k = 0; k < kc; k++) {
+                        a16[k] = (int16_t)(arow[k] - qp->in_zero);
+                    }
+                    kt->q8_gemm_row(kc, a16, bchunk, N, nb, acc[r]);
+                }
+            }
+            for (size_t r = 0; r < rb; r++) {
+                int8_t* crow = C->data + (i0 + r) * N + j0;
+
+                for (size_t j = 0; j < nb; j++) {
+                    crow[j] = (int8_t)q_finish(acc[r][j], qp, j0 + j, INT8_MIN, INT8_MAX);
+                }
+            }
+        }
+    }
+    FX_TRACE_END();
+}
+
+void fx_q16_matrix_mul(const fx_q16_matrix_t* A, const fx_q16_matrix_t* B,
+                       const fx_qparams_t* qp, fx_q16_matrix_t* C) {
+    if (!A || !B || !C || !A->data || !B->data || !C->data ||
+        !qparams_valid(qp, INT16_MIN, INT16_MAX)) {
+        return;
+    }
+    if (A->cols != B->rows || C->rows != A->rows || C->cols != B->cols) {
+        return;
+    }
+
+    const size_t M = A->rows, K = A->cols, N = B->cols;
+    int64_t acc[FX_Q_BATCH_ROWS][Q_OUT_BLOCK];
+
+    /* SRS-011.5: Weight chunks of Q16_KC × 64 are reused across the rows
+     * of a block; int64 sums are exact, so chunking changes no bits */
+    FX_TRACE_BEGIN(FX_TRACE_Q16_MATMUL, M, N, K);
+    for (size_t i0 = 0; i0 < M; i0 += FX_Q_BATCH_ROWS) {
+        const size_t rb = (M - i0 < FX_Q_BATCH_ROWS) ? M - i0 : FX_Q_BATCH_ROWS;
+
+        for (size_t j0 = 0; j0 < N; j0 += Q_OUT_BLOCK) {
+            const size_t nb = (N - j0 < Q_OUT_BLOCK) ? N - j0 : Q_OUT_BLOCK;
+
+            for (size_t r = 0; r < rb; r++) {
+                for (size_t j = 0; j < nb; j++) {
+                    acc[r][j] = 0;
+                }
+            }
+            for (size_t k0 = 0; k0 < K; k0 += Q16_KC) {
+                const size_t kc = (K - k0 < Q16_KC) ? K - k0 : Q16_KC;
+
+                for (size_t r = 0; r < rb; r++) {
+                    const int16_t* arow = A->data + (i0 + r) * K + k0;
+
+                    for (size_t k = 0; k < kc; k++) {
+                        /* |x − z| ≤ 65535, |w| ≤ 32768: the product fits int32 */
+                        const int32_t av = (int32_t)arow[k] - qp->in_zero;
+                        const int16_t* brow = B->data + (k0 + k) * N + j0;
+
+                        for (size_t j = 0; j < nb; j++) {
+                            acc[r][j] += av * brow[j];
+                        }
+                    }
+                }
+            }
+            for (size_t r = 0; r < rb; r++) {
+                int16_t* crow = C->data + (i0 + r) * N + j0;
+
+                for (size_t j = 0; j < nb; j++) {
+                    crow[j] = (int16_t)q_finish(acc[r][j], qp, j0 + j, INT16_MIN, INT16_MAX);
+                }
+            }
+        }
+    }
+    FX_TRACE_END();
+}
+
+/* ------------------------------------------------------------------------ */
+/* Convolution                                                              */
+/* ------------------------------------------------------------------------ */
+
+typedef struct {
+    size_t n, c, h, w;
+} q_strides_t;
+
+static q_strides_t q_strides(uint16_t c, uint16_t h, uint16_t w, fx_layout_t layout) {
+    q_strides_t s;
+
+    if (layout == FX_LAYOUT_NHWC) {
+        s.c = 1;
+        s.w = c;
+        s.h = (size_t)w * c;
+        s.n = (size_t)h * s.h;
+    } else {
+        s.w = 1;
+        s.h = w;
+        s.c = (size_t)h * w;
+        s.n = (size_t)c * s.c;
+    }
+    return s;
+}
+
+/* Shapes shared by both element types */
+typedef struct {
+    uint16_t n, c, h, w;
+} q_shape_t;
+
+static fx_conv_res_t q_conv_check(q_shape_t in, q_shape_t wt, const fx_conv_params_t* p, q_shape_t out) {
+    if (p->stride_h == 0 || p->stride_w == 0 || p->dilation_h == 0 || p->dilation_w == 0) {
+        return FX_CONV_INVALID_PARAM;
+    }
+    if (wt.c != in.c || out.c != wt.n || out.n != in.n) {
+        return FX_CONV_DIM_MISMATCH;
+    }
+
+    const uint16_t oh = fx_conv2d_out_dim(in.h, wt.h, p->stride_h, p->pad_h, p->dilation_h);
+    const uint16_t ow = fx_conv2d_out_dim(in.w, wt.w, p->stride_w, p->pad_w, p->dilation_w);
+    if (oh == 0 || ow == 0 || out.h != oh || out.w != ow) {
+        return FX_CONV_DIM_MISMATCH;
+    }
+    return FX_CONV_OK;
+}
+
+fx_conv_res_t fx_q8_conv2d(const fx_q8_tensor_t* in, const fx_q8_tensor_t* weights,
+                           const fx_conv_params_t* p, const fx_qparams_t* qp,
+                           fx_q8_tensor_t* out) {
+    if (!in || !weights || !p || !out || !in->data || !weights->data || !out->data ||
+        !qparams_valid(qp, INT8_MIN, INT8_MAX)) {
+        return FX_CONV_INVALID_PARAM;
+    }
+
+    const q_shape_t si_shape = { in->n, in->c, in->h, in->w };
+    const q_shape_t sw_shape = { weights->n, weights->c, weights->h, weights->w };
+    const q_shape_t so_shape = { out->n, out->c, out->h, out->w };
+    fx_conv_res_t res = q_conv_check(si_shape, sw_shape, p, so_shape);
+    if (res != FX_CONV_OK) {
+        return res;
+    }
+
+    /* Filter rows are reduced in their own memory order: (c, i, j) for
+     * OIHW, (i, j, c) for OHWI. A unit is one channel or one tap. */
+    const size_t taps = (size_t)weights->h * weights->w;
+    const size_t K = taps * in->c;
+    const bool ohwi = (weights->layout == FX_LAYOUT_NHWC);
+    const size_t unit_len = ohwi ? in->c : taps;
+    const size_t units = ohwi ? taps : in->c;
+    if (K > FX_Q8_MAX_K || unit_len > FX_Q8_KC) {
+        return FX_CONV_UNSUPPORTED;
+    }
+    const size_t units_per_chunk = FX_Q8_KC / unit_len;
+
+    const fx_kernel_table_t* kt = fx_kernels();
+    const q_strides_t si = q_strides(in->c, in->h, in->w, in->layout);
+    const q_strides_t so = q_strides(out->c, out->h, out->w, out->layout);
+    const int32_t H = in->h, W = in->w;
+    const int32_t z = qp->in_zero;
+    int16_t chunk[FX_Q8_KC];
+    int32_t acc[Q_OUT_BLOCK];
+
+    FX_TRACE_BEGIN(FX_TRACE_Q8_CONV2D, out->c, out->h, out->w);
+    for (size_t b = 0; b < in->n; b++) {
+        const int8_t* src = in->data + b * si.n;
+
+        for (size_t y = 0; y < out->h; y++) {
+            const int32_t iy0 = (int32_t)(y * p->stride_h) - p->pad_h;
+
+            for (size_t x = 0; x < out->w; x++) {
+                const int32_t ix0 = (int32_t)(x * p->stride_w) - p->pad_w;
+
+                for (size_t o0 = 0; o0 < out->c; o0 += Q_OUT_BLOCK) {
+                    const size_t ob = (out->c - o0 < Q_OUT_BLOCK) ? out->c - o0 : Q_OUT_BLOCK;
+
+                    for (size_t f = 0; f < ob; f++) {
+                        acc[f] = 0;
+                    }
+
+                    for (size_t u0 = 0; u0 < units; u0 += units_per_chunk) {
+                        const size_t uc = (units - u0 < units_per_chunk) ? units - u0 : units_per_chunk;
+                        size_t len = 0;
+
+                        /* Centred patch; padding is the real value 0 */
+                        for (size_t u = u0; u < u0 + uc; u++) {
+                            if (ohwi) {
+                                const int32_t iy = iy0 + (int32_t)((u / weights->w) * p->dilation_h);
+                                const int32_t ix = ix0 + (int32_t)((u % weights->w) * p->dilation_w);
+                                const bool inside = iy >= 0 && iy < H && ix >= 0 && ix < W;
+                                const int8_t* px = src + (size_t)(inside ? iy : 0) * si.h
+                                                 + (size_t)(inside ? ix : 0) * si.w;
+
+                                for (size_t c = 0; c < in->c; c++) {
+                                    chunk[len++] = inside ? (int16_t)(px[c * si.c] - z) : 0;
+                                }
+                            } else {
+                                for (size_t i = 0; i < weights->h; i++) {
+                                    const int32_t iy = iy0 + (int32_t)(i * p->dilation_h);
+
+                                    for (size_t j = 0; j < weights->w; j++) {
+                                        const int32_t ix = ix0 + (int32_t)(j * p->dilation_w);
+                                        const bool inside = iy >= 0 && iy < H && ix >= 0 && ix < W;
+
+                                        chunk[len++] = inside
+                                            ? (int16_t)(src[u * si.c + (size_t)iy * si.h + (size_t)ix * si.w] - z)
+                                            : 0;
+                                    }
+                                }
+                            }
+                        }
+
+                        for (size_t f = 0; f < ob; f++) {
+                            const int8_t* wrow = weights->data + (o0 + f) * K + u0 * unit_len;
+                            acc[f] += kt->q8_dot(chunk, wrow, len);
+                        }
+                    }
+
+                    for (size_t f = 0; f < ob; f++) {
+                        out->data[b * so.n + (o0 + f) * so.c + y * so.h + x * so.w] =
+                            (int8_t)q_finish(acc[f], qp, o0 + f, INT8_MIN, INT8_MAX);
+                    }
+                }
+            }
+        }
+    }
+
+    FX_TRACE_END();
+    return FX_CONV_OK;
+}
+
+fx_conv_res_t fx_q16_conv2d(const fx_q16_tensor_t* in, const fx_q16_tensor_t* weights,
+                            const fx_conv_params_t* p, const fx_qparams_t* qp,
+                            fx_q16_tensor_t* out) {
+    if (!in || !weights || !p || !out || !in->data || !weights->data || !out->data ||
+        !qparams_valid(qp, INT16_MIN, INT16_MAX)) {
+        return FX_CONV_INVALID_PARAM;
+    }
+
+    const q_shape_t si_shape = { in->n, in->c, in->h, in->w };
+    const q_shape_t sw_shape = { weights->n, weights->c, weights->h, weights->w };
+    const q_shape_t so_shape = { out->n, out->c, out->h, out->w };
+    fx_conv_res_t res = q_conv_check(si_shape, sw_shape, p, so_shape);
+    if (res != FX_CONV_OK) {
+        return res;
+    }
+
+    const q_strides_t si = q_strides(in->c, in->h, in->w, in->layout);
+    const q_strides_t sk = q_strides(weights->c, weights->h, weights->w, weights->layout);
+    const q_strides_t so = q_strides(out->c, out->h, out->w, out->layout);
+    const int32_t H = in->h, W = in->w;
+
+    FX_TRACE_BEGIN(FX_TRACE_Q16_CONV2D, out->c, out->h, out->w);
+    for (size_t b = 0; b < in->n; b++) {
+        const int16_t* src = in->data + b * si.n;
+
+        for (size_t o = 0; o < out->c; o++) {
+            const int16_t* ker = weights->data + o * sk.n;
+
+            for (size_t y = 0; y < out->h; y++) {
+                const int32_t iy0 = (int32_t)(y * p->stride_h) - p->pad_h;
+
+                for (size_t x = 0; x < out->w; x++) {
+                    const int32_t ix0 = (int32_t)(x * p->stride_w) - p->pad_w;
+                    int64_t acc = 0;
+
+                    for (size_t c = 0; c < in->c; c++) {
+                        for (size_t i = 0; i < weights->h; i++) {
+                            const int32_t iy = iy0 + (int32_t)(i * p->dilation_h);
+                            if (iy < 0 || iy >= H) {
+                                continue;
+                            }
+
+                            for (size_t j = 0; j < weights->w; j++) {
+                                const int32_t ix = ix0 + (int32_t)(j * p->dilation_w);
+                                if (ix < 0 || ix >= W) {
+                                    continue;
+                                }
+
+                                const int32_t v = (int32_t)src[c * si.c + (size_t)iy * si.h + (size_t)ix * si.w]
+                                                - qp->in_zero;
+                                acc += v * ker[c * sk.c + i * sk.h + j * sk.w];
+                            }
+                        }
+                    }
+
+                    out->data[b * so.n + o * so.c + y * so.h + x * so.w] =
+                        (int16_t)q_finish(acc, qp, o, INT16_MIN, INT16_MAX);
+                }
+            }
+        }
+    }
+
+    FX_TRACE_END();
+    return FX_CONV_OK;
+}
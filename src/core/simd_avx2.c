@@ -0,0 +1,484 @@
+/**
+ * @file simd_avx2.c
+ * @project Certifiable Inference Engine
+ * @brief AVX2 integer kernels for the core inference primitives.
+ *
+ * @details Vectorises the scalar reference loops without changing their
+ * arithmetic. Every product is a signed 32×32→64 multiply
+ * (_mm256_mul_epi32), every sum is a 64-bit integer add, and every result
+ * is rounded once with the same FIXED_HALF / FIXED_SHIFT step. Because
+ * integer addition is exact and associative, regrouping the sums across
+ * lanes cannot change a single bit of the output.
+ *
+ * Narrowing note: the scalar code computes (fixed_t)(acc >> FIXED_SHIFT),
+ * i.e. bits [16, 48) of the 64-bit accumulator. A logical 64-bit shift
+ * followed by taking the low 32 bits of each lane selects exactly the same
+ * bits, so AVX2's lack of a 64-bit arithmetic shift is immaterial.
+ *
+ * Compiled with -mavx2 when the AVX2 backend is enabled (CI_SIMD=AUTO or
+ * AVX2) and entered only after fx_dispatch_init() has confirmed AVX2
+ * support on the running CPU.
+ *
+ * @traceability SRS-003.10, SRS-003.11, SRS-018.4
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "kernels.h"
+#include <immintrin.h>
+
+/**
+ * @brief Round four Q32.32 lanes to Q16.16 and pack them into 128 bits.
+ */
+static inline __m128i avx2_round_narrow(__m256i acc) {
+    const __m256i half = _mm256_set1_epi64x(FIXED_HALF);
+    const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+    __m256i v = _mm256_add_epi64(acc, half);
+    v = _mm256_srli_epi64(v, FIXED_SHIFT);
+    v = _mm256_permutevar8x32_epi32(v, even);
+
+    return _mm256_castsi256_si128(v);
+}
+
+/**
+ * @brief Horizontal sum of four 64-bit lanes.
+ */
+static inline int64_t avx2_hsum_epi64(__m256i v) {
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, v);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+static fixed_t fx_avx2_vector_dot(const fixed_t* a, const fixed_t* b, size_t len) {
+    __m256i acc_even = _mm256_setzero_si256();
+    __m256i acc_odd = _mm256_setzero_si256();
+    size_t i = 0;
+
+    /* Eight products per step: even lanes directly, odd lanes after
+     * moving them down into the low half of each 64-bit slot */
+    for (; i + 8 <= len; i += 8) {
+        const __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+        const __m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+
+        acc_even = _mm256_add_epi64(acc_even, _mm256_mul_epi32(va, vb));
+        acc_odd = _mm256_add_epi64(acc_odd,
+            _mm256_mul_epi32(_mm256_srli_epi64(va, 32), _mm256_srli_epi64(vb, 32)));
+    }
+
+    int64_t sum = avx2_hsum_epi64(_mm256_add_epi64(acc_even, acc_odd));
+
+    for (; i < len; i++) {
+        sum += (int64_t)a[i] * b[i];
+    }
+
+    sum += FIXED_HALF;
+    return (fixed_t)(sum >> FIXED_SHIFT);
+}
+
+static void fx_avx2_gemm_4x4(size_t kc, const fixed_t* a, size_t lda,
+                             const fixed_t* panel, int64_t acc[][FX_GEMM_NR]) {
+    const fixed_t* a0 = a;
+    const fixed_t* a1 = a + lda;
+    const fixed_t* a2 = a + 2 * lda;
+    const fixed_t* a3 = a + 3 * lda;
+
+    /* One 256-bit register holds a full NR=4 row of 64-bit accumulators */
+    __m256i c0 = _mm256_loadu_si256((const __m256i*)acc[0]);
+    __m256i c1 = _mm256_loadu_si256((const __m256i*)acc[1]);
+    __m256i c2 = _mm256_loadu_si256((const __m256i*)acc[2]);
+    __m256i c3 = _mm256_loadu_si256((const __m256i*)acc[3]);
+
+    for (size_t k = 0; k < kc; k++) {
+        const __m256i b = _mm256_cvtepi32_epi64(
+            _mm_loadu_si128((const __m128i*)&panel[k * FX_GEMM_NR]));
+
+        c0 = _mm256_add_epi64(c0, _mm256_mul_epi32(_mm256_set1_epi64x(a0[k]), b));
+        c1 = _mm256_add_epi64(c1, _mm256_mul_epi32(_mm256_set1_epi64x(a1[k]), b));
+        c2 = _mm256_add_epi64(c2, _mm256_mul_epi32(_mm256_set1_epi64x(a2[k]), b));
+        c3 = _mm256_add_epi64(c3, _mm256_mul_epi32(_mm256_set1_epi64x(a3[k]), b));
+    }
+
+    _mm256_storeu_si256((__m256i*)acc[0], c0);
+    _mm256_storeu_si256((__m256i*)acc[1], c1);
+    _mm256_storeu_si256((__m256i*)acc[2], c2);
+    _mm256_storeu_si256((__m256i*)acc[3], c3);
+}
+
+/**
+ * @brief Scalar evaluation of one output pixel (column tail).
+ */
+static fixed_t conv2d_pixel(const fx_matrix_t* in, const fx_matrix_t* kernel,
+                            size_t out_row, size_t out_col) {
+    int64_t accumulator = 0;
+
+    for (size_t kr = 0; kr < kernel->rows; kr++) {
+        const fixed_t* src = &in->data[(out_row + kr) * in->cols + out_col];
+        const fixed_t* ker = &kernel->data[kr * kernel->cols];
+
+        for (size_t kc = 0; kc < kernel->cols; kc++) {
+            accumulator += (int64_t)src[kc] * ker[kc];
+        }
+    }
+
+    accumulator += FIXED_HALF;
+    return (fixed_t)(accumulator >> FIXED_SHIFT);
+}
+
+static void fx_avx2_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out) {
+    const size_t in_cols = in->cols;
+    const size_t out_cols = out->cols;
+
+    for (size_t out_row = 0; out_row < out->rows; out_row++) {
+        fixed_t* dst = &out->data[out_row * out_cols];
+        size_t out_col = 0;
+
+        /* Four adjacent output pixels per step: each lane keeps its own
+         * accumulator and sees the kernel taps in reference order */
+        for (; out_col + 4 <= out_cols; out_col += 4) {
+            __m256i acc = _mm256_setzero_si256();
+
+            for (size_t kr = 0; kr < kernel->rows; kr++) {
+                const fixed_t* src = &in->data[(out_row + kr) * in_cols + out_col];
+                const fixed_t* ker = &kernel->data[kr * kernel->cols];
+
+                for (size_t kc = 0; kc < kernel->cols; kc++) {
+                    const __m256i x = _mm256_cvtepi32_epi64(
+                        _mm_loadu_si128((const __m128i*)(src + kc)));
+                    const __m256i w = _mm256_set1_epi64x(ker[kc]);
+
+                    acc = _mm256_add_epi64(acc, _mm256_mul_epi32(x, w));
+                }
+            }
+
+            _mm_storeu_si128((__m128i*)(dst + out_col), avx2_round_narrow(acc));
+        }
+
+        for (; out_col < out_cols; out_col++) {
+            dst[out_col] = conv2d_pixel(in, kernel, out_row, out_col);
+        }
+    }
+}
+
+static void fx_avx2_relu(fixed_t* data, size_t n) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        _mm256_storeu_si256((__m256i*)(data + i), _mm256_max_epi32(v, zero));
+    }
+
+    for (; i < n; i++) {
+        if (data[i] < 0) {
+            data[i] = FIXED_ZERO;
+        }
+    }
+}
+
+static void fx_avx2_leaky_relu(fixed_t* data, size_t n, fixed_t alpha) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i valpha = _mm256_set1_epi64x(alpha);
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+
+        /* fixed_mul(x, alpha) for all eight lanes, as two 4×64-bit halves */
+        const __m256i lo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v));
+        const __m256i hi = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1));
+        const __m128i plo = avx2_round_narrow(_mm256_mul_epi32(lo, valpha));
+        const __m128i phi = avx2_round_narrow(_mm256_mul_epi32(hi, valpha));
+        const __m256i prod = _mm256_inserti128_si256(_mm256_castsi128_si256(plo), phi, 1);
+
+        /* Select the scaled value only where x < 0 */
+        const __m256i neg = _mm256_cmpgt_epi32(zero, v);
+        _mm256_storeu_si256((__m256i*)(data + i), _mm256_blendv_epi8(v, prod, neg));
+    }
+
+    for (; i < n; i++) {
+        if (data[i] < 0) {
+            data[i] = fixed_mul(data[i], alpha);
+        }
+    }
+}
+
+static void fx_avx2_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
+    const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    const size_t in_cols = in->cols;
+    const size_t out_cols = out->cols;
+
+    for (size_t out_row = 0; out_row < out->rows; out_row++) {
+        const fixed_t* row1 = &in->data[(2 * out_row) * in_cols];
+        const fixed_t* row2 = row1 + in_cols;
+        fixed_t* dst = &out->data[out_row * out_cols];
+        size_t j = 0;
+
+        /* Eight input columns → four outputs: vertical max of the row
+         * pair, then max with the horizontally adjacent lane */
+        for (; j + 8 <= in_cols; j += 8) {
+            const __m256i v = _mm256_max_epi32(
+                _mm256_loadu_si256((const __m256i*)(row1 + j)),
+                _mm256_loadu_si256((const __m256i*)(row2 + j)));
+            const __m256i pair = _mm256_max_epi32(
+                v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+            const __m256i packed = _mm256_permutevar8x32_epi32(pair, even);
+
+            _mm_storeu_si128((__m128i*)(dst + j / 2), _mm256_castsi256_si128(packed));
+        }
+
+        for (; j < in_cols; j += 2) {
+            fixed_t max_val = row1[j];
+
+            if (row1[j + 1] > max_val) {
+                max_val = row1[j + 1];
+            }
+            if (row2[j] > max_val) {
+                max_val = row2[j];
+            }
+            if (row2[j + 1] > max_val) {
+                max_val = row2[j + 1];
+            }
+
+            dst[j / 2] = max_val;
+        }
+    }
+}
+
+/**
+ * @brief Horizontal sum of eight 32-bit lanes.
+ */
+static inline int32_t avx2_hsum_epi32(__m256i v) {
+    __m128i x = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+    x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(x);
+}
+
+static int32_t fx_avx2_q8_dot(const int16_t* a, const int8_t* b, size_t len) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+
+    /* Sixteen products per step: widen int8 to int16, then pairwise
+     * multiply-add into eight exact int32 lanes */
+    for (; i + 16 <= len; i += 16) {
+        const __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+        const __m256i vb = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)(b + i)));
+
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(va, vb));
+    }
+
+    int32_t sum = avx2_hsum_epi32(acc);
+
+    for (; i < len; i++) {
+        sum += (int32_t)a[i] * b[i];
+    }
+    return sum;
+}
+
+static void fx_avx2_q8_gemm_row(size_t kc, const int16_t* a, const int8_t* b, size_t ldb,
+                                size_t nb, int32_t* acc) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t j = 0;
+
+    /* Sixteen columns per step. Rows k and k+1 are interleaved bytewise so
+     * that one madd forms a[k]·b[k][j] + a[k+1]·b[k+1][j] per lane. */
+    for (; j + 16 <= nb; j += 16) {
+        __m256i c0 = _mm256_loadu_si256((const __m256i*)(acc + j));
+        __m256i c1 = _mm256_loadu_si256((const __m256i*)(acc + j + 8));
+        size_t k = 0;
+
+        for (; k + 2 <= kc; k += 2) {
+            const __m128i r0 = _mm_loadu_si128((const __m128i*)(b + k * ldb + j));
+            const __m128i r1 = _mm_loadu_si128((const __m128i*)(b + (k + 1) * ldb + j));
+            const __m256i av = _mm256_set1_epi32((int32_t)(((uint32_t)(uint16_t)a[k + 1] << 16) |
+                                                           (uint16_t)a[k]));
+
+            c0 = _mm256_add_epi32(c0, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_unpacklo_epi8(r0, r1)), av));
+            c1 = _mm256_add_epi32(c1, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_unpackhi_epi8(r0, r1)), av));
+        }
+        if (k < kc) {
+            const __m128i r0 = _mm_loadu_si128((const __m128i*)(b + k * ldb + j));
+            const __m256i av = _mm256_set1_epi32((int32_t)(uint16_t)a[k]);
+
+            c0 = _mm256_add_epi32(c0, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_unpacklo_epi8(r0, zero)), av));
+            c1 = _mm256_add_epi32(c1, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_unpackhi_epi8(r0, zero)), av));
+        }
+
+        _mm256_storeu_si256((__m256i*)(acc + j), c0);
+        _mm256_storeu_si256((__m256i*)(acc + j + 8), c1);
+    }
+
+    if (j < nb) {
+        fx_scalar_q8_gemm_row(kc, a, b + j, ldb, nb - j, acc + j);
+    }
+}
+
+static void fx_avx2_scale(fixed_t* data, size_t n, fixed_t k) {
+    const __m256i vk = _mm256_set1_epi64x(k);
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        const __m256i lo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v));
+        const __m256i hi = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1));
+        const __m128i plo = avx2_round_narrow(_mm256_mul_epi32(lo, vk));
+        const __m128i phi = avx2_round_narrow(_mm256_mul_epi32(hi, vk));
+        _mm256_storeu_si256((__m256i*)(data + i),
+                            _mm256_inserti128_si256(_mm256_castsi128_si256(plo), phi, 1));
+    }
+
+    fx_scalar_scale(data + i, n - i, k);
+}
+
+static void fx_avx2_add_sat(fixed_t* data, size_t n, fixed_t k) {
+    const __m256i vk = _mm256_set1_epi32(k);
+    const __m256i vmax = _mm256_set1_epi32(FIXED_MAX);
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        const __m256i s = _mm256_add_epi32(v, vk);
+
+        /* Overflow iff both operands differ in sign from the wrapped sum;
+         * the saturated value is FIXED_MAX or FIXED_MIN by the sign of x */
+        const __m256i ovf = _mm256_srai_epi32(
+            _mm256_and_si256(_mm256_xor_si256(v, s), _mm256_xor_si256(vk, s)), 31);
+        const __m256i sat = _mm256_xor_si256(_mm256_srai_epi32(v, 31), vmax);
+        _mm256_storeu_si256((__m256i*)(data + i), _mm256_blendv_epi8(s, sat, ovf));
+    }
+
+    fx_scalar_add_sat(data + i, n - i, k);
+}
+
+static void fx_avx2_clamp(fixed_t* data, size_t n, fixed_t lo, fixed_t hi) {
+    const __m256i vlo = _mm256_set1_epi32(lo);
+    const __m256i vhi = _mm256_set1_epi32(hi);
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        _mm256_storeu_si256((__m256i*)(data + i),
+                            _mm256_min_epi32(_mm256_max_epi32(v, vlo), vhi));
+    }
+
+    fx_scalar_clamp(data + i, n - i, lo, hi);
+}
+
+static void fx_avx2_convert_u8(const uint8_t* src, size_t n, const fixed_t* scale,
+                               const fixed_t* bias, fixed_t* dst) {
+    const __m256i vmax = _mm256_set1_epi32(FIXED_MAX);
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256i x = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + i)));
+        const __m256i b = _mm256_loadu_si256((const __m256i*)(bias + i));
+        const __m256i v = _mm256_mullo_epi32(x, _mm256_loadu_si256((const __m256i*)(scale + i)));
+        const __m256i s = _mm256_add_epi32(v, b);
+
+        /* Saturating add, as fx_avx2_add_sat() */
+        const __m256i ovf = _mm256_srai_epi32(
+            _mm256_and_si256(_mm256_xor_si256(v, s), _mm256_xor_si256(b, s)), 31);
+        const __m256i sat = _mm256_xor_si256(_mm256_srai_epi32(v, 31), vmax);
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_blendv_epi8(s, sat, ovf));
+    }
+
+    fx_scalar_convert_u8(src + i, n - i, scale + i, bias + i, dst + i);
+}
+
+static void fx_avx2_convert_f32(const uint32_t* src, size_t n, fixed_t* dst) {
+    const __m256i exp_mask = _mm256_set1_epi32(0xFF);
+    const __m256i frac_mask = _mm256_set1_epi32(0x7FFFFF);
+    const __m256i implicit = _mm256_set1_epi32(0x800000);
+    const __m256i abs_mask = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i inf = _mm256_set1_epi32(0x7F800000);
+    const __m256i unit = _mm256_set1_epi32(134);
+    const __m256i sat_exp = _mm256_set1_epi32(141);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i vmax = _mm256_set1_epi32(FIXED_MAX);
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256i u = _mm256_loadu_si256((const __m256i*)(src + i));
+        const __m256i e = _mm256_and_si256(_mm256_srli_epi32(u, 23), exp_mask);
+        const __m256i m = _mm256_or_si256(_mm256_and_si256(u, frac_mask), implicit);
+        const __m256i r = _mm256_sub_epi32(unit, e);
+
+        /* Variable shifts by a count outside [0, 31] give 0, so exactly one
+         * of up / down is non-zero (both equal m when e = 134) and every
+         * right shift of 25 or more correctly rounds to 0 */
+        const __m256i up = _mm256_sllv_epi32(m, _mm256_sub_epi32(e, unit));
+        const __m256i down = _mm256_srlv_epi32(
+            _mm256_add_epi32(m, _mm256_sllv_epi32(one, _mm256_sub_epi32(r, one))), r);
+        const __m256i mag = _mm256_or_si256(up, down);
+
+        const __m256i sign = _mm256_srai_epi32(u, 31);
+        __m256i q = _mm256_sub_epi32(_mm256_xor_si256(mag, sign), sign);
+        q = _mm256_blendv_epi8(q, _mm256_xor_si256(sign, vmax), _mm256_cmpgt_epi32(e, sat_exp));
+        q = _mm256_andnot_si256(_mm256_cmpgt_epi32(_mm256_and_si256(u, abs_mask), inf), q);
+        _mm256_storeu_si256((__m256i*)(dst + i), q);
+    }
+
+    fx_scalar_convert_f32(src + i, n - i, dst + i);
+}
+
+/**
+ * @brief x × k + (b << 16) + FIXED_HALF for four lanes, clamped so that
+ *        bits [16, 48) are the saturated Q16.16 result.
+ */
+static inline __m128i avx2_affine4(__m128i x, __m128i k, __m128i b) {
+    const __m256i half = _mm256_set1_epi64x(FIXED_HALF);
+    const __m256i hi = _mm256_set1_epi64x(INT64_C(0x7FFFFFFFFFFF));
+    const __m256i lo = _mm256_set1_epi64x(-INT64_C(0x800000000000));
+    const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+    __m256i t = _mm256_mul_epi32(_mm256_cvtepi32_epi64(x), _mm256_cvtepi32_epi64(k));
+    t = _mm256_add_epi64(t, _mm256_add_epi64(
+        _mm256_slli_epi64(_mm256_cvtepi32_epi64(b), FIXED_SHIFT), half));
+    t = _mm256_blendv_epi8(t, hi, _mm256_cmpgt_epi64(t, hi));
+    t = _mm256_blendv_epi8(t, lo, _mm256_cmpgt_epi64(lo, t));
+    t = _mm256_permutevar8x32_epi32(_mm256_srli_epi64(t, FIXED_SHIFT), even);
+
+    return _mm256_castsi256_si128(t);
+}
+
+static void fx_avx2_affine(fixed_t* data, size_t n, const fixed_t* scale, const fixed_t* bias) {
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256i x = _mm256_loadu_si256((const __m256i*)(data + i));
+        const __m256i k = _mm256_loadu_si256((const __m256i*)(scale + i));
+        const __m256i b = _mm256_loadu_si256((const __m256i*)(bias + i));
+        const __m128i plo = avx2_affine4(_mm256_castsi256_si128(x), _mm256_castsi256_si128(k),
+                                         _mm256_castsi256_si128(b));
+        const __m128i phi = avx2_affine4(_mm256_extracti128_si256(x, 1),
+                                         _mm256_extracti128_si256(k, 1),
+                                         _mm256_extracti128_si256(b, 1));
+        _mm256_storeu_si256((__m256i*)(data + i),
+                            _mm256_inserti128_si256(_mm256_castsi128_si256(plo), phi, 1));
+    }
+
+    fx_scalar_affine(data + i, n - i, scale + i, bias + i);
+}
+
+const fx_kernel_table_t fx_kernels_avx2 = {
+    FX_BACKEND_AVX2,
+    fx_avx2_vector_dot,
+    fx_avx2_gemm_4x4,
+    fx_avx2_conv2d,
+    fx_avx2_relu,
+    fx_avx2_leaky_relu,
+    fx_avx2_maxpool_2x2,
+    fx_avx2_q8_dot,
+    fx_avx2_q8_gemm_row,
+    fx_avx2_scale,
+    fx_avx2_add_sat,
+    fx_avx2_clamp,
+    fx_avx2_convert_u8,
+    fx_avx2_convert_f32,
+    fx_avx2_affine
+};
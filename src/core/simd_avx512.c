@@ -0,0 +1,411 @@
+/**
+ * @file simd_avx512.c
+ * @project Certifiable Inference Engine
+ * @brief AVX-512F integer kernels for the core inference primitives.
+ *
+ * @details Same arithmetic as the scalar reference and the AVX2 backend,
+ * twice as wide: signed 32×32→64 products (_mm512_mul_epi32), 64-bit
+ * integer sums, one FIXED_HALF / FIXED_SHIFT rounding step per output.
+ * AVX-512F provides a 64-bit arithmetic shift and a truncating 64→32
+ * narrow (_mm512_cvtepi64_epi32), which together reproduce the scalar
+ * (fixed_t)(acc >> FIXED_SHIFT) cast bit for bit.
+ *
+ * Only AVX-512F instructions are used. Compiled with -mavx512f when the
+ * backend is enabled and entered only after fx_dispatch_init() has
+ * confirmed AVX-512F support and OS-enabled ZMM state.
+ *
+ * @traceability SRS-003.10, SRS-003.11, SRS-018.4
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "kernels.h"
+#include <immintrin.h>
+
+/**
+ * @brief Round eight Q32.32 lanes to Q16.16 and narrow to 256 bits.
+ */
+static inline __m256i avx512_round_narrow(__m512i acc) {
+    const __m512i half = _mm512_set1_epi64(FIXED_HALF);
+    return _mm512_cvtepi64_epi32(_mm512_srai_epi64(_mm512_add_epi64(acc, half), FIXED_SHIFT));
+}
+
+static fixed_t fx_avx512_vector_dot(const fixed_t* a, const fixed_t* b, size_t len) {
+    __m512i acc_even = _mm512_setzero_si512();
+    __m512i acc_odd = _mm512_setzero_si512();
+    size_t i = 0;
+
+    /* Sixteen products per step, split into even and odd 32-bit lanes */
+    for (; i + 16 <= len; i += 16) {
+        const __m512i va = _mm512_loadu_si512((const void*)(a + i));
+        const __m512i vb = _mm512_loadu_si512((const void*)(b + i));
+
+        acc_even = _mm512_add_epi64(acc_even, _mm512_mul_epi32(va, vb));
+        acc_odd = _mm512_add_epi64(acc_odd,
+            _mm512_mul_epi32(_mm512_srli_epi64(va, 32), _mm512_srli_epi64(vb, 32)));
+    }
+
+    int64_t sum = _mm512_reduce_add_epi64(_mm512_add_epi64(acc_even, acc_odd));
+
+    for (; i < len; i++) {
+        sum += (int64_t)a[i] * b[i];
+    }
+
+    sum += FIXED_HALF;
+    return (fixed_t)(sum >> FIXED_SHIFT);
+}
+
+static void fx_avx512_gemm_4x4(size_t kc, const fixed_t* a, size_t lda,
+                               const fixed_t* panel, int64_t acc[][FX_GEMM_NR]) {
+    const fixed_t* a0 = a;
+    const fixed_t* a1 = a + lda;
+    const fixed_t* a2 = a + 2 * lda;
+    const fixed_t* a3 = a + 3 * lda;
+
+    /* Accumulator rows are contiguous: one ZMM register holds two rows */
+    __m512i c01 = _mm512_loadu_si512((const void*)acc[0]);
+    __m512i c23 = _mm512_loadu_si512((const void*)acc[2]);
+
+    for (size_t k = 0; k < kc; k++) {
+        const __m512i b = _mm512_broadcast_i64x4(_mm256_cvtepi32_epi64(
+            _mm_loadu_si128((const __m128i*)&panel[k * FX_GEMM_NR])));
+        const __m512i v01 = _mm512_inserti64x4(_mm512_set1_epi64(a0[k]),
+                                               _mm256_set1_epi64x(a1[k]), 1);
+        const __m512i v23 = _mm512_inserti64x4(_mm512_set1_epi64(a2[k]),
+                                               _mm256_set1_epi64x(a3[k]), 1);
+
+        c01 = _mm512_add_epi64(c01, _mm512_mul_epi32(v01, b));
+        c23 = _mm512_add_epi64(c23, _mm512_mul_epi32(v23, b));
+    }
+
+    _mm512_storeu_si512((void*)acc[0], c01);
+    _mm512_storeu_si512((void*)acc[2], c23);
+}
+
+/**
+ * @brief Scalar evaluation of one output pixel (column tail).
+ */
+static fixed_t conv2d_pixel(const fx_matrix_t* in, const fx_matrix_t* kernel,
+                            size_t out_row, size_t out_col) {
+    int64_t accumulator = 0;
+
+    for (size_t kr = 0; kr < kernel->rows; kr++) {
+        const fixed_t* src = &in->data[(out_row + kr) * in->cols + out_col];
+        const fixed_t* ker = &kernel->data[kr * kernel->cols];
+
+        for (size_t kc = 0; kc < kernel->cols; kc++) {
+            accumulator += (int64_t)src[kc] * ker[kc];
+        }
+    }
+
+    accumulator += FIXED_HALF;
+    return (fixed_t)(accumulator >> FIXED_SHIFT);
+}
+
+static void fx_avx512_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out) {
+    const size_t in_cols = in->cols;
+    const size_t out_cols = out->cols;
+
+    for (size_t out_row = 0; out_row < out->rows; out_row++) {
+        fixed_t* dst = &out->data[out_row * out_cols];
+        size_t out_col = 0;
+
+        /* Eight adjacent output pixels per step, one 64-bit lane each */
+        for (; out_col + 8 <= out_cols; out_col += 8) {
+            __m512i acc = _mm512_setzero_si512();
+
+            for (size_t kr = 0; kr < kernel->rows; kr++) {
+                const fixed_t* src = &in->data[(out_row + kr) * in_cols + out_col];
+                const fixed_t* ker = &kernel->data[kr * kernel->cols];
+
+                for (size_t kc = 0; kc < kernel->cols; kc++) {
+                    const __m512i x = _mm512_cvtepi32_epi64(
+                        _mm256_loadu_si256((const __m256i*)(src + kc)));
+                    const __m512i w = _mm512_set1_epi64(ker[kc]);
+
+                    acc = _mm512_add_epi64(acc, _mm512_mul_epi32(x, w));
+                }
+            }
+
+            _mm256_storeu_si256((__m256i*)(dst + out_col), avx512_round_narrow(acc));
+        }
+
+        for (; out_col < out_cols; out_col++) {
+            dst[out_col] = conv2d_pixel(in, kernel, out_row, out_col);
+        }
+    }
+}
+
+static void fx_avx512_relu(fixed_t* data, size_t n) {
+    const __m512i zero = _mm512_setzero_si512();
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        __m512i v = _mm512_loadu_si512((const void*)(data + i));
+        _mm512_storeu_si512((void*)(data + i), _mm512_max_epi32(v, zero));
+    }
+
+    for (; i < n; i++) {
+        if (data[i] < 0) {
+            data[i] = FIXED_ZERO;
+        }
+    }
+}
+
+static void fx_avx512_leaky_relu(fixed_t* data, size_t n, fixed_t alpha) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i valpha = _mm512_set1_epi64(alpha);
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m512i v = _mm512_loadu_si512((const void*)(data + i));
+
+        /* fixed_mul(x, alpha) for all sixteen lanes, as two 8×64-bit halves */
+        const __m512i lo = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(v));
+        const __m512i hi = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1));
+        const __m256i plo = avx512_round_narrow(_mm512_mul_epi32(lo, valpha));
+        const __m256i phi = avx512_round_narrow(_mm512_mul_epi32(hi, valpha));
+        const __m512i prod = _mm512_inserti64x4(_mm512_castsi256_si512(plo), phi, 1);
+
+        /* Select the scaled value only where x < 0 */
+        const __mmask16 neg = _mm512_cmplt_epi32_mask(v, zero);
+        _mm512_storeu_si512((void*)(data + i), _mm512_mask_blend_epi32(neg, v, prod));
+    }
+
+    for (; i < n; i++) {
+        if (data[i] < 0) {
+            data[i] = fixed_mul(data[i], alpha);
+        }
+    }
+}
+
+static void fx_avx512_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
+    const size_t in_cols = in->cols;
+    const size_t out_cols = out->cols;
+
+    for (size_t out_row = 0; out_row < out->rows; out_row++) {
+        const fixed_t* row1 = &in->data[(2 * out_row) * in_cols];
+        const fixed_t* row2 = row1 + in_cols;
+        fixed_t* dst = &out->data[out_row * out_cols];
+        size_t j = 0;
+
+        /* Sixteen input columns → eight outputs: vertical max of the row
+         * pair, max with the adjacent lane, then keep the even lanes */
+        for (; j + 16 <= in_cols; j += 16) {
+            const __m512i v = _mm512_max_epi32(
+                _mm512_loadu_si512((const void*)(row1 + j)),
+                _mm512_loadu_si512((const void*)(row2 + j)));
+            const __m512i pair = _mm512_max_epi32(
+                v, _mm512_shuffle_epi32(v, (_MM_PERM_ENUM)_MM_SHUFFLE(2, 3, 0, 1)));
+
+            _mm256_storeu_si256((__m256i*)(dst + j / 2), _mm512_cvtepi64_epi32(pair));
+        }
+
+        for (; j < in_cols; j += 2) {
+            fixed_t max_val = row1[j];
+
+            if (row1[j + 1] > max_val) {
+                max_val = row1[j + 1];
+            }
+            if (row2[j] > max_val) {
+                max_val = row2[j];
+            }
+            if (row2[j + 1] > max_val) {
+                max_val = row2[j + 1];
+            }
+
+            dst[j / 2] = max_val;
+        }
+    }
+}
+
+static int32_t fx_avx512_q8_dot(const int16_t* a, const int8_t* b, size_t len) {
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+
+    /* Sixteen products per step, both operands widened to int32 */
+    for (; i + 16 <= len; i += 16) {
+        const __m512i va = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)(a + i)));
+        const __m512i vb = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)(b + i)));
+
+        acc = _mm512_add_epi32(acc, _mm512_mullo_epi32(va, vb));
+    }
+
+    int32_t sum = _mm512_reduce_add_epi32(acc);
+
+    for (; i < len; i++) {
+        sum += (int32_t)a[i] * b[i];
+    }
+    return sum;
+}
+
+static void fx_avx512_q8_gemm_row(size_t kc, const int16_t* a, const int8_t* b, size_t ldb,
+                                  size_t nb, int32_t* acc) {
+    size_t j = 0;
+
+    /* Sixteen columns per step, one broadcast a[k] per weight row */
+    for (; j + 16 <= nb; j += 16) {
+        __m512i c = _mm512_loadu_si512((const void*)(acc + j));
+
+        for (size_t k = 0; k < kc; k++) {
+            const __m512i vb = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)(b + k * ldb + j)));
+            c = _mm512_add_epi32(c, _mm512_mullo_epi32(vb, _mm512_set1_epi32(a[k])));
+        }
+
+        _mm512_storeu_si512((void*)(acc + j), c);
+    }
+
+    if (j < nb) {
+        fx_scalar_q8_gemm_row(kc, a, b + j, ldb, nb - j, acc + j);
+    }
+}
+
+static void fx_avx512_scale(fixed_t* data, size_t n, fixed_t k) {
+    const __m512i vk = _mm512_set1_epi64(k);
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m512i v = _mm512_loadu_si512((const void*)(data + i));
+        const __m512i lo = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(v));
+        const __m512i hi = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1));
+        const __m256i plo = avx512_round_narrow(_mm512_mul_epi32(lo, vk));
+        const __m256i phi = avx512_round_narrow(_mm512_mul_epi32(hi, vk));
+        _mm512_storeu_si512((void*)(data + i),
+                            _mm512_inserti64x4(_mm512_castsi256_si512(plo), phi, 1));
+    }
+
+    fx_scalar_scale(data + i, n - i, k);
+}
+
+static void fx_avx512_add_sat(fixed_t* data, size_t n, fixed_t k) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i vk = _mm512_set1_epi32(k);
+    const __m512i vmax = _mm512_set1_epi32(FIXED_MAX);
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m512i v = _mm512_loadu_si512((const void*)(data + i));
+        const __m512i s = _mm512_add_epi32(v, vk);
+
+        /* Overflow iff both operands differ in sign from the wrapped sum */
+        const __mmask16 ovf = _mm512_cmplt_epi32_mask(
+            _mm512_and_si512(_mm512_xor_si512(v, s), _mm512_xor_si512(vk, s)), zero);
+        const __m512i sat = _mm512_xor_si512(_mm512_srai_epi32(v, 31), vmax);
+        _mm512_storeu_si512((void*)(data + i), _mm512_mask_blend_epi32(ovf, s, sat));
+    }
+
+    fx_scalar_add_sat(data + i, n - i, k);
+}
+
+static void fx_avx512_clamp(fixed_t* data, size_t n, fixed_t lo, fixed_t hi) {
+    const __m512i vlo = _mm512_set1_epi32(lo);
+    const __m512i vhi = _mm512_set1_epi32(hi);
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m512i v = _mm512_loadu_si512((const void*)(data + i));
+        _mm512_storeu_si512((void*)(data + i),
+                            _mm512_min_epi32(_mm512_max_epi32(v, vlo), vhi));
+    }
+
+    fx_scalar_clamp(data + i, n - i, lo, hi);
+}
+
+static void fx_avx512_convert_u8(const uint8_t* src, size_t n, const fixed_t* scale,
+                                 const fixed_t* bias, fixed_t* dst) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i vmax = _mm512_set1_epi32(FIXED_MAX);
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m512i x = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(src + i)));
+        const __m512i b = _mm512_loadu_si512((const void*)(bias + i));
+        const __m512i v = _mm512_mullo_epi32(x, _mm512_loadu_si512((const void*)(scale + i)));
+        const __m512i s = _mm512_add_epi32(v, b);
+
+        /* Saturating add, as fx_avx512_add_sat() */
+        const __mmask16 ovf = _mm512_cmplt_epi32_mask(
+            _mm512_and_si512(_mm512_xor_si512(v, s), _mm512_xor_si512(b, s)), zero);
+        const __m512i sat = _mm512_xor_si512(_mm512_srai_epi32(v, 31), vmax);
+        _mm512_storeu_si512((void*)(dst + i), _mm512_mask_blend_epi32(ovf, s, sat));
+    }
+
+    fx_scalar_convert_u8(src + i, n - i, scale + i, bias + i, dst + i);
+}
+
+static void fx_avx512_convert_f32(const uint32_t* src, size_t n, fixed_t* dst) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i exp_mask = _mm512_set1_epi32(0xFF);
+    const __m512i frac_mask = _mm512_set1_epi32(0x7FFFFF);
+    const __m512i implicit = _mm512_set1_epi32(0x800000);
+    const __m512i abs_mask = _mm512_set1_epi32(0x7FFFFFFF);
+    const __m512i inf = _mm512_set1_epi32(0x7F800000);
+    const __m512i unit = _mm512_set1_epi32(134);
+    const __m512i sat_exp = _mm512_set1_epi32(141);
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i vmax = _mm512_set1_epi32(FIXED_MAX);
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m512i u = _mm512_loadu_si512((const void*)(src + i));
+        const __m512i e = _mm512_and_si512(_mm512_srli_epi32(u, 23), exp_mask);
+        const __m512i m = _mm512_or_si512(_mm512_and_si512(u, frac_mask), implicit);
+        const __m512i r = _mm512_sub_epi32(unit, e);
+
+        /* Out-of-range shift counts give 0, as in fx_avx2_convert_f32() */
+        const __m512i up = _mm512_sllv_epi32(m, _mm512_sub_epi32(e, unit));
+        const __m512i down = _mm512_srlv_epi32(
+            _mm512_add_epi32(m, _mm512_sllv_epi32(one, _mm512_sub_epi32(r, one))), r);
+        const __m512i mag = _mm512_or_si512(up, down);
+
+        const __m512i sign = _mm512_srai_epi32(u, 31);
+        __m512i q = _mm512_sub_epi32(_mm512_xor_si512(mag, sign), sign);
+        q = _mm512_mask_blend_epi32(_mm512_cmpgt_epi32_mask(e, sat_exp), q,
+                                    _mm512_xor_si512(sign, vmax));
+        q = _mm512_mask_blend_epi32(
+            _mm512_cmpgt_epi32_mask(_mm512_and_si512(u, abs_mask), inf), q, zero);
+        _mm512_storeu_si512((void*)(dst + i), q);
+    }
+
+    fx_scalar_convert_f32(src + i, n - i, dst + i);
+}
+
+static void fx_avx512_affine(fixed_t* data, size_t n, const fixed_t* scale, const fixed_t* bias) {
+    const __m512i half = _mm512_set1_epi64(FIXED_HALF);
+    size_t i = 0;
+
+    /* Saturating narrow of t >> 16 equals the scalar clamp-then-narrow */
+    for (; i + 8 <= n; i += 8) {
+        const __m512i x = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*)(data + i)));
+        const __m512i k = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*)(scale + i)));
+        const __m512i b = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*)(bias + i)));
+        const __m512i t = _mm512_add_epi64(_mm512_mul_epi32(x, k),
+                                           _mm512_add_epi64(_mm512_slli_epi64(b, FIXED_SHIFT), half));
+        _mm256_storeu_si256((__m256i*)(data + i),
+                            _mm512_cvtsepi64_epi32(_mm512_srai_epi64(t, FIXED_SHIFT)));
+    }
+
+    fx_scalar_affine(data + i, n - i, scale + i, bias + i);
+}
+
+const fx_kernel_table_t fx_kernels_avx512 = {
+    FX_BACKEND_AVX512,
+    fx_avx512_vector_dot,
+    fx_avx512_gemm_4x4,
+    fx_avx512_conv2d,
+    fx_avx512_relu,
+    fx_avx512_leaky_relu,
+    fx_avx512_maxpool_2x2,
+    fx_avx512_q8_dot,
+    fx_avx512_q8_gemm_row,
+    fx_avx512_scale,
+    fx_avx512_add_sat,
+    fx_avx512_clamp,
+    fx_avx512_convert_u8,
+    fx_avx512_convert_f32,
+    fx_avx512_affine
+};
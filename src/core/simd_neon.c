@@ -0,0 +1,409 @@
+/**
+ * @file simd_neon.c
+ * @project Certifiable Inference Engine
+ * @brief NEON integer kernels for the core inference primitives.
+ *
+ * @details Vectorises the scalar reference loops without changing their
+ * arithmetic. Every product is a signed 32×32→64 widening multiply
+ * (vmlal_s32 / vmull_s32), every sum is a 64-bit integer add, and every
+ * result is rounded once with the same FIXED_HALF / FIXED_SHIFT step, then
+ * narrowed by keeping the low 32 bits (vmovn_s64), exactly as the scalar
+ * (fixed_t) cast does.
+ *
+ * Only base ARMv7/AArch64 NEON intrinsics are used so the same file builds
+ * for both 32-bit and 64-bit ECUs. Compiled when the NEON backend is
+ * enabled (CI_SIMD=AUTO on ARM, or NEON) and selected at run time.
+ *
+ * @traceability SRS-003.10, SRS-003.11, SRS-018.4
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "kernels.h"
+#include <arm_neon.h>
+
+/**
+ * @brief Round two Q32.32 lanes to Q16.16 and narrow to 32 bits.
+ */
+static inline int32x2_t neon_round_narrow(int64x2_t acc) {
+    const int64x2_t half = vdupq_n_s64(FIXED_HALF);
+    return vmovn_s64(vshrq_n_s64(vaddq_s64(acc, half), FIXED_SHIFT));
+}
+
+static fixed_t fx_neon_vector_dot(const fixed_t* a, const fixed_t* b, size_t len) {
+    int64x2_t acc_lo = vdupq_n_s64(0);
+    int64x2_t acc_hi = vdupq_n_s64(0);
+    size_t i = 0;
+
+    for (; i + 4 <= len; i += 4) {
+        const int32x4_t va = vld1q_s32(a + i);
+        const int32x4_t vb = vld1q_s32(b + i);
+
+        acc_lo = vmlal_s32(acc_lo, vget_low_s32(va), vget_low_s32(vb));
+        acc_hi = vmlal_s32(acc_hi, vget_high_s32(va), vget_high_s32(vb));
+    }
+
+    const int64x2_t acc = vaddq_s64(acc_lo, acc_hi);
+    int64_t sum = vgetq_lane_s64(acc, 0) + vgetq_lane_s64(acc, 1);
+
+    for (; i < len; i++) {
+        sum += (int64_t)a[i] * b[i];
+    }
+
+    sum += FIXED_HALF;
+    return (fixed_t)(sum >> FIXED_SHIFT);
+}
+
+static void fx_neon_gemm_4x4(size_t kc, const fixed_t* a, size_t lda,
+                             const fixed_t* panel, int64_t acc[][FX_GEMM_NR]) {
+    const fixed_t* a0 = a;
+    const fixed_t* a1 = a + lda;
+    const fixed_t* a2 = a + 2 * lda;
+    const fixed_t* a3 = a + 3 * lda;
+
+    /* Each NR=4 accumulator row occupies two int64x2 registers */
+    int64x2_t c0l = vld1q_s64(&acc[0][0]), c0h = vld1q_s64(&acc[0][2]);
+    int64x2_t c1l = vld1q_s64(&acc[1][0]), c1h = vld1q_s64(&acc[1][2]);
+    int64x2_t c2l = vld1q_s64(&acc[2][0]), c2h = vld1q_s64(&acc[2][2]);
+    int64x2_t c3l = vld1q_s64(&acc[3][0]), c3h = vld1q_s64(&acc[3][2]);
+
+    for (size_t k = 0; k < kc; k++) {
+        const int32x4_t b = vld1q_s32(&panel[k * FX_GEMM_NR]);
+        const int32x2_t bl = vget_low_s32(b);
+        const int32x2_t bh = vget_high_s32(b);
+        int32x2_t v;
+
+        v = vdup_n_s32(a0[k]);
+        c0l = vmlal_s32(c0l, v, bl);
+        c0h = vmlal_s32(c0h, v, bh);
+
+        v = vdup_n_s32(a1[k]);
+        c1l = vmlal_s32(c1l, v, bl);
+        c1h = vmlal_s32(c1h, v, bh);
+
+        v = vdup_n_s32(a2[k]);
+        c2l = vmlal_s32(c2l, v, bl);
+        c2h = vmlal_s32(c2h, v, bh);
+
+        v = vdup_n_s32(a3[k]);
+        c3l = vmlal_s32(c3l, v, bl);
+        c3h = vmlal_s32(c3h, v, bh);
+    }
+
+    vst1q_s64(&acc[0][0], c0l); vst1q_s64(&acc[0][2], c0h);
+    vst1q_s64(&acc[1][0], c1l); vst1q_s64(&acc[1][2], c1h);
+    vst1q_s64(&acc[2][0], c2l); vst1q_s64(&acc[2][2], c2h);
+    vst1q_s64(&acc[3][0], c3l); vst1q_s64(&acc[3][2], c3h);
+}
+
+/**
+ * @brief Scalar evaluation of one output pixel (column tail).
+ */
+static fixed_t conv2d_pixel(const fx_matrix_t* in, const fx_matrix_t* kernel,
+                            size_t out_row, size_t out_col) {
+    int64_t accumulator = 0;
+
+    for (size_t kr = 0; kr < kernel->rows; kr++) {
+        const fixed_t* src = &in->data[(out_row + kr) * in->cols + out_col];
+        const fixed_t* ker = &kernel->data[kr * kernel->cols];
+
+        for (size_t kc = 0; kc < kernel->cols; kc++) {
+            accumulator += (int64_t)src[kc] * ker[kc];
+        }
+    }
+
+    accumulator += FIXED_HALF;
+    return (fixed_t)(accumulator >> FIXED_SHIFT);
+}
+
+static void fx_neon_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out) {
+    const size_t in_cols = in->cols;
+    const size_t out_cols = out->cols;
+
+    for (size_t out_row = 0; out_row < out->rows; out_row++) {
+        fixed_t* dst = &out->data[out_row * out_cols];
+        size_t out_col = 0;
+
+        /* Four adjacent output pixels per step, one 64-bit lane each */
+        for (; out_col + 4 <= out_cols; out_col += 4) {
+            int64x2_t acc_lo = vdupq_n_s64(0);
+            int64x2_t acc_hi = vdupq_n_s64(0);
+
+            for (size_t kr = 0; kr < kernel->rows; kr++) {
+                const fixed_t* src = &in->data[(out_row + kr) * in_cols + out_col];
+                const fixed_t* ker = &kernel->data[kr * kernel->cols];
+
+                for (size_t kc = 0; kc < kernel->cols; kc++) {
+                    const int32x4_t x = vld1q_s32(src + kc);
+                    const int32x2_t w = vdup_n_s32(ker[kc]);
+
+                    acc_lo = vmlal_s32(acc_lo, vget_low_s32(x), w);
+                    acc_hi = vmlal_s32(acc_hi, vget_high_s32(x), w);
+                }
+            }
+
+            vst1q_s32(dst + out_col,
+                      vcombine_s32(neon_round_narrow(acc_lo), neon_round_narrow(acc_hi)));
+        }
+
+        for (; out_col < out_cols; out_col++) {
+            dst[out_col] = conv2d_pixel(in, kernel, out_row, out_col);
+        }
+    }
+}
+
+static void fx_neon_relu(fixed_t* data, size_t n) {
+    const int32x4_t zero = vdupq_n_s32(0);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_s32(data + i, vmaxq_s32(vld1q_s32(data + i), zero));
+    }
+
+    for (; i < n; i++) {
+        if (data[i] < 0) {
+            data[i] = FIXED_ZERO;
+        }
+    }
+}
+
+static void fx_neon_leaky_relu(fixed_t* data, size_t n, fixed_t alpha) {
+    const int32x4_t zero = vdupq_n_s32(0);
+    const int32x2_t valpha = vdup_n_s32(alpha);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const int32x4_t v = vld1q_s32(data + i);
+
+        /* fixed_mul(x, alpha) on all four lanes */
+        const int32x2_t plo = neon_round_narrow(vmull_s32(vget_low_s32(v), valpha));
+        const int32x2_t phi = neon_round_narrow(vmull_s32(vget_high_s32(v), valpha));
+        const int32x4_t prod = vcombine_s32(plo, phi);
+
+        /* Select the scaled value only where x < 0 */
+        const uint32x4_t neg = vcltq_s32(v, zero);
+        vst1q_s32(data + i, vbslq_s32(neg, prod, v));
+    }
+
+    for (; i < n; i++) {
+        if (data[i] < 0) {
+            data[i] = fixed_mul(data[i], alpha);
+        }
+    }
+}
+
+static void fx_neon_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
+    const size_t in_cols = in->cols;
+    const size_t out_cols = out->cols;
+
+    for (size_t out_row = 0; out_row < out->rows; out_row++) {
+        const fixed_t* row1 = &in->data[(2 * out_row) * in_cols];
+        const fixed_t* row2 = row1 + in_cols;
+        fixed_t* dst = &out->data[out_row * out_cols];
+        size_t j = 0;
+
+        /* Four input columns → two outputs: vertical max of the row pair,
+         * then pairwise max of horizontally adjacent lanes */
+        for (; j + 4 <= in_cols; j += 4) {
+            const int32x4_t v = vmaxq_s32(vld1q_s32(row1 + j), vld1q_s32(row2 + j));
+            vst1_s32(dst + j / 2, vpmax_s32(vget_low_s32(v), vget_high_s32(v)));
+        }
+
+        for (; j < in_cols; j += 2) {
+            fixed_t max_val = row1[j];
+
+            if (row1[j + 1] > max_val) {
+                max_val = row1[j + 1];
+            }
+            if (row2[j] > max_val) {
+                max_val = row2[j];
+            }
+            if (row2[j + 1] > max_val) {
+                max_val = row2[j + 1];
+            }
+
+            dst[j / 2] = max_val;
+        }
+    }
+}
+
+static int32_t fx_neon_q8_dot(const int16_t* a, const int8_t* b, size_t len) {
+    int32x4_t acc_lo = vdupq_n_s32(0);
+    int32x4_t acc_hi = vdupq_n_s32(0);
+    size_t i = 0;
+
+    /* Eight products per step: widen int8 to int16, 16×16→32 multiply-add */
+    for (; i + 8 <= len; i += 8) {
+        const int16x8_t va = vld1q_s16(a + i);
+        const int16x8_t vb = vmovl_s8(vld1_s8(b + i));
+
+        acc_lo = vmlal_s16(acc_lo, vget_low_s16(va), vget_low_s16(vb));
+        acc_hi = vmlal_s16(acc_hi, vget_high_s16(va), vget_high_s16(vb));
+    }
+
+    const int32x4_t acc = vaddq_s32(acc_lo, acc_hi);
+    int32_t sum = vgetq_lane_s32(acc, 0) + vgetq_lane_s32(acc, 1) +
+                  vgetq_lane_s32(acc, 2) + vgetq_lane_s32(acc, 3);
+
+    for (; i < len; i++) {
+        sum += (int32_t)a[i] * b[i];
+    }
+    return sum;
+}
+
+static void fx_neon_q8_gemm_row(size_t kc, const int16_t* a, const int8_t* b, size_t ldb,
+                                size_t nb, int32_t* acc) {
+    size_t j = 0;
+
+    /* Eight columns per step, one broadcast a[k] per weight row */
+    for (; j + 8 <= nb; j += 8) {
+        int32x4_t c0 = vld1q_s32(acc + j);
+        int32x4_t c1 = vld1q_s32(acc + j + 4);
+
+        for (size_t k = 0; k < kc; k++) {
+            const int16x8_t vb = vmovl_s8(vld1_s8(b + k * ldb + j));
+            const int16x4_t av = vdup_n_s16(a[k]);
+
+            c0 = vmlal_s16(c0, vget_low_s16(vb), av);
+            c1 = vmlal_s16(c1, vget_high_s16(vb), av);
+        }
+
+        vst1q_s32(acc + j, c0);
+        vst1q_s32(acc + j + 4, c1);
+    }
+
+    if (j < nb) {
+        fx_scalar_q8_gemm_row(kc, a, b + j, ldb, nb - j, acc + j);
+    }
+}
+
+static void fx_neon_scale(fixed_t* data, size_t n, fixed_t k) {
+    const int32x2_t vk = vdup_n_s32(k);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const int32x4_t v = vld1q_s32(data + i);
+        const int32x2_t plo = neon_round_narrow(vmull_s32(vget_low_s32(v), vk));
+        const int32x2_t phi = neon_round_narrow(vmull_s32(vget_high_s32(v), vk));
+        vst1q_s32(data + i, vcombine_s32(plo, phi));
+    }
+
+    fx_scalar_scale(data + i, n - i, k);
+}
+
+static void fx_neon_add_sat(fixed_t* data, size_t n, fixed_t k) {
+    const int32x4_t vk = vdupq_n_s32(k);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_s32(data + i, vqaddq_s32(vld1q_s32(data + i), vk));
+    }
+
+    fx_scalar_add_sat(data + i, n - i, k);
+}
+
+static void fx_neon_clamp(fixed_t* data, size_t n, fixed_t lo, fixed_t hi) {
+    const int32x4_t vlo = vdupq_n_s32(lo);
+    const int32x4_t vhi = vdupq_n_s32(hi);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_s32(data + i, vminq_s32(vmaxq_s32(vld1q_s32(data + i), vlo), vhi));
+    }
+
+    fx_scalar_clamp(data + i, n - i, lo, hi);
+}
+
+static void fx_neon_convert_u8(const uint8_t* src, size_t n, const fixed_t* scale,
+                               const fixed_t* bias, fixed_t* dst) {
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const uint16x8_t w = vmovl_u8(vld1_u8(src + i));
+        const int32x4_t x0 = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(w)));
+        const int32x4_t x1 = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(w)));
+        vst1q_s32(dst + i, vqaddq_s32(vmulq_s32(x0, vld1q_s32(scale + i)),
+                                      vld1q_s32(bias + i)));
+        vst1q_s32(dst + i + 4, vqaddq_s32(vmulq_s32(x1, vld1q_s32(scale + i + 4)),
+                                          vld1q_s32(bias + i + 4)));
+    }
+
+    fx_scalar_convert_u8(src + i, n - i, scale + i, bias + i, dst + i);
+}
+
+static void fx_neon_convert_f32(const uint32_t* src, size_t n, fixed_t* dst) {
+    const uint32x4_t exp_mask = vdupq_n_u32(0xFF);
+    const uint32x4_t frac_mask = vdupq_n_u32(0x7FFFFF);
+    const uint32x4_t implicit = vdupq_n_u32(0x800000);
+    const uint32x4_t abs_mask = vdupq_n_u32(0x7FFFFFFF);
+    const uint32x4_t inf = vdupq_n_u32(0x7F800000);
+    const uint32x4_t sat_exp = vdupq_n_u32(141);
+    const int32x4_t unit = vdupq_n_s32(134);
+    const int32x4_t min_shift = vdupq_n_s32(-32);
+    const int32x4_t vmax = vdupq_n_s32(FIXED_MAX);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const uint32x4_t u = vld1q_u32(src + i);
+        const uint32x4_t e = vandq_u32(vshrq_n_u32(u, 23), exp_mask);
+        const uint32x4_t m = vorrq_u32(vandq_u32(u, frac_mask), implicit);
+
+        /* Rounding shift: left by e − 134, or right with + 2^(r−1), which
+         * is the scalar round-half-up of the magnitude; shifts of 32 or
+         * more give 0 */
+        const int32x4_t sh = vmaxq_s32(vsubq_s32(vreinterpretq_s32_u32(e), unit), min_shift);
+        const int32x4_t mag = vreinterpretq_s32_u32(vrshlq_u32(m, sh));
+
+        const int32x4_t sign = vshrq_n_s32(vreinterpretq_s32_u32(u), 31);
+        int32x4_t q = vsubq_s32(veorq_s32(mag, sign), sign);
+        q = vbslq_s32(vcgtq_u32(e, sat_exp), veorq_s32(sign, vmax), q);
+        q = vbicq_s32(q, vreinterpretq_s32_u32(vcgtq_u32(vandq_u32(u, abs_mask), inf)));
+        vst1q_s32(dst + i, q);
+    }
+
+    fx_scalar_convert_f32(src + i, n - i, dst + i);
+}
+
+static void fx_neon_affine(fixed_t* data, size_t n, const fixed_t* scale, const fixed_t* bias) {
+    const int64x2_t half = vdupq_n_s64(FIXED_HALF);
+    size_t i = 0;
+
+    /* vqshrn_n_s64 narrows t >> 16 with saturation, as the scalar clamp */
+    for (; i + 4 <= n; i += 4) {
+        const int32x4_t x = vld1q_s32(data + i);
+        const int32x4_t k = vld1q_s32(scale + i);
+        const int32x4_t b = vld1q_s32(bias + i);
+        const int64x2_t t0 = vmlal_s32(
+            vaddq_s64(vshlq_n_s64(vmovl_s32(vget_low_s32(b)), FIXED_SHIFT), half),
+            vget_low_s32(x), vget_low_s32(k));
+        const int64x2_t t1 = vmlal_s32(
+            vaddq_s64(vshlq_n_s64(vmovl_s32(vget_high_s32(b)), FIXED_SHIFT), half),
+            vget_high_s32(x), vget_high_s32(k));
+        vst1q_s32(data + i, vcombine_s32(vqshrn_n_s64(t0, FIXED_SHIFT),
+                                         vqshrn_n_s64(t1, FIXED_SHIFT)));
+    }
+
+    fx_scalar_affine(data + i, n - i, scale + i, bias + i);
+}
+
+const fx_kernel_table_t fx_kernels_neon = {
+    FX_BACKEND_NEON,
+    fx_neon_vector_dot,
+    fx_neon_gemm_4x4,
+    fx_neon_conv2d,
+    fx_neon_relu,
+    fx_neon_leaky_relu,
+    fx_neon_maxpool_2x2,
+    fx_neon_q8_dot,
+    fx_neon_q8_gemm_row,
+    fx_neon_scale,
+    fx_neon_add_sat,
+    fx_neon_clamp,
+    fx_neon_convert_u8,
+    fx_neon_convert_f32,
+    fx_neon_affine
+};
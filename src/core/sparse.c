@@ -0,0 +1,405 @@
+/**
+ * @file sparse.c
+ * @project Certifiable Inference Engine
+ * @brief Sparse and 2:4 structured-sparse dense and convolution kernels.
+ *
+ * @details Both formats reduce to one primitive: the dot product of a
+ * weight row with a contiguous activation vector, one 64-bit accumulator,
+ * stored products in ascending k. The dense layer takes that vector from
+ * a row of A; the convolution gathers it per output pixel, so padding
+ * taps become zeros as in im2col. Rounding, bias and activation are the
+ * epilogues of fx_matrix_mul_fused() and fx_conv2d_multi().
+ *
+ * @traceability SRS-019
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "sparse.h"
+#include "trace.h"
+#include <stdbool.h>
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Format
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+/**
+ * @brief Position of value s (0 or 1) within a 2:4 group.
+ */
+static inline size_t group_pos(uint8_t meta, unsigned s) {
+    return (size_t)(meta >> (2u * s)) & 3u;
+}
+
+fx_sparse_res_t fx_sparse_check(const fx_sparse_matrix_t* w) {
+    if (!w || w->rows == 0 || w->cols == 0 || !w->values) {
+        return FX_SPARSE_INVALID_PARAM;
+    }
+
+    if (w->format == FX_SPARSE_CSR) {
+        if (!w->col_idx || !w->row_ptr) {
+            return FX_SPARSE_INVALID_PARAM;
+        }
+        if (w->row_ptr[0] != 0) {
+            return FX_SPARSE_CORRUPT;
+        }
+
+        /* SRS-019.1: Offsets non-decreasing, columns ascending and in range */
+        for (size_t n = 0; n < w->rows; n++) {
+            if (w->row_ptr[n + 1] < w->row_ptr[n]) {
+                return FX_SPARSE_CORRUPT;
+            }
+            for (uint32_t p = w->row_ptr[n]; p < w->row_ptr[n + 1]; p++) {
+                if (w->col_idx[p] >= w->cols ||
+                    (p > w->row_ptr[n] && w->col_idx[p] <= w->col_idx[p - 1])) {
+                    return FX_SPARSE_CORRUPT;
+                }
+            }
+        }
+        return FX_SPARSE_OK;
+    }
+
+    if (w->format == FX_SPARSE_2_4) {
+        if (!w->meta) {
+            return FX_SPARSE_INVALID_PARAM;
+        }
+
+        /* SRS-019.2: p0 < p1 < K, or p0 = p1 with a zero second value */
+        const size_t groups = FX_SPARSE_GROUPS(w->cols);
+        for (size_t n = 0; n < w->rows; n++) {
+            for (size_t g = 0; g < groups; g++) {
+                const size_t q = n * groups + g;
+                const size_t p0 = g * FX_SPARSE_GROUP + group_pos(w->meta[q], 0);
+                const size_t p1 = g * FX_SPARSE_GROUP + group_pos(w->meta[q], 1);
+
+                if ((w->meta[q] >> 4) != 0 || p1 >= w->cols || p0 > p1 ||
+                    (p0 == p1 && w->values[q * FX_SPARSE_KEEP + 1] != 0)) {
+                    return FX_SPARSE_CORRUPT;
+                }
+            }
+        }
+        return FX_SPARSE_OK;
+    }
+
+    return FX_SPARSE_INVALID_PARAM;
+}
+
+size_t fx_sparse_values_size(const fixed_t* src, uint16_t rows, uint16_t cols,
+                             size_t row_stride, size_t col_stride, fx_sparse_format_t format) {
+    if (rows == 0 || cols == 0) {
+        return 0;
+    }
+    if (format == FX_SPARSE_2_4) {
+        return (size_t)rows * FX_SPARSE_GROUPS(cols) * FX_SPARSE_KEEP;
+    }
+    if (format != FX_SPARSE_CSR || !src) {
+        return 0;
+    }
+
+    size_t nnz = 0;
+    for (size_t n = 0; n < rows; n++) {
+        for (size_t k = 0; k < cols; k++) {
+            nnz += src[n * row_stride + k * col_stride] != 0 ? 1u : 0u;
+        }
+    }
+    return nnz;
+}
+
+/**
+ * @brief True if no group of four consecutive k holds more than two non-zeros.
+ */
+static bool is_2_4(const fixed_t* src, uint16_t rows, uint16_t cols,
+                   size_t row_stride, size_t col_stride) {
+    for (size_t n = 0; n < rows; n++) {
+        for (size_t k0 = 0; k0 < cols; k0 += FX_SPARSE_GROUP) {
+            const size_t width = (cols - k0 < FX_SPARSE_GROUP) ? cols - k0 : FX_SPARSE_GROUP;
+            size_t nz = 0;
+
+            for (size_t j = 0; j < width; j++) {
+                nz += src[n * row_stride + (k0 + j) * col_stride] != 0 ? 1u : 0u;
+            }
+            if (nz > FX_SPARSE_KEEP) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Fill 2:4 storage from a source that passed is_2_4().
+ */
+static void pack_2_4(const fixed_t* src, uint16_t rows, uint16_t cols,
+                     size_t row_stride, size_t col_stride,
+                     fixed_t* values, uint8_t* meta) {
+    const size_t groups = FX_SPARSE_GROUPS(cols);
+
+    for (size_t n = 0; n < rows; n++) {
+        for (size_t g = 0; g < groups; g++) {
+            const size_t k0 = g * FX_SPARSE_GROUP;
+            const size_t width = (cols - k0 < FX_SPARSE_GROUP) ? cols - k0 : FX_SPARSE_GROUP;
+            unsigned mask = 0;
+            size_t kept = 0;
+
+            for (size_t j = 0; j < width; j++) {
+                if (src[n * row_stride + (k0 + j) * col_stride] != 0) {
+                    mask |= 1u << j;
+                    kept++;
+                }
+            }
+
+            /* Canonical fill: lowest free positions of the group */
+            for (size_t j = 0; j < width && kept < FX_SPARSE_KEEP; j++) {
+                if ((mask & (1u << j)) == 0) {
+                    mask |= 1u << j;
+                    kept++;
+                }
+            }
+
+            /* Lowest and highest chosen; a one-column tail group repeats
+             * its position with a zero second value */
+            size_t pos[FX_SPARSE_KEEP] = { FX_SPARSE_GROUP, 0 };
+            for (size_t j = 0; j < width; j++) {
+                if ((mask & (1u << j)) != 0) {
+                    pos[0] = (j < pos[0]) ? j : pos[0];
+                    pos[1] = j;
+                }
+            }
+
+            const size_t q = n * groups + g;
+            values[q * FX_SPARSE_KEEP] = src[n * row_stride + (k0 + pos[0]) * col_stride];
+            values[q * FX_SPARSE_KEEP + 1] = (pos[1] == pos[0]) ? 0 :
+                                             src[n * row_stride + (k0 + pos[1]) * col_stride];
+            meta[q] = (uint8_t)(pos[0] | (pos[1] << 2));
+        }
+    }
+}
+
+fx_sparse_res_t fx_sparse_pack(const fixed_t* src, uint16_t rows, uint16_t cols,
+                               size_t row_stride, size_t col_stride, fx_sparse_format_t format,
+                               fixed_t* values, size_t values_len, uint16_t* col_idx,
+                               uint32_t* row_ptr, uint8_t* meta, fx_sparse_matrix_t* out) {
+    if (!src || !values || !out || rows == 0 || cols == 0) {
+        return FX_SPARSE_INVALID_PARAM;
+    }
+    if ((format == FX_SPARSE_CSR && (!col_idx || !row_ptr)) ||
+        (format == FX_SPARSE_2_4 && !meta) ||
+        (format != FX_SPARSE_CSR && format != FX_SPARSE_2_4)) {
+        return FX_SPARSE_INVALID_PARAM;
+    }
+
+    /* SRS-019.3: Every check runs before the first write, so a failed
+     * pack leaves the storage untouched */
+    if (values_len < fx_sparse_values_size(src, rows, cols, row_stride, col_stride, format)) {
+        return FX_SPARSE_CAPACITY;
+    }
+    if (format == FX_SPARSE_2_4 && !is_2_4(src, rows, cols, row_stride, col_stride)) {
+        return FX_SPARSE_NOT_2_4;
+    }
+
+    if (format == FX_SPARSE_2_4) {
+        pack_2_4(src, rows, cols, row_stride, col_stride, values, meta);
+    } else {
+        uint32_t p = 0;
+
+        row_ptr[0] = 0;
+        for (size_t n = 0; n < rows; n++) {
+            for (size_t k = 0; k < cols; k++) {
+                const fixed_t v = src[n * row_stride + k * col_stride];
+                if (v != 0) {
+                    values[p] = v;
+                    col_idx[p] = (uint16_t)k;
+                    p++;
+                }
+            }
+            row_ptr[n + 1] = p;
+        }
+    }
+
+    out->format = format;
+    out->rows = rows;
+    out->cols = cols;
+    out->values = values;
+    out->col_idx = (format == FX_SPARSE_CSR) ? col_idx : NULL;
+    out->row_ptr = (format == FX_SPARSE_CSR) ? row_ptr : NULL;
+    out->meta = (format == FX_SPARSE_2_4) ? meta : NULL;
+    return FX_SPARSE_OK;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Kernels
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+/** Activation rows sharing one pass over a weight row */
+#define SPARSE_MR 4
+
+/**
+ * @brief acc[r] = Σ a[r][k] × w[n][k] over the stored weights of row n.
+ *
+ * @details Each stored weight and its position are loaded once for all
+ * mr rows; every accumulator still adds its products in ascending k.
+ * SRS-019.2: the 2:4 loop has a trip count fixed by K and no branch on
+ * the data, two products per group, lower position first.
+ */
+static void sparse_dot(const fx_sparse_matrix_t* w, size_t n, const fixed_t* a, size_t lda,
+                       size_t mr, int64_t acc[SPARSE_MR]) {
+    for (size_t r = 0; r < mr; r++) {
+        acc[r] = 0;
+    }
+
+    if (w->format == FX_SPARSE_2_4) {
+        const size_t groups = FX_SPARSE_GROUPS(w->cols);
+        const fixed_t* v = w->values + n * groups * FX_SPARSE_KEEP;
+        const uint8_t* m = w->meta + n * groups;
+
+        for (size_t g = 0; g < groups; g++) {
+            const size_t p0 = g * FX_SPARSE_GROUP + group_pos(m[g], 0);
+            const size_t p1 = g * FX_SPARSE_GROUP + group_pos(m[g], 1);
+            const int64_t v0 = v[2 * g], v1 = v[2 * g + 1];
+
+            for (size_t r = 0; r < mr; r++) {
+                acc[r] += (int64_t)a[r * lda + p0] * v0;
+                acc[r] += (int64_t)a[r * lda + p1] * v1;
+            }
+        }
+    } else {
+        for (uint32_t p = w->row_ptr[n]; p < w->row_ptr[n + 1]; p++) {
+            const size_t k = w->col_idx[p];
+            const int64_t v = w->values[p];
+
+            for (size_t r = 0; r < mr; r++) {
+                acc[r] += (int64_t)a[r * lda + k] * v;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Round a Q32.32 accumulator (SRS-003.4 / SRS-006.4).
+ */
+static inline fixed_t sparse_round(int64_t acc) {
+    return (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+}
+
+/**
+ * @brief Shared dense-layer body; epilogue only when fused.
+ */
+static fx_sparse_res_t sparse_matmul(const fx_matrix_t* A, const fx_sparse_matrix_t* W,
+                                     const fx_matrix_t* bias, bool fused, fx_activation_t act,
+                                     fixed_t alpha, fx_matrix_t* C) {
+    if (!A || !W || !C || !A->data || !C->data || !W->values) {
+        return FX_SPARSE_INVALID_PARAM;
+    }
+    if (A->cols != W->cols || C->rows != A->rows || C->cols != W->rows) {
+        return FX_SPARSE_DIM_MISMATCH;
+    }
+    if (bias && (!bias->data || bias->rows != 1 || bias->cols != C->cols)) {
+        return FX_SPARSE_DIM_MISMATCH;
+    }
+
+    FX_TRACE_BEGIN(FX_TRACE_SPARSE_MATMUL, A->rows, W->rows, A->cols);
+    for (size_t i = 0; i < A->rows; i += SPARSE_MR) {
+        const size_t mr = (A->rows - i < SPARSE_MR) ? A->rows - i : SPARSE_MR;
+        int64_t acc[SPARSE_MR];
+
+        for (size_t n = 0; n < W->rows; n++) {
+            sparse_dot(W, n, A->data + i * A->cols, A->cols, mr, acc);
+
+            for (size_t r = 0; r < mr; r++) {
+                fixed_t v = sparse_round(acc[r]);
+
+                /* SRS-004.9: Same epilogue order as fx_matrix_mul_fused() */
+                if (fused) {
+                    if (bias) {
+                        v = fixed_add(v, bias->data[n]);
+                    }
+                    v = fx_activate(v, act, alpha);
+                }
+                C->data[(i + r) * C->cols + n] = v;
+            }
+        }
+    }
+    FX_TRACE_END();
+    return FX_SPARSE_OK;
+}
+
+fx_sparse_res_t fx_sparse_matmul(const fx_matrix_t* A, const fx_sparse_matrix_t* W,
+                                 fx_matrix_t* C) {
+    return sparse_matmul(A, W, NULL, false, FX_ACT_NONE, FIXED_ZERO, C);
+}
+
+fx_sparse_res_t fx_sparse_matmul_fused(const fx_matrix_t* A, const fx_sparse_matrix_t* W,
+                                       const fx_matrix_t* bias, fx_activation_t act,
+                                       fixed_t alpha, fx_matrix_t* C) {
+    return sparse_matmul(A, W, bias, true, act, alpha, C);
+}
+
+size_t fx_sparse_conv2d_workspace_size(const fx_sparse_matrix_t* W) {
+    return W ? W->cols : 0;
+}
+
+fx_sparse_res_t fx_sparse_conv2d(const fx_tensor_t* in, const fx_sparse_matrix_t* W,
+                                 uint16_t kh, uint16_t kw, const fixed_t* bias,
+                                 const fx_conv_params_t* params, fixed_t* workspace,
+                                 size_t workspace_len, fx_tensor_t* out) {
+    const fx_conv_params_t* p = params;
+
+    if (!in || !W || !p || !out || !workspace || !in->data || !out->data || !W->values ||
+        kh == 0 || kw == 0) {
+        return FX_SPARSE_INVALID_PARAM;
+    }
+    if (p->stride_h == 0 || p->stride_w == 0 || p->dilation_h == 0 || p->dilation_w == 0) {
+        return FX_SPARSE_INVALID_PARAM;
+    }
+
+    /* SRS-019.5: Filters flattened (c, i, j), one per output channel */
+    if ((size_t)in->c * kh * kw != W->cols || out->c != W->rows || out->n != in->n) {
+        return FX_SPARSE_DIM_MISMATCH;
+    }
+    const uint16_t oh = fx_conv2d_out_dim(in->h, kh, p->stride_h, p->pad_h, p->dilation_h);
+    const uint16_t ow = fx_conv2d_out_dim(in->w, kw, p->stride_w, p->pad_w, p->dilation_w);
+    if (oh == 0 || ow == 0 || out->h != oh || out->w != ow) {
+        return FX_SPARSE_DIM_MISMATCH;
+    }
+    if (workspace_len < W->cols) {
+        return FX_SPARSE_WORKSPACE_TOO_SMALL;
+    }
+
+    FX_TRACE_BEGIN(FX_TRACE_SPARSE_CONV2D, out->c, oh, ow);
+    for (size_t b = 0; b < in->n; b++) {
+        for (size_t y = 0; y < oh; y++) {
+            for (size_t x = 0; x < ow; x++) {
+                fixed_t* patch = workspace;
+
+                /* Receptive field in (c, i, j) order; padding taps are zero */
+                for (size_t c = 0; c < in->c; c++) {
+                    for (size_t i = 0; i < kh; i++) {
+                        const int32_t iy = (int32_t)(y * p->stride_h + i * p->dilation_h)
+                                         - p->pad_h;
+                        for (size_t j = 0; j < kw; j++) {
+                            const int32_t ix = (int32_t)(x * p->stride_w + j * p->dilation_w)
+                                             - p->pad_w;
+                            *patch++ = (iy < 0 || iy >= in->h || ix < 0 || ix >= in->w) ? 0 :
+                                       in->data[fx_tensor_offset(in, b, c, (size_t)iy,
+                                                                 (size_t)ix)];
+                        }
+                    }
+                }
+
+                /* SRS-006.4: One round per output, then the bias */
+                for (size_t o = 0; o < W->rows; o++) {
+                    int64_t acc[SPARSE_MR];
+                    sparse_dot(W, o, workspace, 0, 1, acc);
+                    const fixed_t v = sparse_round(acc[0]);
+                    out->data[fx_tensor_offset(out, b, o, y, x)] =
+                        bias ? fixed_add(v, bias[o]) : v;
+                }
+            }
+        }
+    }
+    FX_TRACE_END();
+    return FX_SPARSE_OK;
+}
@@ -0,0 +1,29 @@
+/**
+ * @file tensor.c
+ * @project Certifiable Inference Engine
+ * @brief Implementation of 4D tensor helpers.
+ *
+ * @traceability SRS-006.8
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "tensor.h"
+#include <string.h>
+
+void fx_tensor_init(fx_tensor_t* t, fixed_t* buffer,
+                    uint16_t n, uint16_t c, uint16_t h, uint16_t w,
+                    fx_layout_t layout) {
+    if (!t || !buffer) {
+        return;
+    }
+
+    fx_tensor_attach(t, buffer, n, c, h, w, layout);
+
+    /* Ensure memory is clean for determinism (SRS-003.1) */
+    memset(t->data, 0, fx_tensor_size(t) * sizeof(fixed_t));
+}
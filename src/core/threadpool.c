@@ -0,0 +1,250 @@
+/**
+ * @file threadpool.c
+ * @project Certifiable Inference Engine
+ * @brief Static worker pool behind the tiled kernels.
+ *
+ * @details Workers are created once by fx_pool_start() and block on a
+ * condition variable. fx_pool_run() publishes the task under the state
+ * lock, bumps a generation counter and wakes them; each worker runs its
+ * fixed parts and decrements the pending count, and the caller returns
+ * when it reaches zero. The mutex hand-off orders every output write
+ * before the caller's return. A second lock admits one task at a time;
+ * callers that find it taken run serially instead of waiting, so nested
+ * use from inside a task cannot deadlock.
+ *
+ * @traceability SRS-013-THREADING
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#if defined(CI_HAVE_THREADS)
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#endif
+
+#include "threadpool.h"
+
+/**
+ * @brief Run the parts of thread @p t: t, t + stride, t + 2·stride, …
+ */
+static void run_parts(fx_pool_task_fn fn, void* ctx, unsigned t, unsigned stride, unsigned parts) {
+    for (unsigned p = t; p < parts; p += stride) {
+        fn(ctx, p, parts);
+    }
+}
+
+unsigned fx_pool_parts(size_t units, uint64_t work) {
+    uint64_t parts = fx_pool_threads();
+
+    if (units < parts) {
+        parts = units;
+    }
+    if (work / FX_POOL_MIN_WORK < parts) {
+        parts = work / FX_POOL_MIN_WORK;
+    }
+    return parts > 0 ? (unsigned)parts : 1u;
+}
+
+#if defined(CI_HAVE_THREADS)
+
+static struct {
+    pthread_mutex_t lock;        /* Guards every field below */
+    pthread_cond_t wake;         /* Signalled when a task is posted or on stop */
+    pthread_cond_t done;         /* Signalled when pending reaches 0 */
+    unsigned threads;            /* Pool size including the caller; 0 if stopped */
+    unsigned long generation;    /* Incremented per posted task */
+    unsigned long base;          /* Generation at fx_pool_start() */
+    bool stopping;
+    fx_pool_task_fn fn;
+    void* ctx;
+    unsigned parts;
+    unsigned pending;            /* Workers still running the current task */
+} g_pool = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+             PTHREAD_COND_INITIALIZER, 0, 0, 0, false, NULL, NULL, 0, 0 };
+
+/* Held for the duration of a task, and by start/stop */
+static pthread_mutex_t g_run_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_t g_workers[FX_POOL_MAX_THREADS - 1];
+static unsigned g_worker_index[FX_POOL_MAX_THREADS - 1];
+
+static void* worker_main(void* arg) {
+    const unsigned t = *(const unsigned*)arg;
+
+    /* Tasks are counted from the start of the pool, not from whenever
+     * this thread first gets scheduled */
+    pthread_mutex_lock(&g_pool.lock);
+    unsigned long seen = g_pool.base;
+
+    for (;;) {
+        while (!g_pool.stopping && g_pool.generation == seen) {
+            pthread_cond_wait(&g_pool.wake, &g_pool.lock);
+        }
+        if (g_pool.stopping) {
+            break;
+        }
+        seen = g_pool.generation;
+
+        const fx_pool_task_fn fn = g_pool.fn;
+        void* const ctx = g_pool.ctx;
+        const unsigned parts = g_pool.parts;
+        const unsigned stride = g_pool.threads;
+
+        /* Threads beyond the part count sit this task out */
+        if (t >= parts) {
+            continue;
+        }
+
+        pthread_mutex_unlock(&g_pool.lock);
+        run_parts(fn, ctx, t, stride, parts);
+        pthread_mutex_lock(&g_pool.lock);
+
+        if (--g_pool.pending == 0) {
+            pthread_cond_signal(&g_pool.done);
+        }
+    }
+
+    pthread_mutex_unlock(&g_pool.lock);
+    return NULL;
+}
+
+/**
+ * @brief Wake and join workers [0, count); g_run_lock held.
+ */
+static void join_workers(unsigned count) {
+    pthread_mutex_lock(&g_pool.lock);
+    g_pool.stopping = true;
+    pthread_cond_broadcast(&g_pool.wake);
+    pthread_mutex_unlock(&g_pool.lock);
+
+    for (unsigned i = 0; i < count; i++) {
+        pthread_join(g_workers[i], NULL);
+    }
+
+    pthread_mutex_lock(&g_pool.lock);
+    g_pool.stopping = false;
+    g_pool.threads = 0;
+    pthread_mutex_unlock(&g_pool.lock);
+}
+
+fx_pool_res_t fx_pool_start(unsigned threads) {
+    if (threads == 0 || threads > FX_POOL_MAX_THREADS) {
+        return FX_POOL_INVALID_PARAM;
+    }
+
+    pthread_mutex_lock(&g_run_lock);
+
+    if (fx_pool_threads() > 1) {
+        pthread_mutex_unlock(&g_run_lock);
+        return FX_POOL_BUSY;
+    }
+
+    /* Workers read the stride from here once they are woken */
+    pthread_mutex_lock(&g_pool.lock);
+    g_pool.threads = threads;
+    g_pool.base = g_pool.generation;
+    pthread_mutex_unlock(&g_pool.lock);
+
+    for (unsigned i = 0; i + 1 < threads; i++) {
+        g_worker_index[i] = i + 1;
+        if (pthread_create(&g_workers[i], NULL, worker_main, &g_worker_index[i]) != 0) {
+            join_workers(i);
+            pthread_mutex_unlock(&g_run_lock);
+            return FX_POOL_SYSTEM;
+        }
+    }
+
+    pthread_mutex_unlock(&g_run_lock);
+    return FX_POOL_OK;
+}
+
+void fx_pool_stop(void) {
+    pthread_mutex_lock(&g_run_lock);
+
+    const unsigned threads = fx_pool_threads();
+    if (threads > 1) {
+        join_workers(threads - 1);
+    } else {
+        pthread_mutex_lock(&g_pool.lock);
+        g_pool.threads = 0;
+        pthread_mutex_unlock(&g_pool.lock);
+    }
+
+    pthread_mutex_unlock(&g_run_lock);
+}
+
+unsigned fx_pool_threads(void) {
+    pthread_mutex_lock(&g_pool.lock);
+    const unsigned threads = g_pool.threads;
+    pthread_mutex_unlock(&g_pool.lock);
+
+    return threads > 0 ? threads : 1u;
+}
+
+void fx_pool_run(fx_pool_task_fn fn, void* ctx, unsigned parts) {
+    if (!fn || parts == 0) {
+        return;
+    }
+
+    /* Busy or nested: the same parts, serially on this thread */
+    if (parts == 1 || pthread_mutex_trylock(&g_run_lock) != 0) {
+        run_parts(fn, ctx, 0, 1, parts);
+        return;
+    }
+
+    pthread_mutex_lock(&g_pool.lock);
+    const unsigned threads = g_pool.threads;
+    if (threads <= 1) {
+        pthread_mutex_unlock(&g_pool.lock);
+        run_parts(fn, ctx, 0, 1, parts);
+        pthread_mutex_unlock(&g_run_lock);
+        return;
+    }
+
+    g_pool.fn = fn;
+    g_pool.ctx = ctx;
+    g_pool.parts = parts;
+    g_pool.pending = (parts < threads ? parts : threads) - 1u;
+    g_pool.generation++;
+    pthread_cond_broadcast(&g_pool.wake);
+    pthread_mutex_unlock(&g_pool.lock);
+
+    run_parts(fn, ctx, 0, threads, parts);
+
+    pthread_mutex_lock(&g_pool.lock);
+    while (g_pool.pending > 0) {
+        pthread_cond_wait(&g_pool.done, &g_pool.lock);
+    }
+    pthread_mutex_unlock(&g_pool.lock);
+
+    pthread_mutex_unlock(&g_run_lock);
+}
+
+#else /* !CI_HAVE_THREADS */
+
+fx_pool_res_t fx_pool_start(unsigned threads) {
+    if (threads == 0 || threads > FX_POOL_MAX_THREADS) {
+        return FX_POOL_INVALID_PARAM;
+    }
+    return threads == 1 ? FX_POOL_OK : FX_POOL_UNSUPPORTED;
+}
+
+void fx_pool_stop(void) {
+}
+
+unsigned fx_pool_threads(void) {
+    return 1u;
+}
+
+void fx_pool_run(fx_pool_task_fn fn, void* ctx, unsigned parts) {
+    if (!fn) {
+        return;
+    }
+    run_parts(fn, ctx, 0, 1, parts);
+}
+
+#endif /* CI_HAVE_THREADS */
@@ -0,0 +1,366 @@
+/**
+ * @file trace.c
+ * @project Certifiable Inference Engine
+ * @brief Event ring, per-thread nesting and trace exporters.
+ *
+ * @details A token is the event's sequence number plus one; its slot is
+ * (token − 1) & mask. fx_trace_begin() claims the next sequence number
+ * with one atomic add, so concurrent threads never share a slot until the
+ * ring wraps. Each thread keeps a small stack of its open events, which
+ * gives every event its parent and the ticks spent in nested events
+ * without any search at export time.
+ *
+ * @traceability SRS-007.12
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "trace.h"
+#include "dispatch.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* Per-thread state; one copy per process without threads */
+#if defined(CI_HAVE_THREADS)
+#define TRACE_THREAD_LOCAL __thread
+#else
+#define TRACE_THREAD_LOCAL
+#endif
+
+typedef struct {
+    uint32_t depth;                          /* Open events */
+    uint32_t layer;                          /* Current layer ID + 1 (0 = none) */
+    uint32_t thread;                         /* Thread index + 1 (0 = unassigned) */
+    uint64_t token[FX_TRACE_MAX_DEPTH];      /* Open events, outermost first */
+    uint64_t begin[FX_TRACE_MAX_DEPTH];      /* Their entry counter values */
+    uint64_t nested[FX_TRACE_MAX_DEPTH];     /* Ticks of their closed children */
+} trace_thread_t;
+
+static TRACE_THREAD_LOCAL trace_thread_t t_state;
+
+static fx_trace_ring_t* g_ring;
+static uint32_t g_threads;
+
+static const char* const k_kernel_names[FX_TRACE_KERNEL_COUNT] = {
+    "user", "layer", "matmul", "matmul_fused", "matmul_packed", "vector_dot",
+    "conv2d", "conv2d_direct", "conv2d_im2col", "conv2d_winograd",
+    "maxpool_2x2", "pool2d", "global_avgpool",
+    "relu", "leaky_relu", "sigmoid", "tanh", "gelu", "softmax", "elementwise",
+    "q8_matmul", "q16_matmul", "q8_conv2d", "q16_conv2d",
+    "view_matmul", "view_conv2d", "view_maxpool_2x2", "input_convert",
+    "sparse_matmul", "sparse_conv2d", "qgemm",
+};
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Ring
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+fx_trace_res_t fx_trace_ring_init(fx_trace_ring_t* ring, fx_trace_event_t* storage,
+                                  uint32_t capacity) {
+    if (!ring || !storage || capacity == 0 || capacity > (1u << 31) ||
+        (capacity & (capacity - 1u)) != 0) {
+        return FX_TRACE_INVALID_PARAM;
+    }
+
+    memset(storage, 0, (size_t)capacity * sizeof(fx_trace_event_t));
+    ring->events = storage;
+    ring->mask = capacity - 1u;
+    ring->head = 0;
+    return FX_TRACE_OK;
+}
+
+void fx_trace_attach(fx_trace_ring_t* ring) {
+    __atomic_store_n(&g_ring, ring, __ATOMIC_RELEASE);
+}
+
+bool fx_trace_hooks_compiled(void) {
+#if defined(CI_TRACE)
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t fx_trace_count(const fx_trace_ring_t* ring) {
+    if (!ring) {
+        return 0;
+    }
+    const uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    const uint64_t capacity = (uint64_t)ring->mask + 1u;
+    return (size_t)(head < capacity ? head : capacity);
+}
+
+uint64_t fx_trace_lost(const fx_trace_ring_t* ring) {
+    if (!ring) {
+        return 0;
+    }
+    const uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    const uint64_t capacity = (uint64_t)ring->mask + 1u;
+    return head > capacity ? head - capacity : 0;
+}
+
+/* Sequence number of the oldest event still in the ring */
+static uint64_t oldest_seq(const fx_trace_ring_t* ring) {
+    return fx_trace_lost(ring);
+}
+
+/* Event i of a ring known to hold more than i events */
+static const fx_trace_event_t* slot(const fx_trace_ring_t* ring, size_t i) {
+    return &ring->events[(oldest_seq(ring) + i) & ring->mask];
+}
+
+const fx_trace_event_t* fx_trace_event_at(const fx_trace_ring_t* ring, size_t i) {
+    if (i >= fx_trace_count(ring)) {
+        return NULL;
+    }
+    return slot(ring, i);
+}
+
+/* Event of @p token if it is still in the ring */
+static const fx_trace_event_t* event_of(const fx_trace_ring_t* ring, uint64_t token) {
+    if (token == 0 || token - 1u < oldest_seq(ring) || token > ring->head) {
+        return NULL;
+    }
+    return &ring->events[(token - 1u) & ring->mask];
+}
+
+const char* fx_trace_kernel_name(fx_trace_kernel_t kernel) {
+    if ((unsigned)kernel >= FX_TRACE_KERNEL_COUNT) {
+        return "unknown";
+    }
+    return k_kernel_names[kernel];
+}
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Clock
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+static uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t fx_trace_clock(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t t;
+    __asm__ __volatile__("isb\n\tmrs %0, cntvct_el0" : "=r"(t));
+    return t;
+#else
+    return monotonic_ns();
+#endif
+}
+
+double fx_trace_ticks_per_us(void) {
+    const uint64_t n0 = monotonic_ns(), c0 = fx_trace_clock();
+    uint64_t n1 = n0;
+    while (n1 - n0 < 10000000u) {
+        n1 = monotonic_ns();
+    }
+    const uint64_t c1 = fx_trace_clock();
+    return (double)(c1 - c0) * 1000.0 / (double)(n1 - n0);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Events
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+void fx_trace_set_layer(uint32_t layer) {
+    t_state.layer = layer == FX_TRACE_NO_LAYER ? 0u : layer + 1u;
+}
+
+uint32_t fx_trace_layer(void) {
+    return t_state.layer == 0 ? FX_TRACE_NO_LAYER : t_state.layer - 1u;
+}
+
+uint64_t fx_trace_begin(fx_trace_kernel_t kernel, uint32_t d0, uint32_t d1, uint32_t d2) {
+    fx_trace_ring_t* ring = __atomic_load_n(&g_ring, __ATOMIC_ACQUIRE);
+    trace_thread_t* t = &t_state;
+
+    if (!ring || t->depth >= FX_TRACE_MAX_DEPTH) {
+        return 0;
+    }
+    if (t->thread == 0) {
+        t->thread = __atomic_add_fetch(&g_threads, 1u, __ATOMIC_RELAXED);
+    }
+
+    const uint64_t seq = __atomic_fetch_add(&ring->head, 1u, __ATOMIC_ACQ_REL);
+    fx_trace_event_t* e = &ring->events[seq & ring->mask];
+    const uint64_t now = fx_trace_clock();
+
+    e->begin = now;
+    e->end = 0;
+    e->nested = 0;
+    e->parent = t->depth > 0 ? t->token[t->depth - 1u] : 0u;
+    e->layer = fx_trace_layer();
+    e->dims[0] = d0;
+    e->dims[1] = d1;
+    e->dims[2] = d2;
+    e->kernel = (uint16_t)kernel;
+    e->backend = (uint8_t)fx_dispatch_init();
+    e->thread = (uint8_t)(t->thread - 1u);
+    e->reserved = 0;
+
+    t->token[t->depth] = seq + 1u;
+    t->begin[t->depth] = now;
+    t->nested[t->depth] = 0;
+    t->depth++;
+    return seq + 1u;
+}
+
+void fx_trace_end(uint64_t token) {
+    trace_thread_t* t = &t_state;
+
+    if (token == 0 || t->depth == 0 || t->token[t->depth - 1u] != token) {
+        return;
+    }
+
+    const uint64_t now = fx_trace_clock();
+    t->depth--;
+    const uint64_t ticks = now - t->begin[t->depth];
+    if (t->depth > 0) {
+        t->nested[t->depth - 1u] += ticks;
+    }
+
+    /* The slot is still this event's unless the ring has wrapped past it */
+    fx_trace_ring_t* ring = __atomic_load_n(&g_ring, __ATOMIC_ACQUIRE);
+    if (ring && __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) <= token - 1u + ring->mask + 1u) {
+        fx_trace_event_t* e = &ring->events[(token - 1u) & ring->mask];
+        e->nested = t->nested[t->depth];
+        e->end = now;
+    }
+}
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Exporters
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+typedef struct {
+    char* buf;
+    size_t len;
+    size_t pos;                  /* Bytes the full output needs so far */
+} trace_writer_t;
+
+static void emit(trace_writer_t* w, const char* fmt, ...) {
+    va_list ap;
+    const size_t room = w->pos < w->len ? w->len - w->pos : 0;
+
+    va_start(ap, fmt);
+    const int n = vsnprintf(room ? w->buf + w->pos : NULL, room, fmt, ap);
+    va_end(ap);
+    if (n > 0) {
+        w->pos += (size_t)n;
+    }
+}
+
+static size_t finish(trace_writer_t* w) {
+    if (w->len > 0 && w->pos >= w->len) {
+        w->buf[w->len - 1u] = '\0';
+    } else if (w->len > 0 && w->pos == 0) {
+        w->buf[0] = '\0';
+    }
+    return w->pos;
+}
+
+static void emit_name(trace_writer_t* w, const fx_trace_event_t* e) {
+    if (e->kernel == FX_TRACE_LAYER) {
+        emit(w, "layer %u", e->layer);
+    } else {
+        emit(w, "%s", fx_trace_kernel_name((fx_trace_kernel_t)e->kernel));
+    }
+}
+
+size_t fx_trace_export_chrome(const fx_trace_ring_t* ring, double ticks_per_us,
+                              char* buf, size_t len) {
+    trace_writer_t w = { buf, buf ? len : 0, 0 };
+    const size_t count = fx_trace_count(ring);
+    uint64_t t0 = UINT64_MAX;
+    bool first = true;
+
+    if (ticks_per_us <= 0.0) {
+        ticks_per_us = 1.0;
+    }
+    for (size_t i = 0; i < count; i++) {
+        const fx_trace_event_t* e = slot(ring, i);
+        if (e->end != 0 && e->begin < t0) {
+            t0 = e->begin;
+        }
+    }
+
+    emit(&w, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    for (size_t i = 0; i < count; i++) {
+        const fx_trace_event_t* e = slot(ring, i);
+        if (e->end == 0) {
+            continue;
+        }
+        emit(&w, "%s\n{\"name\":\"", first ? "" : ",");
+        emit_name(&w, e);
+        emit(&w, "\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,"
+                 "\"args\":{",
+             e->kernel == FX_TRACE_LAYER ? "layer" : "kernel", e->thread,
+             (double)(e->begin - t0) / ticks_per_us, (double)(e->end - e->begin) / ticks_per_us);
+        if (e->layer != FX_TRACE_NO_LAYER) {
+            emit(&w, "\"layer\":%u,", e->layer);
+        }
+        emit(&w, "\"dims\":[%u,%u,%u],\"backend\":\"%s\",\"ticks\":%llu,\"self_ticks\":%llu}}",
+             e->dims[0], e->dims[1], e->dims[2], fx_backend_name((fx_backend_t)e->backend),
+             (unsigned long long)(e->end - e->begin),
+             (unsigned long long)(e->end - e->begin - e->nested));
+        first = false;
+    }
+    emit(&w, "\n]}\n");
+    return finish(&w);
+}
+
+size_t fx_trace_export_folded(const fx_trace_ring_t* ring, char* buf, size_t len) {
+    trace_writer_t w = { buf, buf ? len : 0, 0 };
+    const size_t count = fx_trace_count(ring);
+
+    for (size_t i = 0; i < count; i++) {
+        const fx_trace_event_t* e = slot(ring, i);
+        const fx_trace_event_t* chain[FX_TRACE_MAX_DEPTH] = { e };
+        size_t depth = 1;
+
+        if (e->end == 0) {
+            continue;
+        }
+
+        /* Enclosing events that are still in the ring, innermost first. A
+         * parent opens before its children, so its token is smaller; a
+         * stale token from before fx_trace_ring_init() ends the walk. */
+        uint64_t token = oldest_seq(ring) + i + 1u;
+        while (depth < FX_TRACE_MAX_DEPTH && chain[depth - 1u]->parent < token) {
+            token = chain[depth - 1u]->parent;
+            const fx_trace_event_t* p = event_of(ring, token);
+            if (!p) {
+                break;
+            }
+            chain[depth++] = p;
+        }
+
+        const fx_trace_event_t* top = chain[depth - 1u];
+        if (top->kernel != FX_TRACE_LAYER && top->layer != FX_TRACE_NO_LAYER) {
+            emit(&w, "layer %u;", top->layer);
+        }
+        while (depth > 0) {
+            emit_name(&w, chain[--depth]);
+            emit(&w, "%s", depth > 0 ? ";" : "");
+        }
+        emit(&w, " %llu\n", (unsigned long long)(e->end - e->begin - e->nested));
+    }
+    return finish(&w);
+}
@@ -0,0 +1,398 @@
+/**
+ * @file view.c
+ * @project Certifiable Inference Engine
+ * @brief Strided N-D views and the operations defined on them.
+ *
+ * @details Every operation walks its operands one innermost row at a
+ * time: the outer rank − 1 indices are decoded from a row number in
+ * row-major order, and the row itself is handed to a contiguous kernel
+ * when its stride is 1 or walked element by element otherwise. Indices
+ * and offsets are size_t throughout.
+ *
+ * @traceability SRS-016
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "view.h"
+#include "convolution.h"
+#include "pooling.h"
+#include "kernels.h"
+#include "trace.h"
+#include <string.h>
+
+/* ------------------------------------------------------------------------ */
+/* Helpers                                                                  */
+/* ------------------------------------------------------------------------ */
+
+static bool view_valid(const fx_view_t* v) {
+    return v && v->data && v->rank >= 1 && v->rank <= FX_VIEW_MAX_RANK;
+}
+
+static bool same_shape(const fx_view_t* a, const fx_view_t* b) {
+    if (a->rank != b->rank) {
+        return false;
+    }
+    for (unsigned d = 0; d < a->rank; d++) {
+        if (a->shape[d] != b->shape[d]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Extent and stride of the innermost dimension */
+static inline size_t inner_len(const fx_view_t* v) {
+    return v->shape[v->rank - 1u];
+}
+
+static inline size_t inner_stride(const fx_view_t* v) {
+    return v->stride[v->rank - 1u];
+}
+
+/** Number of innermost rows (product of the outer extents) */
+static size_t row_count(const fx_view_t* v) {
+    return inner_len(v) == 0 ? 0 : fx_view_size(v) / inner_len(v);
+}
+
+/**
+ * @brief Offset of row r, counting the outer dimensions in row-major order.
+ */
+static size_t row_offset(const fx_view_t* v, size_t r) {
+    size_t off = 0;
+
+    for (unsigned d = v->rank - 1u; d-- > 0;) {
+        off += (r % v->shape[d]) * v->stride[d];
+        r /= v->shape[d];
+    }
+    return off;
+}
+
+/** A rank-2 view that is an ordinary fx_matrix_t buffer */
+static bool as_matrix(const fx_view_t* v, fx_matrix_t* mat) {
+    if (v->rank != 2 || v->shape[0] > UINT16_MAX || v->shape[1] > UINT16_MAX ||
+        !fx_view_is_contiguous(v)) {
+        return false;
+    }
+    fx_matrix_attach(mat, v->data, (uint16_t)v->shape[0], (uint16_t)v->shape[1]);
+    return true;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Construction                                                             */
+/* ------------------------------------------------------------------------ */
+
+fx_view_res_t fx_view_init(fx_view_t* v, fixed_t* data, unsigned rank, const uint32_t* shape) {
+    if (!v || !data || !shape || rank < 1 || rank > FX_VIEW_MAX_RANK) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+
+    /* SRS-016.1: dense row-major strides, innermost first */
+    size_t s = 1;
+    for (unsigned d = rank; d-- > 0;) {
+        v->shape[d] = shape[d];
+        v->stride[d] = s;
+        s *= shape[d];
+    }
+    for (unsigned d = rank; d < FX_VIEW_MAX_RANK; d++) {
+        v->shape[d] = 1;
+        v->stride[d] = 0;
+    }
+    v->data = data;
+    v->rank = rank;
+    return FX_VIEW_OK;
+}
+
+fx_view_res_t fx_view_init_2d(fx_view_t* v, fixed_t* data, uint32_t rows, uint32_t cols,
+                              size_t row_stride) {
+    const uint32_t shape[2] = { rows, cols };
+
+    if (row_stride < cols || fx_view_init(v, data, 2, shape) != FX_VIEW_OK) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+    v->stride[0] = row_stride;
+    return FX_VIEW_OK;
+}
+
+fx_view_res_t fx_view_from_matrix(fx_view_t* v, const fx_matrix_t* mat) {
+    if (!mat) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+    return fx_view_init_2d(v, mat->data, mat->rows, mat->cols, mat->cols);
+}
+
+fx_view_res_t fx_view_from_tensor(fx_view_t* v, const fx_tensor_t* t) {
+    if (!t) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+
+    const uint32_t shape[4] = { t->n, t->c, t->h, t->w };
+    if (fx_view_init(v, t->data, 4, shape) != FX_VIEW_OK) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+
+    if (t->layout == FX_LAYOUT_NHWC) {
+        v->stride[1] = 1;
+        v->stride[3] = t->c;
+        v->stride[2] = (size_t)t->w * t->c;
+        v->stride[0] = (size_t)t->h * t->w * t->c;
+    }
+    return FX_VIEW_OK;
+}
+
+fx_view_res_t fx_view_slice(fx_view_t* out, const fx_view_t* in, unsigned dim,
+                            uint32_t start, uint32_t len) {
+    if (!out || !view_valid(in) || dim >= in->rank) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+    if ((uint64_t)start + len > in->shape[dim]) {
+        return FX_VIEW_OUT_OF_RANGE;
+    }
+
+    /* SRS-016.2: same storage, moved origin, shorter extent */
+    fx_view_t v = *in;
+    v.data += (size_t)start * in->stride[dim];
+    v.shape[dim] = len;
+    *out = v;
+    return FX_VIEW_OK;
+}
+
+fx_view_res_t fx_view_select(fx_view_t* out, const fx_view_t* in, unsigned dim, uint32_t index) {
+    if (!out || !view_valid(in) || in->rank < 2 || dim >= in->rank) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+    if (index >= in->shape[dim]) {
+        return FX_VIEW_OUT_OF_RANGE;
+    }
+
+    fx_view_t v = *in;
+    v.data += (size_t)index * in->stride[dim];
+    for (unsigned d = dim; d + 1u < in->rank; d++) {
+        v.shape[d] = in->shape[d + 1u];
+        v.stride[d] = in->stride[d + 1u];
+    }
+    v.rank = in->rank - 1u;
+    v.shape[v.rank] = 1;
+    v.stride[v.rank] = 0;
+    *out = v;
+    return FX_VIEW_OK;
+}
+
+bool fx_view_is_contiguous(const fx_view_t* v) {
+    if (!view_valid(v)) {
+        return false;
+    }
+
+    /* Dimensions of extent 1 never step, so their stride is immaterial */
+    size_t s = 1;
+    for (unsigned d = v->rank; d-- > 0;) {
+        if (v->shape[d] != 1 && v->stride[d] != s) {
+            return false;
+        }
+        s *= v->shape[d];
+    }
+    return true;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Element-wise                                                             */
+/* ------------------------------------------------------------------------ */
+
+fx_view_res_t fx_view_copy(fx_view_t* dst, const fx_view_t* src) {
+    if (!view_valid(dst) || !view_valid(src)) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+    if (!same_shape(dst, src)) {
+        return FX_VIEW_DIM_MISMATCH;
+    }
+
+    const size_t n = inner_len(src), ss = inner_stride(src), ds = inner_stride(dst);
+    const size_t rows = row_count(src);
+
+    for (size_t r = 0; r < rows; r++) {
+        const fixed_t* s = src->data + row_offset(src, r);
+        fixed_t* d = dst->data + row_offset(dst, r);
+
+        if (ss == 1 && ds == 1) {
+            if (d != s) {
+                memcpy(d, s, n * sizeof(fixed_t));
+            }
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                d[i * ds] = s[i * ss];
+            }
+        }
+    }
+    return FX_VIEW_OK;
+}
+
+fx_view_res_t fx_view_fill(fx_view_t* v, fixed_t value) {
+    if (!view_valid(v)) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+
+    const size_t n = inner_len(v), st = inner_stride(v);
+    const size_t rows = row_count(v);
+
+    for (size_t r = 0; r < rows; r++) {
+        fixed_t* d = v->data + row_offset(v, r);
+        for (size_t i = 0; i < n; i++) {
+            d[i * st] = value;
+        }
+    }
+    return FX_VIEW_OK;
+}
+
+fx_view_res_t fx_view_apply_ops(fx_view_t* v, const fx_ew_op_t* ops, size_t count) {
+    /* An empty run validates the chain without touching data */
+    if (!view_valid(v) || fx_ew_apply(NULL, NULL, 0, ops, count) != FX_EW_OK) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+
+    const size_t n = inner_len(v), st = inner_stride(v);
+    const size_t rows = row_count(v);
+
+    for (size_t r = 0; r < rows; r++) {
+        fixed_t* d = v->data + row_offset(v, r);
+
+        if (st == 1) {
+            /* SRS-016.3: a dense row is one engine call (vector kernels) */
+            (void)fx_ew_apply(d, d, n, ops, count);
+            continue;
+        }
+
+        /* Strided row: gather a block, run the chain, scatter */
+        fixed_t block[FX_EW_BLOCK];
+        for (size_t start = 0; start < n; start += FX_EW_BLOCK) {
+            const size_t len = (n - start < FX_EW_BLOCK) ? n - start : FX_EW_BLOCK;
+            for (size_t i = 0; i < len; i++) {
+                block[i] = d[(start + i) * st];
+            }
+            (void)fx_ew_apply(block, block, len, ops, count);
+            for (size_t i = 0; i < len; i++) {
+                d[(start + i) * st] = block[i];
+            }
+        }
+    }
+    return FX_VIEW_OK;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Layer primitives                                                         */
+/* ------------------------------------------------------------------------ */
+
+fx_view_res_t fx_view_matmul(const fx_view_t* A, const fx_view_t* B, fx_view_t* C) {
+    if (!view_valid(A) || !view_valid(B) || !view_valid(C) ||
+        A->rank != 2 || B->rank != 2 || C->rank != 2) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+
+    const size_t M = A->shape[0], K = A->shape[1], N = B->shape[1];
+    if (B->shape[0] != K || C->shape[0] != M || C->shape[1] != N) {
+        return FX_VIEW_DIM_MISMATCH;
+    }
+    if (K == 0) {
+        return fx_view_fill(C, FIXED_ZERO);
+    }
+
+    /* SRS-016.4: row strides become the GEMM leading dimensions */
+    FX_TRACE_BEGIN(FX_TRACE_VIEW_MATMUL, M, N, K);
+    if (M > 0 && N > 0 && A->stride[1] == 1 && B->stride[1] == 1 && C->stride[1] == 1) {
+        fx_gemm(M, N, K, A->data, A->stride[0], B->data, B->stride[0],
+                C->data, C->stride[0], NULL);
+        FX_TRACE_END();
+        return FX_VIEW_OK;
+    }
+
+    for (size_t i = 0; i < M; i++) {
+        for (size_t j = 0; j < N; j++) {
+            int64_t sum = 0;
+            for (size_t k = 0; k < K; k++) {
+                sum += (int64_t)A->data[i * A->stride[0] + k * A->stride[1]] *
+                       B->data[k * B->stride[0] + j * B->stride[1]];
+            }
+            sum += FIXED_HALF;
+            C->data[i * C->stride[0] + j * C->stride[1]] = (fixed_t)(sum >> FIXED_SHIFT);
+        }
+    }
+    FX_TRACE_END();
+    return FX_VIEW_OK;
+}
+
+fx_view_res_t fx_view_conv2d(const fx_view_t* in, const fx_view_t* kernel, fx_view_t* out) {
+    if (!view_valid(in) || !view_valid(kernel) || !view_valid(out) ||
+        in->rank != 2 || kernel->rank != 2 || out->rank != 2) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+
+    const size_t kh = kernel->shape[0], kw = kernel->shape[1];
+    if (kh == 0 || kw == 0 || kh > in->shape[0] || kw > in->shape[1] ||
+        out->shape[0] != in->shape[0] - kh + 1u || out->shape[1] != in->shape[1] - kw + 1u) {
+        return FX_VIEW_DIM_MISMATCH;
+    }
+
+    /* Whole matrices: the dispatched, threaded kernel */
+    FX_TRACE_BEGIN(FX_TRACE_VIEW_CONV2D, out->shape[0], out->shape[1], kh * kw);
+    fx_matrix_t mi, mk, mo;
+    if (as_matrix(in, &mi) && as_matrix(kernel, &mk) && as_matrix(out, &mo)) {
+        fx_conv2d(&mi, &mk, &mo);
+        FX_TRACE_END();
+        return FX_VIEW_OK;
+    }
+
+    /* SRS-016.4: strided sliding window, the fx_scalar_conv2d() arithmetic */
+    for (size_t y = 0; y < out->shape[0]; y++) {
+        for (size_t x = 0; x < out->shape[1]; x++) {
+            int64_t acc = 0;
+            for (size_t i = 0; i < kh; i++) {
+                const fixed_t* src = in->data + (y + i) * in->stride[0] + x * in->stride[1];
+                const fixed_t* ker = kernel->data + i * kernel->stride[0];
+                for (size_t j = 0; j < kw; j++) {
+                    acc += (int64_t)src[j * in->stride[1]] * ker[j * kernel->stride[1]];
+                }
+            }
+            acc += FIXED_HALF;
+            out->data[y * out->stride[0] + x * out->stride[1]] = (fixed_t)(acc >> FIXED_SHIFT);
+        }
+    }
+    FX_TRACE_END();
+    return FX_VIEW_OK;
+}
+
+fx_view_res_t fx_view_maxpool_2x2(const fx_view_t* in, fx_view_t* out) {
+    if (!view_valid(in) || !view_valid(out) || in->rank != 2 || out->rank != 2) {
+        return FX_VIEW_INVALID_PARAM;
+    }
+    if (in->shape[0] % 2u != 0 || in->shape[1] % 2u != 0 ||
+        out->shape[0] != in->shape[0] / 2u || out->shape[1] != in->shape[1] / 2u) {
+        return FX_VIEW_DIM_MISMATCH;
+    }
+
+    FX_TRACE_BEGIN(FX_TRACE_VIEW_MAXPOOL_2X2, in->shape[0], in->shape[1], 0);
+    fx_matrix_t mi, mo;
+    if (as_matrix(in, &mi) && as_matrix(out, &mo)) {
+        fx_maxpool_2x2(&mi, &mo);
+        FX_TRACE_END();
+        return FX_VIEW_OK;
+    }
+
+    const size_t rs = in->stride[0], cs = in->stride[1];
+    for (size_t y = 0; y < out->shape[0]; y++) {
+        const fixed_t* r0 = in->data + 2u * y * rs;
+        const fixed_t* r1 = r0 + rs;
+        for (size_t x = 0; x < out->shape[1]; x++) {
+            const size_t c0 = 2u * x * cs, c1 = c0 + cs;
+            fixed_t m = r0[c0];
+            m = r0[c1] > m ? r0[c1] : m;
+            m = r1[c0] > m ? r1[c0] : m;
+            m = r1[c1] > m ? r1[c1] : m;
+            out->data[y * out->stride[0] + x * out->stride[1]] = m;
+        }
+    }
+    FX_TRACE_END();
+    return FX_VIEW_OK;
+}
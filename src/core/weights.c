@@ -0,0 +1,348 @@
+/**
+ * @file weights.c
+ * @project Certifiable Inference Engine
+ * @brief Binary weight container validation and zero-copy accessors.
+ *
+ * @details Everything here reads the caller's image in place. Validation
+ * touches the header and the tensor table only; payload bytes are read
+ * solely by the optional CRC-32 check.
+ *
+ * @traceability SRS-010-WEIGHTS
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "weights.h"
+#include <stdbool.h>
+#include <string.h>
+
+/* The structures are the on-disk layout: no padding, fixed sizes */
+typedef char fx_weights_header_size_check[(sizeof(fx_weights_header_t) == 64) ? 1 : -1];
+typedef char fx_weights_entry_size_check[(sizeof(fx_weights_entry_t) == 72) ? 1 : -1];
+
+/* CRC-32 (polynomial 0xEDB88320, reflected), four bits per step */
+static const uint32_t crc32_nibble[16] = {
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu,
+    0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+    0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+
+uint32_t fx_weights_crc32(uint32_t crc, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+
+    if (!p) {
+        return crc;
+    }
+
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= p[i];
+        crc = (crc >> 4) ^ crc32_nibble[crc & 0xFu];
+        crc = (crc >> 4) ^ crc32_nibble[crc & 0xFu];
+    }
+    return ~crc;
+}
+
+/* Bytes per element, 0 for unknown types */
+static uint64_t dtype_size(uint8_t dtype) {
+    switch (dtype) {
+    case FX_WEIGHTS_DTYPE_I32: return 4;
+    case FX_WEIGHTS_DTYPE_I64: return 8;
+    default:                   return 0;
+    }
+}
+
+static bool all_zero(const uint8_t* p, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (p[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Stored elements implied by an entry's layout, 0 if inconsistent.
+ *
+ * @param[in] dense Product of the dims (non-zero, bounded by the file size)
+ */
+static uint64_t layout_count(const fx_weights_entry_t* e, uint64_t dense) {
+    switch (e->layout) {
+    case FX_WEIGHTS_LAYOUT_DENSE:
+        return e->tile == 0 ? dense : 0;
+
+    case FX_WEIGHTS_LAYOUT_GEMM_PANELS:
+        /* SRS-010.6: [K, N] padded to whole panels of `tile` columns */
+        if (e->rank != 2 || e->dtype != FX_WEIGHTS_DTYPE_I32 ||
+            e->tile == 0 || e->tile > FX_WEIGHTS_MAX_TILE) {
+            return 0;
+        }
+        return ((uint64_t)e->dims[1] + e->tile - 1u) / e->tile * e->tile * e->dims[0];
+
+    case FX_WEIGHTS_LAYOUT_WINOGRAD_2X2_3X3:
+        /* [C_out, C_in, 3, 3] as 4×4 transformed tiles */
+        if (e->rank != 4 || e->dtype != FX_WEIGHTS_DTYPE_I64 || e->tile != 2 ||
+            e->dims[2] != 3 || e->dims[3] != 3) {
+            return 0;
+        }
+        return (uint64_t)e->dims[0] * e->dims[1] * 16u;
+
+    default:
+        return 0;
+    }
+}
+
+static fx_weights_res_t check_entry(const fx_weights_header_t* h, const fx_weights_entry_t* e) {
+    const uint64_t esize = dtype_size(e->dtype);
+    uint64_t count = 1;
+
+    if (e->name[0] == '\0' || memchr(e->name, '\0', FX_WEIGHTS_NAME_LEN) == NULL) {
+        return FX_WEIGHTS_CORRUPT;
+    }
+    if (esize == 0 || e->frac_bits > 31 || e->rank == 0 || e->rank > FX_WEIGHTS_MAX_RANK) {
+        return FX_WEIGHTS_CORRUPT;
+    }
+    for (uint8_t d = 0; d < FX_WEIGHTS_MAX_RANK; d++) {
+        if (d >= e->rank) {
+            if (e->dims[d] != 1) {
+                return FX_WEIGHTS_CORRUPT;
+            }
+            continue;
+        }
+        if (e->dims[d] == 0 || count > h->file_size / e->dims[d]) {
+            return FX_WEIGHTS_CORRUPT;
+        }
+        count *= e->dims[d];
+    }
+    if (layout_count(e, count) != e->count) {
+        return FX_WEIGHTS_CORRUPT;
+    }
+
+    /* Aligned payload inside the data region */
+    if (e->offset % h->alignment != 0 || e->offset < h->data_offset || e->offset > h->file_size ||
+        e->count > (h->file_size - e->offset) / esize) {
+        return FX_WEIGHTS_CORRUPT;
+    }
+    return FX_WEIGHTS_OK;
+}
+
+fx_weights_res_t fx_weights_open(fx_weights_t* wf, const void* image, size_t len, uint32_t flags) {
+    const uint8_t* base = (const uint8_t*)image;
+
+    if (!wf) {
+        return FX_WEIGHTS_INVALID_PARAM;
+    }
+    memset(wf, 0, sizeof(*wf));
+    if (!base || (flags & ~FX_WEIGHTS_VERIFY) != 0) {
+        return FX_WEIGHTS_INVALID_PARAM;
+    }
+    if ((uintptr_t)base % FX_WEIGHTS_BASE_ALIGN != 0) {
+        return FX_WEIGHTS_MISALIGNED;
+    }
+    if (len < sizeof(fx_weights_header_t)) {
+        return FX_WEIGHTS_TRUNCATED;
+    }
+
+    const fx_weights_header_t* h = (const fx_weights_header_t*)image;
+
+    if (memcmp(h->magic, "CIEW", 4) != 0) {
+        return FX_WEIGHTS_BAD_MAGIC;
+    }
+    if (h->byte_order != FX_WEIGHTS_BYTE_ORDER) {
+        return FX_WEIGHTS_BAD_ENDIAN;
+    }
+    if (h->version_major != FX_WEIGHTS_VERSION_MAJOR) {
+        return FX_WEIGHTS_BAD_VERSION;
+    }
+    if (h->file_size > len) {
+        return FX_WEIGHTS_TRUNCATED;
+    }
+
+    /* Regions: header, then table, then data, all within file_size */
+    if (h->header_size != sizeof(fx_weights_header_t) ||
+        h->entry_size != sizeof(fx_weights_entry_t) ||
+        h->alignment < 8 || (h->alignment & (h->alignment - 1u)) != 0 ||
+        !all_zero(h->reserved, sizeof(h->reserved)) ||
+        h->file_size < sizeof(fx_weights_header_t) ||
+        h->table_offset < sizeof(fx_weights_header_t) || h->table_offset % 8 != 0 ||
+        h->table_offset > h->file_size ||
+        h->tensor_count > (h->file_size - h->table_offset) / sizeof(fx_weights_entry_t) ||
+        h->data_offset < h->table_offset + (uint64_t)h->tensor_count * sizeof(fx_weights_entry_t) ||
+        h->data_offset > h->file_size) {
+        return FX_WEIGHTS_CORRUPT;
+    }
+
+    const fx_weights_entry_t* table = (const fx_weights_entry_t*)(base + h->table_offset);
+
+    for (uint32_t i = 0; i < h->tensor_count; i++) {
+        fx_weights_res_t res = check_entry(h, &table[i]);
+        if (res != FX_WEIGHTS_OK) {
+            return res;
+        }
+        for (uint32_t j = 0; j < i; j++) {
+            if (strncmp(table[i].name, table[j].name, FX_WEIGHTS_NAME_LEN) == 0) {
+                return FX_WEIGHTS_CORRUPT;
+            }
+        }
+    }
+
+    if ((flags & FX_WEIGHTS_VERIFY) != 0 &&
+        fx_weights_crc32(0, base + 8, (size_t)h->file_size - 8) != h->checksum) {
+        return FX_WEIGHTS_CHECKSUM;
+    }
+
+    wf->base = base;
+    wf->header = h;
+    wf->table = table;
+    wf->count = h->tensor_count;
+    return FX_WEIGHTS_OK;
+}
+
+const fx_weights_entry_t* fx_weights_find(const fx_weights_t* wf, const char* name) {
+    if (!wf || !wf->table || !name) {
+        return NULL;
+    }
+    for (uint32_t i = 0; i < wf->count; i++) {
+        if (strncmp(wf->table[i].name, name, FX_WEIGHTS_NAME_LEN) == 0) {
+            return &wf->table[i];
+        }
+    }
+    return NULL;
+}
+
+const fixed_t* fx_weights_data(const fx_weights_t* wf, const fx_weights_entry_t* e) {
+    if (!wf || !wf->base || !e || e->dtype != FX_WEIGHTS_DTYPE_I32 || e->frac_bits != FIXED_SHIFT) {
+        return NULL;
+    }
+    return (const fixed_t*)(wf->base + e->offset);
+}
+
+/* Shared lookup for the attach functions: entry and Q16.16 payload */
+static fx_weights_res_t lookup_fixed(const fx_weights_t* wf, const char* name,
+                                     const fx_weights_entry_t** e, const fixed_t** data) {
+    if (!wf || !name) {
+        return FX_WEIGHTS_INVALID_PARAM;
+    }
+    *e = fx_weights_find(wf, name);
+    if (!*e) {
+        return FX_WEIGHTS_NOT_FOUND;
+    }
+    *data = fx_weights_data(wf, *e);
+    return *data ? FX_WEIGHTS_OK : FX_WEIGHTS_FORMAT;
+}
+
+fx_weights_res_t fx_weights_attach_matrix(const fx_weights_t* wf, const char* name, fx_matrix_t* mat) {
+    const fx_weights_entry_t* e = NULL;
+    const fixed_t* data = NULL;
+
+    if (!mat) {
+        return FX_WEIGHTS_INVALID_PARAM;
+    }
+
+    fx_weights_res_t res = lookup_fixed(wf, name, &e, &data);
+    if (res != FX_WEIGHTS_OK) {
+        return res;
+    }
+    if (e->layout != FX_WEIGHTS_LAYOUT_DENSE) {
+        return FX_WEIGHTS_FORMAT;
+    }
+
+    const uint32_t rows = (e->rank == 2) ? e->dims[0] : 1u;
+    const uint32_t cols = (e->rank == 2) ? e->dims[1] : e->dims[0];
+    if (e->rank > 2 || rows > UINT16_MAX || cols > UINT16_MAX) {
+        return FX_WEIGHTS_SHAPE;
+    }
+
+    /* Read-only view: the matrix API is not const-qualified */
+    fx_matrix_attach(mat, (fixed_t*)(uintptr_t)data, (uint16_t)rows, (uint16_t)cols);
+    return FX_WEIGHTS_OK;
+}
+
+fx_weights_res_t fx_weights_attach_tensor(const fx_weights_t* wf, const char* name, fx_tensor_t* t) {
+    const fx_weights_entry_t* e = NULL;
+    const fixed_t* data = NULL;
+    uint32_t d[FX_WEIGHTS_MAX_RANK] = { 1u, 1u, 1u, 1u };
+
+    if (!t) {
+        return FX_WEIGHTS_INVALID_PARAM;
+    }
+
+    fx_weights_res_t res = lookup_fixed(wf, name, &e, &data);
+    if (res != FX_WEIGHTS_OK) {
+        return res;
+    }
+    if (e->layout != FX_WEIGHTS_LAYOUT_DENSE) {
+        return FX_WEIGHTS_FORMAT;
+    }
+
+    for (uint8_t i = 0; i < e->rank; i++) {
+        d[FX_WEIGHTS_MAX_RANK - e->rank + i] = e->dims[i];
+    }
+    for (uint8_t i = 0; i < FX_WEIGHTS_MAX_RANK; i++) {
+        if (d[i] > UINT16_MAX) {
+            return FX_WEIGHTS_SHAPE;
+        }
+    }
+
+    fx_tensor_attach(t, (fixed_t*)(uintptr_t)data, (uint16_t)d[0], (uint16_t)d[1],
+                     (uint16_t)d[2], (uint16_t)d[3], FX_LAYOUT_NCHW);
+    return FX_WEIGHTS_OK;
+}
+
+fx_weights_res_t fx_weights_attach_packed(const fx_weights_t* wf, const char* name,
+                                          fx_matrix_packed_t* b) {
+    const fx_weights_entry_t* e = NULL;
+    const fixed_t* data = NULL;
+
+    if (!b) {
+        return FX_WEIGHTS_INVALID_PARAM;
+    }
+
+    fx_weights_res_t res = lookup_fixed(wf, name, &e, &data);
+    if (res != FX_WEIGHTS_OK) {
+        return res;
+    }
+
+    /* SRS-010.6: only the panel width the micro-kernel was built for */
+    if (e->layout != FX_WEIGHTS_LAYOUT_GEMM_PANELS || e->tile != FX_MATRIX_PANEL_COLS) {
+        return FX_WEIGHTS_FORMAT;
+    }
+    if (e->dims[0] > UINT16_MAX || e->dims[1] > UINT16_MAX) {
+        return FX_WEIGHTS_SHAPE;
+    }
+
+    b->data = data;
+    b->rows = (uint16_t)e->dims[0];
+    b->cols = (uint16_t)e->dims[1];
+    return FX_WEIGHTS_OK;
+}
+
+fx_weights_res_t fx_weights_attach_winograd(const fx_weights_t* wf, const char* name,
+                                            const int64_t** u, uint16_t* cout, uint16_t* cin) {
+    if (!wf || !wf->base || !name || !u || !cout || !cin) {
+        return FX_WEIGHTS_INVALID_PARAM;
+    }
+
+    const fx_weights_entry_t* e = fx_weights_find(wf, name);
+    if (!e) {
+        return FX_WEIGHTS_NOT_FOUND;
+    }
+    if (e->layout != FX_WEIGHTS_LAYOUT_WINOGRAD_2X2_3X3 || e->dtype != FX_WEIGHTS_DTYPE_I64 ||
+        e->frac_bits != FIXED_SHIFT) {
+        return FX_WEIGHTS_FORMAT;
+    }
+    if (e->dims[0] > UINT16_MAX || e->dims[1] > UINT16_MAX) {
+        return FX_WEIGHTS_SHAPE;
+    }
+
+    /* Payloads are aligned to ≥ 8 bytes (SRS-010.2) */
+    *u = (const int64_t*)(const void*)(wf->base + e->offset);
+    *cout = (uint16_t)e->dims[0];
+    *cin = (uint16_t)e->dims[1];
+    return FX_WEIGHTS_OK;
+}
@@ -0,0 +1,1211 @@
+/**
+ * @file bench_suite.c
+ * @project Certifiable Inference Engine
+ * @brief Structured benchmark of every primitive over a sweep of sizes.
+ *
+ * @details Each case times one call of a kernel on one problem size. A
+ * sample is a batch of calls sized to last about BATCH_TARGET_NS, so timer
+ * resolution does not dominate small kernels, and the per-call time of
+ * each sample is kept. The report gives, per case:
+ *
+ *   ns_per_op   median (P50) time of one call
+ *   gops        work units per ns at the median (2 per multiply-accumulate,
+ *               1 per element, window element or table lookup)
+ *   bytes_per_op  operand bytes read plus written by one call
+ *   p50/p99/max   per-call sample distribution in ns
+ *
+ * Kernels behind the dispatch table (SRS-003.11) run once per backend the
+ * CPU supports; the others run once, reported with backend "any".
+ *
+ * Output is a text table, CSV or JSON. A CSV written with --format csv is
+ * also the baseline format: with --baseline the run fails (exit status 1)
+ * if any case present in both has a P50 more than --tolerance percent
+ * above the baseline, so two releases can be compared on one machine.
+ *
+ * --wcet switches to worst-case measurement. The process is pinned to one
+ * core (--cpu, default the current one), every sample is a single call
+ * timed with the cycle counter (rdtsc on x86, cntvct_el0 on AArch64, or
+ * pmccntr_el0 when built with -DBENCH_PMCCNTR and user access is enabled
+ * by the kernel), and each case is run twice: hot, after warm-up, and
+ * cold, with an --evict-kb working set written through before every call
+ * and, on x86, the operand buffers flushed with clflush. The two
+ * distributions are reported side by side, converted to ns with the
+ * counter rate measured at start-up.
+ *
+ * --counters reads hardware counters around every sample: cycles,
+ * instructions, L1D read misses, last-level cache misses and back-end
+ * stall cycles, through perf_event_open() on Linux or, built with
+ * -DBENCH_ARM_PMU for bare-metal AArch64, the PMU registers directly.
+ * Counters the CPU or kernel does not provide are reported as absent.
+ * Each case then shows IPC, its arithmetic intensity over the operand
+ * bytes (AI) and over the LLC-miss traffic (DRAM AI), and with
+ * --peak-gops the percentage of the roofline bound min(peak GOPS,
+ * AI × --peak-gbs) it achieves.
+ *
+ *   bench_suite [--format text|csv|json] [--output FILE] [--filter TEXT]
+ *               [--samples N] [--baseline FILE] [--tolerance PCT]
+ *               [--wcet [--evict-kb KB] [--cpu N]]
+ *               [--counters [--peak-gops G] [--peak-gbs B]]
+ *
+ * @traceability SRS-007.10, SRS-007.11, SRS-007.13
+ * @compliance DO-178C, ISO 26262, IEC 61508
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "activations.h"
+#include "convolution.h"
+#include "conv_stream.h"
+#include "deterministic_hash.h"
+#include "dispatch.h"
+#include "matrix.h"
+#include "pooling.h"
+#include "sparse.h"
+#include "tensor.h"
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define MAX_ELEMS 65536
+#define HASH_CAPACITY 2048
+#define HASH_KEY_LEN 32
+#define MAX_SAMPLES 10001
+#define DEFAULT_SAMPLES 101
+#define WARMUP_CALLS 3
+#define BATCH_TARGET_NS 20000u
+#define MAX_BATCH 65536u
+#define MAX_BASELINE 512
+#define MAX_NAME 48
+#define CACHE_LINE 64
+#define DEFAULT_EVICT_KB (32u * 1024u)
+#define MAX_EVICT_KB (64u * 1024u)
+
+static fixed_t g_a[MAX_ELEMS], g_b[MAX_ELEMS], g_c[MAX_ELEMS], g_work[MAX_ELEMS];
+static uint32_t g_entries[D_TABLE_BUFFER_SIZE(HASH_CAPACITY) / sizeof(uint32_t)];
+static char g_keys[HASH_CAPACITY][HASH_KEY_LEN];
+static const char* g_key_ptrs[HASH_CAPACITY];
+static int32_t g_values[HASH_CAPACITY];
+static uint64_t g_samples[MAX_SAMPLES];
+static uint8_t g_evict[MAX_EVICT_KB * 1024u];
+static size_t g_evict_bytes = DEFAULT_EVICT_KB * 1024u;
+
+/* Operands set up by the prepare step of the case being timed */
+static fx_matrix_t g_ma, g_mb, g_mc;
+static fx_tensor_t g_ta, g_tc;
+static fx_pool2d_params_t g_pool;
+static fx_conv_stream_t g_stream;
+static fx_sparse_matrix_t g_sparse;
+static uint16_t g_col_idx[MAX_ELEMS];
+static uint32_t g_row_ptr[MAX_ELEMS];
+static uint8_t g_meta[MAX_ELEMS];
+static size_t g_work_len;
+static d_table_t g_table;
+static uint16_t g_count;
+
+/* Volatile sink keeps results that are not stored from being discarded */
+static volatile int64_t g_sink;
+
+/* ─────────────────────────────────────────────────────────────────────── */
+
+typedef struct bench_case bench_case_t;
+
+struct bench_case {
+    const char* kernel;          /**< Primitive name */
+    bool dispatched;             /**< Runs behind the backend table */
+    uint16_t d0, d1, d2;         /**< Problem dimensions (meaning per kernel) */
+    void (*prepare)(const bench_case_t* bc, double* ops, double* bytes);
+    void (*run)(void);
+};
+
+typedef struct {
+    char kernel[MAX_NAME];
+    char size[MAX_NAME];
+    char backend[16];
+    double ns_per_op, gops, bytes_per_op;
+    double p50, p99, max;
+    unsigned samples;
+    uint32_t batch;
+} bench_result_t;
+
+typedef struct {
+    char kernel[MAX_NAME];
+    char size[MAX_NAME];
+    char backend[16];
+    double hot[3];               /**< P50, P99, max in ns */
+    double cold[3];              /**< P50, P99, max in ns */
+    unsigned samples;
+} wcet_result_t;
+
+/**
+ * @brief Get high-resolution timestamp in nanoseconds (CLOCK_MONOTONIC).
+ */
+static uint64_t get_nanos(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000UL + (uint64_t)ts.tv_nsec;
+}
+
+static int cmp_u64(const void* a, const void* b) {
+    const uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/* Sort samples and store P50, P99 and max, each multiplied by scale */
+static void percentiles(uint64_t* t, unsigned n, double scale, double out[3]) {
+    qsort(t, n, sizeof(t[0]), cmp_u64);
+    out[0] = (double)t[n / 2] * scale;
+    out[1] = (double)t[(n * 99u) / 100u] * scale;
+    out[2] = (double)t[n - 1] * scale;
+}
+
+/* Deterministic Q16.16 values in about [-4, 4) */
+static void fill(fixed_t* buf, size_t n, uint32_t seed) {
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        buf[i] = (fixed_t)(seed >> 13) - (fixed_t)(1 << 18);
+    }
+}
+
+/* ─── Cases ───────────────────────────────────────────────────────────── */
+
+/* d0 × d1 times d1 × d2 */
+static void prep_matmul(const bench_case_t* bc, double* ops, double* bytes) {
+    fx_matrix_attach(&g_ma, g_a, bc->d0, bc->d1);
+    fx_matrix_attach(&g_mb, g_b, bc->d1, bc->d2);
+    fx_matrix_attach(&g_mc, g_c, bc->d0, bc->d2);
+    *ops = 2.0 * bc->d0 * bc->d1 * bc->d2;
+    *bytes = 4.0 * ((double)bc->d0 * bc->d1 + (double)bc->d1 * bc->d2 +
+                    (double)bc->d0 * bc->d2);
+}
+static void run_matmul(void) { fx_matrix_mul(&g_ma, &g_mb, &g_mc); }
+
+/* Length d0 */
+static void prep_dot(const bench_case_t* bc, double* ops, double* bytes) {
+    g_count = bc->d0;
+    *ops = 2.0 * bc->d0;
+    *bytes = 8.0 * bc->d0;
+}
+static void run_dot(void) { g_sink = fx_vector_dot(g_a, g_b, g_count); }
+
+/* d0 × d0 input, d1 × d1 kernel, valid padding */
+static void prep_conv2d(const bench_case_t* bc, double* ops, double* bytes) {
+    const uint16_t o = (uint16_t)(bc->d0 - bc->d1 + 1);
+    fx_matrix_attach(&g_ma, g_a, bc->d0, bc->d0);
+    fx_matrix_attach(&g_mb, g_b, bc->d1, bc->d1);
+    fx_matrix_attach(&g_mc, g_c, o, o);
+    *ops = 2.0 * o * o * bc->d1 * bc->d1;
+    *bytes = 4.0 * ((double)bc->d0 * bc->d0 + (double)bc->d1 * bc->d1 + (double)o * o);
+}
+static void run_conv2d(void) { fx_conv2d(&g_ma, &g_mb, &g_mc); }
+
+/* d0 × d1 times sparse d1 × d2 (SRS-019): CSR at 25 % density, 2:4 at 50 % */
+static void prep_sparse(const bench_case_t* bc, double* ops, double* bytes,
+                        fx_sparse_format_t format) {
+    const size_t keep = (format == FX_SPARSE_CSR) ? 1u : 2u;
+    for (size_t k = 0; k < bc->d1; k++) {
+        for (size_t n = 0; n < bc->d2; n++) {
+            if ((k + n) % 4u >= keep) {
+                g_b[k * bc->d2 + n] = 0;
+            }
+        }
+    }
+    (void)fx_sparse_pack(g_b, bc->d2, bc->d1, 1, bc->d2, format, g_work, MAX_ELEMS,
+                         g_col_idx, g_row_ptr, g_meta, &g_sparse);
+    fx_matrix_attach(&g_ma, g_a, bc->d0, bc->d1);
+    fx_matrix_attach(&g_mc, g_c, bc->d0, bc->d2);
+
+    const double stored = (double)bc->d2 * bc->d1 * keep / 4.0;
+    const double index = (format == FX_SPARSE_CSR) ? 2.0 * stored : stored / 2.0;
+    *ops = 2.0 * bc->d0 * stored;
+    *bytes = 4.0 * ((double)bc->d0 * bc->d1 + stored + (double)bc->d0 * bc->d2) + index;
+}
+static void prep_sparse_csr(const bench_case_t* bc, double* ops, double* bytes) {
+    prep_sparse(bc, ops, bytes, FX_SPARSE_CSR);
+}
+static void prep_sparse_2_4(const bench_case_t* bc, double* ops, double* bytes) {
+    prep_sparse(bc, ops, bytes, FX_SPARSE_2_4);
+}
+static void run_sparse(void) { (void)fx_sparse_matmul(&g_ma, &g_sparse, &g_mc); }
+
+/* One new d0-wide row into a streaming d1 × d1 convolution (SRS-006.14) */
+static void prep_conv_stream(const bench_case_t* bc, double* ops, double* bytes) {
+    const fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+    const uint16_t o = (uint16_t)(bc->d0 - bc->d1 + 1);
+    fx_tensor_attach(&g_ta, g_b, 1, 1, bc->d1, bc->d1, FX_LAYOUT_NCHW);
+    (void)fx_conv_stream_init(&g_stream, &g_ta, NULL, &p, bc->d0, g_work, MAX_ELEMS);
+    *ops = 2.0 * o * bc->d1 * bc->d1;
+    *bytes = 4.0 * ((double)bc->d0 + (double)bc->d1 * bc->d1 + o);
+}
+static void run_conv_stream(void) { (void)fx_conv_stream_push(&g_stream, g_a, 1, g_c, NULL); }
+
+/* d0 × d0 input */
+static void prep_maxpool(const bench_case_t* bc, double* ops, double* bytes) {
+    const uint16_t o = (uint16_t)(bc->d0 / 2);
+    fx_matrix_attach(&g_ma, g_a, bc->d0, bc->d0);
+    fx_matrix_attach(&g_mc, g_c, o, o);
+    *ops = (double)bc->d0 * bc->d0;
+    *bytes = 4.0 * ((double)bc->d0 * bc->d0 + (double)o * o);
+}
+static void run_maxpool(void) { fx_maxpool_2x2(&g_ma, &g_mc); }
+
+/* 1 × d0 × d1 × d1 NCHW input, 3×3 window, stride 2, mode from d2 */
+static void prep_pool2d(const bench_case_t* bc, double* ops, double* bytes) {
+    const fx_pool2d_params_t p = { bc->d2 ? FX_POOL2D_AVG : FX_POOL2D_MAX,
+                                   3, 3, 2, 2, 0, 0, false };
+    const uint16_t o = fx_pool2d_out_dim(bc->d1, 3, 2, 0);
+    g_pool = p;
+    fx_tensor_attach(&g_ta, g_a, 1, bc->d0, bc->d1, bc->d1, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&g_tc, g_c, 1, bc->d0, o, o, FX_LAYOUT_NCHW);
+    g_work_len = fx_pool2d_workspace_size(&g_ta, &g_pool, &g_tc);
+    *ops = 9.0 * bc->d0 * o * o;
+    *bytes = 4.0 * bc->d0 * ((double)bc->d1 * bc->d1 + (double)o * o);
+}
+static void run_pool2d(void) { (void)fx_pool2d(&g_ta, &g_pool, g_work, g_work_len, &g_tc); }
+
+/* 1 × d0 × d1 × d1 NCHW input */
+static void prep_gap(const bench_case_t* bc, double* ops, double* bytes) {
+    fx_tensor_attach(&g_ta, g_a, 1, bc->d0, bc->d1, bc->d1, FX_LAYOUT_NCHW);
+    fx_matrix_attach(&g_mc, g_c, 1, bc->d0);
+    *ops = (double)bc->d0 * bc->d1 * bc->d1;
+    *bytes = 4.0 * ((double)bc->d0 * bc->d1 * bc->d1 + bc->d0);
+}
+static void run_gap(void) { (void)fx_global_avgpool(&g_ta, &g_mc); }
+
+/*
+ * Activations run in place on the same buffer in every call. The
+ * table-driven functions take the same path for every input (SRS-007.1),
+ * so repeated application does not change their timing.
+ */
+static void prep_elementwise(const bench_case_t* bc, double* ops, double* bytes) {
+    fx_matrix_attach(&g_mc, g_c, (uint16_t)(bc->d0 / bc->d1), bc->d1);
+    *ops = bc->d0;
+    *bytes = 8.0 * bc->d0;
+}
+static void run_relu(void) { fx_relu(&g_mc); }
+static void run_leaky_relu(void) { fx_leaky_relu(&g_mc, FIXED_ONE / 8); }
+static void run_sigmoid(void) { fx_sigmoid(&g_mc); }
+static void run_tanh(void) { fx_tanh(&g_mc); }
+static void run_gelu(void) { fx_gelu(&g_mc); }
+static void run_softmax(void) { fx_softmax(&g_mc); }
+
+/* d0 keys in a HASH_CAPACITY table */
+static void prep_hash(const bench_case_t* bc, double* ops, double* bytes) {
+    g_count = bc->d0;
+    (void)d_table_init(&g_table, g_entries, sizeof(g_entries));
+    for (uint16_t i = 0; i < g_count; i++) {
+        (void)d_table_insert(&g_table, g_keys[i], (int32_t)i);
+    }
+    *ops = bc->d0;
+    *bytes = (double)bc->d0 * (sizeof(uint32_t) + sizeof(d_entry_t));
+}
+static void run_hash_get(void) {
+    int64_t sum = 0;
+    for (uint16_t i = 0; i < g_count; i++) {
+        int32_t v = 0;
+        (void)d_table_get(&g_table, g_keys[i], &v);
+        sum += v;
+    }
+    g_sink = sum;
+}
+static void run_hash_get_batch(void) {
+    int64_t sum = 0;
+    (void)d_table_get_batch(&g_table, g_key_ptrs, g_count, g_values, NULL);
+    for (uint16_t i = 0; i < g_count; i++) {
+        sum += g_values[i];
+    }
+    g_sink = sum;
+}
+/* Clearing the table is part of the timed call: d_table_init() zeroes it */
+static void run_hash_insert(void) {
+    (void)d_table_init(&g_table, g_entries, sizeof(g_entries));
+    for (uint16_t i = 0; i < g_count; i++) {
+        (void)d_table_insert(&g_table, g_keys[i], (int32_t)i);
+    }
+}
+
+static const bench_case_t k_cases[] = {
+    { "matmul",         true,   16,  16,  16, prep_matmul, run_matmul },
+    { "matmul",         true,   64,  64,  64, prep_matmul, run_matmul },
+    { "matmul",         true,  128, 128, 128, prep_matmul, run_matmul },
+    { "matmul",         true,  256, 256, 256, prep_matmul, run_matmul },
+    { "matmul",         true,    1, 256, 256, prep_matmul, run_matmul },
+    { "sparse_csr",     false,   1, 256, 256, prep_sparse_csr, run_sparse },
+    { "sparse_csr",     false,  64, 256, 256, prep_sparse_csr, run_sparse },
+    { "sparse_2_4",     false,   1, 256, 256, prep_sparse_2_4, run_sparse },
+    { "sparse_2_4",     false,  64, 256, 256, prep_sparse_2_4, run_sparse },
+    { "vector_dot",     true,   64,   0,   0, prep_dot, run_dot },
+    { "vector_dot",     true, 1024,   0,   0, prep_dot, run_dot },
+    { "vector_dot",     true, 16384,  0,   0, prep_dot, run_dot },
+    { "conv2d",         true,   16,   3,   0, prep_conv2d, run_conv2d },
+    { "conv2d",         true,   64,   3,   0, prep_conv2d, run_conv2d },
+    { "conv2d",         true,  128,   3,   0, prep_conv2d, run_conv2d },
+    { "conv2d",         true,  128,   5,   0, prep_conv2d, run_conv2d },
+    { "conv_stream",    false, 128,   3,   0, prep_conv_stream, run_conv_stream },
+    { "conv_stream",    false, 128,   5,   0, prep_conv_stream, run_conv_stream },
+    { "maxpool_2x2",    true,   64,   0,   0, prep_maxpool, run_maxpool },
+    { "maxpool_2x2",    true,  256,   0,   0, prep_maxpool, run_maxpool },
+    { "maxpool_3x3s2",  false,  16,  56,   0, prep_pool2d, run_pool2d },
+    { "avgpool_3x3s2",  false,  16,  56,   1, prep_pool2d, run_pool2d },
+    { "global_avgpool", false,  64,  14,   0, prep_gap, run_gap },
+    { "relu",           true, 4096,  64,   0, prep_elementwise, run_relu },
+    { "relu",           true, 32768, 256,  0, prep_elementwise, run_relu },
+    { "leaky_relu",     true, 4096,  64,   0, prep_elementwise, run_leaky_relu },
+    { "leaky_relu",     true, 32768, 256,  0, prep_elementwise, run_leaky_relu },
+    { "sigmoid",        false, 4096, 64,   0, prep_elementwise, run_sigmoid },
+    { "sigmoid",        false, 32768, 256, 0, prep_elementwise, run_sigmoid },
+    { "tanh",           false, 4096, 64,   0, prep_elementwise, run_tanh },
+    { "gelu",           false, 4096, 64,   0, prep_elementwise, run_gelu },
+    { "softmax",        false, 4090, 10,   0, prep_elementwise, run_softmax },
+    { "hash_get",       false,   64,   0,   0, prep_hash, run_hash_get },
+    { "hash_get",       false, 1024,   0,   0, prep_hash, run_hash_get },
+    { "hash_get_batch", false,   64,   0,   0, prep_hash, run_hash_get_batch },
+    { "hash_get_batch", false, 1024,   0,   0, prep_hash, run_hash_get_batch },
+    { "hash_insert",    false,   64,   0,   0, prep_hash, run_hash_insert },
+    { "hash_insert",    false, 1024,   0,   0, prep_hash, run_hash_insert },
+};
+#define NUM_CASES (sizeof(k_cases) / sizeof(k_cases[0]))
+
+static void format_size(const bench_case_t* bc, char* out, size_t len) {
+    if (bc->prepare == prep_matmul || bc->prepare == prep_sparse_csr ||
+        bc->prepare == prep_sparse_2_4) {
+        snprintf(out, len, "%ux%ux%u", bc->d0, bc->d1, bc->d2);
+    } else if (bc->prepare == prep_conv2d) {
+        snprintf(out, len, "%ux%u/k%u", bc->d0, bc->d0, bc->d1);
+    } else if (bc->prepare == prep_conv_stream) {
+        snprintf(out, len, "1x%u/k%u", bc->d0, bc->d1);
+    } else if (bc->prepare == prep_maxpool) {
+        snprintf(out, len, "%ux%u", bc->d0, bc->d0);
+    } else if (bc->prepare == prep_pool2d || bc->prepare == prep_gap) {
+        snprintf(out, len, "%ux%ux%u", bc->d0, bc->d1, bc->d1);
+    } else if (bc->prepare == prep_elementwise && bc->run == run_softmax) {
+        snprintf(out, len, "%ux%u", bc->d0 / bc->d1, bc->d1);
+    } else {
+        snprintf(out, len, "%u", bc->d0);
+    }
+}
+
+/* ─── Measurement ─────────────────────────────────────────────────────── */
+
+/* Fill the operands, set the case up and warm caches and predictors */
+static void prepare_case(const bench_case_t* bc, double* ops, double* bytes) {
+    fill(g_a, MAX_ELEMS, 0x2545F491u);
+    fill(g_b, MAX_ELEMS, 0x9E3779B9u);
+    fill(g_c, MAX_ELEMS, 0xBE7C0DE5u);
+    bc->prepare(bc, ops, bytes);
+
+    for (int i = 0; i < WARMUP_CALLS; i++) {
+        bc->run();
+    }
+}
+
+/* Calls per sample so that one sample lasts about BATCH_TARGET_NS */
+static uint32_t batch_size(const bench_case_t* bc) {
+    const uint64_t t0 = get_nanos();
+    bc->run();
+    const uint64_t once = get_nanos() - t0;
+    uint32_t batch = once >= BATCH_TARGET_NS ? 1u : (uint32_t)(BATCH_TARGET_NS / (once + 1u));
+    return batch > MAX_BATCH ? MAX_BATCH : batch;
+}
+
+static void measure(const bench_case_t* bc, const char* backend, unsigned samples,
+                    bench_result_t* r) {
+    double ops = 0.0, bytes = 0.0;
+
+    prepare_case(bc, &ops, &bytes);
+    const uint32_t batch = batch_size(bc);
+
+    for (unsigned s = 0; s < samples; s++) {
+        const uint64_t start = get_nanos();
+        for (uint32_t i = 0; i < batch; i++) {
+            bc->run();
+        }
+        g_samples[s] = get_nanos() - start;
+    }
+    double p[3];
+    percentiles(g_samples, samples, 1.0 / batch, p);
+
+    snprintf(r->kernel, sizeof(r->kernel), "%s", bc->kernel);
+    format_size(bc, r->size, sizeof(r->size));
+    snprintf(r->backend, sizeof(r->backend), "%s", backend);
+    r->p50 = p[0];
+    r->p99 = p[1];
+    r->max = p[2];
+    r->ns_per_op = r->p50;
+    r->gops = r->p50 > 0.0 ? ops / r->p50 : 0.0;
+    r->bytes_per_op = bytes;
+    r->samples = samples;
+    r->batch = batch;
+}
+
+/* ─── WCET mode ───────────────────────────────────────────────────────── */
+
+#if defined(__x86_64__) || defined(__i386__)
+#define COUNTER_NAME "rdtsc"
+/* lfence on both sides keeps the timed call from being reordered across */
+static inline uint64_t read_counter(void) {
+    _mm_lfence();
+    const uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+}
+#elif defined(__aarch64__) && defined(BENCH_PMCCNTR)
+#define COUNTER_NAME "pmccntr"
+static inline uint64_t read_counter(void) {
+    uint64_t t;
+    __asm__ __volatile__("isb\n\tmrs %0, pmccntr_el0" : "=r"(t));
+    return t;
+}
+#elif defined(__aarch64__)
+#define COUNTER_NAME "cntvct"
+static inline uint64_t read_counter(void) {
+    uint64_t t;
+    __asm__ __volatile__("isb\n\tmrs %0, cntvct_el0" : "=r"(t));
+    return t;
+}
+#else
+#define COUNTER_NAME "clock"
+static inline uint64_t read_counter(void) { return get_nanos(); }
+#endif
+
+/* Counter ticks per ns, measured against CLOCK_MONOTONIC over 20 ms */
+static double counter_rate(void) {
+    const uint64_t n0 = get_nanos(), c0 = read_counter();
+    uint64_t n1 = n0;
+    while (n1 - n0 < 20000000u) {
+        n1 = get_nanos();
+    }
+    const uint64_t c1 = read_counter();
+    return (double)(c1 - c0) / (double)(n1 - n0);
+}
+
+/**
+ * @brief Pin the process to @p cpu (or the current CPU if negative).
+ * @return The CPU pinned to, or -1 if pinning is unavailable or failed
+ */
+static int pin_to_cpu(int cpu) {
+#if defined(__linux__)
+    cpu_set_t set;
+    if (cpu < 0) {
+        cpu = sched_getcpu();
+    }
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return -1;
+    }
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0 ? cpu : -1;
+#else
+    (void)cpu;
+    return -1;
+#endif
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+static void flush_range(const void* p, size_t bytes) {
+    const uint8_t* b = (const uint8_t*)p;
+    for (size_t i = 0; i < bytes; i += CACHE_LINE) {
+        _mm_clflush(b + i);
+    }
+}
+#endif
+
+/*
+ * Leave the caches as a context switch to a large task would: dirty every
+ * line of the eviction working set, then (x86) flush the operands so none
+ * of them survives in any level.
+ */
+static void evict_caches(void) {
+    for (size_t i = 0; i < g_evict_bytes; i += CACHE_LINE) {
+        g_evict[i]++;
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    flush_range(g_a, sizeof(g_a));
+    flush_range(g_b, sizeof(g_b));
+    flush_range(g_c, sizeof(g_c));
+    flush_range(g_work, sizeof(g_work));
+    flush_range(g_entries, sizeof(g_entries));
+    _mm_mfence();
+#endif
+}
+
+static void time_single_calls(const bench_case_t* bc, unsigned samples, bool cold) {
+    for (unsigned s = 0; s < samples; s++) {
+        if (cold) {
+            evict_caches();
+        }
+        const uint64_t start = read_counter();
+        bc->run();
+        g_samples[s] = read_counter() - start;
+    }
+}
+
+static void measure_wcet(const bench_case_t* bc, const char* backend, unsigned samples,
+                         double ticks_per_ns, wcet_result_t* r) {
+    double ops = 0.0, bytes = 0.0;
+
+    prepare_case(bc, &ops, &bytes);
+    time_single_calls(bc, samples, false);
+    percentiles(g_samples, samples, 1.0 / ticks_per_ns, r->hot);
+    time_single_calls(bc, samples, true);
+    percentiles(g_samples, samples, 1.0 / ticks_per_ns, r->cold);
+
+    snprintf(r->kernel, sizeof(r->kernel), "%s", bc->kernel);
+    format_size(bc, r->size, sizeof(r->size));
+    snprintf(r->backend, sizeof(r->backend), "%s", backend);
+    r->samples = samples;
+}
+
+/* ─── Hardware counter mode ───────────────────────────────────────────── */
+
+typedef enum {
+    CTR_CYCLES = 0,
+    CTR_INSTRUCTIONS,
+    CTR_L1D_MISSES,
+    CTR_LLC_MISSES,
+    CTR_STALL_CYCLES,            /* Cycles stalled in the back end (memory, execution units) */
+    CTR_COUNT
+} counter_id_t;
+
+static const char* const k_counter_names[CTR_COUNT] = {
+    "cycles", "instructions", "l1d_misses", "llc_misses", "stall_cycles",
+};
+
+#if defined(__aarch64__) && defined(BENCH_ARM_PMU)
+/*
+ * Bare-metal AArch64: the PMU is programmed directly. Cycles come from
+ * PMCCNTR_EL0 (64-bit), the others from event counters 0 … 3 (32-bit,
+ * differenced modulo 2³²; a batch lasts microseconds). Requires EL1, or
+ * EL0 with PMUSERENR_EL0.EN set by the firmware.
+ */
+#define COUNTER_BACKEND "armv8-pmu"
+static const uint32_t k_pmu_events[CTR_COUNT - 1] = {
+    0x08,                        /* INST_RETIRED */
+    0x03,                        /* L1D_CACHE_REFILL */
+    0x37,                        /* LL_CACHE_MISS_RD */
+    0x24,                        /* STALL_BACKEND */
+};
+static uint64_t g_pmu_start[CTR_COUNT];
+
+static uint64_t pmu_read(unsigned i) {
+    uint64_t v;
+    if (i == CTR_CYCLES) {
+        __asm__ __volatile__("isb\n\tmrs %0, pmccntr_el0" : "=r"(v));
+        return v;
+    }
+    __asm__ __volatile__("msr pmselr_el0, %1\n\tisb\n\tmrs %0, pmxevcntr_el0"
+                         : "=r"(v) : "r"((uint64_t)(i - 1u)));
+    return v;
+}
+
+static bool counters_open(bool available[CTR_COUNT]) {
+    uint64_t pmcr;
+    __asm__ __volatile__("mrs %0, pmcr_el0" : "=r"(pmcr));
+    if (((pmcr >> 11) & 0x1Fu) < CTR_COUNT - 1u) {
+        return false;            /* PMCR_EL0.N: too few event counters */
+    }
+    for (unsigned i = 0; i < CTR_COUNT - 1u; i++) {
+        __asm__ __volatile__("msr pmselr_el0, %0\n\tisb\n\tmsr pmxevtyper_el0, %1"
+                             :: "r"((uint64_t)i), "r"((uint64_t)k_pmu_events[i]));
+    }
+    /* E: enable, LC: 64-bit cycle counter; counters 0 … 3 and the cycle counter */
+    __asm__ __volatile__("msr pmcr_el0, %0\n\tmsr pmcntenset_el0, %1\n\tisb"
+                         :: "r"(pmcr | 1u | (1u << 6)), "r"((uint64_t)0x8000000Fu));
+    for (unsigned i = 0; i < CTR_COUNT; i++) {
+        available[i] = true;
+    }
+    return true;
+}
+
+static void counters_start(void) {
+    for (unsigned i = 0; i < CTR_COUNT; i++) {
+        g_pmu_start[i] = pmu_read(i);
+    }
+}
+
+static void counters_stop(double values[CTR_COUNT]) {
+    for (unsigned i = 0; i < CTR_COUNT; i++) {
+        const uint64_t d = pmu_read(i) - g_pmu_start[i];
+        values[i] = (double)(i == CTR_CYCLES ? d : (d & 0xFFFFFFFFu));
+    }
+}
+#elif defined(__linux__)
+/*
+ * Linux: one perf_event_open() group on the calling thread, user space
+ * only. Events the PMU or kernel does not offer are left out; if the
+ * group was multiplexed, counts are scaled by enabled / running time.
+ */
+#define COUNTER_BACKEND "perf_event"
+static int g_ctr_fd[CTR_COUNT] = { -1, -1, -1, -1, -1 };
+static int g_ctr_leader = -1;
+
+static bool counters_open(bool available[CTR_COUNT]) {
+    static const struct {
+        uint32_t type;
+        uint64_t config;
+    } k_events[CTR_COUNT] = {
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND },
+    };
+
+    for (unsigned i = 0; i < CTR_COUNT; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = k_events[i].type;
+        attr.size = sizeof(attr);
+        attr.config = k_events[i].config;
+        attr.disabled = g_ctr_leader < 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        g_ctr_fd[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, g_ctr_leader, 0);
+        if (g_ctr_fd[i] >= 0 && g_ctr_leader < 0) {
+            g_ctr_leader = g_ctr_fd[i];
+        }
+        available[i] = g_ctr_fd[i] >= 0;
+    }
+    return g_ctr_leader >= 0;
+}
+
+static void counters_start(void) {
+    (void)ioctl(g_ctr_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    (void)ioctl(g_ctr_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+static void counters_stop(double values[CTR_COUNT]) {
+    (void)ioctl(g_ctr_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    for (unsigned i = 0; i < CTR_COUNT; i++) {
+        uint64_t v[3] = { 0, 0, 0 };   /* value, time enabled, time running */
+        values[i] = 0.0;
+        if (g_ctr_fd[i] >= 0 && read(g_ctr_fd[i], v, sizeof(v)) == (ssize_t)sizeof(v) &&
+            v[2] > 0) {
+            values[i] = (double)v[0] * ((double)v[1] / (double)v[2]);
+        }
+    }
+}
+#else
+#define COUNTER_BACKEND "none"
+static bool counters_open(bool available[CTR_COUNT]) {
+    for (unsigned i = 0; i < CTR_COUNT; i++) {
+        available[i] = false;
+    }
+    return false;
+}
+static void counters_start(void) {}
+static void counters_stop(double values[CTR_COUNT]) {
+    for (unsigned i = 0; i < CTR_COUNT; i++) {
+        values[i] = 0.0;
+    }
+}
+#endif
+
+typedef struct {
+    char kernel[MAX_NAME];
+    char size[MAX_NAME];
+    char backend[16];
+    double ns_per_op, gops;
+    double ai;                   /**< Ops per operand byte */
+    double count[CTR_COUNT];     /**< Per call, median over samples; < 0 if unavailable */
+    double ipc;                  /**< Instructions per cycle, < 0 if unavailable */
+    double dram_ai;              /**< Ops per byte of LLC-miss traffic, < 0 if unavailable */
+    double pct_peak;             /**< Percent of the roofline bound, < 0 without --peak-gops */
+    unsigned samples;
+    uint32_t batch;
+} counter_result_t;
+
+static bool g_ctr_available[CTR_COUNT];
+static uint64_t g_ctr_samples[CTR_COUNT][MAX_SAMPLES];
+
+/*
+ * Roofline bound in GOPS: the compute peak, or the bandwidth peak times
+ * the operand arithmetic intensity if that is lower.
+ */
+static double roofline_gops(double ai, double peak_gops, double peak_gbs) {
+    if (peak_gbs > 0.0 && ai * peak_gbs < peak_gops) {
+        return ai * peak_gbs;
+    }
+    return peak_gops;
+}
+
+static void measure_counters(const bench_case_t* bc, const char* backend, unsigned samples,
+                             double peak_gops, double peak_gbs, counter_result_t* r) {
+    double ops = 0.0, bytes = 0.0;
+
+    prepare_case(bc, &ops, &bytes);
+    const uint32_t batch = batch_size(bc);
+
+    for (unsigned s = 0; s < samples; s++) {
+        double v[CTR_COUNT];
+        const uint64_t start = get_nanos();
+        counters_start();
+        for (uint32_t i = 0; i < batch; i++) {
+            bc->run();
+        }
+        counters_stop(v);
+        g_samples[s] = get_nanos() - start;
+        for (unsigned c = 0; c < CTR_COUNT; c++) {
+            g_ctr_samples[c][s] = (uint64_t)v[c];
+        }
+    }
+
+    double p[3];
+    percentiles(g_samples, samples, 1.0 / batch, p);
+    r->ns_per_op = p[0];
+    for (unsigned c = 0; c < CTR_COUNT; c++) {
+        percentiles(g_ctr_samples[c], samples, 1.0 / batch, p);
+        r->count[c] = g_ctr_available[c] ? p[0] : -1.0;
+    }
+
+    snprintf(r->kernel, sizeof(r->kernel), "%s", bc->kernel);
+    format_size(bc, r->size, sizeof(r->size));
+    snprintf(r->backend, sizeof(r->backend), "%s", backend);
+    r->gops = r->ns_per_op > 0.0 ? ops / r->ns_per_op : 0.0;
+    r->ai = bytes > 0.0 ? ops / bytes : 0.0;
+    r->ipc = r->count[CTR_CYCLES] > 0.0 && r->count[CTR_INSTRUCTIONS] >= 0.0
+             ? r->count[CTR_INSTRUCTIONS] / r->count[CTR_CYCLES] : -1.0;
+    r->dram_ai = r->count[CTR_LLC_MISSES] > 0.0
+                 ? ops / (r->count[CTR_LLC_MISSES] * CACHE_LINE) : -1.0;
+    r->pct_peak = peak_gops > 0.0
+                  ? 100.0 * r->gops / roofline_gops(r->ai, peak_gops, peak_gbs) : -1.0;
+    r->samples = samples;
+    r->batch = batch;
+}
+
+/* ─── Output ──────────────────────────────────────────────────────────── */
+
+static const char k_csv_header[] =
+    "kernel,size,backend,ns_per_op,gops,bytes_per_op,p50_ns,p99_ns,max_ns,samples,batch";
+
+static void print_header(FILE* out, const char* format, unsigned samples) {
+    if (strcmp(format, "csv") == 0) {
+        fprintf(out, "%s\n", k_csv_header);
+    } else if (strcmp(format, "json") == 0) {
+        fprintf(out, "{\n  \"benchmark\": \"bench_suite\",\n  \"samples\": %u,\n"
+                     "  \"results\": [", samples);
+    } else {
+        fprintf(out, "╔═══════════════════════════════════════════════╗\n");
+        fprintf(out, "║   SpeyTech Certifiable Inference Engine      ║\n");
+        fprintf(out, "║   Primitive Benchmark Suite                   ║\n");
+        fprintf(out, "╚═══════════════════════════════════════════════╝\n\n");
+        fprintf(out, "%u samples per case, per-call times in ns\n\n", samples);
+        fprintf(out, "%-15s %-13s %-7s %12s %8s %11s %12s %12s\n", "kernel", "size",
+                "backend", "ns/op", "GOPS", "bytes/op", "P99", "max");
+        fprintf(out, "──────────────────────────────────────────────────"
+                     "──────────────────────────────────────────\n");
+    }
+}
+
+static void print_result(FILE* out, const char* format, const bench_result_t* r, bool first) {
+    if (strcmp(format, "csv") == 0) {
+        fprintf(out, "%s,%s,%s,%.3f,%.4f,%.0f,%.3f,%.3f,%.3f,%u,%" PRIu32 "\n", r->kernel,
+                r->size, r->backend, r->ns_per_op, r->gops, r->bytes_per_op, r->p50, r->p99,
+                r->max, r->samples, r->batch);
+    } else if (strcmp(format, "json") == 0) {
+        fprintf(out, "%s\n    { \"kernel\": \"%s\", \"size\": \"%s\", \"backend\": \"%s\", "
+                     "\"ns_per_op\": %.3f, \"gops\": %.4f, \"bytes_per_op\": %.0f, "
+                     "\"p50_ns\": %.3f, \"p99_ns\": %.3f, \"max_ns\": %.3f, "
+                     "\"samples\": %u, \"batch\": %" PRIu32 " }",
+                first ? "" : ",", r->kernel, r->size, r->backend, r->ns_per_op, r->gops,
+                r->bytes_per_op, r->p50, r->p99, r->max, r->samples, r->batch);
+    } else {
+        fprintf(out, "%-15s %-13s %-7s %12.1f %8.3f %11.0f %12.1f %12.1f\n", r->kernel,
+                r->size, r->backend, r->ns_per_op, r->gops, r->bytes_per_op, r->p99, r->max);
+    }
+}
+
+static void print_footer(FILE* out, const char* format) {
+    if (strcmp(format, "json") == 0) {
+        fprintf(out, "\n  ]\n}\n");
+    } else if (strcmp(format, "text") == 0) {
+        fprintf(out, "\n");
+    }
+}
+
+static const char k_wcet_csv_header[] =
+    "kernel,size,backend,hot_p50_ns,hot_p99_ns,hot_max_ns,cold_p50_ns,cold_p99_ns,cold_max_ns,"
+    "samples";
+
+static void print_wcet_header(FILE* out, const char* format, unsigned samples,
+                              double ticks_per_ns, int cpu) {
+    const size_t evict_kb = g_evict_bytes / 1024u;
+
+    if (strcmp(format, "csv") == 0) {
+        fprintf(out, "%s\n", k_wcet_csv_header);
+    } else if (strcmp(format, "json") == 0) {
+        fprintf(out, "{\n  \"benchmark\": \"bench_suite\",\n  \"mode\": \"wcet\",\n"
+                     "  \"counter\": \"%s\",\n  \"ticks_per_ns\": %.4f,\n  \"cpu\": %d,\n"
+                     "  \"evict_kb\": %zu,\n  \"samples\": %u,\n  \"results\": [",
+                COUNTER_NAME, ticks_per_ns, cpu, evict_kb, samples);
+    } else {
+        fprintf(out, "╔═══════════════════════════════════════════════╗\n");
+        fprintf(out, "║   SpeyTech Certifiable Inference Engine      ║\n");
+        fprintf(out, "║   Primitive WCET Measurement                  ║\n");
+        fprintf(out, "╚═══════════════════════════════════════════════╝\n\n");
+        fprintf(out, "%u single calls per case, counter %s (%.3f ticks/ns), ", samples,
+                COUNTER_NAME, ticks_per_ns);
+        if (cpu >= 0) {
+            fprintf(out, "pinned to CPU %d\n", cpu);
+        } else {
+            fprintf(out, "not pinned\n");
+        }
+        fprintf(out, "cold: %zu KB written and operands flushed before each call\n\n", evict_kb);
+        fprintf(out, "%-15s %-13s %-7s %10s %10s %10s   %10s %10s %10s %6s\n", "kernel",
+                "size", "backend", "hot P50", "P99", "max", "cold P50", "P99", "max", "ratio");
+        fprintf(out, "──────────────────────────────────────────────────"
+                     "───────────────────────────────────────────────────────────\n");
+    }
+}
+
+static void print_wcet_result(FILE* out, const char* format, const wcet_result_t* r, bool first) {
+    const double ratio = r->hot[0] > 0.0 ? r->cold[0] / r->hot[0] : 0.0;
+
+    if (strcmp(format, "csv") == 0) {
+        fprintf(out, "%s,%s,%s,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%u\n", r->kernel, r->size,
+                r->backend, r->hot[0], r->hot[1], r->hot[2], r->cold[0], r->cold[1],
+                r->cold[2], r->samples);
+    } else if (strcmp(format, "json") == 0) {
+        fprintf(out, "%s\n    { \"kernel\": \"%s\", \"size\": \"%s\", \"backend\": \"%s\", "
+                     "\"hot_p50_ns\": %.1f, \"hot_p99_ns\": %.1f, \"hot_max_ns\": %.1f, "
+                     "\"cold_p50_ns\": %.1f, \"cold_p99_ns\": %.1f, \"cold_max_ns\": %.1f, "
+                     "\"samples\": %u }",
+                first ? "" : ",", r->kernel, r->size, r->backend, r->hot[0], r->hot[1],
+                r->hot[2], r->cold[0], r->cold[1], r->cold[2], r->samples);
+    } else {
+        fprintf(out, "%-15s %-13s %-7s %10.0f %10.0f %10.0f   %10.0f %10.0f %10.0f %6.2f\n",
+                r->kernel, r->size, r->backend, r->hot[0], r->hot[1], r->hot[2], r->cold[0],
+                r->cold[1], r->cold[2], ratio);
+    }
+}
+
+static const char k_ctr_csv_header[] =
+    "kernel,size,backend,ns_per_op,gops,ai,cycles,instructions,ipc,l1d_misses,llc_misses,"
+    "stall_cycles,dram_ai,pct_peak,samples,batch";
+
+/* @p v with @p prec decimals, or @p none if it is negative (unavailable) */
+static const char* opt(char* buf, size_t len, double v, int prec, const char* none) {
+    if (v < 0.0) {
+        return none;
+    }
+    snprintf(buf, len, "%.*f", prec, v);
+    return buf;
+}
+
+static void print_ctr_header(FILE* out, const char* format, unsigned samples, double peak_gops,
+                             double peak_gbs) {
+    if (strcmp(format, "csv") == 0) {
+        fprintf(out, "%s\n", k_ctr_csv_header);
+        return;
+    }
+    if (strcmp(format, "json") == 0) {
+        fprintf(out, "{\n  \"benchmark\": \"bench_suite\",\n  \"mode\": \"counters\",\n"
+                     "  \"counter_backend\": \"%s\",\n  \"counters\": [", COUNTER_BACKEND);
+        bool first = true;
+        for (unsigned c = 0; c < CTR_COUNT; c++) {
+            if (g_ctr_available[c]) {
+                fprintf(out, "%s\"%s\"", first ? "" : ", ", k_counter_names[c]);
+                first = false;
+            }
+        }
+        fprintf(out, "],\n  \"peak_gops\": %.3f,\n  \"peak_gbs\": %.3f,\n  \"samples\": %u,\n"
+                     "  \"results\": [", peak_gops, peak_gbs, samples);
+        return;
+    }
+    fprintf(out, "╔═══════════════════════════════════════════════╗\n");
+    fprintf(out, "║   SpeyTech Certifiable Inference Engine      ║\n");
+    fprintf(out, "║   Primitive Hardware Counters                 ║\n");
+    fprintf(out, "╚═══════════════════════════════════════════════╝\n\n");
+    fprintf(out, "%u samples per case, medians per call, counters from %s:", samples,
+            COUNTER_BACKEND);
+    for (unsigned c = 0; c < CTR_COUNT; c++) {
+        fprintf(out, " %s%s", k_counter_names[c], g_ctr_available[c] ? "" : " (n/a)");
+    }
+    fprintf(out, "\nAI = ops per operand byte, DRAM AI = ops per LLC-miss byte");
+    if (peak_gops > 0.0) {
+        fprintf(out, ", %%peak of %.1f GOPS", peak_gops);
+        if (peak_gbs > 0.0) {
+            fprintf(out, " / %.1f GB/s roofline", peak_gbs);
+        }
+    }
+    fprintf(out, "\n\n%-15s %-13s %-7s %10s %8s %6s %11s %5s %10s %10s %6s %8s %6s\n", "kernel",
+            "size", "backend", "ns/op", "GOPS", "AI", "cycles", "IPC", "L1D miss", "LLC miss",
+            "stall%", "DRAM AI", "%peak");
+    fprintf(out, "──────────────────────────────────────────────────"
+                 "───────────────────────────────────────────────────────────────────────\n");
+}
+
+static void print_ctr_result(FILE* out, const char* format, const counter_result_t* r,
+                             bool first) {
+    char b[CTR_COUNT + 3][32];
+    const double* n = r->count;
+    const double stall = n[CTR_STALL_CYCLES] >= 0.0 && n[CTR_CYCLES] > 0.0
+                         ? 100.0 * n[CTR_STALL_CYCLES] / n[CTR_CYCLES] : -1.0;
+
+    if (strcmp(format, "csv") == 0) {
+        fprintf(out, "%s,%s,%s,%.3f,%.4f,%.4f,%s,%s,%s,%s,%s,%s,%s,%s,%u,%" PRIu32 "\n",
+                r->kernel, r->size, r->backend, r->ns_per_op, r->gops, r->ai,
+                opt(b[0], 32, n[CTR_CYCLES], 1, ""), opt(b[1], 32, n[CTR_INSTRUCTIONS], 1, ""),
+                opt(b[2], 32, r->ipc, 3, ""), opt(b[3], 32, n[CTR_L1D_MISSES], 1, ""),
+                opt(b[4], 32, n[CTR_LLC_MISSES], 1, ""), opt(b[5], 32, n[CTR_STALL_CYCLES], 1, ""),
+                opt(b[6], 32, r->dram_ai, 3, ""), opt(b[7], 32, r->pct_peak, 2, ""),
+                r->samples, r->batch);
+    } else if (strcmp(format, "json") == 0) {
+        fprintf(out, "%s\n    { \"kernel\": \"%s\", \"size\": \"%s\", \"backend\": \"%s\", "
+                     "\"ns_per_op\": %.3f, \"gops\": %.4f, \"ai\": %.4f, \"cycles\": %s, "
+                     "\"instructions\": %s, \"ipc\": %s, \"l1d_misses\": %s, "
+                     "\"llc_misses\": %s, \"stall_cycles\": %s, \"dram_ai\": %s, "
+                     "\"pct_peak\": %s, \"samples\": %u, \"batch\": %" PRIu32 " }",
+                first ? "" : ",", r->kernel, r->size, r->backend, r->ns_per_op, r->gops, r->ai,
+                opt(b[0], 32, n[CTR_CYCLES], 1, "null"),
+                opt(b[1], 32, n[CTR_INSTRUCTIONS], 1, "null"), opt(b[2], 32, r->ipc, 3, "null"),
+                opt(b[3], 32, n[CTR_L1D_MISSES], 1, "null"),
+                opt(b[4], 32, n[CTR_LLC_MISSES], 1, "null"),
+                opt(b[5], 32, n[CTR_STALL_CYCLES], 1, "null"),
+                opt(b[6], 32, r->dram_ai, 3, "null"), opt(b[7], 32, r->pct_peak, 2, "null"),
+                r->samples, r->batch);
+    } else {
+        fprintf(out, "%-15s %-13s %-7s %10.1f %8.3f %6.2f %11s %5s %10s %10s %6s %8s %6s\n",
+                r->kernel, r->size, r->backend, r->ns_per_op, r->gops, r->ai,
+                opt(b[0], 32, n[CTR_CYCLES], 0, "-"), opt(b[1], 32, r->ipc, 2, "-"),
+                opt(b[2], 32, n[CTR_L1D_MISSES], 1, "-"), opt(b[3], 32, n[CTR_LLC_MISSES], 1, "-"),
+                opt(b[4], 32, stall, 1, "-"), opt(b[5], 32, r->dram_ai, 2, "-"),
+                opt(b[6], 32, r->pct_peak, 1, "-"));
+    }
+}
+
+/* ─── Baseline comparison ─────────────────────────────────────────────── */
+
+typedef struct {
+    char key[3 * MAX_NAME];      /**< "kernel,size,backend" */
+    double p50;
+} baseline_row_t;
+
+static baseline_row_t g_baseline[MAX_BASELINE];
+static size_t g_baseline_count;
+
+static bool load_baseline(const char* path) {
+    FILE* f = fopen(path, "r");
+    char line[512];
+
+    if (!f) {
+        fprintf(stderr, "bench_suite: cannot open baseline %s\n", path);
+        return false;
+    }
+    while (fgets(line, sizeof(line), f) && g_baseline_count < MAX_BASELINE) {
+        char kernel[MAX_NAME], size[MAX_NAME], backend[16];
+        double ns = 0.0;
+        if (strncmp(line, "kernel,", 7) == 0 ||
+            sscanf(line, "%47[^,],%47[^,],%15[^,],%lf", kernel, size, backend, &ns) != 4) {
+            continue;
+        }
+        baseline_row_t* b = &g_baseline[g_baseline_count++];
+        snprintf(b->key, sizeof(b->key), "%s,%s,%s", kernel, size, backend);
+        b->p50 = ns;
+    }
+    fclose(f);
+    return true;
+}
+
+/**
+ * @brief Compare one result with the baseline.
+ * @return true if the case regressed past the tolerance
+ */
+static bool regressed(const bench_result_t* r, double tolerance_pct) {
+    char key[3 * MAX_NAME];
+    snprintf(key, sizeof(key), "%s,%s,%s", r->kernel, r->size, r->backend);
+
+    for (size_t i = 0; i < g_baseline_count; i++) {
+        if (strcmp(g_baseline[i].key, key) != 0) {
+            continue;
+        }
+        const double limit = g_baseline[i].p50 * (1.0 + tolerance_pct / 100.0);
+        if (r->p50 > limit) {
+            fprintf(stderr, "REGRESSION %s: %.1f ns/op vs baseline %.1f (+%.1f%%, limit %.1f%%)\n",
+                    key, r->p50, g_baseline[i].p50,
+                    100.0 * (r->p50 / g_baseline[i].p50 - 1.0), tolerance_pct);
+            return true;
+        }
+        return false;
+    }
+    return false;
+}
+
+/* ─── Driver ──────────────────────────────────────────────────────────── */
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: bench_suite [--format text|csv|json] [--output FILE] [--filter TEXT]\n"
+            "                   [--samples N] [--baseline FILE] [--tolerance PCT]\n"
+            "                   [--wcet [--evict-kb KB] [--cpu N]]\n"
+            "                   [--counters [--peak-gops G] [--peak-gbs B]]\n");
+}
+
+int main(int argc, char** argv) {
+    const char* format = "text";
+    const char* output = NULL;
+    const char* filter = NULL;
+    const char* baseline = NULL;
+    double tolerance = 10.0;
+    unsigned samples = DEFAULT_SAMPLES;
+    bool wcet = false;
+    unsigned long evict_kb = DEFAULT_EVICT_KB;
+    int cpu = -1;
+    bool counters = false;
+    double peak_gops = 0.0, peak_gbs = 0.0;
+
+    for (int i = 1; i < argc; i++) {
+        const bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--format") == 0 && has_value) {
+            format = argv[++i];
+        } else if (strcmp(argv[i], "--output") == 0 && has_value) {
+            output = argv[++i];
+        } else if (strcmp(argv[i], "--filter") == 0 && has_value) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && has_value) {
+            baseline = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && has_value) {
+            tolerance = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--samples") == 0 && has_value) {
+            samples = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--wcet") == 0) {
+            wcet = true;
+        } else if (strcmp(argv[i], "--evict-kb") == 0 && has_value) {
+            evict_kb = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--cpu") == 0 && has_value) {
+            cpu = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--counters") == 0) {
+            counters = true;
+        } else if (strcmp(argv[i], "--peak-gops") == 0 && has_value) {
+            peak_gops = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--peak-gbs") == 0 && has_value) {
+            peak_gbs = atof(argv[++i]);
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (strcmp(format, "text") != 0 && strcmp(format, "csv") != 0 &&
+        strcmp(format, "json") != 0) {
+        usage();
+        return 2;
+    }
+    if (samples < 1 || samples > MAX_SAMPLES || tolerance < 0.0) {
+        fprintf(stderr, "bench_suite: samples must be 1 … %d, tolerance ≥ 0\n", MAX_SAMPLES);
+        return 2;
+    }
+    if (evict_kb > MAX_EVICT_KB || (wcet && baseline)) {
+        fprintf(stderr, "bench_suite: evict-kb must be ≤ %u; --baseline applies without --wcet\n",
+                MAX_EVICT_KB);
+        return 2;
+    }
+    if (counters && (wcet || baseline)) {
+        fprintf(stderr, "bench_suite: --counters excludes --wcet and --baseline\n");
+        return 2;
+    }
+    g_evict_bytes = (size_t)evict_kb * 1024u;
+    if (baseline && !load_baseline(baseline)) {
+        return 2;
+    }
+
+    FILE* out = output ? fopen(output, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "bench_suite: cannot write %s\n", output);
+        return 2;
+    }
+
+    for (unsigned i = 0; i < HASH_CAPACITY; i++) {
+        snprintf(g_keys[i], HASH_KEY_LEN, "layer%u.weight", i);
+        g_key_ptrs[i] = g_keys[i];
+    }
+
+    const fx_backend_t best = fx_dispatch_init();
+    unsigned regressions = 0;
+    bool first = true;
+
+    double ticks_per_ns = 1.0;
+    if (wcet) {
+        cpu = pin_to_cpu(cpu);
+        if (cpu < 0) {
+            fprintf(stderr, "bench_suite: could not pin to a CPU, measuring unpinned\n");
+        }
+        ticks_per_ns = counter_rate();
+        print_wcet_header(out, format, samples, ticks_per_ns, cpu);
+    } else if (counters) {
+        if (!counters_open(g_ctr_available)) {
+            fprintf(stderr, "bench_suite: no hardware counters (%s); reporting time and AI only\n",
+                    COUNTER_BACKEND);
+        }
+        print_ctr_header(out, format, samples, peak_gops, peak_gbs);
+    } else {
+        print_header(out, format, samples);
+    }
+    for (size_t c = 0; c < NUM_CASES; c++) {
+        const bench_case_t* bc = &k_cases[c];
+        if (filter && !strstr(bc->kernel, filter)) {
+            continue;
+        }
+        const int last = bc->dispatched ? FX_BACKEND_COUNT - 1 : FX_BACKEND_SCALAR;
+        for (int b = FX_BACKEND_SCALAR; b <= last; b++) {
+            const fx_backend_t backend = bc->dispatched ? (fx_backend_t)b : best;
+            const char* name = bc->dispatched ? fx_backend_name(backend) : "any";
+            bench_result_t r;
+
+            if (fx_dispatch_pin(backend) != FX_DISPATCH_OK) {
+                continue;
+            }
+            if (wcet) {
+                wcet_result_t w;
+                measure_wcet(bc, name, samples, ticks_per_ns, &w);
+                print_wcet_result(out, format, &w, first);
+                first = false;
+                continue;
+            }
+            if (counters) {
+                counter_result_t cr;
+                measure_counters(bc, name, samples, peak_gops, peak_gbs, &cr);
+                print_ctr_result(out, format, &cr, first);
+                first = false;
+                continue;
+            }
+            measure(bc, name, samples, &r);
+            print_result(out, format, &r, first);
+            first = false;
+            if (baseline && regressed(&r, tolerance)) {
+                regressions++;
+            }
+        }
+    }
+    print_footer(out, format);
+    (void)fx_dispatch_pin(best);
+
+    if (output) {
+        fclose(out);
+    }
+    if (baseline) {
+        fprintf(stderr, "bench_suite: %u regression(s) beyond %.1f%% of %s\n", regressions,
+                tolerance, baseline);
+    }
+    return regressions ? 1 : 0;
+}
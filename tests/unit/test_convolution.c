@@ -8,8 +8,11 @@
  * - Edge detection (Sobel kernels)
  * - Boundary handling
  * - Deterministic behavior
+ * - Multi-channel convolution with stride, padding, dilation and bias
+ * - im2col + GEMM lowering bit-identical to the direct algorithm
+ * - Winograd F(2×2, 3×3) bit-identical, with setup-time exactness proof
  *
- * @traceability SRS-004-CONVOLUTION
+ * @traceability SRS-004-CONVOLUTION, SRS-004.9, SRS-006.7 - SRS-006.12
  * @compliance DO-178C, ISO 26262, IEC 62304
  *
  * @author William Murray
@@ -18,9 +21,12 @@
  */
 
 #include "convolution.h"
+#include "activations.h"
+#include "pooling.h"
 #include "fixed_point.h"
 #include <stdio.h>
 #include <assert.h>
+#include <string.h>
 
 /* Test counter */
 static int tests_passed = 0;
@@ -318,6 +324,705 @@ static void test_zero_kernel(void) {
     TEST_ASSERT(all_zero, "Zero kernel produces zero output");
 }
 
+/*
+ * Multi-channel convolution (SRS-006.7 - SRS-006.10)
+ */
+
+#define MC_MAX_ELEMS 8192
+
+static fixed_t g_in[MC_MAX_ELEMS];
+static fixed_t g_w[MC_MAX_ELEMS];
+static fixed_t g_out_a[MC_MAX_ELEMS];
+static fixed_t g_out_b[MC_MAX_ELEMS];
+static fixed_t g_ws[32768];
+static int64_t g_u[16384];
+
+/**
+ * @brief Deterministic LCG so inputs are identical on every platform.
+ */
+static uint32_t g_lcg_state = 0x5EEDu;
+static fixed_t lcg_fixed(unsigned bits) {
+    g_lcg_state = g_lcg_state * 1664525u + 1013904223u;
+    return (fixed_t)((int64_t)(g_lcg_state >> (32u - bits)) - ((int64_t)1 << (bits - 1u)));
+}
+
+/**
+ * @test Output extent formula
+ * @traceability SRS-006.7, SRS-006.9, SRS-006.10
+ */
+static void test_conv_out_dim(void) {
+    printf("\nTest: Output extent\n");
+    printf("────────────────────\n");
+
+    TEST_ASSERT(fx_conv2d_out_dim(8, 3, 1, 0, 1) == 6, "Valid: 8, k3 → 6");
+    TEST_ASSERT(fx_conv2d_out_dim(8, 3, 1, 1, 1) == 8, "Same: 8, k3, pad 1 → 8");
+    TEST_ASSERT(fx_conv2d_out_dim(8, 3, 2, 1, 1) == 4, "Strided: 8, k3, s2, pad 1 → 4");
+    TEST_ASSERT(fx_conv2d_out_dim(9, 3, 1, 0, 2) == 5, "Dilated: 9, k3, d2 → 5");
+    TEST_ASSERT(fx_conv2d_out_dim(4, 3, 1, 0, 2) == 0, "Dilated kernel larger than input → 0");
+    TEST_ASSERT(fx_conv2d_out_dim(8, 3, 0, 0, 1) == 0, "Zero stride → 0");
+}
+
+/**
+ * @test One channel, one filter, default geometry equals fx_conv2d()
+ * @traceability SRS-006.8
+ */
+static void test_multi_matches_single(void) {
+    printf("\nTest: Multi-channel degenerates to fx_conv2d\n");
+    printf("─────────────────────────────────────────────\n");
+
+    fx_matrix_t m_in, m_k, m_out;
+    fx_tensor_t t_in, t_k, t_out;
+    const fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+
+    for (size_t i = 0; i < 12 * 10; i++) {
+        g_in[i] = lcg_fixed(24);
+    }
+    for (size_t i = 0; i < 9; i++) {
+        g_w[i] = lcg_fixed(20);
+    }
+
+    fx_matrix_attach(&m_in, g_in, 12, 10);
+    fx_matrix_attach(&m_k, g_w, 3, 3);
+    fx_matrix_init(&m_out, g_out_a, 10, 8);
+    fx_tensor_attach(&t_in, g_in, 1, 1, 12, 10, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&t_k, g_w, 1, 1, 3, 3, FX_LAYOUT_NCHW);
+    fx_tensor_init(&t_out, g_out_b, 1, 1, 10, 8, FX_LAYOUT_NCHW);
+
+    fx_conv2d(&m_in, &m_k, &m_out);
+    fx_conv_res_t res = fx_conv2d_multi(&t_in, &t_k, NULL, &p, &t_out);
+
+    TEST_ASSERT(res == FX_CONV_OK, "Returns FX_CONV_OK");
+    TEST_ASSERT(memcmp(g_out_a, g_out_b, 80 * sizeof(fixed_t)) == 0, "Bit-identical to fx_conv2d");
+}
+
+/**
+ * @test Zero padding, stride and dilation against hand-computed values
+ * @traceability SRS-006.7, SRS-006.9, SRS-006.10
+ */
+static void test_multi_geometry(void) {
+    printf("\nTest: Padding, stride, dilation\n");
+    printf("────────────────────────────────\n");
+
+    fx_tensor_t in, k, out;
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+
+    /* 3×3 ones, 3×3 ones kernel, pad 1: corners see 4 taps, edges 6, centre 9 */
+    for (size_t i = 0; i < 9; i++) {
+        g_in[i] = FIXED_ONE;
+        g_w[i] = FIXED_ONE;
+    }
+    fx_tensor_attach(&in, g_in, 1, 1, 3, 3, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&k, g_w, 1, 1, 3, 3, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out, g_out_a, 1, 1, 3, 3, FX_LAYOUT_NCHW);
+    p.pad_h = 1;
+    p.pad_w = 1;
+    fx_conv2d_multi(&in, &k, NULL, &p, &out);
+    TEST_ASSERT(g_out_a[0] == fixed_from_int(4), "Padded corner = 4");
+    TEST_ASSERT(g_out_a[1] == fixed_from_int(6), "Padded edge = 6");
+    TEST_ASSERT(g_out_a[4] == fixed_from_int(9), "Centre = 9");
+
+    /* 5×5 ramp in[r][c] = 5r + c, 2×2 ones kernel, dilation 2 → 3×3 */
+    for (int i = 0; i < 25; i++) {
+        g_in[i] = fixed_from_int(i);
+    }
+    fx_tensor_attach(&in, g_in, 1, 1, 5, 5, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&k, g_w, 1, 1, 2, 2, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out, g_out_a, 1, 1, 3, 3, FX_LAYOUT_NCHW);
+    p = (fx_conv_params_t)FX_CONV_PARAMS_DEFAULT;
+    p.dilation_h = 2;
+    p.dilation_w = 2;
+    fx_conv2d_multi(&in, &k, NULL, &p, &out);
+    TEST_ASSERT(g_out_a[0] == fixed_from_int(0 + 2 + 10 + 12), "Dilated tap sum at (0,0)");
+    TEST_ASSERT(g_out_a[8] == fixed_from_int(12 + 14 + 22 + 24), "Dilated tap sum at (2,2)");
+
+    /* Same ramp, 1×1 kernel, stride 2 → samples every other pixel */
+    fx_tensor_attach(&k, g_w, 1, 1, 1, 1, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out, g_out_a, 1, 1, 3, 3, FX_LAYOUT_NCHW);
+    p = (fx_conv_params_t)FX_CONV_PARAMS_DEFAULT;
+    p.stride_h = 2;
+    p.stride_w = 2;
+    fx_conv2d_multi(&in, &k, NULL, &p, &out);
+    TEST_ASSERT(g_out_a[1] == fixed_from_int(2) && g_out_a[3] == fixed_from_int(10),
+                "Stride 2 samples (0,2) and (2,0)");
+}
+
+/**
+ * @test Filter-blocked kernel matches the reference over many shapes
+ * @traceability SRS-006.3, SRS-006.8
+ */
+static void test_multi_matches_reference(void) {
+    printf("\nTest: fx_conv2d_multi vs reference\n");
+    printf("───────────────────────────────────\n");
+
+    static const uint16_t cfg[][11] = {
+        /* n, cin, h, w, cout, kh, kw, stride, pad, dil, nhwc */
+        {1, 1, 6, 6, 1, 3, 3, 1, 0, 1, 0},
+        {2, 3, 9, 7, 5, 3, 3, 1, 1, 1, 0},
+        {1, 4, 11, 13, 13, 3, 3, 2, 1, 1, 1},
+        {1, 2, 10, 10, 8, 5, 5, 1, 2, 1, 0},
+        {3, 3, 8, 9, 9, 3, 2, 1, 0, 2, 1},
+        {1, 8, 7, 7, 17, 1, 1, 1, 0, 1, 0},
+        {2, 5, 12, 6, 3, 3, 3, 3, 2, 2, 1},
+    };
+
+    int identical = 1;
+    for (size_t t = 0; t < sizeof(cfg) / sizeof(cfg[0]); t++) {
+        const fx_layout_t layout = cfg[t][10] ? FX_LAYOUT_NHWC : FX_LAYOUT_NCHW;
+        fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+        fx_tensor_t in, k, out_a, out_b;
+        fixed_t bias[32];
+
+        p.stride_h = p.stride_w = cfg[t][7];
+        p.pad_h = p.pad_w = cfg[t][8];
+        p.dilation_h = p.dilation_w = cfg[t][9];
+
+        const uint16_t oh = fx_conv2d_out_dim(cfg[t][2], cfg[t][5], cfg[t][7], cfg[t][8], cfg[t][9]);
+        const uint16_t ow = fx_conv2d_out_dim(cfg[t][3], cfg[t][6], cfg[t][7], cfg[t][8], cfg[t][9]);
+
+        fx_tensor_attach(&in, g_in, cfg[t][0], cfg[t][1], cfg[t][2], cfg[t][3], layout);
+        fx_tensor_attach(&k, g_w, cfg[t][4], cfg[t][1], cfg[t][5], cfg[t][6], layout);
+        fx_tensor_init(&out_a, g_out_a, cfg[t][0], cfg[t][4], oh, ow, layout);
+        fx_tensor_init(&out_b, g_out_b, cfg[t][0], cfg[t][4], oh, ow, layout);
+
+        for (size_t i = 0; i < fx_tensor_size(&in); i++) {
+            g_in[i] = lcg_fixed(24);
+        }
+        for (size_t i = 0; i < fx_tensor_size(&k); i++) {
+            g_w[i] = lcg_fixed(20);
+        }
+        for (size_t i = 0; i < cfg[t][4]; i++) {
+            bias[i] = lcg_fixed(20);
+        }
+
+        if (fx_conv2d_multi(&in, &k, bias, &p, &out_a) != FX_CONV_OK ||
+            fx_conv2d_multi_ref(&in, &k, bias, &p, &out_b) != FX_CONV_OK ||
+            memcmp(g_out_a, g_out_b, fx_tensor_size(&out_a) * sizeof(fixed_t)) != 0) {
+            identical = 0;
+        }
+    }
+
+    TEST_ASSERT(identical, "Bit-identical for all shapes, both layouts, with bias");
+}
+
+/**
+ * @test NCHW and NHWC tensors holding the same values give the same result
+ * @traceability SRS-006.8
+ */
+static void test_multi_layout_independence(void) {
+    printf("\nTest: NCHW / NHWC equivalence\n");
+    printf("──────────────────────────────\n");
+
+    enum { N = 2, C = 3, H = 6, W = 5, O = 4, K = 3 };
+    static fixed_t in_nhwc[N * C * H * W];
+    static fixed_t w_nhwc[O * C * K * K];
+    fx_tensor_t in_a, in_b, k_a, k_b, out_a, out_b;
+    const fx_conv_params_t p = { 1, 1, 1, 1, 1, 1, FX_CONV_ALGO_DIRECT };
+
+    fx_tensor_attach(&in_a, g_in, N, C, H, W, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&in_b, in_nhwc, N, C, H, W, FX_LAYOUT_NHWC);
+    fx_tensor_attach(&k_a, g_w, O, C, K, K, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&k_b, w_nhwc, O, C, K, K, FX_LAYOUT_NHWC);
+    fx_tensor_init(&out_a, g_out_a, N, O, H, W, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out_b, g_out_b, N, O, H, W, FX_LAYOUT_NHWC);
+
+    for (size_t n = 0; n < N; n++) {
+        for (size_t c = 0; c < C; c++) {
+            for (size_t y = 0; y < H; y++) {
+                for (size_t x = 0; x < W; x++) {
+                    fixed_t v = lcg_fixed(24);
+                    g_in[fx_tensor_offset(&in_a, n, c, y, x)] = v;
+                    in_nhwc[fx_tensor_offset(&in_b, n, c, y, x)] = v;
+                }
+            }
+        }
+    }
+    for (size_t o = 0; o < O; o++) {
+        for (size_t c = 0; c < C; c++) {
+            for (size_t y = 0; y < K; y++) {
+                for (size_t x = 0; x < K; x++) {
+                    fixed_t v = lcg_fixed(20);
+                    g_w[fx_tensor_offset(&k_a, o, c, y, x)] = v;
+                    w_nhwc[fx_tensor_offset(&k_b, o, c, y, x)] = v;
+                }
+            }
+        }
+    }
+
+    fx_conv2d_multi(&in_a, &k_a, NULL, &p, &out_a);
+    fx_conv2d_multi(&in_b, &k_b, NULL, &p, &out_b);
+
+    int identical = 1;
+    for (size_t n = 0; n < N; n++) {
+        for (size_t o = 0; o < O; o++) {
+            for (size_t y = 0; y < H; y++) {
+                for (size_t x = 0; x < W; x++) {
+                    if (g_out_a[fx_tensor_offset(&out_a, n, o, y, x)] !=
+                        g_out_b[fx_tensor_offset(&out_b, n, o, y, x)]) {
+                        identical = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    TEST_ASSERT(identical, "Same logical output in both layouts");
+}
+
+/**
+ * @test Invalid arguments are rejected without touching the output
+ * @traceability SRS-006.1, SRS-006.8
+ */
+static void test_multi_invalid(void) {
+    printf("\nTest: Multi-channel argument validation\n");
+    printf("────────────────────────────────────────\n");
+
+    fx_tensor_t in, k, out;
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+
+    fx_tensor_attach(&in, g_in, 1, 2, 5, 5, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&k, g_w, 3, 2, 3, 3, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&out, g_out_a, 1, 3, 3, 3, FX_LAYOUT_NCHW);
+    for (size_t i = 0; i < 27; i++) {
+        g_out_a[i] = (fixed_t)0x7E57;
+    }
+
+    TEST_ASSERT(fx_conv2d_multi(NULL, &k, NULL, &p, &out) == FX_CONV_INVALID_PARAM, "NULL input");
+    TEST_ASSERT(fx_conv2d_multi(&in, &k, NULL, NULL, &out) == FX_CONV_INVALID_PARAM, "NULL params");
+
+    p.stride_w = 0;
+    TEST_ASSERT(fx_conv2d_multi(&in, &k, NULL, &p, &out) == FX_CONV_INVALID_PARAM, "Zero stride");
+    p = (fx_conv_params_t)FX_CONV_PARAMS_DEFAULT;
+
+    k.c = 1;
+    TEST_ASSERT(fx_conv2d_multi(&in, &k, NULL, &p, &out) == FX_CONV_DIM_MISMATCH, "C_in mismatch");
+    k.c = 2;
+
+    out.h = 4;
+    TEST_ASSERT(fx_conv2d_multi(&in, &k, NULL, &p, &out) == FX_CONV_DIM_MISMATCH, "Wrong output height");
+    out.h = 3;
+
+    int untouched = 1;
+    for (size_t i = 0; i < 27; i++) {
+        if (g_out_a[i] != (fixed_t)0x7E57) {
+            untouched = 0;
+        }
+    }
+    TEST_ASSERT(untouched, "Output untouched on error");
+}
+
+/**
+ * @test im2col + GEMM matches the direct algorithm exactly
+ * @traceability SRS-006.11, SRS-003.9
+ */
+static void test_im2col_matches_direct(void) {
+    printf("\nTest: im2col lowering vs direct\n");
+    printf("────────────────────────────────\n");
+
+    static const uint16_t cfg[][12] = {
+        /* n, cin, h, w, cout, kh, kw, stride, pad, dil, in_nhwc, out_nhwc */
+        {1, 1, 6, 6, 1, 3, 3, 1, 0, 1, 0, 0},
+        {2, 3, 9, 7, 5, 3, 3, 1, 1, 1, 0, 1},
+        {1, 4, 11, 13, 13, 3, 3, 2, 1, 1, 1, 0},
+        {1, 2, 24, 22, 6, 3, 3, 1, 1, 1, 0, 0},   /* 528 pixels: three tiles */
+        {3, 3, 8, 9, 9, 3, 2, 1, 0, 2, 1, 1},
+        {1, 8, 20, 20, 17, 1, 1, 1, 0, 1, 0, 0},  /* 1×1 identity lowering */
+        {2, 5, 18, 16, 3, 1, 1, 1, 0, 1, 0, 1},   /* identity, NHWC out */
+        {2, 5, 12, 6, 3, 3, 3, 3, 2, 2, 1, 0},
+    };
+
+    int identical = 1;
+    int sized = 1;
+    for (size_t t = 0; t < sizeof(cfg) / sizeof(cfg[0]); t++) {
+        const fx_layout_t in_layout = cfg[t][10] ? FX_LAYOUT_NHWC : FX_LAYOUT_NCHW;
+        const fx_layout_t out_layout = cfg[t][11] ? FX_LAYOUT_NHWC : FX_LAYOUT_NCHW;
+        fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+        fx_tensor_t in, k, out_a, out_b;
+        fixed_t bias[32];
+
+        p.stride_h = p.stride_w = cfg[t][7];
+        p.pad_h = p.pad_w = cfg[t][8];
+        p.dilation_h = p.dilation_w = cfg[t][9];
+
+        const uint16_t oh = fx_conv2d_out_dim(cfg[t][2], cfg[t][5], cfg[t][7], cfg[t][8], cfg[t][9]);
+        const uint16_t ow = fx_conv2d_out_dim(cfg[t][3], cfg[t][6], cfg[t][7], cfg[t][8], cfg[t][9]);
+
+        fx_tensor_attach(&in, g_in, cfg[t][0], cfg[t][1], cfg[t][2], cfg[t][3], in_layout);
+        fx_tensor_attach(&k, g_w, cfg[t][4], cfg[t][1], cfg[t][5], cfg[t][6], in_layout);
+        fx_tensor_init(&out_a, g_out_a, cfg[t][0], cfg[t][4], oh, ow, out_layout);
+        fx_tensor_init(&out_b, g_out_b, cfg[t][0], cfg[t][4], oh, ow, out_layout);
+
+        for (size_t i = 0; i < fx_tensor_size(&in); i++) {
+            g_in[i] = lcg_fixed(24);
+        }
+        for (size_t i = 0; i < fx_tensor_size(&k); i++) {
+            g_w[i] = lcg_fixed(20);
+        }
+        for (size_t i = 0; i < cfg[t][4]; i++) {
+            bias[i] = lcg_fixed(20);
+        }
+
+        p.algo = FX_CONV_ALGO_IM2COL;
+        const size_t ws = fx_conv2d_workspace_size(&in, &k, &p, &out_b);
+        if (ws > sizeof(g_ws) / sizeof(g_ws[0])) {
+            sized = 0;
+            continue;
+        }
+
+        p.algo = FX_CONV_ALGO_DIRECT;
+        fx_conv_res_t ra = fx_conv2d_layer(&in, &k, bias, &p, NULL, 0, &out_a);
+        p.algo = FX_CONV_ALGO_IM2COL;
+        fx_conv_res_t rb = fx_conv2d_layer(&in, &k, bias, &p, g_ws, ws, &out_b);
+
+        if (ra != FX_CONV_OK || rb != FX_CONV_OK ||
+            memcmp(g_out_a, g_out_b, fx_tensor_size(&out_a) * sizeof(fixed_t)) != 0) {
+            identical = 0;
+        }
+    }
+
+    TEST_ASSERT(sized, "Workspace fits test buffer");
+    TEST_ASSERT(identical, "Bit-identical for all shapes, layouts, tiles, with bias");
+}
+
+/**
+ * @test Workspace sizing and enforcement
+ * @traceability SRS-006.11
+ */
+static void test_im2col_workspace(void) {
+    printf("\nTest: im2col workspace\n");
+    printf("───────────────────────\n");
+
+    fx_tensor_t in, k, out;
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+
+    /* 2 × 10 × 10 input, 4 filters of 3×3 → 8×8 = 64 pixels, K = 18 */
+    fx_tensor_attach(&in, g_in, 1, 2, 10, 10, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&k, g_w, 4, 2, 3, 3, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out, g_out_a, 1, 4, 8, 8, FX_LAYOUT_NCHW);
+
+    TEST_ASSERT(fx_conv2d_workspace_size(&in, &k, &p, &out) == 0, "Direct needs no workspace");
+
+    p.algo = FX_CONV_ALGO_IM2COL;
+    TEST_ASSERT(fx_conv2d_workspace_size(&in, &k, &p, &out) == 18 * 64, "im2col: K × pixels");
+
+    out.layout = FX_LAYOUT_NHWC;
+    TEST_ASSERT(fx_conv2d_workspace_size(&in, &k, &p, &out) == 18 * 64 + 4 * 64,
+                "NHWC output adds staging tile");
+    out.layout = FX_LAYOUT_NCHW;
+
+    TEST_ASSERT(fx_conv2d_layer(&in, &k, NULL, &p, g_ws, 18 * 64 - 1, &out) ==
+                FX_CONV_WORKSPACE_TOO_SMALL, "Short workspace rejected");
+    TEST_ASSERT(fx_conv2d_layer(&in, &k, NULL, &p, NULL, 0, &out) ==
+                FX_CONV_WORKSPACE_TOO_SMALL, "Missing workspace rejected");
+
+    /* 1×1 on NCHW input lowers without copying */
+    fx_tensor_attach(&k, g_w, 4, 2, 1, 1, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out, g_out_a, 1, 4, 10, 10, FX_LAYOUT_NCHW);
+    TEST_ASSERT(fx_conv2d_workspace_size(&in, &k, &p, &out) == 0, "1×1 NCHW needs no workspace");
+    TEST_ASSERT(fx_conv2d_layer(&in, &k, NULL, &p, NULL, 0, &out) == FX_CONV_OK,
+                "1×1 runs without workspace");
+
+    p.algo = (fx_conv_algo_t)99;
+    TEST_ASSERT(fx_conv2d_layer(&in, &k, NULL, &p, NULL, 0, &out) == FX_CONV_INVALID_PARAM,
+                "Unknown algorithm rejected");
+}
+
+/**
+ * @test Winograd matches the direct reference on randomized layers
+ * @traceability SRS-006.12
+ */
+static void test_winograd_matches_reference(void) {
+    printf("\nTest: Winograd F(2x2,3x3) vs reference\n");
+    printf("───────────────────────────────────────\n");
+
+    static const uint16_t cfg[][8] = {
+        /* n, cin, h, w, cout, pad, nhwc, input bits */
+        {1, 1, 4, 4, 1, 0, 0, 24},
+        {1, 1, 5, 7, 1, 0, 0, 24},     /* odd output: partial tiles */
+        {2, 3, 9, 8, 5, 1, 0, 24},
+        {1, 17, 10, 11, 9, 1, 1, 24},  /* > one channel and filter block */
+        {1, 4, 12, 12, 16, 2, 0, 24},
+        {3, 2, 6, 9, 3, 1, 1, 32},     /* full fixed_t input range */
+    };
+
+    int planned = 1;
+    int identical = 1;
+    for (size_t t = 0; t < sizeof(cfg) / sizeof(cfg[0]); t++) {
+        const fx_layout_t layout = cfg[t][6] ? FX_LAYOUT_NHWC : FX_LAYOUT_NCHW;
+        const unsigned bits = cfg[t][7];
+        fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+        fx_winograd_plan_t plan;
+        fx_tensor_t in, k, out_a, out_b;
+        fixed_t bias[32];
+
+        p.pad_h = p.pad_w = cfg[t][5];
+        const uint16_t oh = fx_conv2d_out_dim(cfg[t][2], 3, 1, cfg[t][5], 1);
+        const uint16_t ow = fx_conv2d_out_dim(cfg[t][3], 3, 1, cfg[t][5], 1);
+
+        fx_tensor_attach(&in, g_in, cfg[t][0], cfg[t][1], cfg[t][2], cfg[t][3], layout);
+        fx_tensor_attach(&k, g_w, cfg[t][4], cfg[t][1], 3, 3, layout);
+        fx_tensor_init(&out_a, g_out_a, cfg[t][0], cfg[t][4], oh, ow, FX_LAYOUT_NCHW);
+        fx_tensor_init(&out_b, g_out_b, cfg[t][0], cfg[t][4], oh, ow, FX_LAYOUT_NCHW);
+
+        for (size_t i = 0; i < fx_tensor_size(&in); i++) {
+            g_in[i] = lcg_fixed(bits);
+        }
+        for (size_t i = 0; i < fx_tensor_size(&k); i++) {
+            g_w[i] = lcg_fixed(18);
+        }
+        for (size_t i = 0; i < cfg[t][4]; i++) {
+            bias[i] = lcg_fixed(20);
+        }
+        if (bits == 32) {
+            g_in[0] = FIXED_MIN;
+            g_in[1] = FIXED_MAX;
+        }
+
+        const uint32_t bound = (bits == 32) ? FX_WINOGRAD_BOUND_ANY : (1u << (bits - 1u));
+        if (fx_winograd_plan(&plan, &k, &p, bound, g_u, sizeof(g_u) / sizeof(g_u[0])) != FX_CONV_OK) {
+            planned = 0;
+            continue;
+        }
+
+        if (fx_conv2d_multi_ref(&in, &k, bias, &p, &out_a) != FX_CONV_OK ||
+            fx_conv2d_winograd(&plan, &in, bias, &out_b) != FX_CONV_OK ||
+            memcmp(g_out_a, g_out_b, fx_tensor_size(&out_a) * sizeof(fixed_t)) != 0) {
+            identical = 0;
+        }
+    }
+
+    TEST_ASSERT(planned, "All layers proven exact at setup");
+    TEST_ASSERT(identical, "Bit-identical for all layers, layouts, paddings, with bias");
+}
+
+/**
+ * @test Layers that cannot be proven exact or are unsupported are rejected
+ * @traceability SRS-006.12
+ */
+static void test_winograd_rejection(void) {
+    printf("\nTest: Winograd setup-time rejection\n");
+    printf("────────────────────────────────────\n");
+
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+    fx_winograd_plan_t plan;
+    fx_tensor_t in, k, out;
+    const size_t u_len = sizeof(g_u) / sizeof(g_u[0]);
+
+    /* 64 channels of extreme weights with unbounded input overflow int64 */
+    fx_tensor_attach(&k, g_w, 2, 64, 3, 3, FX_LAYOUT_NCHW);
+    for (size_t i = 0; i < fx_tensor_size(&k); i++) {
+        g_w[i] = (i % 2) ? FIXED_MAX : FIXED_MIN;
+    }
+    TEST_ASSERT(fx_winograd_plan(&plan, &k, &p, FX_WINOGRAD_BOUND_ANY, g_u, u_len) == FX_CONV_INEXACT,
+                "Overflow-prone layer rejected");
+
+    /* Same weights are provably exact once inputs are bounded to ±1.0 */
+    TEST_ASSERT(fx_winograd_plan(&plan, &k, &p, (uint32_t)FIXED_ONE, g_u, u_len) == FX_CONV_OK,
+                "Bounded input makes layer exact");
+
+    /* Inputs violating the proven bound are refused at run time */
+    fx_tensor_attach(&in, g_in, 1, 64, 4, 4, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&out, g_out_a, 1, 2, 2, 2, FX_LAYOUT_NCHW);
+    for (size_t i = 0; i < fx_tensor_size(&in); i++) {
+        g_in[i] = FIXED_HALF;
+    }
+    g_in[100] = FIXED_ONE + 1;
+    for (size_t i = 0; i < 8; i++) {
+        g_out_a[i] = (fixed_t)0x7E57;
+    }
+    TEST_ASSERT(fx_conv2d_winograd(&plan, &in, NULL, &out) == FX_CONV_INEXACT,
+                "Out-of-bound input rejected");
+    TEST_ASSERT(g_out_a[0] == (fixed_t)0x7E57 && g_out_a[7] == (fixed_t)0x7E57,
+                "Output untouched on rejection");
+
+    /* Geometry the transform does not cover */
+    fx_tensor_attach(&k, g_w, 1, 1, 5, 5, FX_LAYOUT_NCHW);
+    TEST_ASSERT(fx_winograd_plan(&plan, &k, &p, FX_WINOGRAD_BOUND_ANY, g_u, u_len) == FX_CONV_UNSUPPORTED,
+                "5×5 kernel unsupported");
+    fx_tensor_attach(&k, g_w, 1, 1, 3, 3, FX_LAYOUT_NCHW);
+    p.stride_h = 2;
+    TEST_ASSERT(fx_winograd_plan(&plan, &k, &p, FX_WINOGRAD_BOUND_ANY, g_u, u_len) == FX_CONV_UNSUPPORTED,
+                "Stride 2 unsupported");
+    p.stride_h = 1;
+    TEST_ASSERT(fx_winograd_plan(&plan, &k, &p, FX_WINOGRAD_BOUND_ANY, g_u, 15) ==
+                FX_CONV_WORKSPACE_TOO_SMALL, "Short filter storage rejected");
+}
+
+/**
+ * @test Plan from filters transformed elsewhere (offline) equals the runtime plan
+ * @traceability SRS-006.13
+ */
+static void test_winograd_transformed(void) {
+    printf("\nTest: Winograd plan from transformed filters\n");
+    printf("────────────────────────────────────────────\n");
+
+    static int64_t u_file[5 * 3 * FX_WINOGRAD_TILE];
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+    fx_winograd_plan_t plan_rt, plan_tf;
+    fx_tensor_t in, k, out_a, out_b;
+    const size_t u_len = sizeof(g_u) / sizeof(g_u[0]);
+
+    p.pad_h = p.pad_w = 1;
+    fx_tensor_attach(&in, g_in, 2, 3, 9, 8, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&k, g_w, 5, 3, 3, 3, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out_a, g_out_a, 2, 5, 9, 8, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out_b, g_out_b, 2, 5, 9, 8, FX_LAYOUT_NCHW);
+    for (size_t i = 0; i < fx_tensor_size(&in); i++) {
+        g_in[i] = lcg_fixed(24);
+    }
+    for (size_t i = 0; i < fx_tensor_size(&k); i++) {
+        g_w[i] = lcg_fixed(18);
+    }
+
+    TEST_ASSERT(fx_winograd_plan(&plan_rt, &k, &p, 1u << 23, g_u, u_len) == FX_CONV_OK,
+                "Runtime plan");
+    memcpy(u_file, g_u, sizeof(u_file));
+    TEST_ASSERT(fx_winograd_plan_transformed(&plan_tf, u_file, 5, 3, &p, 1u << 23) == FX_CONV_OK &&
+                plan_tf.u == u_file && plan_tf.cout == 5 && plan_tf.cin == 3 &&
+                plan_tf.pad_h == 1 && plan_tf.input_bound == plan_rt.input_bound,
+                "Transformed filters used in place");
+    TEST_ASSERT(fx_conv2d_winograd(&plan_rt, &in, NULL, &out_a) == FX_CONV_OK &&
+                fx_conv2d_winograd(&plan_tf, &in, NULL, &out_b) == FX_CONV_OK &&
+                memcmp(g_out_a, g_out_b, fx_tensor_size(&out_a) * sizeof(fixed_t)) == 0,
+                "Bit-identical to the runtime plan");
+
+    /* A U' in range but not the transform of any filter */
+    bool flipped_rejected = true;
+    for (size_t e = 0; e < FX_WINOGRAD_TILE; e++) {
+        const size_t at = 2u * FX_WINOGRAD_TILE + e;
+        u_file[at] ^= (int64_t)1 << (e % 8);
+        flipped_rejected = flipped_rejected &&
+            fx_winograd_plan_transformed(&plan_tf, u_file, 5, 3, &p, 1u << 23) ==
+            FX_CONV_INVALID_PARAM;
+        u_file[at] = g_u[at];
+    }
+    TEST_ASSERT(flipped_rejected, "Any single flipped U' entry rejected");
+    u_file[7] += 4;
+    TEST_ASSERT(fx_winograd_plan_transformed(&plan_tf, u_file, 5, 3, &p, 1u << 23) ==
+                FX_CONV_INVALID_PARAM, "Edge entry off by 4 (exact division still holds) rejected");
+    u_file[7] = g_u[7];
+
+    /* The proof runs on transformed filters too */
+    fx_tensor_attach(&k, g_w, 2, 64, 3, 3, FX_LAYOUT_NCHW);
+    for (size_t i = 0; i < fx_tensor_size(&k); i++) {
+        g_w[i] = (i % 2) ? FIXED_MAX : FIXED_MIN;
+    }
+    (void)fx_winograd_plan(&plan_rt, &k, &p, (uint32_t)FIXED_ONE, g_u, u_len);
+    TEST_ASSERT(fx_winograd_plan_transformed(&plan_tf, g_u, 2, 64, &p, FX_WINOGRAD_BOUND_ANY) ==
+                FX_CONV_INEXACT, "Overflow-prone transformed filters rejected");
+    p.dilation_w = 2;
+    TEST_ASSERT(fx_winograd_plan_transformed(&plan_tf, g_u, 2, 64, &p, (uint32_t)FIXED_ONE) ==
+                FX_CONV_UNSUPPORTED, "Dilation 2 unsupported");
+    TEST_ASSERT(fx_winograd_plan_transformed(&plan_tf, NULL, 2, 64, &p, (uint32_t)FIXED_ONE) ==
+                FX_CONV_INVALID_PARAM, "NULL filters rejected");
+}
+
+/**
+ * @test Fused conv + bias + activation (+ 2×2 max pool) vs the separate calls
+ * @traceability SRS-004.9, SRS-008.2
+ */
+static void test_fused_matches_sequential(void) {
+    printf("\nTest: fx_conv2d_fused vs sequential layers\n");
+    printf("───────────────────────────────────────────\n");
+
+    static const uint16_t cfg[][9] = {
+        /* n, cin, h, w, cout, k, stride, pad, pool */
+        {1, 3, 8, 8, 4, 3, 1, 1, 1},
+        {2, 5, 12, 10, 11, 3, 1, 1, 1},
+        {1, 4, 16, 15, 9, 3, 2, 1, 1},
+        {1, 2, 9, 11, 3, 3, 1, 0, 0},
+    };
+    const fixed_t alpha = fixed_from_float(0.125f);
+
+    int identical = 1;
+    for (size_t t = 0; t < sizeof(cfg) / sizeof(cfg[0]); t++) {
+        for (int leaky = 0; leaky < 2; leaky++) {
+            fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+            fx_conv_epilogue_t epi = { leaky ? FX_ACT_LEAKY_RELU : FX_ACT_RELU, alpha,
+                                       cfg[t][8] != 0 };
+            fx_tensor_t in, k, conv, out;
+            fixed_t bias[16];
+
+            p.stride_h = p.stride_w = cfg[t][6];
+            p.pad_h = p.pad_w = cfg[t][7];
+
+            const uint16_t oh = fx_conv2d_out_dim(cfg[t][2], cfg[t][5], cfg[t][6], cfg[t][7], 1);
+            const uint16_t ow = fx_conv2d_out_dim(cfg[t][3], cfg[t][5], cfg[t][6], cfg[t][7], 1);
+            const uint16_t ph = epi.maxpool_2x2 ? oh / 2 : oh;
+            const uint16_t pw = epi.maxpool_2x2 ? ow / 2 : ow;
+
+            fx_tensor_attach(&in, g_in, cfg[t][0], cfg[t][1], cfg[t][2], cfg[t][3], FX_LAYOUT_NCHW);
+            fx_tensor_attach(&k, g_w, cfg[t][4], cfg[t][1], cfg[t][5], cfg[t][5], FX_LAYOUT_NCHW);
+            fx_tensor_init(&conv, g_out_a, cfg[t][0], cfg[t][4], oh, ow, FX_LAYOUT_NCHW);
+            fx_tensor_init(&out, g_out_b, cfg[t][0], cfg[t][4], ph, pw, FX_LAYOUT_NCHW);
+
+            for (size_t i = 0; i < fx_tensor_size(&in); i++) {
+                g_in[i] = lcg_fixed(24);
+            }
+            for (size_t i = 0; i < fx_tensor_size(&k); i++) {
+                g_w[i] = lcg_fixed(20);
+            }
+            for (size_t i = 0; i < cfg[t][4]; i++) {
+                bias[i] = lcg_fixed(20);
+            }
+
+            /* Sequential: conv → activation → pool, one plane at a time */
+            if (fx_conv2d_multi(&in, &k, bias, &p, &conv) != FX_CONV_OK) {
+                identical = 0;
+                continue;
+            }
+            for (size_t plane = 0; plane < (size_t)cfg[t][0] * cfg[t][4]; plane++) {
+                fx_matrix_t m, pooled;
+                fx_matrix_attach(&m, g_out_a + plane * oh * ow, oh, ow);
+                if (leaky) {
+                    fx_leaky_relu(&m, alpha);
+                } else {
+                    fx_relu(&m);
+                }
+                if (epi.maxpool_2x2) {
+                    fx_matrix_attach(&pooled, g_ws + plane * ph * pw, ph, pw);
+                    fx_maxpool_2x2(&m, &pooled);
+                } else {
+                    memcpy(g_ws + plane * ph * pw, m.data, (size_t)oh * ow * sizeof(fixed_t));
+                }
+            }
+
+            if (fx_conv2d_fused(&in, &k, bias, &p, &epi, &out) != FX_CONV_OK ||
+                memcmp(g_out_b, g_ws, fx_tensor_size(&out) * sizeof(fixed_t)) != 0) {
+                identical = 0;
+            }
+        }
+    }
+    TEST_ASSERT(identical, "Bit-identical to conv → ReLU / Leaky ReLU → max pool");
+
+    /* NHWC output holds the same values as NCHW */
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+    fx_tensor_t in, k, out_nchw, out_nhwc;
+    p.pad_h = p.pad_w = 1;
+    fx_tensor_attach(&in, g_in, 1, 3, 8, 8, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&k, g_w, 5, 3, 3, 3, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out_nchw, g_out_a, 1, 5, 4, 4, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out_nhwc, g_out_b, 1, 5, 4, 4, FX_LAYOUT_NHWC);
+    int same = fx_conv2d_bias_relu_maxpool(&in, &k, NULL, &p, &out_nchw) == FX_CONV_OK &&
+               fx_conv2d_bias_relu_maxpool(&in, &k, NULL, &p, &out_nhwc) == FX_CONV_OK;
+    for (size_t c = 0; same && c < 5; c++) {
+        for (size_t y = 0; y < 4; y++) {
+            for (size_t x = 0; x < 4; x++) {
+                if (g_out_a[fx_tensor_offset(&out_nchw, 0, c, y, x)] !=
+                    g_out_b[fx_tensor_offset(&out_nhwc, 0, c, y, x)]) {
+                    same = 0;
+                }
+            }
+        }
+    }
+    TEST_ASSERT(same, "NHWC fused output matches NCHW");
+
+    /* Odd conv output cannot be pooled */
+    fx_tensor_attach(&in, g_in, 1, 3, 9, 9, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&out_nchw, g_out_a, 1, 5, 4, 4, FX_LAYOUT_NCHW);
+    TEST_ASSERT(fx_conv2d_bias_relu_maxpool(&in, &k, NULL, &p, &out_nchw) == FX_CONV_DIM_MISMATCH,
+                "Odd conv output with pooling → DIM_MISMATCH");
+}
+
 int main(void) {
     printf("\n");
     printf("═══════════════════════════════════════════════\n");
@@ -332,6 +1037,18 @@ int main(void) {
     test_vertical_edges();
     test_deterministic_behavior();
     test_zero_kernel();
+    test_conv_out_dim();
+    test_multi_matches_single();
+    test_multi_geometry();
+    test_multi_matches_reference();
+    test_multi_layout_independence();
+    test_multi_invalid();
+    test_im2col_matches_direct();
+    test_im2col_workspace();
+    test_winograd_matches_reference();
+    test_winograd_rejection();
+    test_winograd_transformed();
+    test_fused_matches_sequential();
 
     /* Print summary */
     printf("\n");
@@ -348,6 +1065,11 @@ int main(void) {
     printf("  • SRS-006.2: Kernel application\n");
     printf("  • SRS-006.3: Edge detection patterns\n");
     printf("  • SRS-006.4: Bit-perfect determinism\n");
+    printf("  • SRS-006.7 - 006.10: Multi-channel, padded, strided, dilated\n");
+    printf("  • SRS-006.11: im2col + GEMM lowering\n");
+    printf("  • SRS-006.12: Exact integer Winograd F(2x2,3x3)\n");
+    printf("  • SRS-006.13: Winograd filters transformed offline\n");
+    printf("  • SRS-004.9: Fused bias + activation + max pool\n");
     printf("\n");
 
     return tests_failed > 0 ? 1 : 0;
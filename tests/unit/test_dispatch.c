@@ -0,0 +1,243 @@
+/**
+ * @file test_dispatch.c
+ * @project Certifiable Inference Engine
+ * @brief Unit tests for runtime kernel backend selection.
+ *
+ * @details Verifies:
+ * - Automatic selection picks an available backend
+ * - Selection is idempotent and reported by fx_dispatch_active()
+ * - Pinning an available backend succeeds, an unavailable one is refused
+ *   without disturbing the active backend
+ * - Invalid values are rejected
+ * - Results after re-pinning are unchanged
+ * - Re-pinning while kernels run on pool threads never leaves them
+ *   without a table
+ *
+ * @traceability SRS-003.11
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "dispatch.h"
+#include "matrix.h"
+#include "fixed_point.h"
+#include "threadpool.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/**
+ * @test Automatic selection and idempotence
+ * @traceability SRS-003.11
+ */
+static void test_auto_selection(void) {
+    printf("\nTest: Automatic backend selection\n");
+    printf("──────────────────────────────────\n");
+
+    fx_backend_t first = fx_dispatch_init();
+    fx_backend_t second = fx_dispatch_init();
+
+    TEST_ASSERT(first != FX_BACKEND_AUTO, "A concrete backend is selected");
+    TEST_ASSERT(fx_backend_available(first), "Selected backend is available");
+    TEST_ASSERT(first == second, "Selection is idempotent");
+    TEST_ASSERT(fx_dispatch_active() == first, "Active backend is reported");
+    TEST_ASSERT(fx_backend_available(FX_BACKEND_SCALAR), "Scalar backend always available");
+
+    printf("  Selected: %s\n", fx_backend_name(first));
+}
+
+/**
+ * @test Preference order: no available backend ranks above the selection
+ * @traceability SRS-003.11
+ */
+static void test_preference_order(void) {
+    printf("\nTest: Preference order\n");
+    printf("───────────────────────\n");
+
+    TEST_ASSERT(fx_dispatch_pin(FX_BACKEND_AUTO) == FX_DISPATCH_OK, "AUTO re-runs detection");
+
+    fx_backend_t active = fx_dispatch_active();
+    fx_backend_t expected = FX_BACKEND_SCALAR;
+    if (fx_backend_available(FX_BACKEND_AVX512)) {
+        expected = FX_BACKEND_AVX512;
+    } else if (fx_backend_available(FX_BACKEND_AVX2)) {
+        expected = FX_BACKEND_AVX2;
+    } else if (fx_backend_available(FX_BACKEND_NEON)) {
+        expected = FX_BACKEND_NEON;
+    }
+
+    TEST_ASSERT(active == expected, "Widest available backend selected");
+}
+
+/**
+ * @test Pinning available, unavailable and invalid backends
+ * @traceability SRS-003.11
+ */
+static void test_pinning(void) {
+    printf("\nTest: Backend pinning\n");
+    printf("──────────────────────\n");
+
+    TEST_ASSERT(fx_dispatch_pin(FX_BACKEND_SCALAR) == FX_DISPATCH_OK, "Scalar pin accepted");
+    TEST_ASSERT(fx_dispatch_active() == FX_BACKEND_SCALAR, "Scalar pin active");
+    TEST_ASSERT(fx_dispatch_init() == FX_BACKEND_SCALAR, "Init does not override pin");
+
+    int refusals_ok = 1;
+    for (int b = FX_BACKEND_SCALAR; b < FX_BACKEND_COUNT; b++) {
+        if (!fx_backend_available((fx_backend_t)b)) {
+            if (fx_dispatch_pin((fx_backend_t)b) != FX_DISPATCH_UNAVAILABLE ||
+                fx_dispatch_active() != FX_BACKEND_SCALAR) {
+                refusals_ok = 0;
+            }
+        }
+    }
+    TEST_ASSERT(refusals_ok, "Unavailable backends refused, active unchanged");
+
+    TEST_ASSERT(fx_dispatch_pin(FX_BACKEND_COUNT) == FX_DISPATCH_INVALID_PARAM,
+                "Out-of-range value rejected");
+    TEST_ASSERT(fx_dispatch_pin((fx_backend_t)-1) == FX_DISPATCH_INVALID_PARAM,
+                "Negative value rejected");
+    TEST_ASSERT(fx_dispatch_active() == FX_BACKEND_SCALAR, "Active unchanged after rejection");
+
+    (void)fx_dispatch_pin(FX_BACKEND_AUTO);
+}
+
+/**
+ * @test Backend names
+ * @traceability SRS-003.11
+ */
+static void test_names(void) {
+    printf("\nTest: Backend names\n");
+    printf("────────────────────\n");
+
+    TEST_ASSERT(strcmp(fx_backend_name(FX_BACKEND_SCALAR), "scalar") == 0, "scalar");
+    TEST_ASSERT(strcmp(fx_backend_name(FX_BACKEND_AVX2), "avx2") == 0, "avx2");
+    TEST_ASSERT(strcmp(fx_backend_name(FX_BACKEND_AVX512), "avx512") == 0, "avx512");
+    TEST_ASSERT(strcmp(fx_backend_name(FX_BACKEND_NEON), "neon") == 0, "neon");
+    TEST_ASSERT(strcmp(fx_backend_name(FX_BACKEND_COUNT), "unknown") == 0, "unknown");
+}
+
+/**
+ * @test Same result from every available backend through the public API
+ * @traceability SRS-003.10, SRS-003.11
+ */
+static void test_results_independent_of_backend(void) {
+    printf("\nTest: Results independent of backend\n");
+    printf("─────────────────────────────────────\n");
+
+    fixed_t a[37], b[37];
+    for (int i = 0; i < 37; i++) {
+        a[i] = fixed_from_int(i - 18) + (fixed_t)(i * 977);
+        b[i] = fixed_from_int(3 - i % 7) - (fixed_t)(i * 311);
+    }
+
+    (void)fx_dispatch_pin(FX_BACKEND_SCALAR);
+    const fixed_t expected = fx_vector_dot(a, b, 37);
+
+    int identical = 1;
+    for (int be = FX_BACKEND_SCALAR; be < FX_BACKEND_COUNT; be++) {
+        if (fx_dispatch_pin((fx_backend_t)be) == FX_DISPATCH_OK &&
+            fx_vector_dot(a, b, 37) != expected) {
+            identical = 0;
+        }
+    }
+    TEST_ASSERT(identical, "Dot product identical on every backend");
+
+    (void)fx_dispatch_pin(FX_BACKEND_AUTO);
+}
+
+/** Rounds each thread runs while part 0 keeps re-pinning */
+#define PIN_ROUNDS 20000
+
+typedef struct {
+    fixed_t a[37], b[37];
+    fixed_t expected;
+    int mismatches[4];
+} pin_race_t;
+
+static void pin_race_task(void* ctx, unsigned part, unsigned parts) {
+    pin_race_t* r = (pin_race_t*)ctx;
+    (void)parts;
+
+    for (int i = 0; i < PIN_ROUNDS; i++) {
+        if (part == 0) {
+            (void)fx_dispatch_pin((i & 1) ? FX_BACKEND_SCALAR : FX_BACKEND_AUTO);
+        } else if (fx_dispatch_active() == FX_BACKEND_AUTO ||
+                   fx_vector_dot(r->a, r->b, 37) != r->expected) {
+            r->mismatches[part]++;
+        }
+    }
+}
+
+/**
+ * @test Pinning from one thread while others run kernels
+ * @traceability SRS-003.11, SRS-013.1
+ */
+static void test_concurrent_pin(void) {
+    printf("\nTest: Pinning while kernels run\n");
+    printf("───────────────────────────────\n");
+
+    static pin_race_t r;
+    for (int i = 0; i < 37; i++) {
+        r.a[i] = fixed_from_int(i % 5 - 2) + (fixed_t)(i * 4099);
+        r.b[i] = fixed_from_int(1 - i % 3) - (fixed_t)(i * 613);
+    }
+    (void)fx_dispatch_pin(FX_BACKEND_SCALAR);
+    r.expected = fx_vector_dot(r.a, r.b, 37);
+    memset(r.mismatches, 0, sizeof(r.mismatches));
+
+    /* Serial builds run the parts one after another; the check still holds */
+    (void)fx_pool_start(4);
+    fx_pool_run(pin_race_task, &r, 4);
+    fx_pool_stop();
+
+    TEST_ASSERT(r.mismatches[1] + r.mismatches[2] + r.mismatches[3] == 0,
+                "Kernels always see a table and compute the same result");
+
+    (void)fx_dispatch_pin(FX_BACKEND_AUTO);
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("  SRS-003.11 Runtime Dispatch Test Suite\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    test_auto_selection();
+    test_preference_order();
+    test_pinning();
+    test_names();
+    test_results_independent_of_backend();
+    test_concurrent_pin();
+
+    /* Print summary */
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-003.11 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-003.11 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
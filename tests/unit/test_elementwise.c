@@ -0,0 +1,281 @@
+/**
+ * @file test_elementwise.c
+ * @project Certifiable Inference Engine
+ * @brief Unit tests for the element-wise op engine.
+ *
+ * @details Test suite verifying:
+ * - Semantics of each op (scale, saturating add, clamp, activation, callback)
+ * - Op chains bit-identical to the element-by-element reference across
+ *   lengths covering the vector tails and the block boundaries
+ * - In-place and out-of-place application
+ * - Counts beyond 65535 elements (fx_matrix_apply, fx_matrix_apply_ops)
+ * - Rejection of invalid chains with the output untouched
+ *
+ * @traceability SRS-015
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "elementwise.h"
+#include "activations.h"
+#include "fixed_point.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+#define BIG_ROWS 300
+#define BIG_COLS 300
+#define BIG_ELEMS (BIG_ROWS * BIG_COLS)
+
+static fixed_t g_src[BIG_ELEMS];
+static fixed_t g_out[BIG_ELEMS];
+static fixed_t g_ref[BIG_ELEMS];
+
+static uint32_t g_lcg = 0xE1E7u;
+
+/**
+ * @brief Signed pseudo-random values of at most @p bits magnitude.
+ */
+static void fill_random(fixed_t* buf, size_t n, unsigned bits) {
+    for (size_t i = 0; i < n; i++) {
+        g_lcg = g_lcg * 1664525u + 1013904223u;
+        const uint32_t r = g_lcg >> (32u - bits);
+        buf[i] = (fixed_t)((int64_t)r - ((int64_t)1 << (bits - 1u)));
+    }
+}
+
+static fixed_t negate(fixed_t x) {
+    return x == FIXED_MIN ? FIXED_MAX : -x;
+}
+
+static fixed_t add_one(fixed_t x) {
+    return x + (x < FIXED_MAX ? 1 : 0);
+}
+
+/**
+ * @test Each op on hand-picked values
+ * @traceability SRS-015.1
+ */
+static void test_single_ops(void) {
+    printf("\nTest: Single-op semantics\n");
+    printf("─────────────────────────\n");
+
+    const fixed_t in[6] = { FIXED_MIN, -fixed_from_int(3), -FIXED_HALF, 0,
+                            fixed_from_int(2), FIXED_MAX };
+    fixed_t out[6];
+
+    const fx_ew_op_t scale[] = { FX_EW_OP_SCALE(FIXED_HALF) };
+    TEST_ASSERT(fx_ew_apply(in, out, 6, scale, 1) == FX_EW_OK, "Scale accepted");
+    int ok = 1;
+    for (int i = 0; i < 6; i++) {
+        ok &= out[i] == fixed_mul(in[i], FIXED_HALF);
+    }
+    TEST_ASSERT(ok, "Scale equals fixed_mul()");
+
+    const fx_ew_op_t add[] = { FX_EW_OP_ADD(fixed_from_int(4)) };
+    fx_ew_apply(in, out, 6, add, 1);
+    TEST_ASSERT(out[0] == FIXED_MIN + fixed_from_int(4) && out[3] == fixed_from_int(4),
+                "Add in range is exact");
+    TEST_ASSERT(out[5] == FIXED_MAX, "Add saturates at FIXED_MAX");
+
+    const fx_ew_op_t sub[] = { FX_EW_OP_ADD(-fixed_from_int(4)) };
+    fx_ew_apply(in, out, 6, sub, 1);
+    TEST_ASSERT(out[0] == FIXED_MIN && out[5] == FIXED_MAX - fixed_from_int(4),
+                "Negative add saturates at FIXED_MIN");
+
+    const fx_ew_op_t clamp[] = { FX_EW_OP_CLAMP(-FIXED_ONE, FIXED_ONE) };
+    fx_ew_apply(in, out, 6, clamp, 1);
+    TEST_ASSERT(out[0] == -FIXED_ONE && out[1] == -FIXED_ONE && out[2] == -FIXED_HALF &&
+                out[4] == FIXED_ONE && out[5] == FIXED_ONE, "Clamp to [-1, 1]");
+
+    const fx_ew_op_t relu[] = { FX_EW_OP_ACT(FX_ACT_RELU, 0) };
+    fx_ew_apply(in, out, 6, relu, 1);
+    TEST_ASSERT(out[0] == 0 && out[2] == 0 && out[4] == fixed_from_int(2),
+                "ReLU activation op");
+
+    const fx_ew_op_t sig[] = { FX_EW_OP_ACT(FX_ACT_SIGMOID, 0) };
+    fx_ew_apply(in, out, 6, sig, 1);
+    TEST_ASSERT(out[3] == FIXED_HALF && out[1] == fixed_sigmoid(in[1]),
+                "Sigmoid activation op");
+
+    const fx_ew_op_t none[] = { FX_EW_OP_ACT(FX_ACT_NONE, 0) };
+    fx_ew_apply(in, out, 6, none, 1);
+    TEST_ASSERT(memcmp(in, out, sizeof(in)) == 0, "Identity activation copies");
+
+    const fx_ew_op_t call[] = { FX_EW_OP_CALL(negate) };
+    fx_ew_apply(in, out, 6, call, 1);
+    TEST_ASSERT(out[0] == FIXED_MAX && out[4] == -fixed_from_int(2), "Callback op");
+
+    memset(out, 0, sizeof(out));
+    TEST_ASSERT(fx_ew_apply(in, out, 6, NULL, 0) == FX_EW_OK &&
+                memcmp(in, out, sizeof(in)) == 0, "Empty chain copies src");
+}
+
+/**
+ * @test Chains against the element-by-element reference
+ * @traceability SRS-015.1, SRS-015.2
+ */
+static void test_chain_matches_reference(void) {
+    printf("\nTest: Chains vs reference\n");
+    printf("─────────────────────────\n");
+
+    const fx_ew_op_t chain[] = {
+        FX_EW_OP_SCALE(fixed_from_float(1.75f)),
+        FX_EW_OP_ADD(-fixed_from_float(0.3f)),
+        FX_EW_OP_ACT(FX_ACT_LEAKY_RELU, fixed_from_float(0.1f)),
+        FX_EW_OP_CLAMP(-fixed_from_int(6), fixed_from_int(6)),
+        FX_EW_OP_ACT(FX_ACT_TANH, 0),
+    };
+    static const size_t lengths[] = { 1, 7, 17, 1023, 1024, 1025, 3000, BIG_ELEMS };
+
+    int identical = 1;
+    for (size_t t = 0; t < sizeof(lengths) / sizeof(lengths[0]); t++) {
+        const size_t n = lengths[t];
+        fill_random(g_src, n, 24);
+        g_src[0] = FIXED_MIN;
+        g_src[n - 1] = FIXED_MAX;
+
+        fx_ew_apply_ref(g_src, g_ref, n, chain, 5);
+        fx_ew_apply(g_src, g_out, n, chain, 5);
+        identical &= memcmp(g_ref, g_out, n * sizeof(fixed_t)) == 0;
+    }
+    TEST_ASSERT(identical, "Five-op chain bit-identical for all lengths");
+
+    /* Saturating add on extreme inputs, every vector tail */
+    const fx_ew_op_t sat[] = { FX_EW_OP_ADD(FIXED_MAX / 2), FX_EW_OP_ADD(FIXED_MIN / 2 - 7) };
+    fill_random(g_src, 4099, 32);
+    fx_ew_apply_ref(g_src, g_ref, 4099, sat, 2);
+    fx_ew_apply(g_src, g_out, 4099, sat, 2);
+    TEST_ASSERT(memcmp(g_ref, g_out, 4099 * sizeof(fixed_t)) == 0,
+                "Saturating adds bit-identical on full-range input");
+
+    /* Callback in the middle of a chain */
+    const fx_ew_op_t mixed[] = {
+        FX_EW_OP_SCALE(fixed_from_int(3)), FX_EW_OP_CALL(add_one), FX_EW_OP_ACT(FX_ACT_RELU, 0)
+    };
+    fill_random(g_src, 2500, 20);
+    fx_ew_apply_ref(g_src, g_ref, 2500, mixed, 3);
+    fx_ew_apply(g_src, g_out, 2500, mixed, 3);
+    TEST_ASSERT(memcmp(g_ref, g_out, 2500 * sizeof(fixed_t)) == 0,
+                "Chain with a callback bit-identical");
+
+    /* In place equals out of place */
+    memcpy(g_ref, g_src, 2500 * sizeof(fixed_t));
+    fx_ew_apply(g_ref, g_ref, 2500, chain, 5);
+    fx_ew_apply(g_src, g_out, 2500, chain, 5);
+    TEST_ASSERT(memcmp(g_ref, g_out, 2500 * sizeof(fixed_t)) == 0, "In place equals out of place");
+}
+
+/**
+ * @test Element counts beyond 16 bits
+ * @traceability SRS-015.3, SRS-003.3
+ */
+static void test_large_counts(void) {
+    printf("\nTest: More than 65535 elements\n");
+    printf("──────────────────────────────\n");
+
+    fx_matrix_t mat;
+    fx_matrix_attach(&mat, g_out, BIG_ROWS, BIG_COLS);
+
+    for (size_t i = 0; i < BIG_ELEMS; i++) {
+        g_out[i] = fixed_from_int(5);
+    }
+    fx_matrix_apply(&mat, negate);
+    int all = 1;
+    for (size_t i = 0; i < BIG_ELEMS; i++) {
+        all &= g_out[i] == -fixed_from_int(5);
+    }
+    TEST_ASSERT(all, "fx_matrix_apply reaches all 90000 elements");
+
+    const fx_ew_op_t ops[] = { FX_EW_OP_ADD(fixed_from_int(1)), FX_EW_OP_SCALE(fixed_from_int(2)) };
+    TEST_ASSERT(fx_matrix_apply_ops(&mat, ops, 2) == FX_EW_OK, "fx_matrix_apply_ops accepted");
+    all = 1;
+    for (size_t i = 0; i < BIG_ELEMS; i++) {
+        all &= g_out[i] == -fixed_from_int(8);
+    }
+    TEST_ASSERT(all, "fx_matrix_apply_ops reaches all 90000 elements");
+}
+
+/**
+ * @test Invalid chains are rejected before anything is written
+ * @traceability SRS-015.1
+ */
+static void test_invalid(void) {
+    printf("\nTest: Invalid parameters\n");
+    printf("────────────────────────\n");
+
+    fixed_t in[4] = { 1, 2, 3, 4 };
+    fixed_t out[4] = { 9, 9, 9, 9 };
+    const fixed_t untouched[4] = { 9, 9, 9, 9 };
+
+    const fx_ew_op_t bad_clamp[] = { FX_EW_OP_SCALE(FIXED_ONE), FX_EW_OP_CLAMP(FIXED_ONE, 0) };
+    TEST_ASSERT(fx_ew_apply(in, out, 4, bad_clamp, 2) == FX_EW_INVALID_PARAM, "Clamp lo > hi rejected");
+
+    const fx_ew_op_t bad_call[] = { FX_EW_OP_CALL(NULL) };
+    TEST_ASSERT(fx_ew_apply(in, out, 4, bad_call, 1) == FX_EW_INVALID_PARAM, "NULL callback rejected");
+
+    fx_ew_op_t bad_kind = FX_EW_OP_SCALE(FIXED_ONE);
+    bad_kind.kind = (fx_ew_kind_t)42;
+    TEST_ASSERT(fx_ew_apply(in, out, 4, &bad_kind, 1) == FX_EW_INVALID_PARAM, "Unknown op rejected");
+
+    fx_ew_op_t bad_act = FX_EW_OP_ACT(FX_ACT_RELU, 0);
+    bad_act.act = (fx_activation_t)42;
+    TEST_ASSERT(fx_ew_apply(in, out, 4, &bad_act, 1) == FX_EW_INVALID_PARAM,
+                "Unknown activation rejected");
+
+    TEST_ASSERT(fx_ew_apply(in, out, 4, NULL, 1) == FX_EW_INVALID_PARAM, "NULL ops rejected");
+    TEST_ASSERT(fx_ew_apply(NULL, out, 4, NULL, 0) == FX_EW_INVALID_PARAM, "NULL src rejected");
+    TEST_ASSERT(fx_matrix_apply_ops(NULL, NULL, 0) == FX_EW_INVALID_PARAM, "NULL matrix rejected");
+    TEST_ASSERT(memcmp(out, untouched, sizeof(out)) == 0, "Output untouched on error");
+
+    TEST_ASSERT(fx_ew_apply(NULL, NULL, 0, NULL, 0) == FX_EW_OK, "Zero elements accepted");
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("  SRS-015 Element-wise Engine Verification Suite\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    test_single_ops();
+    test_chain_matches_reference();
+    test_large_counts();
+    test_invalid();
+
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-015 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-015 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+    printf("Requirements validated:\n");
+    printf("  • SRS-015.1: Op semantics and reference equivalence\n");
+    printf("  • SRS-015.2: Blocked chains, dispatch per block\n");
+    printf("  • SRS-015.3: size_t element counts\n");
+    printf("  • SRS-015.4: Callback fallback\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
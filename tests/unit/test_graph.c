@@ -0,0 +1,496 @@
+/**
+ * @file test_graph.c
+ * @project Certifiable Inference Engine
+ * @brief Unit tests for the model graph, arena planner and executor.
+ *
+ * @details Verifies:
+ * - A planned graph produces results bit-identical to calling the layer
+ *   functions by hand with separate buffers
+ * - Buffers with overlapping lifetimes never share arena memory
+ * - Buffers with disjoint lifetimes are reused (peak below the unshared sum)
+ * - Activations on dying intermediates are computed in place
+ * - Planning is deterministic
+ * - Invalid declarations and run-time misuse are rejected
+ *
+ * @traceability SRS-009-GRAPH
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "graph.h"
+#include "activations.h"
+#include "pooling.h"
+#include "fixed_point.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+static fx_graph_t g_graph;
+static fixed_t g_arena[8192];
+
+/* Model: 3×16×16 → conv 8 (ReLU, pool) → conv 8 (im2col, ReLU) → pool
+ *        → leaky ReLU → dense 10 */
+static fixed_t g_image[3 * 16 * 16];
+static fixed_t g_w1[8 * 3 * 3 * 3];
+static fixed_t g_b1[8];
+static fixed_t g_w2[8 * 8 * 3 * 3];
+static fixed_t g_b2[8];
+static fixed_t g_w3[128 * 10];
+static fixed_t g_b3[10];
+static fixed_t g_logits_graph[10];
+
+/* Hand-chained reference buffers */
+static fixed_t g_ref_a[8 * 8 * 8];
+static fixed_t g_ref_b[8 * 8 * 8];
+static fixed_t g_ref_c[8 * 4 * 4];
+static fixed_t g_ref_ws[8192];
+static fixed_t g_logits_ref[10];
+
+/* Deterministic pseudo-random Q16.16 values in [-2^(bits-1), 2^(bits-1)) */
+static uint32_t g_lcg_state = 0x6A09E667u;
+static fixed_t lcg_fixed(unsigned bits) {
+    g_lcg_state = g_lcg_state * 1664525u + 1013904223u;
+    return (fixed_t)(int32_t)(g_lcg_state >> (32u - bits)) - (fixed_t)(1 << (bits - 1u));
+}
+
+static void fill(fixed_t* buf, size_t len, unsigned bits) {
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = lcg_fixed(bits);
+    }
+}
+
+static size_t elems(const fx_graph_tensor_t* t) {
+    return (size_t)t->n * t->c * t->h * t->w;
+}
+
+/**
+ * @brief Check that no two arena buffers with overlapping lifetimes
+ *        overlap in memory (op scratch included) and all fit the arena.
+ */
+static int plan_is_sound(const fx_graph_t* g) {
+    size_t off[FX_GRAPH_MAX_TENSORS + FX_GRAPH_MAX_OPS];
+    size_t len[FX_GRAPH_MAX_TENSORS + FX_GRAPH_MAX_OPS];
+    uint16_t first[FX_GRAPH_MAX_TENSORS + FX_GRAPH_MAX_OPS];
+    uint16_t last[FX_GRAPH_MAX_TENSORS + FX_GRAPH_MAX_OPS];
+    size_t count = 0;
+
+    for (uint16_t t = 0; t < g->tensor_count; t++) {
+        const fx_graph_tensor_t* ten = &g->tensors[t];
+        if (ten->kind == FX_GRAPH_TENSOR_INTERMEDIATE && ten->root == t) {
+            off[count] = ten->offset;
+            len[count] = elems(ten);
+            first[count] = ten->def;
+            last[count] = ten->last;
+            count++;
+        }
+    }
+    for (uint16_t i = 0; i < g->op_count; i++) {
+        if (g->ops[i].scratch_len > 0) {
+            off[count] = g->ops[i].scratch_offset;
+            len[count] = g->ops[i].scratch_len;
+            first[count] = i;
+            last[count] = i;
+            count++;
+        }
+    }
+
+    for (size_t a = 0; a < count; a++) {
+        if (off[a] + len[a] > g->arena_len) {
+            return 0;
+        }
+        for (size_t b = a + 1; b < count; b++) {
+            const int live = first[a] <= last[b] && first[b] <= last[a];
+            const int share = off[a] < off[b] + len[b] && off[b] < off[a] + len[a];
+            if (live && share) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Declare the test CNN; returns input and output ids.
+ */
+static fx_graph_res_t build_cnn(fx_graph_t* g, fx_tensor_id_t* x, fx_tensor_id_t* y) {
+    static fx_tensor_t w1, w2;
+    static fx_matrix_t w3, b3;
+    fx_conv_params_t p1 = FX_CONV_PARAMS_DEFAULT;
+    fx_conv_params_t p2 = FX_CONV_PARAMS_DEFAULT;
+    const fx_conv_epilogue_t relu_pool = { FX_ACT_RELU, FIXED_ZERO, true };
+    const fx_conv_epilogue_t relu = { FX_ACT_RELU, FIXED_ZERO, false };
+    fx_tensor_id_t h1, h2, h3, h4;
+
+    p1.pad_h = p1.pad_w = 1;
+    p2.pad_h = p2.pad_w = 1;
+    p2.algo = FX_CONV_ALGO_IM2COL;
+
+    fx_tensor_attach(&w1, g_w1, 8, 3, 3, 3, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&w2, g_w2, 8, 8, 3, 3, FX_LAYOUT_NCHW);
+    fx_matrix_attach(&w3, g_w3, 128, 10);
+    fx_matrix_attach(&b3, g_b3, 1, 10);
+
+    fx_graph_res_t res = fx_graph_init(g);
+    if (res == FX_GRAPH_OK) res = fx_graph_input(g, 1, 3, 16, 16, FX_LAYOUT_NCHW, x);
+    if (res == FX_GRAPH_OK) res = fx_graph_conv2d(g, *x, &w1, g_b1, &p1, &relu_pool, &h1);
+    if (res == FX_GRAPH_OK) res = fx_graph_conv2d(g, h1, &w2, g_b2, &p2, &relu, &h2);
+    if (res == FX_GRAPH_OK) res = fx_graph_maxpool_2x2(g, h2, &h3);
+    if (res == FX_GRAPH_OK) res = fx_graph_activation(g, h3, FX_ACT_LEAKY_RELU,
+                                                      fixed_from_float(0.125f), &h4);
+    if (res == FX_GRAPH_OK) res = fx_graph_dense(g, h4, &w3, &b3, FX_ACT_NONE, FIXED_ZERO, y);
+    if (res == FX_GRAPH_OK) res = fx_graph_output(g, *y);
+    return res;
+}
+
+/**
+ * @test Planned graph equals the hand-chained layers
+ * @traceability SRS-009.5
+ */
+static void test_graph_matches_manual(void) {
+    printf("\nTest: Graph execution vs hand-chained layers\n");
+    printf("─────────────────────────────────────────────\n");
+
+    fill(g_image, sizeof(g_image) / sizeof(g_image[0]), 24);
+    fill(g_w1, sizeof(g_w1) / sizeof(g_w1[0]), 18);
+    fill(g_b1, 8, 18);
+    fill(g_w2, sizeof(g_w2) / sizeof(g_w2[0]), 16);
+    fill(g_b2, 8, 18);
+    fill(g_w3, sizeof(g_w3) / sizeof(g_w3[0]), 16);
+    fill(g_b3, 10, 18);
+
+    /* Reference: each layer into its own buffer */
+    fx_tensor_t in, w1, w2, a, b;
+    fx_matrix_t m, pooled, dense_in, w3, b3, logits;
+    fx_conv_params_t p1 = FX_CONV_PARAMS_DEFAULT;
+    fx_conv_params_t p2 = FX_CONV_PARAMS_DEFAULT;
+    p1.pad_h = p1.pad_w = 1;
+    p2.pad_h = p2.pad_w = 1;
+    p2.algo = FX_CONV_ALGO_IM2COL;
+
+    fx_tensor_attach(&in, g_image, 1, 3, 16, 16, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&w1, g_w1, 8, 3, 3, 3, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&w2, g_w2, 8, 8, 3, 3, FX_LAYOUT_NCHW);
+    fx_tensor_init(&a, g_ref_a, 1, 8, 8, 8, FX_LAYOUT_NCHW);
+    fx_tensor_init(&b, g_ref_b, 1, 8, 8, 8, FX_LAYOUT_NCHW);
+
+    int ref_ok = fx_conv2d_bias_relu_maxpool(&in, &w1, g_b1, &p1, &a) == FX_CONV_OK;
+    ref_ok = ref_ok && fx_conv2d_layer(&a, &w2, g_b2, &p2, g_ref_ws, 8192, &b) == FX_CONV_OK;
+    fx_matrix_attach(&m, g_ref_b, 64, 8);
+    fx_relu(&m);
+    for (size_t c = 0; c < 8; c++) {
+        fx_matrix_attach(&m, g_ref_b + c * 64, 8, 8);
+        fx_matrix_attach(&pooled, g_ref_c + c * 16, 4, 4);
+        fx_maxpool_2x2(&m, &pooled);
+    }
+    fx_matrix_attach(&m, g_ref_c, 16, 8);
+    fx_leaky_relu(&m, fixed_from_float(0.125f));
+    fx_matrix_attach(&dense_in, g_ref_c, 1, 128);
+    fx_matrix_attach(&w3, g_w3, 128, 10);
+    fx_matrix_attach(&b3, g_b3, 1, 10);
+    fx_matrix_init(&logits, g_logits_ref, 1, 10);
+    fx_matrix_mul_fused(&dense_in, &w3, &b3, FX_ACT_NONE, FIXED_ZERO, &logits);
+    TEST_ASSERT(ref_ok, "Reference chain runs");
+
+    /* Graph */
+    fx_tensor_id_t x, y;
+    fx_graph_stats_t st;
+    TEST_ASSERT(build_cnn(&g_graph, &x, &y) == FX_GRAPH_OK, "Graph declared");
+    TEST_ASSERT(fx_graph_plan(&g_graph, &st) == FX_GRAPH_OK, "Graph planned");
+    TEST_ASSERT(st.arena_len <= sizeof(g_arena) / sizeof(g_arena[0]), "Peak fits test arena");
+    TEST_ASSERT(fx_graph_bind(&g_graph, x, g_image) == FX_GRAPH_OK &&
+                fx_graph_bind(&g_graph, y, g_logits_graph) == FX_GRAPH_OK, "Input and output bound");
+
+    /* Poison the arena: nothing may depend on its previous contents */
+    memset(g_arena, 0xA5, sizeof(g_arena));
+    TEST_ASSERT(fx_graph_run(&g_graph, g_arena, st.arena_len) == FX_GRAPH_OK, "Graph runs");
+    TEST_ASSERT(memcmp(g_logits_graph, g_logits_ref, sizeof(g_logits_ref)) == 0,
+                "Logits bit-identical to hand-chained layers");
+
+    printf("  Arena: %zu elements (%zu bytes), unshared %zu, %u buffers\n",
+           st.arena_len, st.arena_len * sizeof(fixed_t), st.unshared_len, st.buffers);
+}
+
+/**
+ * @test Lifetime-overlapping buffers never share memory; others are reused
+ * @traceability SRS-009.2, SRS-009.3
+ */
+static void test_arena_reuse(void) {
+    printf("\nTest: Liveness-based arena reuse\n");
+    printf("────────────────────────────────\n");
+
+    fx_tensor_id_t x, y;
+    fx_graph_stats_t st;
+    (void)build_cnn(&g_graph, &x, &y);
+    (void)fx_graph_plan(&g_graph, &st);
+
+    TEST_ASSERT(plan_is_sound(&g_graph), "CNN plan: live buffers disjoint, all within arena");
+    TEST_ASSERT(st.arena_len < st.unshared_len, "CNN plan: peak below unshared sum");
+    TEST_ASSERT(st.arena_len >= st.largest_len, "CNN plan: peak at least the largest buffer");
+
+    /* Chain of five equal 1×1 convs: two buffers suffice */
+    static fixed_t w_buf[16 * 16];
+    fx_tensor_t w;
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+    fx_tensor_id_t t;
+    fx_tensor_attach(&w, w_buf, 16, 16, 1, 1, FX_LAYOUT_NCHW);
+
+    (void)fx_graph_init(&g_graph);
+    (void)fx_graph_input(&g_graph, 1, 16, 8, 8, FX_LAYOUT_NCHW, &t);
+    for (int i = 0; i < 5; i++) {
+        (void)fx_graph_conv2d(&g_graph, t, &w, NULL, &p, NULL, &t);
+    }
+    (void)fx_graph_output(&g_graph, t);
+    (void)fx_graph_plan(&g_graph, &st);
+    TEST_ASSERT(st.unshared_len == 4 * 1024, "Chain: four intermediates of 1024");
+    TEST_ASSERT(st.arena_len == 2 * 1024, "Chain: ping-pong between two buffers");
+    TEST_ASSERT(plan_is_sound(&g_graph), "Chain plan sound");
+
+    /* A tensor read by a later op stays live across the ops in between */
+    fx_tensor_id_t a, b, c, d;
+    (void)fx_graph_init(&g_graph);
+    (void)fx_graph_input(&g_graph, 1, 16, 8, 8, FX_LAYOUT_NCHW, &t);
+    (void)fx_graph_conv2d(&g_graph, t, &w, NULL, &p, NULL, &a);
+    (void)fx_graph_conv2d(&g_graph, a, &w, NULL, &p, NULL, &b);
+    (void)fx_graph_conv2d(&g_graph, b, &w, NULL, &p, NULL, &c);
+    (void)fx_graph_conv2d(&g_graph, a, &w, NULL, &p, NULL, &d);
+    (void)fx_graph_output(&g_graph, d);
+    (void)fx_graph_output(&g_graph, c);
+    (void)fx_graph_plan(&g_graph, &st);
+    TEST_ASSERT(g_graph.tensors[a].last == 3, "Long-lived tensor lives to its last reader");
+    TEST_ASSERT(st.arena_len == 2 * 1024 && plan_is_sound(&g_graph),
+                "Long-lived tensor never overwritten");
+
+    /* Activations on dying intermediates run in place */
+    fx_tensor_id_t h, r1, r2;
+    (void)fx_graph_init(&g_graph);
+    (void)fx_graph_input(&g_graph, 1, 16, 8, 8, FX_LAYOUT_NCHW, &t);
+    (void)fx_graph_conv2d(&g_graph, t, &w, NULL, &p, NULL, &h);
+    (void)fx_graph_activation(&g_graph, h, FX_ACT_RELU, FIXED_ZERO, &r1);
+    (void)fx_graph_activation(&g_graph, r1, FX_ACT_LEAKY_RELU, FIXED_ONE / 8, &r2);
+    (void)fx_graph_conv2d(&g_graph, r2, &w, NULL, &p, NULL, &y);
+    (void)fx_graph_output(&g_graph, y);
+    (void)fx_graph_plan(&g_graph, &st);
+    TEST_ASSERT(st.buffers == 1 && st.arena_len == 1024, "Activation chain shares one buffer");
+    TEST_ASSERT(g_graph.tensors[r2].offset == g_graph.tensors[h].offset, "In-place alias resolved");
+}
+
+/**
+ * @test Same declaration, same plan
+ * @traceability SRS-009.4
+ */
+static void test_plan_deterministic(void) {
+    printf("\nTest: Plan determinism\n");
+    printf("──────────────────────\n");
+
+    static fx_graph_t other;
+    fx_tensor_id_t x, y;
+    fx_graph_stats_t s1, s2;
+
+    (void)build_cnn(&g_graph, &x, &y);
+    (void)fx_graph_plan(&g_graph, &s1);
+    (void)build_cnn(&other, &x, &y);
+    (void)fx_graph_plan(&other, &s2);
+    (void)fx_graph_plan(&other, &s2);
+
+    int same = s1.arena_len == s2.arena_len && s1.buffers == s2.buffers;
+    for (uint16_t t = 0; t < g_graph.tensor_count; t++) {
+        same = same && g_graph.tensors[t].offset == other.tensors[t].offset;
+    }
+    for (uint16_t i = 0; i < g_graph.op_count; i++) {
+        same = same && g_graph.ops[i].scratch_offset == other.ops[i].scratch_offset;
+    }
+    TEST_ASSERT(same, "Identical offsets across graphs and re-planning");
+}
+
+/**
+ * @test Declaration and run-time errors
+ * @traceability SRS-009.1, SRS-009.5
+ */
+static void test_graph_invalid(void) {
+    printf("\nTest: Graph argument validation\n");
+    printf("───────────────────────────────\n");
+
+    static fixed_t w_buf[16 * 16];
+    static fixed_t io[1024];
+    fx_tensor_t w;
+    fx_matrix_t mw;
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+    fx_tensor_id_t x, h, y;
+    fx_graph_stats_t st;
+
+    fx_tensor_attach(&w, w_buf, 16, 16, 1, 1, FX_LAYOUT_NCHW);
+    fx_matrix_attach(&mw, w_buf, 100, 2);
+
+    TEST_ASSERT(fx_graph_init(NULL) == FX_GRAPH_INVALID_PARAM, "NULL graph rejected");
+
+    (void)fx_graph_init(&g_graph);
+    TEST_ASSERT(fx_graph_input(&g_graph, 0, 16, 8, 8, FX_LAYOUT_NCHW, &x) == FX_GRAPH_INVALID_PARAM,
+                "Empty input shape rejected");
+    (void)fx_graph_input(&g_graph, 1, 16, 8, 8, FX_LAYOUT_NCHW, &x);
+    TEST_ASSERT(fx_graph_conv2d(&g_graph, 7, &w, NULL, &p, NULL, &h) == FX_GRAPH_INVALID_PARAM,
+                "Unknown tensor id rejected");
+    TEST_ASSERT(fx_graph_dense(&g_graph, x, &mw, NULL, FX_ACT_NONE, 0, &h) == FX_GRAPH_DIM_MISMATCH,
+                "Dense K mismatch rejected");
+    TEST_ASSERT(fx_graph_output(&g_graph, x) == FX_GRAPH_INVALID_PARAM,
+                "Graph input cannot be an output");
+
+    fx_tensor_id_t nhwc, odd;
+    (void)fx_graph_input(&g_graph, 1, 16, 8, 8, FX_LAYOUT_NHWC, &nhwc);
+    (void)fx_graph_input(&g_graph, 1, 16, 7, 8, FX_LAYOUT_NCHW, &odd);
+    TEST_ASSERT(fx_graph_maxpool_2x2(&g_graph, nhwc, &h) == FX_GRAPH_UNSUPPORTED,
+                "NHWC max pool op unsupported");
+    TEST_ASSERT(fx_graph_maxpool_2x2(&g_graph, odd, &h) == FX_GRAPH_DIM_MISMATCH,
+                "Odd max pool input rejected");
+
+    (void)fx_graph_init(&g_graph);
+    (void)fx_graph_input(&g_graph, 1, 16, 8, 8, FX_LAYOUT_NCHW, &x);
+    (void)fx_graph_conv2d(&g_graph, x, &w, NULL, &p, NULL, &h);
+    (void)fx_graph_conv2d(&g_graph, h, &w, NULL, &p, NULL, &y);
+    (void)fx_graph_output(&g_graph, y);
+    TEST_ASSERT(fx_graph_run(&g_graph, g_arena, 8192) == FX_GRAPH_NOT_PLANNED,
+                "Run before plan rejected");
+    (void)fx_graph_plan(&g_graph, &st);
+    TEST_ASSERT(fx_graph_run(&g_graph, g_arena, 8192) == FX_GRAPH_UNBOUND,
+                "Unbound input rejected");
+    (void)fx_graph_bind(&g_graph, x, io);
+    (void)fx_graph_bind(&g_graph, y, io);
+    TEST_ASSERT(fx_graph_bind(&g_graph, h, io) == FX_GRAPH_INVALID_PARAM,
+                "Intermediates cannot be bound");
+    TEST_ASSERT(fx_graph_run(&g_graph, g_arena, st.arena_len - 1) == FX_GRAPH_ARENA_TOO_SMALL,
+                "Short arena rejected");
+
+    fx_tensor_id_t extra;
+    (void)fx_graph_activation(&g_graph, y, FX_ACT_RELU, 0, &extra);
+    TEST_ASSERT(fx_graph_run(&g_graph, g_arena, 8192) == FX_GRAPH_NOT_PLANNED,
+                "Adding an op invalidates the plan");
+
+    (void)fx_graph_init(&g_graph);
+    (void)fx_graph_input(&g_graph, 1, 16, 8, 8, FX_LAYOUT_NCHW, &x);
+    fx_graph_res_t res = FX_GRAPH_OK;
+    for (int i = 0; i <= FX_GRAPH_MAX_OPS && res == FX_GRAPH_OK; i++) {
+        res = fx_graph_activation(&g_graph, x, FX_ACT_RELU, 0, &h);
+    }
+    TEST_ASSERT(res == FX_GRAPH_FULL && g_graph.op_count == FX_GRAPH_MAX_OPS,
+                "Op capacity enforced");
+}
+
+/**
+ * @test Pooling ops: strided max, average and global average into dense
+ * @traceability SRS-009.1, SRS-008.9, SRS-008.12
+ */
+static void test_graph_pooling(void) {
+    printf("\nTest: Pooling ops in a graph\n");
+    printf("────────────────────────────\n");
+
+    /* 8×15×15 → max 3×3/2 → 8×7×7 → avg 2×2/1 pad-counted → 8×6×6
+     *         → global average → dense 10 */
+    static fixed_t x_buf[8 * 15 * 15];
+    static fixed_t a_buf[8 * 7 * 7];
+    static fixed_t b_buf[8 * 6 * 6];
+    static fixed_t gap_buf[8];
+    static fixed_t ws[15 * 7];
+    static fixed_t wd[8 * 10];
+    static fixed_t y_graph[10], y_ref[10];
+
+    const fx_pool2d_params_t pmax = FX_POOL2D_PARAMS_MAX_3X3_S2;
+    const fx_pool2d_params_t pavg = { FX_POOL2D_AVG, 2, 2, 1, 1, 0, 0, true };
+    fx_matrix_t w, bias, gm, ym;
+    fx_tensor_t tx, ta, tb;
+    fx_tensor_id_t x, h1, h2, h3, y;
+    fx_graph_stats_t st;
+
+    fill(x_buf, sizeof(x_buf) / sizeof(x_buf[0]), 24);
+    fill(wd, sizeof(wd) / sizeof(wd[0]), 16);
+    fx_matrix_attach(&w, wd, 8, 10);
+    fx_matrix_attach(&bias, g_b3, 1, 10);
+
+    fx_graph_res_t res = fx_graph_init(&g_graph);
+    if (res == FX_GRAPH_OK) res = fx_graph_input(&g_graph, 1, 8, 15, 15, FX_LAYOUT_NCHW, &x);
+    if (res == FX_GRAPH_OK) res = fx_graph_pool2d(&g_graph, x, &pmax, &h1);
+    if (res == FX_GRAPH_OK) res = fx_graph_pool2d(&g_graph, h1, &pavg, &h2);
+    if (res == FX_GRAPH_OK) res = fx_graph_global_avgpool(&g_graph, h2, &h3);
+    if (res == FX_GRAPH_OK) res = fx_graph_dense(&g_graph, h3, &w, &bias, FX_ACT_NONE,
+                                                 FIXED_ZERO, &y);
+    if (res == FX_GRAPH_OK) res = fx_graph_output(&g_graph, y);
+    if (res == FX_GRAPH_OK) res = fx_graph_plan(&g_graph, &st);
+    TEST_ASSERT(res == FX_GRAPH_OK, "Declare and plan pool → pool → GAP → dense");
+    TEST_ASSERT(g_graph.tensors[h1].h == 7 && g_graph.tensors[h2].w == 6 &&
+                g_graph.tensors[h3].c == 8 && g_graph.tensors[h3].h == 1,
+                "Shapes 8×7×7, 8×6×6, 8×1×1");
+    TEST_ASSERT(g_graph.ops[0].scratch_len == 15 * 7 && g_graph.ops[1].scratch_len == 0,
+                "Max-pool row pass planned as scratch; average needs none");
+    TEST_ASSERT(plan_is_sound(&g_graph), "Scratch and buffers never overlap while live");
+
+    fx_graph_bind(&g_graph, x, x_buf);
+    fx_graph_bind(&g_graph, y, y_graph);
+    TEST_ASSERT(fx_graph_run(&g_graph, g_arena, 8192) == FX_GRAPH_OK, "Run succeeds");
+
+    fx_tensor_attach(&tx, x_buf, 1, 8, 15, 15, FX_LAYOUT_NCHW);
+    fx_tensor_init(&ta, a_buf, 1, 8, 7, 7, FX_LAYOUT_NCHW);
+    fx_tensor_init(&tb, b_buf, 1, 8, 6, 6, FX_LAYOUT_NCHW);
+    fx_matrix_init(&gm, gap_buf, 1, 8);
+    fx_matrix_init(&ym, y_ref, 1, 10);
+    int ref_ok = fx_pool2d(&tx, &pmax, ws, 15 * 7, &ta) == FX_POOL2D_OK;
+    ref_ok = ref_ok && fx_pool2d(&ta, &pavg, NULL, 0, &tb) == FX_POOL2D_OK;
+    ref_ok = ref_ok && fx_global_avgpool(&tb, &gm) == FX_POOL2D_OK;
+    fx_matrix_mul_fused(&gm, &w, &bias, FX_ACT_NONE, FIXED_ZERO, &ym);
+
+    TEST_ASSERT(ref_ok && memcmp(y_graph, y_ref, sizeof(y_ref)) == 0,
+                "Graph output bit-identical to direct calls");
+
+    const fx_pool2d_params_t bad = { FX_POOL2D_MAX, 3, 3, 1, 1, 3, 0, false };
+    TEST_ASSERT(fx_graph_pool2d(&g_graph, x, &bad, &h1) == FX_GRAPH_INVALID_PARAM,
+                "Padding ≥ kernel rejected");
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("  SRS-009 Model Graph Verification Suite\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    test_graph_matches_manual();
+    test_arena_reuse();
+    test_plan_deterministic();
+    test_graph_invalid();
+    test_graph_pooling();
+
+    /* Print summary */
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-009 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-009 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+    printf("Requirements validated:\n");
+    printf("  • SRS-009.1: Static graph declaration\n");
+    printf("  • SRS-009.2: Liveness analysis\n");
+    printf("  • SRS-009.3: Arena reuse and in-place activations\n");
+    printf("  • SRS-009.4: Deterministic planning\n");
+    printf("  • SRS-009.5: Bit-identical execution\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
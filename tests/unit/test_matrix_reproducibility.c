@@ -296,6 +296,129 @@ void test_matrix_addition(void) {
     printf("✓\n");
 }
 
+/* Scratch for the blocked-vs-reference sweep (kept off the stack) */
+#define SWEEP_MAX_M 67
+#define SWEEP_MAX_K 300
+#define SWEEP_MAX_N 13
+static fixed_t g_sweep_a[SWEEP_MAX_M * SWEEP_MAX_K];
+static fixed_t g_sweep_b[SWEEP_MAX_K * SWEEP_MAX_N];
+static fixed_t g_sweep_ref[SWEEP_MAX_M * SWEEP_MAX_N];
+static fixed_t g_sweep_blk[SWEEP_MAX_M * SWEEP_MAX_N];
+
+/**
+ * @brief Deterministic LCG so the sweep is reproducible on every platform.
+ */
+static uint32_t g_lcg_state = 12345u;
+static fixed_t lcg_fixed(void) {
+    g_lcg_state = g_lcg_state * 1664525u + 1013904223u;
+    /* Signed values in roughly ±16.0 exercise carries and rounding */
+    return (fixed_t)(g_lcg_state >> 11) - (fixed_t)(1 << 20);
+}
+
+/**
+ * @brief Test blocked GEMM is bit-identical to the reference loop (SRS-003.9).
+ * @traceability SRS-003.3, SRS-003.9
+ */
+void test_blocked_matches_reference(void) {
+    printf("  Testing blocked GEMM matches reference... ");
+
+    /* Shapes straddle the MR/NR tile edges and the MC/KC block edges */
+    static const uint16_t shapes[][3] = {
+        {1, 1, 1}, {2, 3, 2}, {3, 5, 7}, {4, 4, 4}, {5, 9, 6},
+        {17, 33, 9}, {64, 256, 4}, {65, 257, 5}, {67, 300, 13}
+    };
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        fx_matrix_t A, B, C_ref, C_blk;
+        uint16_t m = shapes[s][0], k = shapes[s][1], n = shapes[s][2];
+
+        fx_matrix_init(&A, g_sweep_a, m, k);
+        fx_matrix_init(&B, g_sweep_b, k, n);
+        fx_matrix_init(&C_ref, g_sweep_ref, m, n);
+        fx_matrix_init(&C_blk, g_sweep_blk, m, n);
+
+        for (size_t i = 0; i < (size_t)m * k; i++) {
+            A.data[i] = lcg_fixed();
+        }
+        for (size_t i = 0; i < (size_t)k * n; i++) {
+            B.data[i] = lcg_fixed();
+        }
+
+        fx_matrix_mul_ref(&A, &B, &C_ref);
+        fx_matrix_mul(&A, &B, &C_blk);
+
+        assert(memcmp(C_ref.data, C_blk.data, (size_t)m * n * sizeof(fixed_t)) == 0);
+    }
+
+    printf("✓\n");
+}
+
+static fixed_t g_sweep_packed[((SWEEP_MAX_N + FX_MATRIX_PANEL_COLS - 1) / FX_MATRIX_PANEL_COLS) *
+                              FX_MATRIX_PANEL_COLS * SWEEP_MAX_K];
+static fixed_t g_sweep_bias[SWEEP_MAX_N];
+
+/**
+ * @brief Test pre-packed B is bit-identical to packing per call (SRS-003.12).
+ * @traceability SRS-003.9, SRS-003.12
+ */
+void test_packed_matches_unpacked(void) {
+    printf("  Testing pre-packed GEMM operand... ");
+
+    static const uint16_t shapes[][3] = {
+        {1, 1, 1}, {3, 5, 7}, {4, 4, 4}, {17, 33, 9}, {65, 257, 5}, {67, 300, 13}
+    };
+
+    /* Panel layout: padded to whole 4-column panels */
+    assert(fx_matrix_packed_size(300, 13) == 16u * 300u);
+    assert(fx_matrix_packed_size(5, 4) == 20u);
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        fx_matrix_t A, B, C_ref, C_pk, bias;
+        fx_matrix_packed_t P;
+        uint16_t m = shapes[s][0], k = shapes[s][1], n = shapes[s][2];
+
+        fx_matrix_init(&A, g_sweep_a, m, k);
+        fx_matrix_init(&B, g_sweep_b, k, n);
+        fx_matrix_init(&C_ref, g_sweep_ref, m, n);
+        fx_matrix_init(&C_pk, g_sweep_blk, m, n);
+        fx_matrix_attach(&bias, g_sweep_bias, 1, n);
+
+        for (size_t i = 0; i < (size_t)m * k; i++) {
+            A.data[i] = lcg_fixed();
+        }
+        for (size_t i = 0; i < (size_t)k * n; i++) {
+            B.data[i] = lcg_fixed();
+        }
+        for (size_t i = 0; i < n; i++) {
+            g_sweep_bias[i] = lcg_fixed();
+        }
+
+        fx_matrix_pack(&B, g_sweep_packed, sizeof(g_sweep_packed) / sizeof(g_sweep_packed[0]), &P);
+        assert(P.data == g_sweep_packed && P.rows == k && P.cols == n);
+        /* Last panel starts at column 4p; lanes past N are zero */
+        const size_t last = (n - 1u) / 4u;
+        assert(P.data[last * k * 4u] == B.data[last * 4u]);
+        assert(n % 4u == 0 || P.data[last * k * 4u + 3u] == FIXED_ZERO);
+
+        fx_matrix_mul(&A, &B, &C_ref);
+        fx_matrix_mul_packed(&A, &P, &C_pk);
+        assert(memcmp(C_ref.data, C_pk.data, (size_t)m * n * sizeof(fixed_t)) == 0);
+
+        fx_matrix_mul_fused(&A, &B, &bias, FX_ACT_LEAKY_RELU, FIXED_ONE / 4, &C_ref);
+        fx_matrix_mul_packed_fused(&A, &P, &bias, FX_ACT_LEAKY_RELU, FIXED_ONE / 4, &C_pk);
+        assert(memcmp(C_ref.data, C_pk.data, (size_t)m * n * sizeof(fixed_t)) == 0);
+    }
+
+    /* Storage too small: operand untouched */
+    fx_matrix_t B;
+    fx_matrix_packed_t P = { NULL, 0, 0 };
+    fx_matrix_attach(&B, g_sweep_b, 3, 5);
+    fx_matrix_pack(&B, g_sweep_packed, fx_matrix_packed_size(3, 5) - 1, &P);
+    assert(P.data == NULL);
+
+    printf("✓\n");
+}
+
 int main(void) {
     printf("\n");
     printf("═══════════════════════════════════════════════\n");
@@ -310,10 +433,12 @@ int main(void) {
     test_overflow_protection();
     test_vector_dot_product();
     test_matrix_addition();
+    test_blocked_matches_reference();
+    test_packed_matches_unpacked();
 
     printf("\n");
     printf("═══════════════════════════════════════════════\n");
-    printf("  ✅ SRS-003 Verified (7 tests passed)\n");
+    printf("  ✅ SRS-003 Verified (9 tests passed)\n");
     printf("═══════════════════════════════════════════════\n");
     printf("\n");
     printf("Requirements validated:\n");
@@ -323,6 +448,8 @@ int main(void) {
     printf("  • SRS-003.4: Dimension validation\n");
     printf("  • SRS-003.5: 64-bit accumulator protection\n");
     printf("  • SRS-003.6: Bounded execution\n");
+    printf("  • SRS-003.9: Blocked GEMM matches reference\n");
+    printf("  • SRS-003.12: Pre-packed operands match per-call packing\n");
     printf("\n");
 
     return 0;
@@ -0,0 +1,205 @@
+/**
+ * @file test_phash.c
+ * @project Certifiable Inference Engine
+ * @brief Verification of generated minimal perfect hash tables.
+ *
+ * @details The build runs tools/gen_phash.py on tests/unit/phash_keys.txt
+ * and compiles the result in, so the Python generator and the C lookup
+ * are checked against each other. A d_table_t filled with the same
+ * records is the reference for members and non-members.
+ *
+ * @traceability SRS-017
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "perfect_hash.h"
+#include "model_keys_phash.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+static uint8_t g_pool[D_TABLE_BUFFER_SIZE(512)];
+static d_entry_t g_entries[MODEL_KEYS_SIZE];
+static uint16_t g_displace[sizeof(model_keys_displace) / sizeof(model_keys_displace[0])];
+
+static void test_hash_function(void) {
+    printf("\nTest: Seeded FNV-1a\n");
+    printf("───────────────────\n");
+
+    TEST_ASSERT(d_phash_hash("", 0) == 0x811C9DC5u, "Empty key gives the offset basis");
+    TEST_ASSERT(d_phash_hash("a", 0) == 0xE40C292Cu, "FNV-1a(\"a\") = 0xE40C292C");
+    TEST_ASSERT(d_phash_hash("a", 1) != d_phash_hash("a", 0), "Seed changes the hash");
+    TEST_ASSERT(d_phash_hash("backbone.stage4.block12.conv2.weight", 0) ==
+                d_phash_hash("backbone.stage4.block12.conv2.w", 0),
+                "Only the first 31 characters are hashed");
+}
+
+static void test_generated_table(void) {
+    printf("\nTest: Generated table\n");
+    printf("─────────────────────\n");
+
+    TEST_ASSERT(model_keys.size == MODEL_KEYS_SIZE, "Size macro matches the table");
+    TEST_ASSERT(d_phash_verify(&model_keys) == D_TABLE_OK, "Every record hashes to its own slot");
+
+    bool own_slot = true;
+    bool values = true;
+    for (uint32_t i = 0; i < model_keys.size; i++) {
+        int32_t value = 0;
+        own_slot = own_slot && d_phash_index(&model_keys, model_keys_entries[i].key) == i;
+        values = values && d_phash_get(&model_keys, model_keys_entries[i].key, &value) == D_TABLE_OK &&
+                 value == model_keys_entries[i].value;
+    }
+    TEST_ASSERT(own_slot, "d_phash_index() of each key is its slot");
+    TEST_ASSERT(values, "d_phash_get() returns each record's value");
+
+    int32_t value = 0;
+    TEST_ASSERT(d_phash_get(&model_keys, "stem.conv.weight", &value) == D_TABLE_OK && value == 0,
+                "Unvalued first key gets index 0");
+    TEST_ASSERT(d_phash_get(&model_keys, "stage1.block0.conv1.bias", &value) == D_TABLE_OK &&
+                value == 5, "Unvalued key gets its key index");
+    TEST_ASSERT(d_phash_get(&model_keys, "fc.weight", &value) == D_TABLE_OK && value == -7,
+                "Explicit negative value");
+    TEST_ASSERT(d_phash_get(&model_keys, "fc.bias", &value) == D_TABLE_OK && value == 0x7FFF,
+                "Explicit hexadecimal value");
+    TEST_ASSERT(d_phash_get(&model_keys, "cfg.\"quoted\"?\?=\\path", &value) == D_TABLE_OK &&
+                value == INT32_MIN, "Escaped key and INT32_MIN value");
+    TEST_ASSERT(d_phash_get(&model_keys, "backbone.stage4.block12.conv2.weight", &value) ==
+                D_TABLE_OK && value == 1234, "Long key found on its first 31 characters");
+    TEST_ASSERT(d_phash_get(&model_keys, "backbone.stage4.block12.conv2.", &value) ==
+                D_TABLE_NOT_FOUND, "Shorter prefix of a long key not found");
+}
+
+static void test_matches_d_table(void) {
+    printf("\nTest: Agreement with d_table_t\n");
+    printf("──────────────────────────────\n");
+
+    d_table_t table;
+    d_table_init(&table, g_pool, sizeof(g_pool));
+    bool inserted = true;
+    for (uint32_t i = 0; i < model_keys.size; i++) {
+        inserted = inserted &&
+                   d_table_insert(&table, model_keys_entries[i].key, model_keys_entries[i].value) ==
+                   D_TABLE_OK;
+    }
+    TEST_ASSERT(inserted && table.count == model_keys.size, "Records form a d_table_t");
+
+    /* Members and near misses: other stages, blocks, suffixes */
+    char key[64];                /* Room for three full-width %u fields */
+    bool agree = true;
+    unsigned probes = 0;
+    for (unsigned s = 0; s < 7; s++) {
+        for (unsigned b = 0; b < 6; b++) {
+            for (unsigned c = 0; c < 5; c++) {
+                snprintf(key, sizeof(key), "stage%u.block%u.conv%u.weight", s, b, c);
+                int32_t pv = -1;
+                int32_t tv = -2;
+                const d_table_res_t pr = d_phash_get(&model_keys, key, &pv);
+                const d_table_res_t tr = d_table_get(&table, key, &tv);
+                agree = agree && pr == tr && (pr != D_TABLE_OK || pv == tv);
+                agree = agree && (pr == D_TABLE_OK) ==
+                                 (d_phash_index(&model_keys, key) < model_keys.size);
+                probes++;
+            }
+        }
+    }
+    TEST_ASSERT(agree && probes == 210, "210 lookups agree on presence and value");
+
+    int32_t value = 99;
+    TEST_ASSERT(d_phash_get(&model_keys, "", &value) == D_TABLE_NOT_FOUND && value == 99,
+                "Empty key not found, value untouched");
+    TEST_ASSERT(d_phash_index(&model_keys, "fc") == model_keys.size, "Non-member index is size");
+}
+
+static void test_corrupted_data(void) {
+    printf("\nTest: Validation\n");
+    printf("────────────────\n");
+
+    d_phash_t copy = model_keys;
+    memcpy(g_entries, model_keys_entries, sizeof(g_entries));
+    memcpy(g_displace, model_keys_displace, sizeof(g_displace));
+    copy.entries = g_entries;
+    copy.displace = g_displace;
+    TEST_ASSERT(d_phash_verify(&copy) == D_TABLE_OK, "Writable copy verifies");
+
+    const d_entry_t first = g_entries[0];
+    g_entries[0] = g_entries[1];
+    g_entries[1] = first;
+    TEST_ASSERT(d_phash_verify(&copy) == D_TABLE_INVALID_PARAM, "Swapped records rejected");
+    g_entries[1] = g_entries[0];
+    g_entries[0] = first;
+
+    g_entries[3] = g_entries[7];
+    TEST_ASSERT(d_phash_verify(&copy) == D_TABLE_INVALID_PARAM, "Duplicate record rejected");
+    g_entries[3] = model_keys_entries[3];
+
+    memset(g_entries[5].key, 'x', D_TABLE_KEY_LEN);
+    TEST_ASSERT(d_phash_verify(&copy) == D_TABLE_INVALID_PARAM, "Unterminated key rejected");
+    g_entries[5] = model_keys_entries[5];
+
+    g_displace[1] = (uint16_t)copy.size;
+    TEST_ASSERT(d_phash_verify(&copy) == D_TABLE_INVALID_PARAM, "Displacement ≥ size rejected");
+    g_displace[1] = model_keys_displace[1];
+    TEST_ASSERT(d_phash_verify(&copy) == D_TABLE_OK, "Restored copy verifies");
+
+    copy.size = 0;
+    int32_t value = 0;
+    TEST_ASSERT(d_phash_verify(&copy) == D_TABLE_INVALID_PARAM, "Size 0 rejected");
+    TEST_ASSERT(d_phash_get(&copy, "fc.weight", &value) == D_TABLE_INVALID_PARAM &&
+                d_phash_index(&copy, "fc.weight") == 0, "Lookups in a size-0 table fail");
+    copy.size = model_keys.size;
+    copy.buckets = 0;
+    TEST_ASSERT(d_phash_verify(&copy) == D_TABLE_INVALID_PARAM, "Zero buckets rejected");
+
+    TEST_ASSERT(d_phash_verify(NULL) == D_TABLE_INVALID_PARAM &&
+                d_phash_get(NULL, "fc.weight", &value) == D_TABLE_INVALID_PARAM &&
+                d_phash_get(&model_keys, NULL, &value) == D_TABLE_INVALID_PARAM &&
+                d_phash_get(&model_keys, "fc.weight", NULL) == D_TABLE_INVALID_PARAM &&
+                d_phash_index(NULL, "fc.weight") == 0 &&
+                d_phash_index(&model_keys, NULL) == model_keys.size,
+                "NULL arguments rejected");
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("  SRS-017 Perfect Hash Verification Suite\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    test_hash_function();
+    test_generated_table();
+    test_matches_d_table();
+    test_corrupted_data();
+
+    /* Print summary */
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-017 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-017 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,545 @@
+/**
+ * @file test_pipeline.c
+ * @project Certifiable Inference Engine
+ * @brief Verification of the multi-stage frame pipeline.
+ *
+ * @details Verifies:
+ * - SPSC rings are FIFO, bounded by their depth and survive wrap-around
+ * - A conv → pool → dense model split into three stage graphs produces,
+ *   frame for frame and in order, the bits of the unsplit graph, both
+ *   stepped on one thread and with one thread per stage
+ * - A failing stage halts the pipeline and is reported with its index
+ * - Invalid construction and misuse are rejected
+ *
+ * @traceability SRS-014
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "pipeline.h"
+#include "graph.h"
+#include "fixed_point.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Model: 3×16×16 → conv 8 (3×3, pad 1, ReLU) → max pool → dense 10 */
+#define FRAMES     50
+#define IN_LEN     (3 * 16 * 16)
+#define CONV_LEN   (8 * 16 * 16)
+#define POOL_LEN   (8 * 8 * 8)
+#define OUT_LEN    10
+#define ARENA_LEN  8192
+
+static fixed_t g_frames[FRAMES][IN_LEN];
+static fixed_t g_expected[FRAMES][OUT_LEN];
+static fixed_t g_got[FRAMES][OUT_LEN];
+
+static fixed_t g_w1[8 * 3 * 3 * 3];
+static fixed_t g_b1[8];
+static fixed_t g_w2[POOL_LEN * OUT_LEN];
+static fixed_t g_b2[OUT_LEN];
+
+static fx_graph_t g_full, g_conv, g_pool, g_dense;
+static fixed_t g_arena_full[ARENA_LEN];
+static fixed_t g_arena_conv[ARENA_LEN];
+static fixed_t g_arena_pool[ARENA_LEN];
+static fixed_t g_arena_dense[ARENA_LEN];
+
+/* Ring storage */
+static fixed_t g_in_slots[4 * IN_LEN];
+static fixed_t g_conv_slots[2 * CONV_LEN];
+static fixed_t g_pool_slots[3 * POOL_LEN];
+static fixed_t g_out_slots[4 * OUT_LEN];
+
+static fx_pipeline_t g_pipe;
+static bool g_threads_supported = false;
+
+/* Deterministic pseudo-random Q16.16 values in [-2^(bits-1), 2^(bits-1)) */
+static uint32_t g_lcg_state = 0x3C6EF372u;
+static fixed_t lcg_fixed(unsigned bits) {
+    g_lcg_state = g_lcg_state * 1664525u + 1013904223u;
+    return (fixed_t)(int32_t)(g_lcg_state >> (32u - bits)) - (fixed_t)(1 << (bits - 1u));
+}
+
+static void fill(fixed_t* buf, size_t len, unsigned bits) {
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = lcg_fixed(bits);
+    }
+}
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Model graphs
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+static fx_tensor_t g_w1_t;
+static fx_matrix_t g_w2_m, g_b2_m;
+static const fx_conv_epilogue_t g_relu = { FX_ACT_RELU, FIXED_ZERO, false };
+
+static fx_graph_res_t add_conv(fx_graph_t* g, fx_tensor_id_t in, fx_tensor_id_t* out) {
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+    p.pad_h = p.pad_w = 1;
+    return fx_graph_conv2d(g, in, &g_w1_t, g_b1, &p, &g_relu, out);
+}
+
+static fx_graph_res_t add_dense(fx_graph_t* g, fx_tensor_id_t in, fx_tensor_id_t* out) {
+    return fx_graph_dense(g, in, &g_w2_m, &g_b2_m, FX_ACT_NONE, FIXED_ZERO, out);
+}
+
+/**
+ * @brief Plan a graph and check its arena fits.
+ */
+static fx_graph_res_t finish(fx_graph_t* g, fx_tensor_id_t y, fx_graph_res_t res) {
+    fx_graph_stats_t st;
+    if (res == FX_GRAPH_OK) res = fx_graph_output(g, y);
+    if (res == FX_GRAPH_OK) res = fx_graph_plan(g, &st);
+    if (res == FX_GRAPH_OK && st.arena_len > ARENA_LEN) res = FX_GRAPH_ARENA_TOO_SMALL;
+    return res;
+}
+
+static fx_graph_stage_t g_st_conv, g_st_pool, g_st_dense;
+
+/**
+ * @brief Build the unsplit reference graph and the three stage graphs.
+ */
+static bool build_model(void) {
+    fx_tensor_id_t x, h1, h2, y;
+    fx_graph_res_t res;
+
+    fill(g_w1, sizeof(g_w1) / sizeof(g_w1[0]), 18);
+    fill(g_b1, 8, 18);
+    fill(g_w2, sizeof(g_w2) / sizeof(g_w2[0]), 15);
+    fill(g_b2, OUT_LEN, 18);
+    fill(&g_frames[0][0], (size_t)FRAMES * IN_LEN, 24);
+
+    fx_tensor_attach(&g_w1_t, g_w1, 8, 3, 3, 3, FX_LAYOUT_NCHW);
+    fx_matrix_attach(&g_w2_m, g_w2, POOL_LEN, OUT_LEN);
+    fx_matrix_attach(&g_b2_m, g_b2, 1, OUT_LEN);
+
+    res = fx_graph_init(&g_full);
+    if (res == FX_GRAPH_OK) res = fx_graph_input(&g_full, 1, 3, 16, 16, FX_LAYOUT_NCHW, &x);
+    if (res == FX_GRAPH_OK) res = add_conv(&g_full, x, &h1);
+    if (res == FX_GRAPH_OK) res = fx_graph_maxpool_2x2(&g_full, h1, &h2);
+    if (res == FX_GRAPH_OK) res = add_dense(&g_full, h2, &y);
+    if (finish(&g_full, y, res) != FX_GRAPH_OK) return false;
+
+    for (size_t f = 0; f < FRAMES; f++) {
+        if (fx_graph_bind(&g_full, x, g_frames[f]) != FX_GRAPH_OK ||
+            fx_graph_bind(&g_full, y, g_expected[f]) != FX_GRAPH_OK ||
+            fx_graph_run(&g_full, g_arena_full, ARENA_LEN) != FX_GRAPH_OK) {
+            return false;
+        }
+    }
+
+    res = fx_graph_init(&g_conv);
+    if (res == FX_GRAPH_OK) res = fx_graph_input(&g_conv, 1, 3, 16, 16, FX_LAYOUT_NCHW, &x);
+    if (res == FX_GRAPH_OK) res = add_conv(&g_conv, x, &y);
+    if (finish(&g_conv, y, res) != FX_GRAPH_OK) return false;
+    g_st_conv = (fx_graph_stage_t){ &g_conv, x, y, g_arena_conv, ARENA_LEN };
+
+    res = fx_graph_init(&g_pool);
+    if (res == FX_GRAPH_OK) res = fx_graph_input(&g_pool, 1, 8, 16, 16, FX_LAYOUT_NCHW, &x);
+    if (res == FX_GRAPH_OK) res = fx_graph_maxpool_2x2(&g_pool, x, &y);
+    if (finish(&g_pool, y, res) != FX_GRAPH_OK) return false;
+    g_st_pool = (fx_graph_stage_t){ &g_pool, x, y, g_arena_pool, ARENA_LEN };
+
+    res = fx_graph_init(&g_dense);
+    if (res == FX_GRAPH_OK) res = fx_graph_input(&g_dense, 1, 8, 8, 8, FX_LAYOUT_NCHW, &x);
+    if (res == FX_GRAPH_OK) res = add_dense(&g_dense, x, &y);
+    if (finish(&g_dense, y, res) != FX_GRAPH_OK) return false;
+    g_st_dense = (fx_graph_stage_t){ &g_dense, x, y, g_arena_dense, ARENA_LEN };
+
+    return true;
+}
+
+static fx_pipe_res_t build_pipeline(fx_pipeline_t* p) {
+    fx_pipe_res_t res = fx_pipeline_init(p, g_in_slots, IN_LEN, 4);
+    if (res == FX_PIPE_OK) res = fx_pipeline_add_stage(p, fx_graph_stage_run, &g_st_conv,
+                                                       g_conv_slots, CONV_LEN, 2, -1);
+    if (res == FX_PIPE_OK) res = fx_pipeline_add_stage(p, fx_graph_stage_run, &g_st_pool,
+                                                       g_pool_slots, POOL_LEN, 3, -1);
+    if (res == FX_PIPE_OK) res = fx_pipeline_add_stage(p, fx_graph_stage_run, &g_st_dense,
+                                                       g_out_slots, OUT_LEN, 4, -1);
+    return res;
+}
+
+/**
+ * @brief Feed every frame and collect every output.
+ *
+ * @param[in] threaded Stages run on their own threads (else stepped here)
+ *
+ * @return Frames received, in order, into g_got
+ */
+static size_t stream_frames(fx_pipeline_t* p, bool threaded, uint32_t* max_in_flight) {
+    fx_ring_t* in = fx_pipeline_input(p);
+    fx_ring_t* out = fx_pipeline_output(p);
+    size_t sent = 0;
+    size_t received = 0;
+    unsigned long idle = 0;
+
+    *max_in_flight = 0;
+    while (received < FRAMES && idle < 100000000ul) {
+        bool progress = false;
+
+        if (sent < FRAMES) {
+            fixed_t* slot = fx_ring_acquire(in);
+            if (slot) {
+                memcpy(slot, g_frames[sent], sizeof(g_frames[0]));
+                fx_ring_commit(in);
+                sent++;
+                progress = true;
+            }
+        }
+        if (!threaded && fx_pipeline_step(p) == FX_PIPE_OK) {
+            progress = true;
+        }
+        const fixed_t* y = fx_ring_peek(out);
+        if (y) {
+            memcpy(g_got[received], y, sizeof(g_got[0]));
+            fx_ring_release(out);
+            received++;
+            progress = true;
+        }
+
+        const uint32_t in_flight = (uint32_t)(sent - received);
+        if (in_flight > *max_in_flight) {
+            *max_in_flight = in_flight;
+        }
+        idle = progress ? 0 : idle + 1;
+    }
+    return received;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════
+ * Tests
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+/**
+ * @test Ring FIFO order, bounds and wrap-around
+ * @traceability SRS-014.1
+ */
+static void test_ring(void) {
+    printf("\nTest: SPSC ring\n");
+    printf("───────────────\n");
+
+    static fixed_t slots[3 * 2];
+    fx_ring_t r;
+
+    TEST_ASSERT(fx_ring_init(&r, slots, 2, 3) == FX_PIPE_OK, "Init depth 3, 2 elements/slot");
+    TEST_ASSERT(fx_ring_peek(&r) == NULL && fx_ring_count(&r) == 0, "Empty after init");
+
+    bool ok = true;
+    for (int i = 0; i < 3; i++) {
+        fixed_t* s = fx_ring_acquire(&r);
+        ok = ok && s != NULL && s == fx_ring_acquire(&r);
+        if (s) {
+            s[0] = i;
+            s[1] = -i;
+            fx_ring_commit(&r);
+        }
+    }
+    TEST_ASSERT(ok && fx_ring_count(&r) == 3, "Three commits; acquire is idempotent");
+    TEST_ASSERT(fx_ring_acquire(&r) == NULL, "Full at depth");
+
+    /* 1000 frames through a depth-3 ring: order kept across wrap-around */
+    int next_in = 3;
+    int next_out = 0;
+    while (next_out < 1000 && ok) {
+        const fixed_t* s = fx_ring_peek(&r);
+        if (s) {
+            ok = s[0] == next_out && s[1] == -next_out;
+            fx_ring_release(&r);
+            next_out++;
+        }
+        fixed_t* w = next_in < 1000 ? fx_ring_acquire(&r) : NULL;
+        if (w) {
+            w[0] = next_in;
+            w[1] = -next_in;
+            fx_ring_commit(&r);
+            next_in++;
+        }
+        ok = ok && fx_ring_count(&r) <= 3;
+    }
+    TEST_ASSERT(ok && next_out == 1000, "1000 frames FIFO, never above depth");
+    TEST_ASSERT(fx_ring_peek(&r) == NULL, "Empty after draining");
+
+    /* Counters near UINT32_MAX, depth 3: 2^32 is not a multiple of 3,
+     * so free-running counters would reuse a slot at the wrap */
+    r.head = r.tail = 0xFFFFFFFEu;
+    ok = true;
+    ptrdiff_t prev = -1;
+    for (int i = 0; i < 20 && ok; i++) {
+        fixed_t* w = fx_ring_acquire(&r);
+        ok = w != NULL;
+        if (w) {
+            const ptrdiff_t slot = (w - slots) / 2;
+            ok = prev < 0 || slot == (prev + 1) % 3;
+            prev = slot;
+            w[0] = 100 + i;
+            fx_ring_commit(&r);
+            const fixed_t* s = fx_ring_peek(&r);
+            ok = ok && s == w && s[0] == 100 + i && fx_ring_count(&r) == 1;
+            fx_ring_release(&r);
+        }
+    }
+    TEST_ASSERT(ok, "Counter overflow keeps strict slot rotation");
+
+    /* Two frames in flight across the same wrap: FIFO and bounded */
+    r.head = r.tail = 0xFFFFFFFDu;
+    ok = true;
+    next_in = next_out = 0;
+    while (next_out < 20 && ok) {
+        fixed_t* w = next_in < 20 && fx_ring_count(&r) < 2 ? fx_ring_acquire(&r) : NULL;
+        if (w) {
+            w[0] = next_in++;
+            fx_ring_commit(&r);
+            continue;
+        }
+        const fixed_t* s = fx_ring_peek(&r);
+        ok = s != NULL && s[0] == next_out && fx_ring_count(&r) == (uint32_t)(next_in - next_out);
+        fx_ring_release(&r);
+        next_out++;
+    }
+    TEST_ASSERT(ok && next_out == 20, "FIFO across counter overflow with two frames in flight");
+
+    TEST_ASSERT(fx_ring_init(&r, NULL, 2, 3) == FX_PIPE_INVALID_PARAM, "NULL storage rejected");
+    TEST_ASSERT(fx_ring_init(&r, slots, 0, 3) == FX_PIPE_INVALID_PARAM, "Zero slot length rejected");
+    TEST_ASSERT(fx_ring_init(&r, slots, 2, 0) == FX_PIPE_INVALID_PARAM, "Zero depth rejected");
+    TEST_ASSERT(fx_ring_init(&r, slots, 2, FX_PIPE_MAX_DEPTH + 1) == FX_PIPE_INVALID_PARAM,
+                "Depth above FX_PIPE_MAX_DEPTH rejected");
+}
+
+/**
+ * @test Stepped pipeline equals the unsplit graph
+ * @traceability SRS-014.2, SRS-014.4
+ */
+static void test_stepped(void) {
+    printf("\nTest: Three-stage pipeline, stepped\n");
+    printf("───────────────────────────────────\n");
+
+    uint32_t max_in_flight;
+
+    TEST_ASSERT(build_pipeline(&g_pipe) == FX_PIPE_OK, "Build conv → pool → dense");
+    memset(g_got, 0, sizeof(g_got));
+    const size_t n = stream_frames(&g_pipe, false, &max_in_flight);
+
+    TEST_ASSERT(n == FRAMES, "All 50 frames delivered");
+    TEST_ASSERT(memcmp(g_got, g_expected, sizeof(g_got)) == 0,
+                "Outputs bit-identical to the unsplit graph, in order");
+    TEST_ASSERT(max_in_flight <= 4 + 2 + 3 + 4 + 3, "Frames in flight within Σ depth + stages");
+    TEST_ASSERT(fx_pipeline_step(&g_pipe) == FX_PIPE_IDLE, "Drained pipeline is idle");
+    TEST_ASSERT(fx_pipeline_stop(&g_pipe) == FX_PIPE_OK, "Stop on a stepped pipeline is OK");
+}
+
+/**
+ * @test One thread per stage equals the unsplit graph
+ * @traceability SRS-014.3
+ */
+static void test_threaded(void) {
+    printf("\nTest: Three-stage pipeline, one thread per stage\n");
+    printf("────────────────────────────────────────────────\n");
+
+    uint32_t max_in_flight;
+
+    build_pipeline(&g_pipe);
+    const fx_pipe_res_t res = fx_pipeline_start(&g_pipe);
+    g_threads_supported = res == FX_PIPE_OK;
+
+    if (!g_threads_supported) {
+        TEST_ASSERT(res == FX_PIPE_UNSUPPORTED, "Threads unavailable: start reports UNSUPPORTED");
+        return;
+    }
+
+    TEST_ASSERT(fx_pipeline_start(&g_pipe) == FX_PIPE_BUSY, "Second start rejected");
+    TEST_ASSERT(fx_pipeline_step(&g_pipe) == FX_PIPE_BUSY, "Step rejected while running");
+    TEST_ASSERT(fx_pipeline_add_stage(&g_pipe, fx_graph_stage_run, &g_st_dense, g_out_slots,
+                                      OUT_LEN, 4, -1) == FX_PIPE_BUSY,
+                "Adding a stage while running rejected");
+
+    memset(g_got, 0, sizeof(g_got));
+    const size_t n = stream_frames(&g_pipe, true, &max_in_flight);
+
+    TEST_ASSERT(fx_pipeline_stop(&g_pipe) == FX_PIPE_OK, "Stop joins every stage");
+    TEST_ASSERT(n == FRAMES, "All 50 frames delivered");
+    TEST_ASSERT(memcmp(g_got, g_expected, sizeof(g_got)) == 0,
+                "Outputs bit-identical to the unsplit graph, in order");
+    TEST_ASSERT(max_in_flight <= 4 + 2 + 3 + 4 + 3, "Frames in flight within Σ depth + stages");
+
+    /* Restart after stop reuses the same rings */
+    TEST_ASSERT(fx_pipeline_start(&g_pipe) == FX_PIPE_OK, "Restart after stop");
+    memset(g_got, 0, sizeof(g_got));
+    const size_t again = stream_frames(&g_pipe, true, &max_in_flight);
+    fx_pipeline_stop(&g_pipe);
+    TEST_ASSERT(again == FRAMES && memcmp(g_got, g_expected, sizeof(g_got)) == 0,
+                "Second run identical");
+
+    /* A core that cannot exist cannot be pinned to */
+    fx_pipeline_init(&g_pipe, g_in_slots, IN_LEN, 4);
+    fx_pipeline_add_stage(&g_pipe, fx_graph_stage_run, &g_st_conv, g_conv_slots, CONV_LEN, 2,
+                          1 << 20);
+    TEST_ASSERT(fx_pipeline_start(&g_pipe) == FX_PIPE_SYSTEM && !g_pipe.running,
+                "Unpinnable core reports SYSTEM, nothing left running");
+}
+
+typedef struct {
+    unsigned calls;
+    unsigned fail_at;
+} failing_ctx_t;
+
+static bool copy_or_fail(void* ctx, const fixed_t* in, fixed_t* out) {
+    failing_ctx_t* f = (failing_ctx_t*)ctx;
+    if (f->calls++ == f->fail_at) {
+        return false;
+    }
+    out[0] = in[0];
+    return true;
+}
+
+/**
+ * @test Stage failure halts the pipeline and names the stage
+ * @traceability SRS-014.3
+ */
+static void test_stage_failure(void) {
+    printf("\nTest: Stage failure\n");
+    printf("───────────────────\n");
+
+    static fixed_t a[4], b[4], c[4];
+    failing_ctx_t ok_ctx = { 0, 1000 };
+    failing_ctx_t bad_ctx = { 0, 3 };
+
+    fx_pipeline_init(&g_pipe, a, 1, 4);
+    fx_pipeline_add_stage(&g_pipe, copy_or_fail, &ok_ctx, b, 1, 4, -1);
+    fx_pipeline_add_stage(&g_pipe, copy_or_fail, &bad_ctx, c, 1, 4, -1);
+    TEST_ASSERT(fx_pipeline_failed_stage(&g_pipe) == -1, "No failure recorded initially");
+
+    fx_ring_t* in = fx_pipeline_input(&g_pipe);
+    fx_ring_t* out = fx_pipeline_output(&g_pipe);
+    fx_pipe_res_t res = FX_PIPE_OK;
+    unsigned received = 0;
+    fixed_t value = 0;
+    for (int i = 0; i < 100 && res != FX_PIPE_STAGE_FAILED; i++) {
+        fixed_t* s = fx_ring_acquire(in);
+        if (s) {
+            s[0] = value++;
+            fx_ring_commit(in);
+        }
+        res = fx_pipeline_step(&g_pipe);
+        while (fx_ring_peek(out)) {
+            fx_ring_release(out);
+            received++;
+        }
+    }
+    TEST_ASSERT(res == FX_PIPE_STAGE_FAILED && fx_pipeline_failed_stage(&g_pipe) == 1,
+                "Stepped: failure of stage 1 reported");
+    TEST_ASSERT(received == 3, "Stepped: frames before the failure delivered");
+    TEST_ASSERT(fx_pipeline_step(&g_pipe) == FX_PIPE_STAGE_FAILED, "Failed pipeline stays failed");
+    TEST_ASSERT(fx_pipeline_stop(&g_pipe) == FX_PIPE_STAGE_FAILED, "Stop reports the failure");
+
+    if (!g_threads_supported) {
+        return;
+    }
+
+    ok_ctx.calls = 0;
+    bad_ctx.calls = 0;
+    fx_pipeline_init(&g_pipe, a, 1, 4);
+    fx_pipeline_add_stage(&g_pipe, copy_or_fail, &ok_ctx, b, 1, 4, -1);
+    fx_pipeline_add_stage(&g_pipe, copy_or_fail, &bad_ctx, c, 1, 4, -1);
+    fx_pipeline_start(&g_pipe);
+    for (unsigned long spin = 0; fx_pipeline_failed_stage(&g_pipe) < 0 && spin < 100000000ul;
+         spin++) {
+        fixed_t* s = fx_ring_acquire(in);
+        if (s) {
+            s[0] = 0;
+            fx_ring_commit(in);
+        }
+        if (fx_ring_peek(out)) {
+            fx_ring_release(out);
+        }
+    }
+    TEST_ASSERT(fx_pipeline_failed_stage(&g_pipe) == 1, "Threaded: failure of stage 1 recorded");
+    TEST_ASSERT(fx_pipeline_stop(&g_pipe) == FX_PIPE_STAGE_FAILED,
+                "Threaded: stop joins and reports the failure");
+}
+
+/**
+ * @test Invalid construction rejected
+ * @traceability SRS-014.2
+ */
+static void test_invalid(void) {
+    printf("\nTest: Invalid construction\n");
+    printf("──────────────────────────\n");
+
+    static fixed_t a[4], b[4];
+
+    TEST_ASSERT(fx_pipeline_init(NULL, a, 1, 4) == FX_PIPE_INVALID_PARAM, "NULL pipeline rejected");
+    TEST_ASSERT(fx_pipeline_init(&g_pipe, a, 1, 0) == FX_PIPE_INVALID_PARAM,
+                "Zero input depth rejected");
+
+    fx_pipeline_init(&g_pipe, a, 1, 4);
+    TEST_ASSERT(fx_pipeline_step(&g_pipe) == FX_PIPE_INVALID_PARAM, "Step with no stages rejected");
+    TEST_ASSERT(fx_pipeline_start(&g_pipe) == FX_PIPE_INVALID_PARAM, "Start with no stages rejected");
+    TEST_ASSERT(fx_pipeline_add_stage(&g_pipe, NULL, NULL, b, 1, 4, -1) == FX_PIPE_INVALID_PARAM,
+                "NULL stage function rejected");
+    TEST_ASSERT(fx_pipeline_add_stage(&g_pipe, copy_or_fail, NULL, b, 1, 0, -1) ==
+                FX_PIPE_INVALID_PARAM, "Zero stage depth rejected");
+
+    fx_pipe_res_t res = FX_PIPE_OK;
+    for (int s = 0; s < FX_PIPE_MAX_STAGES && res == FX_PIPE_OK; s++) {
+        res = fx_pipeline_add_stage(&g_pipe, copy_or_fail, NULL, b, 1, 4, -1);
+    }
+    TEST_ASSERT(res == FX_PIPE_OK, "FX_PIPE_MAX_STAGES stages accepted");
+    TEST_ASSERT(fx_pipeline_add_stage(&g_pipe, copy_or_fail, NULL, b, 1, 4, -1) == FX_PIPE_FULL,
+                "One more stage reports FULL");
+    TEST_ASSERT(!fx_graph_stage_run(NULL, a, b), "Graph stage without context fails");
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("  SRS-014 Pipelined Executor Verification\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    if (!build_model()) {
+        printf("  ✗ FAILED: model construction\n");
+        return 1;
+    }
+
+    test_ring();
+    test_stepped();
+    test_threaded();
+    test_stage_failure();
+    test_invalid();
+
+    /* Print summary */
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-014 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-014 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
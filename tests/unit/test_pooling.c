@@ -1,13 +1,16 @@
 /**
  * @file test_pooling.c
  * @project Certifiable Inference Engine
- * @brief Unit tests for deterministic max pooling operations.
+ * @brief Unit tests for deterministic pooling operations.
  *
  * @details Comprehensive test suite verifying:
  * - Correctness of max selection
  * - Dimension reduction
  * - Boundary value handling
  * - Deterministic behavior
+ * - k×k strided max / average pooling against an independent window
+ *   scan, in both layouts, with padding and odd extents
+ * - Average rounding and global average pooling
  *
  * @traceability SRS-008-POOLING
  * @compliance DO-178C, ISO 26262, IEC 62304
@@ -324,10 +327,355 @@ static void test_range_preservation(void) {
     TEST_ASSERT(in_max == fixed_from_int(15), "Input max = 15");
 }
 
+/* ═══════════════════════════════════════════════════════════════════════
+ * Tensor pooling (SRS-008.8 – SRS-008.12)
+ * ═══════════════════════════════════════════════════════════════════════ */
+
+#define POOL_MAX_ELEMS 8192
+
+static fixed_t g_pool_in[POOL_MAX_ELEMS];
+static fixed_t g_pool_out[POOL_MAX_ELEMS];
+static fixed_t g_pool_ref[POOL_MAX_ELEMS];
+static fixed_t g_pool_ws[POOL_MAX_ELEMS];
+
+/* Deterministic pseudo-random Q16.16 values in [-2^(bits-1), 2^(bits-1)) */
+static uint32_t g_lcg_state = 0x510E527Fu;
+static fixed_t lcg_fixed(unsigned bits) {
+    g_lcg_state = g_lcg_state * 1664525u + 1013904223u;
+    return (fixed_t)(int32_t)(g_lcg_state >> (32u - bits)) - (fixed_t)(1 << (bits - 1u));
+}
+
+static size_t t_index(const fx_tensor_t* t, int b, int c, int y, int x) {
+    if (t->layout == FX_LAYOUT_NHWC) {
+        return (((size_t)b * t->h + y) * t->w + x) * t->c + c;
+    }
+    return (((size_t)b * t->c + c) * t->h + y) * t->w + x;
+}
+
+/**
+ * @brief Independent oracle: visit the padded window, skip samples
+ *        outside the image, round (2·sum + d) / 2d down.
+ */
+static void naive_pool(const fx_tensor_t* in, const fx_pool2d_params_t* p, fx_tensor_t* out) {
+    for (int b = 0; b < in->n; b++) {
+        for (int c = 0; c < in->c; c++) {
+            for (int y = 0; y < out->h; y++) {
+                for (int x = 0; x < out->w; x++) {
+                    int64_t sum = 0;
+                    int64_t count = 0;
+                    fixed_t m = INT32_MIN;
+                    for (int i = 0; i < p->kernel_h; i++) {
+                        for (int j = 0; j < p->kernel_w; j++) {
+                            const int iy = y * p->stride_h - p->pad_h + i;
+                            const int ix = x * p->stride_w - p->pad_w + j;
+                            if (iy < 0 || ix < 0 || iy >= in->h || ix >= in->w) {
+                                continue;
+                            }
+                            const fixed_t v = in->data[t_index(in, b, c, iy, ix)];
+                            m = v > m ? v : m;
+                            sum += v;
+                            count++;
+                        }
+                    }
+                    if (p->mode == FX_POOL2D_AVG) {
+                        const int64_t d = p->count_pad ? (int64_t)p->kernel_h * p->kernel_w
+                                                       : count;
+                        const int64_t num = 2 * sum + d;
+                        int64_t q = num / (2 * d);
+                        if (num < 0 && q * 2 * d != num) {
+                            q--;
+                        }
+                        m = (fixed_t)q;
+                    }
+                    out->data[t_index(out, b, c, y, x)] = m;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @test Output extents, including odd inputs
+ * @traceability SRS-008.9, SRS-008.10
+ */
+static void test_pool2d_out_dim(void) {
+    printf("\nTest: Pooled output extents\n");
+    printf("───────────────────────────\n");
+
+    TEST_ASSERT(fx_pool2d_out_dim(28, 3, 2, 0) == 13, "28, 3×3 / stride 2 → 13");
+    TEST_ASSERT(fx_pool2d_out_dim(7, 2, 2, 0) == 3, "Odd 7, 2×2 / stride 2 → 3 (last column dropped)");
+    TEST_ASSERT(fx_pool2d_out_dim(112, 3, 2, 1) == 56, "112, 3×3 / stride 2, pad 1 → 56");
+    TEST_ASSERT(fx_pool2d_out_dim(2, 3, 1, 0) == 0, "Window larger than input → 0");
+    TEST_ASSERT(fx_pool2d_out_dim(8, 0, 1, 0) == 0 && fx_pool2d_out_dim(8, 2, 0, 0) == 0,
+                "Zero kernel or stride → 0");
+}
+
+/**
+ * @test 3×3 / stride-2 max pool of a known 5×5 plane
+ * @traceability SRS-008.9
+ */
+static void test_maxpool_3x3_s2(void) {
+    printf("\nTest: 3×3 / stride-2 max pooling\n");
+    printf("────────────────────────────────\n");
+
+    static const int v[25] = {
+        1,  2,  3,  4,  5,
+        6, 20,  8,  9, 10,
+       11, 12, 13, 14, 15,
+       16, 17, 18, 30, 19,
+       21, 22, 23, 24, -1
+    };
+    const fx_pool2d_params_t p = FX_POOL2D_PARAMS_MAX_3X3_S2;
+    fx_tensor_t in, out;
+
+    fx_tensor_init(&in, g_pool_in, 1, 1, 5, 5, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out, g_pool_out, 1, 1, 2, 2, FX_LAYOUT_NCHW);
+    for (int i = 0; i < 25; i++) {
+        in.data[i] = fixed_from_int(v[i]);
+    }
+
+    const size_t ws = fx_pool2d_workspace_size(&in, &p, &out);
+    TEST_ASSERT(ws == 5 * 2, "Workspace is input rows × output columns");
+    TEST_ASSERT(fx_pool2d(&in, &p, g_pool_ws, ws, &out) == FX_POOL2D_OK, "Pooling succeeds");
+    TEST_ASSERT(out.data[0] == fixed_from_int(20) && out.data[1] == fixed_from_int(15) &&
+                out.data[2] == fixed_from_int(23) && out.data[3] == fixed_from_int(30),
+                "Overlapping windows: [20 15; 23 30]");
+}
+
+/**
+ * @test Separable max and direct average match the independent oracle
+ * @traceability SRS-008.8, SRS-008.9, SRS-008.10, SRS-008.11
+ */
+static void test_pool2d_matches_oracle(void) {
+    printf("\nTest: k×k strided pooling vs window scan\n");
+    printf("────────────────────────────────────────\n");
+
+    static const struct { uint16_t h, w, kh, kw, sh, sw, ph, pw; } shapes[] = {
+        { 9, 11, 3, 3, 2, 2, 0, 0 },
+        { 9, 11, 3, 3, 2, 2, 1, 1 },
+        { 8, 8, 2, 2, 2, 2, 0, 0 },
+        { 7, 13, 2, 3, 1, 2, 1, 2 },
+        { 16, 15, 5, 5, 1, 1, 2, 2 },
+        { 6, 20, 1, 4, 1, 3, 0, 3 },
+        { 12, 12, 4, 2, 3, 1, 0, 1 },
+    };
+    static const fx_layout_t layouts[2] = { FX_LAYOUT_NCHW, FX_LAYOUT_NHWC };
+
+    int max_ok = 1, avg_ok = 1, ref_ok = 1;
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        for (int mode = 0; mode < 3; mode++) {
+            for (int li = 0; li < 2; li++) {
+                for (int lo = 0; lo < 2; lo++) {
+                    fx_pool2d_params_t p = { mode == 0 ? FX_POOL2D_MAX : FX_POOL2D_AVG,
+                                             shapes[s].kh, shapes[s].kw, shapes[s].sh,
+                                             shapes[s].sw, shapes[s].ph, shapes[s].pw,
+                                             mode == 2 };
+                    const uint16_t oh = fx_pool2d_out_dim(shapes[s].h, p.kernel_h,
+                                                          p.stride_h, p.pad_h);
+                    const uint16_t ow = fx_pool2d_out_dim(shapes[s].w, p.kernel_w,
+                                                          p.stride_w, p.pad_w);
+                    fx_tensor_t in, out, ref;
+                    fx_tensor_init(&in, g_pool_in, 2, 3, shapes[s].h, shapes[s].w, layouts[li]);
+                    for (size_t i = 0; i < fx_tensor_size(&in); i++) {
+                        in.data[i] = lcg_fixed(24);
+                    }
+                    fx_tensor_init(&out, g_pool_out, 2, 3, oh, ow, layouts[lo]);
+                    fx_tensor_init(&ref, g_pool_ref, 2, 3, oh, ow, layouts[lo]);
+
+                    naive_pool(&in, &p, &ref);
+                    const size_t ws = fx_pool2d_workspace_size(&in, &p, &out);
+                    const int ok = fx_pool2d(&in, &p, g_pool_ws, ws, &out) == FX_POOL2D_OK &&
+                        memcmp(out.data, ref.data, fx_tensor_size(&out) * sizeof(fixed_t)) == 0;
+                    if (mode == 0) {
+                        max_ok = max_ok && ok;
+                    } else {
+                        avg_ok = avg_ok && ok;
+                    }
+
+                    fx_tensor_init(&out, g_pool_out, 2, 3, oh, ow, layouts[lo]);
+                    ref_ok = ref_ok && fx_pool2d_ref(&in, &p, &out) == FX_POOL2D_OK &&
+                        memcmp(out.data, ref.data, fx_tensor_size(&out) * sizeof(fixed_t)) == 0;
+                }
+            }
+        }
+    }
+    TEST_ASSERT(max_ok, "Max: bit-identical, 7 geometries × layout pairs");
+    TEST_ASSERT(avg_ok, "Avg (valid and padded divisor): bit-identical");
+    TEST_ASSERT(ref_ok, "fx_pool2d_ref: bit-identical");
+
+    /* Large window: separable passes must still agree */
+    const fx_pool2d_params_t big = { FX_POOL2D_MAX, 15, 15, 1, 1, 7, 7, false };
+    fx_tensor_t in, out, ref;
+    fx_tensor_init(&in, g_pool_in, 1, 1, 64, 64, FX_LAYOUT_NCHW);
+    for (size_t i = 0; i < fx_tensor_size(&in); i++) {
+        in.data[i] = lcg_fixed(30);
+    }
+    fx_tensor_init(&out, g_pool_out, 1, 1, 64, 64, FX_LAYOUT_NCHW);
+    fx_tensor_init(&ref, g_pool_ref, 1, 1, 64, 64, FX_LAYOUT_NCHW);
+    naive_pool(&in, &big, &ref);
+    TEST_ASSERT(fx_pool2d(&in, &big, g_pool_ws, POOL_MAX_ELEMS, &out) == FX_POOL2D_OK &&
+                memcmp(out.data, ref.data, 64 * 64 * sizeof(fixed_t)) == 0,
+                "15×15 / stride 1, pad 7 on 64×64: bit-identical");
+}
+
+/**
+ * @test 2×2 / stride 2 uses the fx_maxpool_2x2 kernel, no workspace
+ * @traceability SRS-008.9, SRS-003.10
+ */
+static void test_pool2d_2x2_path(void) {
+    printf("\nTest: 2×2 / stride-2 tensor path\n");
+    printf("────────────────────────────────\n");
+
+    const fx_pool2d_params_t p = FX_POOL2D_PARAMS_MAX_2X2;
+    fx_tensor_t in, out;
+    fx_tensor_init(&in, g_pool_in, 2, 4, 10, 14, FX_LAYOUT_NCHW);
+    for (size_t i = 0; i < fx_tensor_size(&in); i++) {
+        in.data[i] = lcg_fixed(28);
+    }
+    fx_tensor_init(&out, g_pool_out, 2, 4, 5, 7, FX_LAYOUT_NCHW);
+
+    TEST_ASSERT(fx_pool2d_workspace_size(&in, &p, &out) == 0, "No workspace needed");
+    TEST_ASSERT(fx_pool2d(&in, &p, NULL, 0, &out) == FX_POOL2D_OK, "Pooling succeeds");
+
+    int ok = 1;
+    for (size_t plane = 0; plane < 8 && ok; plane++) {
+        fx_matrix_t a, c;
+        fixed_t expect[35];
+        fx_matrix_attach(&a, in.data + plane * 140, 10, 14);
+        fx_matrix_attach(&c, expect, 5, 7);
+        fx_maxpool_2x2_ref(&a, &c);
+        ok = memcmp(expect, out.data + plane * 35, sizeof(expect)) == 0;
+    }
+    TEST_ASSERT(ok, "Every plane equals fx_maxpool_2x2_ref");
+}
+
+/**
+ * @test Average rounding is half up, exact over the window
+ * @traceability SRS-008.8
+ */
+static void test_avgpool_rounding(void) {
+    printf("\nTest: Average rounding\n");
+    printf("──────────────────────\n");
+
+    /* Raw Q16.16 values: averages 1.5, −1.5, 2/3 and −2/3 of an LSB */
+    static const fixed_t v[10] = { 1, 2, -1, -2, 0, 1, 1, 0, -1, -1 };
+    const fx_pool2d_params_t p = { FX_POOL2D_AVG, 1, 2, 1, 2, 0, 0, false };
+    const fx_pool2d_params_t q = { FX_POOL2D_AVG, 1, 3, 1, 3, 0, 0, false };
+    fx_tensor_t in, out;
+
+    fx_tensor_init(&in, g_pool_in, 1, 1, 1, 4, FX_LAYOUT_NCHW);
+    memcpy(in.data, v, 4 * sizeof(fixed_t));
+    fx_tensor_init(&out, g_pool_out, 1, 1, 1, 2, FX_LAYOUT_NCHW);
+    fx_pool2d(&in, &p, NULL, 0, &out);
+    TEST_ASSERT(out.data[0] == 2 && out.data[1] == -1, "Ties round up: 1.5 → 2, −1.5 → −1");
+
+    fx_tensor_init(&in, g_pool_in, 1, 1, 1, 6, FX_LAYOUT_NCHW);
+    memcpy(in.data, v + 4, 6 * sizeof(fixed_t));
+    fx_tensor_init(&out, g_pool_out, 1, 1, 1, 2, FX_LAYOUT_NCHW);
+    fx_pool2d(&in, &q, NULL, 0, &out);
+    TEST_ASSERT(out.data[0] == 1 && out.data[1] == -1, "Nearest: 2/3 → 1, −2/3 → −1");
+
+    /* Extreme values: the 64-bit sum cannot overflow */
+    fx_tensor_init(&in, g_pool_in, 1, 1, 4, 4, FX_LAYOUT_NCHW);
+    for (int i = 0; i < 16; i++) {
+        in.data[i] = FIXED_MAX;
+    }
+    const fx_pool2d_params_t all = { FX_POOL2D_AVG, 4, 4, 1, 1, 0, 0, false };
+    fx_tensor_init(&out, g_pool_out, 1, 1, 1, 1, FX_LAYOUT_NCHW);
+    fx_pool2d(&in, &all, NULL, 0, &out);
+    TEST_ASSERT(out.data[0] == FIXED_MAX, "Average of FIXED_MAX is FIXED_MAX");
+
+    /* Padded divisor: a corner window of 3×3 / pad 1 sees 4 samples */
+    const fx_pool2d_params_t pad = { FX_POOL2D_AVG, 3, 3, 3, 3, 1, 1, true };
+    const fx_pool2d_params_t valid = { FX_POOL2D_AVG, 3, 3, 3, 3, 1, 1, false };
+    for (int i = 0; i < 16; i++) {
+        in.data[i] = fixed_from_int(9);
+    }
+    fx_tensor_init(&out, g_pool_out, 1, 1, 2, 2, FX_LAYOUT_NCHW);
+    fx_pool2d(&in, &pad, NULL, 0, &out);
+    TEST_ASSERT(out.data[0] == fixed_from_int(4), "count_pad: 4 × 9 / 9 = 4");
+    fx_pool2d(&in, &valid, NULL, 0, &out);
+    TEST_ASSERT(out.data[0] == fixed_from_int(9), "Valid count: 4 × 9 / 4 = 9");
+}
+
+/**
+ * @test Global average pooling in both layouts
+ * @traceability SRS-008.12
+ */
+static void test_global_avgpool(void) {
+    printf("\nTest: Global average pooling\n");
+    printf("────────────────────────────\n");
+
+    /* 70 channels: one full NHWC block of 64 and a partial block */
+    fx_tensor_t nchw, nhwc, avg;
+    fx_tensor_init(&nchw, g_pool_in, 2, 70, 5, 7, FX_LAYOUT_NCHW);
+    fx_tensor_init(&nhwc, g_pool_ref, 2, 70, 5, 7, FX_LAYOUT_NHWC);
+    for (int b = 0; b < 2; b++) {
+        for (int c = 0; c < 70; c++) {
+            for (int y = 0; y < 5; y++) {
+                for (int x = 0; x < 7; x++) {
+                    const fixed_t v = lcg_fixed(26);
+                    nchw.data[t_index(&nchw, b, c, y, x)] = v;
+                    nhwc.data[t_index(&nhwc, b, c, y, x)] = v;
+                }
+            }
+        }
+    }
+
+    /* Oracle: an average pool whose window is the whole plane */
+    const fx_pool2d_params_t whole = { FX_POOL2D_AVG, 5, 7, 1, 1, 0, 0, false };
+    fx_tensor_init(&avg, g_pool_ws, 2, 70, 1, 1, FX_LAYOUT_NCHW);
+    naive_pool(&nchw, &whole, &avg);
+
+    fx_matrix_t m;
+    fx_matrix_init(&m, g_pool_out, 2, 70);
+    TEST_ASSERT(fx_global_avgpool(&nchw, &m) == FX_POOL2D_OK &&
+                memcmp(m.data, avg.data, 140 * sizeof(fixed_t)) == 0, "NCHW equals whole-plane average");
+    fx_matrix_init(&m, g_pool_out, 2, 70);
+    TEST_ASSERT(fx_global_avgpool(&nhwc, &m) == FX_POOL2D_OK &&
+                memcmp(m.data, avg.data, 140 * sizeof(fixed_t)) == 0, "NHWC equals whole-plane average");
+
+    fx_matrix_init(&m, g_pool_out, 2, 69);
+    TEST_ASSERT(fx_global_avgpool(&nchw, &m) == FX_POOL2D_DIM_MISMATCH, "Wrong N × C rejected");
+}
+
+/**
+ * @test Invalid geometry and buffers rejected, output untouched
+ * @traceability SRS-008.3, SRS-008.9
+ */
+static void test_pool2d_invalid(void) {
+    printf("\nTest: Invalid pooling arguments\n");
+    printf("───────────────────────────────\n");
+
+    fx_pool2d_params_t p = FX_POOL2D_PARAMS_MAX_3X3_S2;
+    fx_tensor_t in, out;
+    fx_tensor_init(&in, g_pool_in, 1, 2, 9, 9, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out, g_pool_out, 1, 2, 4, 4, FX_LAYOUT_NCHW);
+    out.data[0] = 12345;
+
+    TEST_ASSERT(fx_pool2d(&in, &p, g_pool_ws, 35, &out) == FX_POOL2D_WORKSPACE_TOO_SMALL,
+                "Workspace one short rejected");
+    TEST_ASSERT(fx_pool2d(&in, &p, NULL, 0, &out) == FX_POOL2D_WORKSPACE_TOO_SMALL,
+                "Missing workspace rejected");
+    p.pad_h = 3;
+    TEST_ASSERT(fx_pool2d(&in, &p, g_pool_ws, POOL_MAX_ELEMS, &out) == FX_POOL2D_INVALID_PARAM,
+                "Padding ≥ kernel rejected");
+    p.pad_h = 0;
+    p.stride_w = 0;
+    TEST_ASSERT(fx_pool2d(&in, &p, g_pool_ws, POOL_MAX_ELEMS, &out) == FX_POOL2D_INVALID_PARAM,
+                "Zero stride rejected");
+    p.stride_w = 2;
+    out.w = 5;
+    TEST_ASSERT(fx_pool2d(&in, &p, g_pool_ws, POOL_MAX_ELEMS, &out) == FX_POOL2D_DIM_MISMATCH,
+                "Output extent inconsistent with params rejected");
+    TEST_ASSERT(out.data[0] == 12345, "Output untouched on error");
+    TEST_ASSERT(fx_pool2d_ref(NULL, &p, &out) == FX_POOL2D_INVALID_PARAM, "NULL input rejected");
+}
+
 int main(void) {
     printf("\n");
     printf("═══════════════════════════════════════════════\n");
-    printf("  SRS-008 Max Pooling Verification Suite\n");
+    printf("  SRS-008 Pooling Verification Suite\n");
     printf("═══════════════════════════════════════════════\n");
     printf("\n");
 
@@ -339,6 +687,13 @@ int main(void) {
     test_larger_dimensions();
     test_deterministic_behavior();
     test_range_preservation();
+    test_pool2d_out_dim();
+    test_maxpool_3x3_s2();
+    test_pool2d_matches_oracle();
+    test_pool2d_2x2_path();
+    test_avgpool_rounding();
+    test_global_avgpool();
+    test_pool2d_invalid();
 
     /* Print summary */
     printf("\n");
@@ -356,6 +711,10 @@ int main(void) {
     printf("  • SRS-008.3: Boundary conditions\n");
     printf("  • SRS-008.4: Bit-perfect determinism\n");
     printf("  • SRS-008.5: Range preservation\n");
+    printf("  • SRS-008.8: Average pooling with exact rounding\n");
+    printf("  • SRS-008.9 / .10: k×k windows, stride and padding\n");
+    printf("  • SRS-008.11: Separable max passes\n");
+    printf("  • SRS-008.12: Global average pooling\n");
     printf("\n");
 
     return tests_failed > 0 ? 1 : 0;
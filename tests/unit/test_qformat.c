@@ -0,0 +1,316 @@
+/**
+ * @file test_qformat.c
+ * @project Certifiable Inference Engine
+ * @brief Verification of the configurable Qm.n formats.
+ *
+ * @details Checks the shared rounding step, format conversion and buffer
+ * rescaling, and the generated arithmetic and kernels of the library
+ * formats against exact int64 references. A format is also instantiated
+ * here from the public template, as user code would.
+ *
+ * @traceability SRS-012
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "qformat.h"
+#include "matrix.h"
+#include "fixed_point.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* A user-defined format: Q12.20 */
+FX_QFORMAT_DECLARE(tq12_20, int32_t, 20, INT32_MIN, INT32_MAX);
+FX_QFORMAT_DEFINE(tq12_20, int32_t, 20, INT32_MIN, INT32_MAX);
+
+#define MAX_ELEMS 4096
+
+static int32_t g_a[MAX_ELEMS], g_b[MAX_ELEMS], g_c[MAX_ELEMS], g_d[MAX_ELEMS];
+static int16_t g_w16[MAX_ELEMS];
+
+/* Deterministic LCG so inputs are identical on every platform */
+static uint32_t g_lcg_state = 0x9E3779B9u;
+static uint32_t lcg_next(void) {
+    g_lcg_state = g_lcg_state * 1664525u + 1013904223u;
+    return g_lcg_state;
+}
+
+/* Signed value of at most @p bits magnitude */
+static int32_t lcg_bits(unsigned bits) {
+    return (int32_t)((int64_t)(lcg_next() >> (32u - bits)) - ((int64_t)1 << (bits - 1u)));
+}
+
+/* Reference: floor(v / 2^s + 1/2) for s > 0 by exact division */
+static int64_t ref_round(int64_t v, int s) {
+    const int64_t d = (int64_t)1 << s;
+    int64_t q = v / d;
+    int64_t r = v % d;
+    if (r < 0) {
+        q -= 1;
+        r += d;
+    }
+    return q + ((2 * r >= d) ? 1 : 0);
+}
+
+static fx_qformat_t fmt(uint8_t bits, uint8_t frac) {
+    fx_qformat_t f;
+    f.bits = bits;
+    f.frac = frac;
+    return f;
+}
+
+/**
+ * @test Rounding step
+ * @traceability SRS-012.2
+ */
+static void test_round(void) {
+    printf("\nTest: Rounding and saturation\n");
+    printf("─────────────────────────────\n");
+
+    TEST_ASSERT(fx_qround(3, 1) == 2 && fx_qround(-3, 1) == -1 &&
+                fx_qround(5, 1) == 3 && fx_qround(-5, 1) == -2,
+                "Ties round half up");
+
+    int exact = 1;
+    for (int t = 0; t < 10000; t++) {
+        const int64_t v = (int64_t)(((uint64_t)lcg_bits(32) << 20) ^ (lcg_next() & 0xFFFFFu));
+        const int s = 1 + (int)(lcg_next() % 40u);
+        if (fx_qround(v, s) != ref_round(v, s)) {
+            exact = 0;
+        }
+    }
+    TEST_ASSERT(exact, "Matches exact division for random values and shifts");
+
+    TEST_ASSERT(fx_qround(INT64_MAX, 1) == ((int64_t)1 << 62) &&
+                fx_qround(INT64_MIN, 62) == -2, "No overflow at the int64 limits");
+    TEST_ASSERT(fx_qround(-7, -4) == -112 && fx_qround((int64_t)1 << 40, -30) == INT64_MAX &&
+                fx_qround(-((int64_t)1 << 40), -30) == INT64_MIN, "Left shifts saturate");
+}
+
+/**
+ * @test Format conversion and buffer rescaling
+ * @traceability SRS-012.1, SRS-012.2
+ */
+static void test_rescale(void) {
+    printf("\nTest: Format conversion\n");
+    printf("───────────────────────\n");
+
+    TEST_ASSERT(fx_qformat_valid(fmt(8, 7)) && fx_qformat_valid(fmt(32, 0)) &&
+                !fx_qformat_valid(fmt(24, 8)) && !fx_qformat_valid(fmt(16, 16)),
+                "Format validation");
+
+    /* Q16.16 1.75 → Q4.4 (int8) = 28; −0.03125 → −0.5 LSB rounds up to 0 */
+    TEST_ASSERT(fx_qformat_convert(FIXED_ONE + 3 * FIXED_ONE / 4, fmt(32, 16), fmt(8, 4)) == 28 &&
+                fx_qformat_convert(-FIXED_ONE / 32, fmt(32, 16), fmt(8, 4)) == 0 &&
+                fx_qformat_convert(-3 * FIXED_ONE / 32, fmt(32, 16), fmt(8, 4)) == -1,
+                "Narrowing rounds half up");
+    TEST_ASSERT(fx_qformat_convert(fixed_from_int(9), fmt(32, 16), fmt(8, 4)) == INT8_MAX &&
+                fx_qformat_convert(fixed_from_int(-200), fmt(32, 16), fmt(16, 8)) == INT16_MIN,
+                "Out-of-range values saturate");
+    TEST_ASSERT(fx_qformat_convert(-100, fmt(16, 8), fmt(32, 24)) == -100 * 65536 &&
+                fx_qformat_convert(100, fmt(8, 0), fmt(32, 25)) == INT32_MAX,
+                "Widening is exact, or saturates");
+
+    static int8_t q8[64], back8[64];
+    static int16_t q16[64];
+    for (int i = 0; i < 64; i++) {
+        q8[i] = (int8_t)lcg_bits(8);
+    }
+    /* Q4.4 → Q8.8 (exact) → Q4.4 is the identity */
+    TEST_ASSERT(fx_qformat_rescale(q8, fmt(8, 4), q16, fmt(16, 8), 64) &&
+                fx_qformat_rescale(q16, fmt(16, 8), back8, fmt(8, 4), 64) &&
+                memcmp(q8, back8, sizeof(q8)) == 0 && q16[5] == q8[5] * 16,
+                "Buffer round trip through a wider format");
+
+    for (int i = 0; i < 64; i++) {
+        g_a[i] = lcg_bits(24);
+        g_c[i] = g_a[i];
+    }
+    int in_place = fx_qformat_rescale(g_c, fmt(32, 16), g_c, fmt(32, 10), 64);
+    for (int i = 0; i < 64; i++) {
+        if (g_c[i] != (int32_t)ref_round(g_a[i], 6)) {
+            in_place = 0;
+        }
+    }
+    TEST_ASSERT(in_place, "In-place rescale between 32-bit formats");
+    TEST_ASSERT(!fx_qformat_rescale(q8, fmt(12, 4), q16, fmt(16, 8), 64) &&
+                !fx_qformat_rescale(NULL, fmt(8, 4), q16, fmt(16, 8), 64) &&
+                fx_qformat_convert(5, fmt(8, 9), fmt(16, 8)) == 0,
+                "Invalid formats rejected");
+}
+
+/**
+ * @test Generated arithmetic of each library format
+ * @traceability SRS-012.1
+ */
+static void test_arithmetic(void) {
+    printf("\nTest: Generated arithmetic\n");
+    printf("──────────────────────────\n");
+
+    int same = 1;
+    for (int t = 0; t < 10000; t++) {
+        const fixed_t a = lcg_bits(24), b = lcg_bits(24);
+        if (fx_q16_16_mul(a, b) != fixed_mul(a, b)) {
+            same = 0;
+        }
+    }
+    TEST_ASSERT(same, "fx_q16_16_mul equals fixed_mul in range");
+    TEST_ASSERT(fx_q16_16_mul(fixed_from_int(300), fixed_from_int(300)) == INT32_MAX &&
+                fx_q16_16_mul(fixed_from_int(-300), fixed_from_int(300)) == INT32_MIN,
+                "Overflow saturates instead of wrapping");
+
+    /* Q24.8 holds 2000 × 2000 = 4e6, which overflows Q16.16 */
+    TEST_ASSERT(fx_q24_8_to_int(fx_q24_8_mul(fx_q24_8_from_int(2000), fx_q24_8_from_int(2000))) == 4000000,
+                "Q24.8 range");
+
+    /* 1/3 · 1/3 in Q8.24 is ~256× closer to 1/9 than in Q16.16 */
+    const fx_q8_24_t third = (fx_q8_24_t)((1 << 24) / 3);
+    const int64_t err24 = (int64_t)fx_q8_24_mul(third, third) - ((int64_t)1 << 24) / 9;
+    TEST_ASSERT(err24 >= -1 && err24 <= 1 &&
+                fx_q8_24_to_q16(fx_q8_24_from_q16(FIXED_ONE / 3)) == FIXED_ONE / 3,
+                "Q8.24 precision, exact Q16.16 round trip");
+
+    TEST_ASSERT(fx_q8_8_from_int(127) == 32512 && fx_q8_8_from_int(128) == INT16_MAX &&
+                fx_q8_8_add(fx_q8_8_from_int(100), fx_q8_8_from_int(100)) == INT16_MAX &&
+                fx_q8_8_sub(fx_q8_8_from_int(-100), fx_q8_8_from_int(100)) == INT16_MIN,
+                "Q8.8 saturates to 16 bits");
+    TEST_ASSERT(fx_q1_15_mul(INT16_MIN, INT16_MIN) == INT16_MAX &&
+                fx_q1_15_mul(16384, 16384) == 8192 &&
+                fx_q1_15_from_q16(-FIXED_ONE) == INT16_MIN && fx_q1_15_from_q16(FIXED_ONE) == INT16_MAX,
+                "Q1.15 edge cases");
+    TEST_ASSERT(fx_q8_8_qformat().bits == 16 && fx_q8_8_qformat().frac == 8 &&
+                fx_q8_24_qformat().bits == 32 && fx_q8_24_qformat().frac == 24,
+                "Format descriptors");
+    TEST_ASSERT(fx_q8_8_to_int(fx_q8_8_from_int(-3) + 1) == -3 && fx_q24_8_to_int(-1) == -1,
+                "to_int floors");
+    TEST_ASSERT(tq12_20_to_q16(tq12_20_mul(tq12_20_from_int(3), tq12_20_from_q16(FIXED_ONE / 2))) ==
+                3 * FIXED_ONE / 2 && tq12_20_qformat().frac == 20,
+                "User-instantiated Q12.20 format");
+}
+
+/**
+ * @test Generated kernels against int64 references
+ * @traceability SRS-012.3
+ */
+static void test_kernels(void) {
+    printf("\nTest: Generated kernels\n");
+    printf("───────────────────────\n");
+
+    static const uint16_t shapes[][3] = {
+        {1, 1, 1}, {3, 17, 5}, {7, 33, 64}, {4, 20, 130}
+    };
+    int q16_same = 1, q8_8_ok = 1, mixed_ok = 1;
+
+    for (size_t t = 0; t < sizeof(shapes) / sizeof(shapes[0]); t++) {
+        const uint16_t m = shapes[t][0], k = shapes[t][1], n = shapes[t][2];
+        fx_matrix_t A, B, C;
+
+        /* Q16.16 kernel vs fx_matrix_mul */
+        fx_matrix_init(&A, g_a, m, k);
+        fx_matrix_init(&B, g_b, k, n);
+        fx_matrix_init(&C, g_c, m, n);
+        for (size_t i = 0; i < (size_t)m * k; i++) {
+            g_a[i] = lcg_bits(22);
+        }
+        for (size_t i = 0; i < (size_t)k * n; i++) {
+            g_b[i] = lcg_bits(20);
+            g_w16[i] = (int16_t)lcg_bits(16);
+        }
+        fx_matrix_mul(&A, &B, &C);
+        fx_q16_16_matrix_mul(g_a, g_b, g_d, m, k, n);
+        if (memcmp(g_c, g_d, (size_t)m * n * sizeof(int32_t)) != 0) {
+            q16_same = 0;
+        }
+
+        /* Mixed Q16.16 × Q1.15 → Q16.16 vs exact reference */
+        fx_matrix_mul_q16_16_q1_15(g_a, g_w16, g_d, m, k, n);
+        for (size_t i = 0; i < m; i++) {
+            for (size_t j = 0; j < n; j++) {
+                int64_t acc = 0;
+                for (size_t p = 0; p < k; p++) {
+                    acc += (int64_t)g_a[i * k + p] * g_w16[p * n + j];
+                }
+                if (g_d[i * n + j] != (int32_t)fx_qsat(ref_round(acc, 15), INT32_MIN, INT32_MAX)) {
+                    mixed_ok = 0;
+                }
+            }
+        }
+
+        /* Q8.8 kernel vs reference, with saturation */
+        static fx_q8_8_t a8[MAX_ELEMS], b8[MAX_ELEMS], c8[MAX_ELEMS];
+        for (size_t i = 0; i < (size_t)m * k; i++) {
+            a8[i] = (fx_q8_8_t)lcg_bits(14);
+        }
+        for (size_t i = 0; i < (size_t)k * n; i++) {
+            b8[i] = (fx_q8_8_t)lcg_bits(14);
+        }
+        fx_q8_8_matrix_mul(a8, b8, c8, m, k, n);
+        for (size_t i = 0; i < m; i++) {
+            for (size_t j = 0; j < n; j++) {
+                int64_t acc = 0;
+                for (size_t p = 0; p < k; p++) {
+                    acc += (int64_t)a8[i * k + p] * b8[p * n + j];
+                }
+                if (c8[i * n + j] != (fx_q8_8_t)fx_qsat(ref_round(acc, 8), INT16_MIN, INT16_MAX)) {
+                    q8_8_ok = 0;
+                }
+            }
+        }
+    }
+
+    TEST_ASSERT(q16_same, "fx_q16_16_matrix_mul bit-identical to fx_matrix_mul");
+    TEST_ASSERT(mixed_ok, "Q16.16 × Q1.15 kernel exact, one rounding");
+    TEST_ASSERT(q8_8_ok, "Q8.8 kernel exact, saturating");
+
+    for (size_t i = 0; i < 100; i++) {
+        g_a[i] = lcg_bits(20);
+        g_b[i] = lcg_bits(20);
+    }
+    TEST_ASSERT(fx_q16_16_dot(g_a, g_b, 100) == fx_vector_dot(g_a, g_b, 100) &&
+                fx_q16_16_dot(NULL, g_b, 100) == 0, "fx_q16_16_dot equals fx_vector_dot");
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("  SRS-012 Q-Format Verification Suite\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    test_round();
+    test_rescale();
+    test_arithmetic();
+    test_kernels();
+
+    /* Print summary */
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-012 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-012 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
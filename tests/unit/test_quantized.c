@@ -0,0 +1,620 @@
+/**
+ * @file test_quantized.c
+ * @project Certifiable Inference Engine
+ * @brief Verification of the int8 / int16 quantized layers.
+ *
+ * @details fx_requantize() is checked against the exact int64 formula
+ * where that cannot overflow and against power-of-two scales beyond it.
+ * The layers are compared bit for bit with naive int64 references over
+ * shapes that cross every blocking boundary (batch row blocks, output
+ * blocks, K chunks, padding, both layouts of activations and filters), and the int8 path
+ * is shown to reproduce the Q16.16 path exactly when all scales are
+ * powers of two.
+ *
+ * @traceability SRS-011
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "quantized.h"
+#include "matrix.h"
+#include "fixed_point.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+#define MAX_ELEMS 16384
+#define MAX_CH    256
+
+static int8_t g_a8[MAX_ELEMS], g_b8[MAX_ELEMS], g_c8[MAX_ELEMS], g_d8[MAX_ELEMS];
+static int16_t g_a16[MAX_ELEMS], g_b16[MAX_ELEMS], g_c16[MAX_ELEMS];
+static int32_t g_ai[MAX_ELEMS], g_bi[MAX_ELEMS], g_ref[MAX_ELEMS];
+static fx_requant_t g_scale[MAX_CH];
+static int32_t g_bias[MAX_CH];
+
+/* Deterministic LCG so inputs are identical on every platform */
+static uint32_t g_lcg_state = 0x2545F491u;
+static uint32_t lcg_next(void) {
+    g_lcg_state = g_lcg_state * 1664525u + 1013904223u;
+    return g_lcg_state;
+}
+
+/* Uniform in [lo, hi] */
+static int32_t lcg_range(int32_t lo, int32_t hi) {
+    return lo + (int32_t)(lcg_next() % (uint32_t)(hi - lo + 1));
+}
+
+static int32_t clamp(int64_t v, int32_t lo, int32_t hi) {
+    return (v < lo) ? lo : (v > hi) ? hi : (int32_t)v;
+}
+
+/* Per-channel multipliers around 2^-shift */
+static void fill_scales(size_t n, int32_t shift) {
+    for (size_t i = 0; i < n; i++) {
+        g_scale[i].multiplier = (int32_t)(0x40000000u + (lcg_next() >> 2));
+        g_scale[i].shift = shift;
+        g_bias[i] = lcg_range(-3000, 3000);
+    }
+}
+
+/* Reference epilogue on an exact int64 accumulator */
+static int32_t ref_finish(int64_t acc, const fx_qparams_t* qp, size_t o, int32_t qmin, int32_t qmax) {
+    if (qp->bias) {
+        acc += qp->bias[o];
+    }
+    int32_t v = fx_requantize(acc, qp->scale[qp->per_channel ? o : 0]);
+    v = fx_activate(v, qp->act, qp->alpha);
+    return clamp((int64_t)v + qp->out_zero, qmin, qmax);
+}
+
+static void ref_matmul(size_t M, size_t K, size_t N, const fx_qparams_t* qp,
+                       int32_t qmin, int32_t qmax) {
+    for (size_t i = 0; i < M; i++) {
+        for (size_t j = 0; j < N; j++) {
+            int64_t acc = 0;
+            for (size_t k = 0; k < K; k++) {
+                acc += (int64_t)(g_ai[i * K + k] - qp->in_zero) * g_bi[k * N + j];
+            }
+            g_ref[i * N + j] = ref_finish(acc, qp, j, qmin, qmax);
+        }
+    }
+}
+
+/* Element offset of (n, c, y, x) */
+static size_t offset_of(size_t n, size_t c, size_t y, size_t x,
+                        size_t C, size_t H, size_t W, fx_layout_t layout) {
+    return (layout == FX_LAYOUT_NHWC) ? ((n * H + y) * W + x) * C + c
+                                      : ((n * C + c) * H + y) * W + x;
+}
+
+/* Offset in @p layout of the element at NCHW linear index @p i */
+static size_t relayout(size_t i, size_t C, size_t H, size_t W, fx_layout_t layout) {
+    const size_t x = i % W, y = (i / W) % H, c = (i / (W * H)) % C, n = i / (W * H * C);
+    return offset_of(n, c, y, x, C, H, W, layout);
+}
+
+typedef struct {
+    uint16_t n, cin, h, w, cout, kh, kw, stride, pad, dil;
+} conv_case_t;
+
+static fx_conv_params_t case_params(const conv_case_t* cc) {
+    fx_conv_params_t p;
+    memset(&p, 0, sizeof(p));
+    p.stride_h = p.stride_w = cc->stride;
+    p.pad_h = p.pad_w = cc->pad;
+    p.dilation_h = p.dilation_w = cc->dil;
+    return p;
+}
+
+/* NCHW reference on g_ai (input) and g_bi (OIHW filters), NCHW output */
+static void ref_conv(const conv_case_t* cc, uint16_t oh, uint16_t ow, const fx_qparams_t* qp,
+                     int32_t qmin, int32_t qmax) {
+    for (size_t b = 0; b < cc->n; b++) {
+        for (size_t o = 0; o < cc->cout; o++) {
+            for (size_t y = 0; y < oh; y++) {
+                for (size_t x = 0; x < ow; x++) {
+                    int64_t acc = 0;
+                    for (size_t c = 0; c < cc->cin; c++) {
+                        for (size_t i = 0; i < cc->kh; i++) {
+                            for (size_t j = 0; j < cc->kw; j++) {
+                                const int32_t iy = (int32_t)(y * cc->stride + i * cc->dil) - cc->pad;
+                                const int32_t ix = (int32_t)(x * cc->stride + j * cc->dil) - cc->pad;
+                                if (iy < 0 || iy >= cc->h || ix < 0 || ix >= cc->w) {
+                                    continue;
+                                }
+                                acc += (int64_t)(g_ai[offset_of(b, c, (size_t)iy, (size_t)ix, cc->cin, cc->h, cc->w, FX_LAYOUT_NCHW)]
+                                                 - qp->in_zero) *
+                                       g_bi[offset_of(o, c, i, j, cc->cin, cc->kh, cc->kw, FX_LAYOUT_NCHW)];
+                            }
+                        }
+                    }
+                    g_ref[offset_of(b, o, y, x, cc->cout, oh, ow, FX_LAYOUT_NCHW)] =
+                        ref_finish(acc, qp, o, qmin, qmax);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @test Requantization against the exact formula
+ * @traceability SRS-011.3
+ */
+static void test_requantize(void) {
+    printf("\nTest: Requantization\n");
+    printf("────────────────────\n");
+
+    int exact = 1;
+    for (int t = 0; t < 20000; t++) {
+        const int64_t acc = (int64_t)(int32_t)lcg_next();
+        fx_requant_t rq;
+        rq.multiplier = (int32_t)(0x40000000u + (lcg_next() >> 2));
+        rq.shift = lcg_range(-31, 31);
+
+        /* |acc · M| < 2^62: the direct form is exact */
+        const unsigned s = (unsigned)(31 + rq.shift);
+        int64_t prod = acc * rq.multiplier;
+        if (s > 0) {
+            prod += (int64_t)1 << (s - 1);
+        }
+        if (fx_requantize(acc, rq) != clamp(prod >> s, INT32_MIN, INT32_MAX)) {
+            exact = 0;
+        }
+    }
+    TEST_ASSERT(exact, "Matches round(acc · M / 2^s) for 20000 random cases");
+
+    /* M = 2^30, shift = 9: acc / 2^10 for 64-bit accumulators */
+    const fx_requant_t div1024 = { 0x40000000, 9 };
+    int wide = 1;
+    for (int t = 0; t < 1000; t++) {
+        const int64_t acc = (int64_t)(((uint64_t)lcg_next() << 8) ^ lcg_next()) - ((int64_t)1 << 39);
+        if (fx_requantize(acc, div1024) != (int32_t)((acc + 512) >> 10)) {
+            wide = 0;
+        }
+    }
+    TEST_ASSERT(wide, "Exact for 40-bit accumulators");
+
+    const fx_requant_t half = { 0x40000000, 0 };
+    TEST_ASSERT(fx_requantize(3, half) == 2 && fx_requantize(-3, half) == -1 &&
+                fx_requantize(5, half) == 3 && fx_requantize(-5, half) == -2,
+                "Ties round half up");
+
+    const fx_requant_t unity = { 0x40000000, -1 };
+    const fx_requant_t big = { 0x7FFFFFFF, -31 };
+    TEST_ASSERT(fx_requantize(123456789, unity) == 123456789 &&
+                fx_requantize(-7, unity) == -7, "Unit scale is the identity");
+    TEST_ASSERT(fx_requantize(INT64_MAX, big) == INT32_MAX &&
+                fx_requantize(INT64_MIN, big) == INT32_MIN &&
+                fx_requantize((int64_t)1 << 40, unity) == INT32_MAX &&
+                fx_requantize(INT64_MIN, div1024) == INT32_MIN, "Saturates to int32");
+
+    const fx_requant_t zero = { 0, 5 };
+    const fx_requant_t bad_shift = { 0x40000000, 32 };
+    const fx_requant_t bad_mult = { -1, 0 };
+    TEST_ASSERT(fx_requantize(1000, zero) == 0 && fx_requantize(1000, bad_shift) == 0 &&
+                fx_requantize(1000, bad_mult) == 0, "Zero and invalid scales give 0");
+}
+
+/**
+ * @test Q16.16 ⇄ int8/int16 conversion
+ * @traceability SRS-011.4
+ */
+static void test_quantize_round_trip(void) {
+    printf("\nTest: Quantize / dequantize\n");
+    printf("───────────────────────────\n");
+
+    /* s = 2^-6: to int8 multiply by 2^-10, back by 2^10 */
+    const fx_requant_t to_q = { 0x40000000, 9 };
+    const fx_requant_t from_q = { 0x40000000, -11 };
+    fixed_t x[256], back[256];
+    int8_t q[256];
+    int16_t q16[256];
+
+    for (int i = 0; i < 256; i++) {
+        x[i] = lcg_range(-FIXED_ONE, FIXED_ONE);
+    }
+    fx_q8_quantize(x, 256, to_q, 3, q);
+    fx_q8_dequantize(q, 256, from_q, 3, back);
+
+    int close = 1;
+    for (int i = 0; i < 256; i++) {
+        if (back[i] - x[i] > 512 || x[i] - back[i] > 512) {
+            close = 0;
+        }
+    }
+    TEST_ASSERT(close, "int8 round trip within half a step");
+
+    fx_q16_quantize(x, 256, to_q, -100, q16);
+    int same = 1;
+    for (int i = 0; i < 256; i++) {
+        if (q16[i] != q[i] - 3 - 100) {
+            same = 0;
+        }
+    }
+    TEST_ASSERT(same, "int16 quantization agrees with int8 in range");
+
+    const fixed_t extremes[2] = { fixed_from_int(10), fixed_from_int(-10) };
+    fx_q8_quantize(extremes, 2, to_q, 0, q);
+    TEST_ASSERT(q[0] == INT8_MAX && q[1] == INT8_MIN, "Out-of-range values saturate");
+}
+
+/**
+ * @test Int8 and int16 matrix multiply against the reference
+ * @traceability SRS-011.1, SRS-011.2
+ */
+static void test_matrix_mul(void) {
+    printf("\nTest: Quantized matrix multiply\n");
+    printf("───────────────────────────────\n");
+
+    static const uint16_t shapes[][3] = {
+        {1, 1, 1}, {3, 17, 5}, {7, 33, 64}, {4, 100, 130}, {2, 1500, 10}, {5, 3000, 5},
+        {19, 70, 90}, {64, 40, 65}, {9, 1300, 12}
+    };
+    int identical8 = 1, identical16 = 1;
+
+    for (size_t t = 0; t < sizeof(shapes) / sizeof(shapes[0]); t++) {
+        const uint16_t m = shapes[t][0], k = shapes[t][1], n = shapes[t][2];
+        fx_qparams_t qp;
+
+        fill_scales(n, k > 1000 ? 12 : 8);
+        memset(&qp, 0, sizeof(qp));
+        qp.scale = g_scale;
+        qp.per_channel = true;
+        qp.bias = (t % 2) ? g_bias : NULL;
+        qp.in_zero = (int32_t)t * 11 - 20;
+        qp.out_zero = 5 - (int32_t)t;
+        qp.act = (fx_activation_t)(t % 3);
+        qp.alpha = FIXED_ONE / 8;
+
+        for (size_t i = 0; i < (size_t)m * k; i++) {
+            g_a8[i] = (int8_t)lcg_range(-128, 127);
+            g_ai[i] = g_a8[i];
+        }
+        for (size_t i = 0; i < (size_t)k * n; i++) {
+            g_b8[i] = (int8_t)lcg_range(-127, 127);
+            g_bi[i] = g_b8[i];
+        }
+
+        fx_q8_matrix_t A = { g_a8, m, k }, B = { g_b8, k, n }, C = { g_c8, m, n };
+        fx_q8_matrix_mul(&A, &B, &qp, &C);
+        ref_matmul(m, k, n, &qp, INT8_MIN, INT8_MAX);
+        for (size_t i = 0; i < (size_t)m * n; i++) {
+            if (g_c8[i] != g_ref[i]) {
+                identical8 = 0;
+            }
+        }
+
+        for (size_t i = 0; i < (size_t)m * k; i++) {
+            g_a16[i] = (int16_t)lcg_range(-32768, 32767);
+            g_ai[i] = g_a16[i];
+        }
+        for (size_t i = 0; i < (size_t)k * n; i++) {
+            g_b16[i] = (int16_t)lcg_range(-32767, 32767);
+            g_bi[i] = g_b16[i];
+        }
+        fill_scales(n, k > 1000 ? 31 : 26);
+        qp.in_zero *= 100;
+        qp.out_zero *= 100;
+
+        fx_q16_matrix_t A16 = { g_a16, m, k }, B16 = { g_b16, k, n }, C16 = { g_c16, m, n };
+        fx_q16_matrix_mul(&A16, &B16, &qp, &C16);
+        ref_matmul(m, k, n, &qp, INT16_MIN, INT16_MAX);
+        for (size_t i = 0; i < (size_t)m * n; i++) {
+            if (g_c16[i] != g_ref[i]) {
+                identical16 = 0;
+            }
+        }
+    }
+
+    TEST_ASSERT(identical8, "int8 bit-identical to reference for all shapes");
+    TEST_ASSERT(identical16, "int16 bit-identical to reference for all shapes");
+
+    /* Per-tensor scale, invalid arguments leave C untouched */
+    fx_qparams_t qp;
+    memset(&qp, 0, sizeof(qp));
+    g_scale[0].multiplier = 0x40000000;
+    g_scale[0].shift = 3;
+    qp.scale = g_scale;
+    for (size_t i = 0; i < 12; i++) {
+        g_a8[i] = (int8_t)(i * 7);
+        g_ai[i] = g_a8[i];
+        g_b8[i] = (int8_t)(60 - (int)i * 9);
+        g_bi[i] = g_b8[i];
+    }
+    fx_q8_matrix_t A = { g_a8, 3, 4 }, B = { g_b8, 4, 3 }, C = { g_c8, 3, 3 };
+    fx_q8_matrix_mul(&A, &B, &qp, &C);
+    ref_matmul(3, 4, 3, &qp, INT8_MIN, INT8_MAX);
+    int same = 1;
+    for (size_t i = 0; i < 9; i++) {
+        if (g_c8[i] != g_ref[i]) {
+            same = 0;
+        }
+    }
+    TEST_ASSERT(same, "Per-tensor scale");
+
+    memset(g_c8, 0x55, 9);
+    qp.in_zero = 128;
+    fx_q8_matrix_mul(&A, &B, &qp, &C);
+    qp.in_zero = 0;
+    B.rows = 5;
+    fx_q8_matrix_mul(&A, &B, &qp, &C);
+    TEST_ASSERT(g_c8[0] == 0x55 && g_c8[8] == 0x55, "Invalid zero point or shape rejected");
+}
+
+/**
+ * @test A batch equals its samples run one row at a time
+ * @traceability SRS-011.5
+ */
+static void test_batch_rows(void) {
+    printf("\nTest: Batched rows share the weight pass\n");
+    printf("────────────────────────────────────────\n");
+
+    const uint16_t m = 21, k = 200, n = 70;
+    static int8_t row8[128];
+    static int16_t row16[128];
+    fx_qparams_t qp;
+    int same8 = 1, same16 = 1;
+
+    fill_scales(n, 8);
+    memset(&qp, 0, sizeof(qp));
+    qp.scale = g_scale;
+    qp.per_channel = true;
+    qp.bias = g_bias;
+    qp.in_zero = -3;
+    qp.out_zero = 2;
+    qp.act = FX_ACT_RELU;
+
+    for (size_t i = 0; i < (size_t)m * k; i++) {
+        g_a8[i] = (int8_t)lcg_range(-128, 127);
+        g_a16[i] = (int16_t)lcg_range(-32768, 32767);
+    }
+    for (size_t i = 0; i < (size_t)k * n; i++) {
+        g_b8[i] = (int8_t)lcg_range(-127, 127);
+        g_b16[i] = (int16_t)lcg_range(-32767, 32767);
+    }
+
+    fx_q8_matrix_t A = { g_a8, m, k }, B = { g_b8, k, n }, C = { g_c8, m, n };
+    fx_q8_matrix_mul(&A, &B, &qp, &C);
+    for (size_t r = 0; r < m; r++) {
+        fx_q8_matrix_t a1 = { g_a8 + r * k, 1, k }, c1 = { row8, 1, n };
+        fx_q8_matrix_mul(&a1, &B, &qp, &c1);
+        if (memcmp(row8, g_c8 + r * n, n) != 0) {
+            same8 = 0;
+        }
+    }
+
+    fill_scales(n, 26);
+    fx_q16_matrix_t A16 = { g_a16, m, k }, B16 = { g_b16, k, n }, C16 = { g_c16, m, n };
+    fx_q16_matrix_mul(&A16, &B16, &qp, &C16);
+    for (size_t r = 0; r < m; r++) {
+        fx_q16_matrix_t a1 = { g_a16 + r * k, 1, k }, c1 = { row16, 1, n };
+        fx_q16_matrix_mul(&a1, &B16, &qp, &c1);
+        if (memcmp(row16, g_c16 + r * n, n * sizeof(int16_t)) != 0) {
+            same16 = 0;
+        }
+    }
+
+    TEST_ASSERT(same8, "int8: 21-row batch equals 21 single-row calls");
+    TEST_ASSERT(same16, "int16: 21-row batch equals 21 single-row calls");
+}
+
+/**
+ * @test Int8 and int16 convolution in every layout combination
+ * @traceability SRS-011.1, SRS-011.2
+ */
+static void test_conv2d(void) {
+    printf("\nTest: Quantized convolution\n");
+    printf("───────────────────────────\n");
+
+    static const conv_case_t cases[] = {
+        {1, 3, 9, 11, 5, 3, 3, 1, 1, 1},
+        {2, 4, 12, 10, 70, 3, 3, 2, 1, 1},     /* two filter blocks */
+        {1, 8, 10, 10, 6, 3, 2, 1, 2, 2},      /* dilation, wide padding */
+        {1, 200, 5, 5, 3, 3, 3, 1, 1, 1},      /* OIHW rows split into chunks */
+        {1, 600, 4, 4, 3, 3, 3, 1, 1, 1}       /* OHWI rows split into chunks */
+    };
+    static const fx_layout_t layouts[2] = { FX_LAYOUT_NCHW, FX_LAYOUT_NHWC };
+    int identical8 = 1, identical16 = 1;
+
+    for (size_t t = 0; t < sizeof(cases) / sizeof(cases[0]); t++) {
+        const conv_case_t* cc = &cases[t];
+        const fx_conv_params_t p = case_params(cc);
+        const uint16_t oh = fx_conv2d_out_dim(cc->h, cc->kh, cc->stride, cc->pad, cc->dil);
+        const uint16_t ow = fx_conv2d_out_dim(cc->w, cc->kw, cc->stride, cc->pad, cc->dil);
+        const size_t in_len = (size_t)cc->n * cc->cin * cc->h * cc->w;
+        const size_t k_len = (size_t)cc->cout * cc->cin * cc->kh * cc->kw;
+        const size_t out_len = (size_t)cc->n * cc->cout * oh * ow;
+        fx_qparams_t qp;
+
+        for (int bits = 8; bits <= 16; bits += 8) {
+            const int32_t qmax = (bits == 8) ? INT8_MAX : INT16_MAX;
+            const int32_t qmin = -qmax - 1;
+
+            fill_scales(cc->cout, (bits == 8 ? 8 : 24) + (k_len > 5000 ? 3 : 0));
+            memset(&qp, 0, sizeof(qp));
+            qp.scale = g_scale;
+            qp.per_channel = true;
+            qp.bias = g_bias;
+            qp.in_zero = (bits == 8) ? -7 : 1234;
+            qp.out_zero = (bits == 8) ? 4 : -300;
+            qp.act = (fx_activation_t)(t % 3);
+            qp.alpha = FIXED_ONE / 4;
+
+            for (size_t i = 0; i < in_len; i++) {
+                g_ai[i] = lcg_range(qmin, qmax);
+            }
+            for (size_t i = 0; i < k_len; i++) {
+                g_bi[i] = lcg_range(-qmax, qmax);
+            }
+            ref_conv(cc, oh, ow, &qp, qmin, qmax);
+
+            for (int li = 0; li < 2; li++) {
+                for (int lk = 0; lk < 2; lk++) {
+                    const fx_layout_t lin = layouts[li], lker = layouts[lk];
+
+                    /* Scatter the NCHW data into the layouts under test */
+                    for (size_t i = 0; i < in_len; i++) {
+                        const size_t d = relayout(i, cc->cin, cc->h, cc->w, lin);
+                        g_a8[d] = (int8_t)g_ai[i];
+                        g_a16[d] = (int16_t)g_ai[i];
+                    }
+                    for (size_t i = 0; i < k_len; i++) {
+                        const size_t d = relayout(i, cc->cin, cc->kh, cc->kw, lker);
+                        g_b8[d] = (int8_t)g_bi[i];
+                        g_b16[d] = (int16_t)g_bi[i];
+                    }
+
+                    fx_conv_res_t res;
+                    if (bits == 8) {
+                        fx_q8_tensor_t in = { g_a8, cc->n, cc->cin, cc->h, cc->w, lin };
+                        fx_q8_tensor_t wt = { g_b8, cc->cout, cc->cin, cc->kh, cc->kw, lker };
+                        fx_q8_tensor_t out = { g_c8, cc->n, cc->cout, oh, ow, lin };
+                        res = fx_q8_conv2d(&in, &wt, &p, &qp, &out);
+                    } else {
+                        fx_q16_tensor_t in = { g_a16, cc->n, cc->cin, cc->h, cc->w, lin };
+                        fx_q16_tensor_t wt = { g_b16, cc->cout, cc->cin, cc->kh, cc->kw, lker };
+                        fx_q16_tensor_t out = { g_c16, cc->n, cc->cout, oh, ow, lin };
+                        res = fx_q16_conv2d(&in, &wt, &p, &qp, &out);
+                    }
+
+                    for (size_t i = 0; i < out_len; i++) {
+                        const size_t sidx = relayout(i, cc->cout, oh, ow, lin);
+                        const int32_t got = (bits == 8) ? g_c8[sidx] : g_c16[sidx];
+
+                        if (res != FX_CONV_OK || got != g_ref[i]) {
+                            if (bits == 8) {
+                                identical8 = 0;
+                            } else {
+                                identical16 = 0;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    TEST_ASSERT(identical8, "int8 bit-identical to reference, all layouts");
+    TEST_ASSERT(identical16, "int16 bit-identical to reference, all layouts");
+
+    /* Argument checks (never touch the buffers) */
+    fx_qparams_t qp;
+    memset(&qp, 0, sizeof(qp));
+    qp.scale = g_scale;
+    const conv_case_t one = {1, 1, 4, 4, 1, 3, 3, 1, 0, 1};
+    fx_conv_params_t p = case_params(&one);
+
+    fx_q8_tensor_t in = { g_a8, 1, 8192, 4, 4, FX_LAYOUT_NHWC };
+    fx_q8_tensor_t wt = { g_b8, 1, 8192, 3, 3, FX_LAYOUT_NHWC };
+    fx_q8_tensor_t out = { g_c8, 1, 1, 2, 2, FX_LAYOUT_NHWC };
+    TEST_ASSERT(fx_q8_conv2d(&in, &wt, &p, &qp, &out) == FX_CONV_UNSUPPORTED,
+                "Reduction beyond FX_Q8_MAX_K is unsupported");
+
+    in.c = wt.c = 2048;
+    wt.h = wt.w = 1;
+    out.h = out.w = 4;
+    TEST_ASSERT(fx_q8_conv2d(&in, &wt, &p, &qp, &out) == FX_CONV_UNSUPPORTED,
+                "OHWI channel row beyond FX_Q8_KC is unsupported");
+
+    in.c = wt.c = 1;
+    wt.h = wt.w = 3;
+    out.h = out.w = 2;
+    qp.in_zero = -129;
+    TEST_ASSERT(fx_q8_conv2d(&in, &wt, &p, &qp, &out) == FX_CONV_INVALID_PARAM,
+                "Out-of-range zero point rejected");
+    qp.in_zero = 0;
+    qp.scale = NULL;
+    TEST_ASSERT(fx_q8_conv2d(&in, &wt, &p, &qp, &out) == FX_CONV_INVALID_PARAM,
+                "Missing scale rejected");
+    qp.scale = g_scale;
+    out.w = 3;
+    TEST_ASSERT(fx_q8_conv2d(&in, &wt, &p, &qp, &out) == FX_CONV_DIM_MISMATCH,
+                "Output shape mismatch rejected");
+}
+
+/**
+ * @test Int8 path equals the Q16.16 path for power-of-two scales
+ * @traceability SRS-011.3
+ */
+static void test_matches_fixed_point(void) {
+    printf("\nTest: Agreement with Q16.16\n");
+    printf("───────────────────────────\n");
+
+    /* s_a = 2^-7, s_w = 2^-6, s_out = 2^-3: every Q16.16 value is exact */
+    enum { M = 6, K = 40, N = 9 };
+    static fixed_t fa[M * K], fb[K * N], fc[M * N];
+    const fx_requant_t acc_to_out = { 0x40000000, 9 };    /* 2^-10 */
+    const fx_requant_t fixed_to_out = { 0x40000000, 12 }; /* 1 / (2^-3 · 2^16) */
+    fx_matrix_t A, B, C;
+    fx_qparams_t qp;
+    int8_t from_fixed[M * N];
+
+    fx_matrix_init(&A, fa, M, K);
+    fx_matrix_init(&B, fb, K, N);
+    fx_matrix_init(&C, fc, M, N);
+
+    for (size_t i = 0; i < M * K; i++) {
+        g_a8[i] = (int8_t)lcg_range(-128, 127);
+        fa[i] = (fixed_t)g_a8[i] * (FIXED_ONE >> 7);
+    }
+    for (size_t i = 0; i < K * N; i++) {
+        g_b8[i] = (int8_t)lcg_range(-127, 127);
+        fb[i] = (fixed_t)g_b8[i] * (FIXED_ONE >> 6);
+    }
+
+    fx_matrix_mul(&A, &B, &C);
+    fx_q8_quantize(fc, M * N, fixed_to_out, 0, from_fixed);
+
+    memset(&qp, 0, sizeof(qp));
+    qp.scale = &acc_to_out;
+    fx_q8_matrix_t qa = { g_a8, M, K }, qb = { g_b8, K, N }, qc = { g_d8, M, N };
+    fx_q8_matrix_mul(&qa, &qb, &qp, &qc);
+
+    TEST_ASSERT(memcmp(from_fixed, g_d8, M * N) == 0, "int8 result equals quantized Q16.16 result");
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("  SRS-011 Quantized Inference Verification Suite\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    test_requantize();
+    test_quantize_round_trip();
+    test_matrix_mul();
+    test_batch_rows();
+    test_conv2d();
+    test_matches_fixed_point();
+
+    /* Print summary */
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-011 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-011 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
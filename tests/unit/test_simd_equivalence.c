@@ -0,0 +1,482 @@
+/**
+ * @file test_simd_equivalence.c
+ * @project Certifiable Inference Engine
+ * @brief Bit-for-bit equivalence of the accelerated kernels against the
+ *        scalar reference oracles.
+ *
+ * @details Runs every accelerated primitive (fx_vector_dot, fx_matrix_mul,
+ * fx_conv2d, fx_relu, fx_leaky_relu, fx_maxpool_2x2, fx_ew_apply,
+ * fx_input_convert) and its *_ref()
+ * counterpart on identical pseudo-random inputs (the int8 layers against
+ * the scalar backend), across sizes chosen to
+ * hit both the vector body and the scalar tail of each kernel, and
+ * compares the outputs with memcmp(). The whole suite is repeated with
+ * every backend that is compiled in and supported by the running CPU
+ * pinned via fx_dispatch_pin(), so one test run covers each code path
+ * the dispatcher could select on this machine.
+ *
+ * @traceability SRS-003.10, SRS-003.11, SRS-018.4
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "matrix.h"
+#include "convolution.h"
+#include "activations.h"
+#include "pooling.h"
+#include "quantized.h"
+#include "elementwise.h"
+#include "input.h"
+#include "fixed_point.h"
+#include "dispatch.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+#define MAX_ELEMS 4096
+
+static fixed_t g_a[MAX_ELEMS];
+static fixed_t g_b[MAX_ELEMS];
+static fixed_t g_out_ref[MAX_ELEMS];
+static fixed_t g_out_simd[MAX_ELEMS];
+
+/**
+ * @brief Deterministic LCG so inputs are identical on every platform.
+ */
+static uint32_t g_lcg_state = 0xC0FFEEu;
+static uint32_t lcg_next(void) {
+    g_lcg_state = g_lcg_state * 1664525u + 1013904223u;
+    return g_lcg_state;
+}
+
+/**
+ * @brief Fill a buffer with signed values of at most @p bits magnitude.
+ */
+static void fill_random(fixed_t* buf, size_t n, unsigned bits) {
+    for (size_t i = 0; i < n; i++) {
+        uint32_t r = lcg_next() >> (32u - bits);
+        buf[i] = (fixed_t)((int64_t)r - ((int64_t)1 << (bits - 1u)));
+    }
+}
+
+/**
+ * @test Dot product over lengths covering every tail size
+ * @traceability SRS-003.10
+ */
+static void test_vector_dot_equivalence(void) {
+    printf("\nTest: fx_vector_dot vs reference\n");
+    printf("─────────────────────────────────\n");
+
+    int identical = 1;
+    static const uint16_t lengths[] = {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 31, 33, 1000, 4096};
+
+    for (size_t t = 0; t < sizeof(lengths) / sizeof(lengths[0]); t++) {
+        fill_random(g_a, lengths[t], 24);
+        fill_random(g_b, lengths[t], 24);
+
+        if (fx_vector_dot(g_a, g_b, lengths[t]) != fx_vector_dot_ref(g_a, g_b, lengths[t])) {
+            identical = 0;
+        }
+    }
+
+    TEST_ASSERT(identical, "Dot product bit-identical for all lengths");
+}
+
+/**
+ * @test Matrix multiply over shapes that straddle the register tile
+ * @traceability SRS-003.9, SRS-003.10
+ */
+static void test_matrix_mul_equivalence(void) {
+    printf("\nTest: fx_matrix_mul vs reference\n");
+    printf("─────────────────────────────────\n");
+
+    int identical = 1;
+    static const uint16_t shapes[][3] = {
+        {1, 1, 1}, {4, 4, 4}, {5, 7, 3}, {8, 16, 8}, {13, 29, 11}, {32, 64, 32}
+    };
+
+    for (size_t t = 0; t < sizeof(shapes) / sizeof(shapes[0]); t++) {
+        fx_matrix_t A, B, C_ref, C_simd;
+        uint16_t m = shapes[t][0], k = shapes[t][1], n = shapes[t][2];
+
+        fx_matrix_init(&A, g_a, m, k);
+        fx_matrix_init(&B, g_b, k, n);
+        fx_matrix_init(&C_ref, g_out_ref, m, n);
+        fx_matrix_init(&C_simd, g_out_simd, m, n);
+
+        fill_random(g_a, (size_t)m * k, 24);
+        fill_random(g_b, (size_t)k * n, 24);
+
+        fx_matrix_mul_ref(&A, &B, &C_ref);
+        fx_matrix_mul(&A, &B, &C_simd);
+
+        if (memcmp(g_out_ref, g_out_simd, (size_t)m * n * sizeof(fixed_t)) != 0) {
+            identical = 0;
+        }
+    }
+
+    TEST_ASSERT(identical, "Matrix multiply bit-identical for all shapes");
+}
+
+/**
+ * @test Convolution over input widths and kernel shapes hitting the tails
+ * @traceability SRS-006.4, SRS-003.10
+ */
+static void test_conv2d_equivalence(void) {
+    printf("\nTest: fx_conv2d vs reference\n");
+    printf("─────────────────────────────\n");
+
+    int identical = 1;
+    static const uint16_t shapes[][4] = {
+        /* in_rows, in_cols, k_rows, k_cols */
+        {3, 3, 3, 3}, {5, 5, 3, 3}, {8, 11, 3, 3}, {16, 16, 3, 3},
+        {9, 21, 5, 5}, {7, 13, 1, 1}, {12, 19, 2, 5}, {30, 37, 3, 3}
+    };
+
+    for (size_t t = 0; t < sizeof(shapes) / sizeof(shapes[0]); t++) {
+        fx_matrix_t in, kernel, out_ref, out_simd;
+        fixed_t kernel_buf[25];
+        uint16_t ih = shapes[t][0], iw = shapes[t][1];
+        uint16_t kh = shapes[t][2], kw = shapes[t][3];
+        uint16_t oh = ih - kh + 1, ow = iw - kw + 1;
+
+        fx_matrix_init(&in, g_a, ih, iw);
+        fx_matrix_init(&kernel, kernel_buf, kh, kw);
+        fx_matrix_init(&out_ref, g_out_ref, oh, ow);
+        fx_matrix_init(&out_simd, g_out_simd, oh, ow);
+
+        fill_random(in.data, (size_t)ih * iw, 24);
+        fill_random(kernel.data, (size_t)kh * kw, 20);
+
+        fx_conv2d_ref(&in, &kernel, &out_ref);
+        fx_conv2d(&in, &kernel, &out_simd);
+
+        if (memcmp(g_out_ref, g_out_simd, (size_t)oh * ow * sizeof(fixed_t)) != 0) {
+            identical = 0;
+        }
+    }
+
+    TEST_ASSERT(identical, "Convolution bit-identical for all shapes");
+}
+
+/**
+ * @test ReLU and Leaky ReLU including extreme values
+ * @traceability SRS-004.2, SRS-004.4, SRS-003.10
+ */
+static void test_activation_equivalence(void) {
+    printf("\nTest: fx_relu / fx_leaky_relu vs reference\n");
+    printf("───────────────────────────────────────────\n");
+
+    int relu_identical = 1;
+    int leaky_identical = 1;
+    static const uint16_t lengths[] = {1, 3, 4, 7, 8, 9, 17, 64, 1023};
+    const fixed_t alpha = fixed_from_float(0.01f);
+
+    for (size_t t = 0; t < sizeof(lengths) / sizeof(lengths[0]); t++) {
+        fx_matrix_t m_ref, m_simd;
+        uint16_t n = lengths[t];
+
+        fill_random(g_a, n, 32);
+        g_a[0] = FIXED_MIN;
+        g_a[n - 1] = FIXED_MAX;
+
+        fx_matrix_attach(&m_ref, g_out_ref, 1, n);
+        fx_matrix_attach(&m_simd, g_out_simd, 1, n);
+
+        memcpy(g_out_ref, g_a, n * sizeof(fixed_t));
+        memcpy(g_out_simd, g_a, n * sizeof(fixed_t));
+        fx_relu_ref(&m_ref);
+        fx_relu(&m_simd);
+        if (memcmp(g_out_ref, g_out_simd, n * sizeof(fixed_t)) != 0) {
+            relu_identical = 0;
+        }
+
+        memcpy(g_out_ref, g_a, n * sizeof(fixed_t));
+        memcpy(g_out_simd, g_a, n * sizeof(fixed_t));
+        fx_leaky_relu_ref(&m_ref, alpha);
+        fx_leaky_relu(&m_simd, alpha);
+        if (memcmp(g_out_ref, g_out_simd, n * sizeof(fixed_t)) != 0) {
+            leaky_identical = 0;
+        }
+    }
+
+    TEST_ASSERT(relu_identical, "ReLU bit-identical for all lengths");
+    TEST_ASSERT(leaky_identical, "Leaky ReLU bit-identical for all lengths");
+}
+
+/**
+ * @test Element-wise scale / saturating add / clamp kernels
+ * @traceability SRS-015.1, SRS-003.10
+ */
+static void test_elementwise_equivalence(void) {
+    printf("\nTest: fx_ew_apply vs reference\n");
+    printf("──────────────────────────────\n");
+
+    static const size_t lengths[] = {1, 3, 4, 7, 8, 9, 15, 16, 17, 64, 1023, 4096};
+    const fx_ew_op_t ops[][1] = {
+        { FX_EW_OP_SCALE(fixed_from_float(-2.375f)) },
+        { FX_EW_OP_SCALE(FIXED_MAX) },
+        { FX_EW_OP_ADD(fixed_from_int(20000)) },
+        { FX_EW_OP_ADD(FIXED_MIN) },
+        { FX_EW_OP_CLAMP(-fixed_from_int(100), fixed_from_int(3)) },
+    };
+    int identical = 1;
+
+    for (size_t o = 0; o < sizeof(ops) / sizeof(ops[0]); o++) {
+        for (size_t t = 0; t < sizeof(lengths) / sizeof(lengths[0]); t++) {
+            const size_t n = lengths[t];
+
+            fill_random(g_a, n, 32);
+            g_a[0] = FIXED_MIN;
+            g_a[n - 1] = FIXED_MAX;
+
+            fx_ew_apply_ref(g_a, g_out_ref, n, ops[o], 1);
+            fx_ew_apply(g_a, g_out_simd, n, ops[o], 1);
+            if (memcmp(g_out_ref, g_out_simd, n * sizeof(fixed_t)) != 0) {
+                identical = 0;
+            }
+        }
+    }
+
+    TEST_ASSERT(identical, "Scale, saturating add and clamp bit-identical for all lengths");
+}
+
+/**
+ * @test Frame conversion for every format and layout pair, widths hitting
+ *       the vector tails and the FX_INPUT_BLOCK boundary
+ * @traceability SRS-018.4, SRS-003.10
+ */
+static void test_input_equivalence(void) {
+    printf("\nTest: fx_input_convert vs reference\n");
+    printf("───────────────────────────────────\n");
+
+    static uint32_t pool[MAX_ELEMS + FX_INPUT_ALIGN / 4];
+    uint32_t* frame = pool + (FX_INPUT_ALIGN - (uintptr_t)pool % FX_INPUT_ALIGN) / 4;
+    static const uint16_t widths[] = {1, 5, 7, 17, 33, 161, 500};
+    static const uint16_t channels[] = {1, 3, 4};
+    int identical = 1;
+
+    for (int f = FX_INPUT_Q16; f <= FX_INPUT_F32; f++) {
+        for (size_t ci = 0; ci < sizeof(channels) / sizeof(channels[0]); ci++) {
+            for (size_t t = 0; t < sizeof(widths) / sizeof(widths[0]); t++) {
+                for (int l = 0; l < 4; l++) {
+                    const uint16_t c = channels[ci];
+                    const uint16_t w = widths[t];
+                    const uint16_t h = (uint16_t)(MAX_ELEMS / ((size_t)c * w) < 3 ? 1 : 3);
+                    const fx_layout_t src_layout = (l & 1) ? FX_LAYOUT_NCHW : FX_LAYOUT_NHWC;
+                    const fx_layout_t dst_layout = (l & 2) ? FX_LAYOUT_NCHW : FX_LAYOUT_NHWC;
+                    fx_input_desc_t d;
+                    fx_tensor_t ref, out;
+
+                    /* Padded rows; uint8 keeps 4-byte-multiple strides out */
+                    (void)fx_input_desc_init(&d, (fx_input_format_t)f, src_layout, c, h, w, 0);
+                    d.row_stride += (f == FX_INPUT_U8) ? 3u : 8u;
+                    d.plane_stride = d.row_stride * h;
+                    for (uint16_t k = 0; k < c; k++) {
+                        d.scale[k] = (f == FX_INPUT_U8)
+                            ? (fixed_t)(lcg_next() % (2u * FX_INPUT_U8_SCALE_MAX)) - FX_INPUT_U8_SCALE_MAX
+                            : (fixed_t)lcg_next();
+                        d.bias[k] = (fixed_t)lcg_next();
+                    }
+                    if (t == 0) {
+                        /* Identity normalisation takes the single-pass path */
+                        (void)fx_input_desc_init(&d, (fx_input_format_t)f, src_layout, c, h, w, 0);
+                    }
+
+                    for (size_t i = 0; i < (fx_input_frame_bytes(&d) + 3) / 4; i++) {
+                        /* Mostly finite binary32 around the Q16.16 range */
+                        uint32_t u = lcg_next();
+                        if (f == FX_INPUT_F32 && (u & 7u) != 0u) {
+                            u = (u & 0x807FFFFFu) | ((100u + (u >> 8) % 50u) << 23);
+                        }
+                        frame[i] = u;
+                    }
+
+                    fx_tensor_attach(&ref, g_out_ref, 1, c, h, w, dst_layout);
+                    fx_tensor_attach(&out, g_out_simd, 1, c, h, w, dst_layout);
+                    if (fx_input_convert_ref(&d, frame, &ref) != FX_INPUT_OK ||
+                        fx_input_convert(&d, frame, &out) != FX_INPUT_OK ||
+                        memcmp(g_out_ref, g_out_simd, fx_tensor_size(&ref) * sizeof(fixed_t)) != 0) {
+                        identical = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    TEST_ASSERT(identical, "Q16, uint8 and binary32 frames bit-identical for all layouts");
+}
+
+/**
+ * @test 2×2 max pooling over widths hitting the vector tail
+ * @traceability SRS-008.2, SRS-003.10
+ */
+static void test_maxpool_equivalence(void) {
+    printf("\nTest: fx_maxpool_2x2 vs reference\n");
+    printf("──────────────────────────────────\n");
+
+    int identical = 1;
+    static const uint16_t shapes[][2] = {
+        {2, 2}, {2, 6}, {4, 8}, {6, 10}, {8, 18}, {16, 16}, {28, 28}, {10, 62}
+    };
+
+    for (size_t t = 0; t < sizeof(shapes) / sizeof(shapes[0]); t++) {
+        fx_matrix_t in, out_ref, out_simd;
+        uint16_t h = shapes[t][0], w = shapes[t][1];
+
+        fx_matrix_init(&in, g_a, h, w);
+        fx_matrix_init(&out_ref, g_out_ref, h / 2, w / 2);
+        fx_matrix_init(&out_simd, g_out_simd, h / 2, w / 2);
+
+        fill_random(in.data, (size_t)h * w, 32);
+
+        fx_maxpool_2x2_ref(&in, &out_ref);
+        fx_maxpool_2x2(&in, &out_simd);
+
+        if (memcmp(g_out_ref, g_out_simd, (size_t)(h / 2) * (w / 2) * sizeof(fixed_t)) != 0) {
+            identical = 0;
+        }
+    }
+
+    TEST_ASSERT(identical, "Max pooling bit-identical for all shapes");
+}
+
+/**
+ * @test Int8 matmul and conv against the scalar kernels
+ * @traceability SRS-011.2, SRS-003.10
+ */
+static void test_q8_equivalence(fx_backend_t backend) {
+    printf("\nTest: int8 layers vs scalar backend\n");
+    printf("───────────────────────────────────\n");
+
+    static int8_t qa[MAX_ELEMS], qb[MAX_ELEMS], qref[MAX_ELEMS], qsimd[MAX_ELEMS];
+    static const uint16_t shapes[][3] = {
+        {1, 1, 1}, {3, 15, 17}, {5, 33, 64}, {4, 100, 31}, {2, 1100, 3}
+    };
+    fx_requant_t scale[64];
+    fx_qparams_t qp;
+    int identical = 1;
+
+    for (size_t i = 0; i < 64; i++) {
+        scale[i].multiplier = (int32_t)(0x40000000u + (lcg_next() >> 2));
+        scale[i].shift = 8;
+    }
+    memset(&qp, 0, sizeof(qp));
+    qp.scale = scale;
+    qp.per_channel = true;
+    qp.in_zero = -3;
+    for (size_t i = 0; i < MAX_ELEMS; i++) {
+        qa[i] = (int8_t)(lcg_next() >> 24);
+        qb[i] = (int8_t)(lcg_next() >> 24);
+    }
+
+    for (size_t t = 0; t < sizeof(shapes) / sizeof(shapes[0]); t++) {
+        uint16_t m = shapes[t][0], k = shapes[t][1], n = shapes[t][2];
+        fx_q8_matrix_t A = { qa, m, k }, B = { qb, k, n };
+        fx_q8_matrix_t C_ref = { qref, m, n }, C_simd = { qsimd, m, n };
+
+        (void)fx_dispatch_pin(FX_BACKEND_SCALAR);
+        fx_q8_matrix_mul(&A, &B, &qp, &C_ref);
+        (void)fx_dispatch_pin(backend);
+        fx_q8_matrix_mul(&A, &B, &qp, &C_simd);
+
+        if (memcmp(qref, qsimd, (size_t)m * n) != 0) {
+            identical = 0;
+        }
+    }
+
+    /* 3×3 conv, both filter layouts: tap- and channel-ordered dots */
+    for (int l = 0; l < 2; l++) {
+        const fx_layout_t layout = l ? FX_LAYOUT_NHWC : FX_LAYOUT_NCHW;
+        fx_q8_tensor_t in = { qa, 1, 19, 9, 9, layout };
+        fx_q8_tensor_t w = { qb, 20, 19, 3, 3, layout };
+        fx_q8_tensor_t out_ref = { qref, 1, 20, 9, 9, layout };
+        fx_q8_tensor_t out_simd = { qsimd, 1, 20, 9, 9, layout };
+        fx_conv_params_t p;
+
+        memset(&p, 0, sizeof(p));
+        p.stride_h = p.stride_w = 1;
+        p.pad_h = p.pad_w = 1;
+        p.dilation_h = p.dilation_w = 1;
+
+        (void)fx_dispatch_pin(FX_BACKEND_SCALAR);
+        fx_conv_res_t r0 = fx_q8_conv2d(&in, &w, &p, &qp, &out_ref);
+        (void)fx_dispatch_pin(backend);
+        fx_conv_res_t r1 = fx_q8_conv2d(&in, &w, &p, &qp, &out_simd);
+
+        if (r0 != FX_CONV_OK || r1 != FX_CONV_OK || memcmp(qref, qsimd, 20u * 81u) != 0) {
+            identical = 0;
+        }
+    }
+
+    TEST_ASSERT(identical, "int8 matmul and conv bit-identical to scalar");
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("  SRS-003.10 SIMD Equivalence Suite\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    /* SRS-003.11: Repeat the suite once per backend available here */
+    int backends_run = 0;
+    for (int b = FX_BACKEND_SCALAR; b < FX_BACKEND_COUNT; b++) {
+        const fx_backend_t backend = (fx_backend_t)b;
+
+        if (!fx_backend_available(backend)) {
+            printf("\n[backend %s: not available, skipped]\n", fx_backend_name(backend));
+            continue;
+        }
+
+        TEST_ASSERT(fx_dispatch_pin(backend) == FX_DISPATCH_OK &&
+                    fx_dispatch_active() == backend,
+                    "Backend pinned");
+        printf("\n[backend %s]\n", fx_backend_name(backend));
+
+        test_vector_dot_equivalence();
+        test_matrix_mul_equivalence();
+        test_conv2d_equivalence();
+        test_activation_equivalence();
+        test_elementwise_equivalence();
+        test_maxpool_equivalence();
+        test_input_equivalence();
+        test_q8_equivalence(backend);
+        backends_run++;
+    }
+
+    (void)fx_dispatch_pin(FX_BACKEND_AUTO);
+    printf("\nBackends verified: %d (auto-selected: %s)\n",
+           backends_run, fx_backend_name(fx_dispatch_active()));
+
+    /* Print summary */
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-003.10 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-003.10 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,380 @@
+/**
+ * @file test_sparse.c
+ * @project Certifiable Inference Engine
+ * @brief Unit tests for sparse and 2:4 structured-sparse weight kernels.
+ *
+ * @details Test suite verifying:
+ * - CSR and 2:4 packing of pruned weights, canonical 2:4 fill and tail
+ *   groups when K is not a multiple of four
+ * - Dense layers bit-identical to fx_matrix_mul() and
+ *   fx_matrix_mul_fused() on the dense weights, both formats
+ * - Convolution bit-identical to fx_conv2d_multi_ref() with stride,
+ *   padding, dilation, bias and either layout
+ * - Rejection of corrupt matrices, dense groups, short storage and
+ *   mismatched shapes
+ *
+ * @traceability SRS-019
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "sparse.h"
+#include "fixed_point.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+#define MAX_ELEMS 8192
+
+static fixed_t g_a[MAX_ELEMS];
+static fixed_t g_b[MAX_ELEMS];
+static fixed_t g_bias[64];
+static fixed_t g_ref[MAX_ELEMS];
+static fixed_t g_out[MAX_ELEMS];
+static fixed_t g_values[MAX_ELEMS];
+static uint16_t g_col_idx[MAX_ELEMS];
+static uint32_t g_row_ptr[MAX_ELEMS];
+static uint8_t g_meta[MAX_ELEMS];
+static fixed_t g_work[MAX_ELEMS];
+
+static uint32_t g_lcg = 0x5A75u;
+
+static uint32_t next_random(void) {
+    g_lcg = g_lcg * 1664525u + 1013904223u;
+    return g_lcg;
+}
+
+/**
+ * @brief Signed pseudo-random values of at most @p bits magnitude.
+ */
+static void fill_random(fixed_t* buf, size_t n, unsigned bits) {
+    for (size_t i = 0; i < n; i++) {
+        const uint32_t r = next_random() >> (32u - bits);
+        buf[i] = (fixed_t)((int64_t)r - ((int64_t)1 << (bits - 1u)));
+    }
+}
+
+/**
+ * @brief Zero about 70 % of an N × K matrix at the given strides.
+ */
+static void prune_random(fixed_t* w, uint16_t rows, uint16_t cols, size_t rs, size_t cs) {
+    for (size_t n = 0; n < rows; n++) {
+        for (size_t k = 0; k < cols; k++) {
+            if ((next_random() >> 24) % 10u < 7u) {
+                w[n * rs + k * cs] = 0;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Keep the two largest magnitudes of every group of four along k.
+ */
+static void prune_2_4(fixed_t* w, uint16_t rows, uint16_t cols, size_t rs, size_t cs) {
+    for (size_t n = 0; n < rows; n++) {
+        for (size_t k0 = 0; k0 < cols; k0 += FX_SPARSE_GROUP) {
+            const size_t width = (cols - k0 < FX_SPARSE_GROUP) ? cols - k0 : FX_SPARSE_GROUP;
+
+            while (1) {
+                size_t nz = 0, small = 0;
+                int64_t small_mag = INT64_MAX;
+                for (size_t j = 0; j < width; j++) {
+                    const int64_t v = w[n * rs + (k0 + j) * cs];
+                    const int64_t mag = v < 0 ? -v : v;
+                    if (v != 0) {
+                        nz++;
+                        if (mag < small_mag) {
+                            small_mag = mag;
+                            small = j;
+                        }
+                    }
+                }
+                if (nz <= FX_SPARSE_KEEP) {
+                    break;
+                }
+                w[n * rs + (k0 + small) * cs] = 0;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Pack a dense matrix, failing the caller's flag on error.
+ */
+static bool pack(const fixed_t* src, uint16_t rows, uint16_t cols, size_t rs, size_t cs,
+                 fx_sparse_format_t format, fx_sparse_matrix_t* w) {
+    return fx_sparse_pack(src, rows, cols, rs, cs, format, g_values, MAX_ELEMS, g_col_idx,
+                          g_row_ptr, g_meta, w) == FX_SPARSE_OK &&
+           fx_sparse_check(w) == FX_SPARSE_OK;
+}
+
+/**
+ * @test Packing layout, canonical 2:4 fill and tail groups
+ * @traceability SRS-019.1, SRS-019.2, SRS-019.3
+ */
+static void test_pack(void) {
+    printf("\nTest: Packing\n");
+    printf("─────────────\n");
+
+    /* Two rows, K = 6: groups {0..3} and the tail {4, 5} */
+    const fixed_t dense[12] = {
+        0, 5, 0, 7,   0, 0,
+        0, 0, 9, 0,   3, 0,
+    };
+    fx_sparse_matrix_t w;
+
+    TEST_ASSERT(fx_sparse_values_size(dense, 2, 6, 6, 1, FX_SPARSE_CSR) == 4 &&
+                fx_sparse_values_size(dense, 2, 6, 6, 1, FX_SPARSE_2_4) == 8,
+                "CSR stores 4 non-zeros; 2:4 stores 2 × 2 groups × 2");
+
+    TEST_ASSERT(pack(dense, 2, 6, 6, 1, FX_SPARSE_CSR, &w) &&
+                g_row_ptr[0] == 0 && g_row_ptr[1] == 2 && g_row_ptr[2] == 4 &&
+                g_col_idx[0] == 1 && g_col_idx[1] == 3 && g_col_idx[2] == 2 &&
+                g_col_idx[3] == 4 && g_values[0] == 5 && g_values[3] == 3,
+                "CSR: row offsets, ascending columns and values");
+
+    TEST_ASSERT(pack(dense, 2, 6, 6, 1, FX_SPARSE_2_4, &w) &&
+                g_meta[0] == (1u | (3u << 2)) && g_values[0] == 5 && g_values[1] == 7 &&
+                g_meta[1] == (0u | (1u << 2)) && g_values[2] == 0 && g_values[3] == 0 &&
+                g_meta[2] == (0u | (2u << 2)) && g_values[4] == 0 && g_values[5] == 9 &&
+                g_meta[3] == (0u | (1u << 2)) && g_values[6] == 3 && g_values[7] == 0,
+                "2:4: positions ascending, free slots filled lowest first with zeros");
+
+    /* K = 5: the tail group has one column, repeated with a zero value */
+    const fixed_t tail[5] = { 1, 0, 0, 2, 4 };
+    TEST_ASSERT(pack(tail, 1, 5, 5, 1, FX_SPARSE_2_4, &w) &&
+                g_meta[1] == 0 && g_values[2] == 4 && g_values[3] == 0,
+                "One-column tail group repeats its position");
+
+    /* Transposed source: column n of a 6 × 2 matrix is row n of W */
+    fixed_t kn[12];
+    for (size_t n = 0; n < 2; n++) {
+        for (size_t k = 0; k < 6; k++) {
+            kn[k * 2 + n] = dense[n * 6 + k];
+        }
+    }
+    TEST_ASSERT(pack(kn, 2, 6, 1, 2, FX_SPARSE_CSR, &w) &&
+                g_col_idx[2] == 2 && g_values[2] == 9 && w.rows == 2 && w.cols == 6,
+                "K × N source packed through strides");
+}
+
+/**
+ * @test Dense layers against fx_matrix_mul and fx_matrix_mul_fused
+ * @traceability SRS-019.4, SRS-004.9
+ */
+static void test_matmul(void) {
+    printf("\nTest: Sparse dense layers\n");
+    printf("─────────────────────────\n");
+
+    /* K not a multiple of four; M > 1 exercises the row loop */
+    const uint16_t shapes[][3] = { { 1, 37, 23 }, { 5, 64, 16 }, { 3, 13, 1 }, { 7, 1, 9 } };
+    bool identical = true;
+    bool fused = true;
+    bool ok = true;
+
+    for (size_t f = 0; f < 2; f++) {
+        const fx_sparse_format_t format = f == 0 ? FX_SPARSE_CSR : FX_SPARSE_2_4;
+
+        for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+            const uint16_t M = shapes[s][0], K = shapes[s][1], N = shapes[s][2];
+            fx_matrix_t A, B, C, R, bias;
+            fx_sparse_matrix_t w;
+
+            fill_random(g_a, (size_t)M * K, 24);
+            fill_random(g_b, (size_t)K * N, 20);
+            fill_random(g_bias, N, 20);
+            if (format == FX_SPARSE_CSR) {
+                prune_random(g_b, N, K, 1, N);
+            } else {
+                prune_2_4(g_b, N, K, 1, N);
+            }
+            fx_matrix_attach(&A, g_a, M, K);
+            fx_matrix_attach(&B, g_b, K, N);
+            fx_matrix_attach(&C, g_out, M, N);
+            fx_matrix_attach(&R, g_ref, M, N);
+            fx_matrix_attach(&bias, g_bias, 1, N);
+
+            ok = ok && pack(g_b, N, K, 1, N, format, &w);
+            fx_matrix_mul(&A, &B, &R);
+            ok = ok && fx_sparse_matmul(&A, &w, &C) == FX_SPARSE_OK;
+            identical = identical && memcmp(g_out, g_ref, (size_t)M * N * sizeof(fixed_t)) == 0;
+
+            for (int act = FX_ACT_NONE; act <= FX_ACT_GELU; act++) {
+                fx_matrix_mul_fused(&A, &B, &bias, (fx_activation_t)act, FIXED_HALF, &R);
+                ok = ok && fx_sparse_matmul_fused(&A, &w, &bias, (fx_activation_t)act,
+                                                  FIXED_HALF, &C) == FX_SPARSE_OK;
+                fused = fused && memcmp(g_out, g_ref, (size_t)M * N * sizeof(fixed_t)) == 0;
+            }
+        }
+    }
+
+    TEST_ASSERT(ok, "Packed, checked and every call accepted");
+    TEST_ASSERT(identical, "CSR and 2:4: bit-identical to fx_matrix_mul");
+    TEST_ASSERT(fused, "Bias and all activations: bit-identical to fx_matrix_mul_fused");
+}
+
+/**
+ * @test Convolution against fx_conv2d_multi_ref
+ * @traceability SRS-019.5, SRS-006.4, SRS-006.10
+ */
+static void test_conv(void) {
+    printf("\nTest: Sparse convolution\n");
+    printf("────────────────────────\n");
+
+    const uint16_t C = 3, O = 6, H = 11, W = 10, KH = 3, KW = 3;
+    const uint16_t K = (uint16_t)(C * KH * KW);   /* 27: tail group of 3 */
+    bool identical = true;
+    bool ok = true;
+
+    for (size_t f = 0; f < 2; f++) {
+        const fx_sparse_format_t format = f == 0 ? FX_SPARSE_CSR : FX_SPARSE_2_4;
+
+        fill_random(g_b, (size_t)O * K, 18);
+        if (format == FX_SPARSE_CSR) {
+            prune_random(g_b, O, K, K, 1);
+        } else {
+            prune_2_4(g_b, O, K, K, 1);
+        }
+
+        for (size_t cfg = 0; cfg < 8; cfg++) {
+            const fx_layout_t layout = (cfg & 1u) ? FX_LAYOUT_NHWC : FX_LAYOUT_NCHW;
+            fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+            fx_tensor_t in, wt, ref, out;
+            fx_sparse_matrix_t w;
+
+            p.stride_h = (cfg & 2u) ? 2 : 1;
+            p.stride_w = (cfg & 2u) ? 1 : 2;
+            p.pad_h = p.pad_w = (cfg & 4u) ? 2 : 0;
+            p.dilation_h = (cfg & 4u) ? 2 : 1;
+
+            const uint16_t oh = fx_conv2d_out_dim(H, KH, p.stride_h, p.pad_h, p.dilation_h);
+            const uint16_t ow = fx_conv2d_out_dim(W, KW, p.stride_w, p.pad_w, p.dilation_w);
+
+            fill_random(g_a, (size_t)2 * C * H * W, 24);
+            fill_random(g_bias, O, 20);
+            fx_tensor_attach(&in, g_a, 2, C, H, W, layout);
+            fx_tensor_attach(&wt, g_b, O, C, KH, KW, FX_LAYOUT_NCHW);
+            fx_tensor_attach(&ref, g_ref, 2, O, oh, ow, layout);
+            fx_tensor_attach(&out, g_out, 2, O, oh, ow, layout);
+
+            ok = ok && pack(g_b, O, K, K, 1, format, &w) &&
+                 fx_conv2d_multi_ref(&in, &wt, (cfg & 1u) ? g_bias : NULL, &p, &ref) == FX_CONV_OK &&
+                 fx_sparse_conv2d(&in, &w, KH, KW, (cfg & 1u) ? g_bias : NULL, &p, g_work,
+                                  fx_sparse_conv2d_workspace_size(&w), &out) == FX_SPARSE_OK;
+            identical = identical &&
+                        memcmp(g_out, g_ref, (size_t)2 * O * oh * ow * sizeof(fixed_t)) == 0;
+        }
+    }
+
+    TEST_ASSERT(ok, "Every configuration accepted with a K-element workspace");
+    TEST_ASSERT(identical, "Stride, padding, dilation, bias, both layouts: bit-identical");
+}
+
+/**
+ * @test Corrupt matrices, dense groups, short storage and shape mismatches
+ * @traceability SRS-019.1, SRS-019.2, SRS-019.3
+ */
+static void test_invalid(void) {
+    printf("\nTest: Invalid arguments\n");
+    printf("───────────────────────\n");
+
+    const fixed_t dense[8] = { 1, 2, 3, 0,   0, 0, 0, 4 };
+    fx_sparse_matrix_t w = { FX_SPARSE_CSR, 0, 0, NULL, NULL, NULL, NULL };
+    fx_matrix_t A, C;
+
+    TEST_ASSERT(fx_sparse_pack(dense, 1, 8, 8, 1, FX_SPARSE_2_4, g_values, MAX_ELEMS, NULL,
+                               NULL, g_meta, &w) == FX_SPARSE_NOT_2_4 && w.rows == 0,
+                "Three non-zeros in a group rejected; matrix untouched");
+
+    /* Dense group last: the valid groups before it must not be written */
+    const fixed_t late[8] = { 0, 5, 0, 7,   1, 2, 3, 0 };
+    memset(g_values, 0xA5, 2 * FX_SPARSE_KEEP * sizeof(g_values[0]));
+    memset(g_meta, 0xA5, 2);
+    TEST_ASSERT(fx_sparse_pack(late, 1, 8, 8, 1, FX_SPARSE_2_4, g_values, MAX_ELEMS, NULL,
+                               NULL, g_meta, &w) == FX_SPARSE_NOT_2_4 &&
+                g_values[0] == (fixed_t)0xA5A5A5A5u && g_values[1] == (fixed_t)0xA5A5A5A5u &&
+                g_meta[0] == 0xA5u && g_meta[1] == 0xA5u,
+                "Dense last group rejected; storage untouched");
+    TEST_ASSERT(fx_sparse_pack(dense, 1, 8, 8, 1, FX_SPARSE_CSR, g_values, 3, g_col_idx,
+                               g_row_ptr, NULL, &w) == FX_SPARSE_CAPACITY,
+                "CSR storage shorter than the non-zeros rejected");
+
+    (void)pack(dense, 2, 4, 4, 1, FX_SPARSE_CSR, &w);
+    g_col_idx[1] = 0;
+    TEST_ASSERT(fx_sparse_check(&w) == FX_SPARSE_CORRUPT, "Descending CSR columns rejected");
+    g_col_idx[1] = 4;
+    TEST_ASSERT(fx_sparse_check(&w) == FX_SPARSE_CORRUPT, "CSR column ≥ K rejected");
+
+    const fixed_t pruned[6] = { 0, 5, 0, 7,   1, 0 };
+    (void)pack(pruned, 1, 6, 6, 1, FX_SPARSE_2_4, &w);
+    g_meta[0] = (uint8_t)(3u | (1u << 2));
+    TEST_ASSERT(fx_sparse_check(&w) == FX_SPARSE_CORRUPT, "Descending 2:4 positions rejected");
+    g_meta[0] = (uint8_t)(1u | (3u << 2));
+    g_meta[1] = (uint8_t)(0u | (2u << 2));
+    TEST_ASSERT(fx_sparse_check(&w) == FX_SPARSE_CORRUPT, "2:4 position ≥ K rejected");
+    g_meta[1] = 0;
+    g_values[3] = 1;
+    TEST_ASSERT(fx_sparse_check(&w) == FX_SPARSE_CORRUPT,
+                "Repeated 2:4 position with a non-zero value rejected");
+
+    fx_matrix_attach(&A, g_a, 2, 5);
+    fx_matrix_attach(&C, g_out, 2, 1);
+    g_values[3] = 0;
+    TEST_ASSERT(fx_sparse_matmul(&A, &w, &C) == FX_SPARSE_DIM_MISMATCH &&
+                fx_sparse_matmul(NULL, &w, &C) == FX_SPARSE_INVALID_PARAM,
+                "K mismatch and NULL operands rejected");
+
+    fx_tensor_t in, out;
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+    fx_tensor_attach(&in, g_a, 1, 1, 4, 4, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&out, g_out, 1, 1, 3, 2, FX_LAYOUT_NCHW);
+    TEST_ASSERT(fx_sparse_conv2d(&in, &w, 2, 3, NULL, &p, g_work, 5, &out) ==
+                FX_SPARSE_WORKSPACE_TOO_SMALL &&
+                fx_sparse_conv2d(&in, &w, 3, 2, NULL, &p, g_work, 6, &out) ==
+                FX_SPARSE_DIM_MISMATCH,
+                "Short workspace and wrong output shape rejected");
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("  SRS-019 Sparse Weight Kernel Verification\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    test_pack();
+    test_matmul();
+    test_conv();
+    test_invalid();
+
+    /* Print summary */
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-019 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-019 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
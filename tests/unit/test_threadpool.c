@@ -0,0 +1,422 @@
+/**
+ * @file test_threadpool.c
+ * @project Certifiable Inference Engine
+ * @brief Verification of deterministic multithreaded tiling.
+ *
+ * @details Checks the pool API and the static partition, then runs the
+ * tiled GEMM and convolution paths with 1 … 8 threads and requires every
+ * result to be bit-identical to the serial run and to the reference
+ * implementations. Shapes are chosen to exercise both the row and the
+ * column split, uneven spans and fused epilogues.
+ *
+ * @traceability SRS-013
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "threadpool.h"
+#include "matrix.h"
+#include "convolution.h"
+#include "tensor.h"
+#include "fixed_point.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+#define MAX_ELEMS 65536
+#define MAX_PARTS 64
+
+static const unsigned k_thread_counts[] = { 1, 2, 3, 4, 7, 8 };
+#define NUM_THREAD_COUNTS (sizeof(k_thread_counts) / sizeof(k_thread_counts[0]))
+
+static fixed_t g_a[MAX_ELEMS], g_b[MAX_ELEMS], g_bias[MAX_ELEMS];
+static fixed_t g_serial[MAX_ELEMS], g_out[MAX_ELEMS], g_ref[MAX_ELEMS];
+
+/* Deterministic LCG so inputs are identical on every platform */
+static uint32_t g_lcg_state = 0x2545F491u;
+static uint32_t lcg_next(void) {
+    g_lcg_state = g_lcg_state * 1664525u + 1013904223u;
+    return g_lcg_state;
+}
+
+/* Q16.16 value in about [-4, 4) */
+static void fill(fixed_t* buf, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        buf[i] = (fixed_t)(lcg_next() >> 13) - (fixed_t)(1 << 18);
+    }
+}
+
+static bool g_threads_supported = false;
+
+/* ─────────────────────────────────────────────────────────────────────── */
+
+static unsigned g_part_runs[MAX_PARTS];
+
+static void count_part(void* ctx, unsigned part, unsigned parts) {
+    (void)ctx;
+    if (part < MAX_PARTS && parts <= MAX_PARTS) {
+        g_part_runs[part]++;
+    }
+}
+
+static void mark_part(void* ctx, unsigned part, unsigned parts) {
+    (void)parts;
+    ((unsigned*)ctx)[part] = 1;
+}
+
+/* A task that itself posts a task: the inner call must run serially */
+static void nested_part(void* ctx, unsigned part, unsigned parts) {
+    unsigned* marks = (unsigned*)ctx;
+    (void)parts;
+
+    fx_pool_run(mark_part, &marks[part * 4u], 4);
+}
+
+static bool parts_ran_once(unsigned parts) {
+    for (unsigned p = 0; p < MAX_PARTS; p++) {
+        if (g_part_runs[p] != (p < parts ? 1u : 0u)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void test_pool_api(void) {
+    printf("\nPool API and static partition\n");
+    printf("─────────────────────────────────────────────────\n");
+
+    TEST_ASSERT(fx_pool_threads() == 1, "Pool size is 1 before fx_pool_start()");
+    TEST_ASSERT(fx_pool_start(0) == FX_POOL_INVALID_PARAM, "Zero threads rejected");
+    TEST_ASSERT(fx_pool_start(FX_POOL_MAX_THREADS + 1) == FX_POOL_INVALID_PARAM,
+                "More than FX_POOL_MAX_THREADS rejected");
+
+    memset(g_part_runs, 0, sizeof(g_part_runs));
+    fx_pool_run(count_part, NULL, 9);
+    TEST_ASSERT(parts_ran_once(9), "Without a pool every part runs once on the caller");
+
+    const fx_pool_res_t res = fx_pool_start(4);
+    g_threads_supported = (res == FX_POOL_OK);
+    if (res == FX_POOL_UNSUPPORTED) {
+        printf("  ℹ  Built without thread support, pool tests run serially\n");
+        TEST_ASSERT(fx_pool_threads() == 1, "Unsupported pool stays at 1 thread");
+    } else {
+        TEST_ASSERT(res == FX_POOL_OK && fx_pool_threads() == 4, "Pool of 4 threads started");
+        TEST_ASSERT(fx_pool_start(2) == FX_POOL_BUSY, "Second start reports FX_POOL_BUSY");
+
+        bool all_once = true;
+        for (unsigned parts = 1; parts <= 13; parts++) {
+            memset(g_part_runs, 0, sizeof(g_part_runs));
+            fx_pool_run(count_part, NULL, parts);
+            all_once = all_once && parts_ran_once(parts);
+        }
+        TEST_ASSERT(all_once, "1 … 13 parts each run exactly once on 4 threads");
+
+        unsigned marks[16];
+        bool nested_ok = true;
+        memset(marks, 0, sizeof(marks));
+        fx_pool_run(nested_part, marks, 4);
+        for (unsigned i = 0; i < 16; i++) {
+            nested_ok = nested_ok && marks[i] == 1;
+        }
+        TEST_ASSERT(nested_ok, "Nested fx_pool_run() completes serially without deadlock");
+
+        fx_pool_stop();
+        TEST_ASSERT(fx_pool_threads() == 1, "fx_pool_stop() returns to 1 thread");
+        TEST_ASSERT(fx_pool_start(3) == FX_POOL_OK && fx_pool_threads() == 3,
+                    "Pool restarts after stop");
+        fx_pool_stop();
+    }
+
+    /* Spans tile [0, units) contiguously and differ by at most one */
+    bool spans_ok = true;
+    for (size_t units = 0; units < 50 && spans_ok; units++) {
+        for (unsigned parts = 1; parts <= 9 && spans_ok; parts++) {
+            size_t next = 0, lo = (size_t)-1, hi = 0;
+            for (unsigned p = 0; p < parts; p++) {
+                size_t b, e;
+                fx_pool_span(units, p, parts, &b, &e);
+                spans_ok = spans_ok && b == next && e >= b;
+                next = e;
+                lo = (e - b < lo) ? e - b : lo;
+                hi = (e - b > hi) ? e - b : hi;
+            }
+            spans_ok = spans_ok && next == units && hi - lo <= 1;
+        }
+    }
+    TEST_ASSERT(spans_ok, "fx_pool_span(): contiguous, complete, even to one unit");
+
+    TEST_ASSERT(fx_pool_parts(100, (uint64_t)FX_POOL_MIN_WORK * 100) == 1,
+                "fx_pool_parts() is 1 without a pool");
+    if (g_threads_supported) {
+        fx_pool_start(8);
+        TEST_ASSERT(fx_pool_parts(100, FX_POOL_MIN_WORK - 1) == 1 &&
+                    fx_pool_parts(100, (uint64_t)FX_POOL_MIN_WORK * 3) == 3 &&
+                    fx_pool_parts(5, (uint64_t)FX_POOL_MIN_WORK * 100) == 5 &&
+                    fx_pool_parts(100, (uint64_t)FX_POOL_MIN_WORK * 100) == 8,
+                    "fx_pool_parts() bounded by threads, units and minimum work");
+        fx_pool_stop();
+    }
+}
+
+/* ─────────────────────────────────────────────────────────────────────── */
+
+typedef struct {
+    uint16_t m, k, n;
+    const char* name;
+} gemm_shape_t;
+
+static const gemm_shape_t k_gemm_shapes[] = {
+    {  64, 200,  96, "64×200×96 (row split)" },
+    {   3, 200, 256, "3×200×256 (column split)" },
+    { 130,  50,  77, "130×50×77 (uneven row tiles, column edge)" },
+    {   5, 700,   9, "5×700×9 (few tiles of each kind)" },
+};
+#define NUM_GEMM_SHAPES (sizeof(k_gemm_shapes) / sizeof(k_gemm_shapes[0]))
+
+/**
+ * @brief Run matmul, fused matmul and fused matmul on pre-packed B with
+ *        @p threads threads.
+ */
+static void gemm_with_threads(unsigned threads, const fx_matrix_t* A, const fx_matrix_t* B,
+                              const fx_matrix_packed_t* Bp, const fx_matrix_t* bias,
+                              fx_matrix_t* C, fx_matrix_t* F, fx_matrix_t* P) {
+    if (threads > 1) {
+        fx_pool_start(threads);
+    }
+    fx_matrix_mul(A, B, C);
+    fx_matrix_mul_fused(A, B, bias, FX_ACT_LEAKY_RELU, fixed_from_float(0.125f), F);
+    fx_matrix_mul_packed_fused(A, Bp, bias, FX_ACT_LEAKY_RELU, fixed_from_float(0.125f), P);
+    fx_pool_stop();
+}
+
+static void test_gemm_bit_identical(void) {
+    printf("\nTiled GEMM bit-identical for 1 … 8 threads\n");
+    printf("─────────────────────────────────────────────────\n");
+
+    static fixed_t fused_serial[MAX_ELEMS], fused_out[MAX_ELEMS], packed_out[MAX_ELEMS];
+    static fixed_t panels[2 * MAX_ELEMS];   /* K × N rounded up to whole panels */
+
+    for (size_t s = 0; s < NUM_GEMM_SHAPES; s++) {
+        const gemm_shape_t* sh = &k_gemm_shapes[s];
+        fx_matrix_t A, B, bias, C, F, P, R;
+        fx_matrix_packed_t Bp = { NULL, 0, 0 };
+        char msg[128];
+
+        fx_matrix_init(&A, g_a, sh->m, sh->k);
+        fx_matrix_init(&B, g_b, sh->k, sh->n);
+        fx_matrix_init(&bias, g_bias, 1, sh->n);
+        fill(g_a, (size_t)sh->m * sh->k);
+        fill(g_b, (size_t)sh->k * sh->n);
+        fill(g_bias, sh->n);
+        fx_matrix_pack(&B, panels, sizeof(panels) / sizeof(panels[0]), &Bp);
+
+        fx_matrix_init(&R, g_ref, sh->m, sh->n);
+        fx_matrix_mul_ref(&A, &B, &R);
+
+        fx_matrix_init(&C, g_serial, sh->m, sh->n);
+        fx_matrix_init(&F, fused_serial, sh->m, sh->n);
+        fx_matrix_init(&P, packed_out, sh->m, sh->n);
+        gemm_with_threads(1, &A, &B, &Bp, &bias, &C, &F, &P);
+
+        const size_t bytes = (size_t)sh->m * sh->n * sizeof(fixed_t);
+        bool ok = Bp.data != NULL && memcmp(g_serial, g_ref, bytes) == 0 &&
+                  memcmp(packed_out, fused_serial, bytes) == 0;
+
+        for (size_t t = 0; t < NUM_THREAD_COUNTS && g_threads_supported; t++) {
+            fx_matrix_init(&C, g_out, sh->m, sh->n);
+            fx_matrix_init(&F, fused_out, sh->m, sh->n);
+            memset(packed_out, 0, bytes);
+            gemm_with_threads(k_thread_counts[t], &A, &B, &Bp, &bias, &C, &F, &P);
+
+            ok = ok && memcmp(g_out, g_serial, bytes) == 0 &&
+                 memcmp(fused_out, fused_serial, bytes) == 0 &&
+                 memcmp(packed_out, fused_serial, bytes) == 0;
+        }
+
+        snprintf(msg, sizeof(msg), "%s: matmul + fused + pre-packed B", sh->name);
+        TEST_ASSERT(ok, msg);
+    }
+}
+
+/* ─────────────────────────────────────────────────────────────────────── */
+
+static void test_conv2d_bit_identical(void) {
+    printf("\nTiled fx_conv2d() bit-identical for 1 … 8 threads\n");
+    printf("─────────────────────────────────────────────────\n");
+
+    const uint16_t shapes[][4] = {
+        { 100, 90, 5, 5 },       /* in rows, in cols, kernel rows, kernel cols */
+        {  67, 120, 3, 7 },
+        { 200, 40, 9, 1 },
+    };
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        const uint16_t ir = shapes[s][0], ic = shapes[s][1];
+        const uint16_t kr = shapes[s][2], kc = shapes[s][3];
+        const uint16_t orows = (uint16_t)(ir - kr + 1), ocols = (uint16_t)(ic - kc + 1);
+        fx_matrix_t in, ker, out;
+        char msg[128];
+
+        fx_matrix_init(&in, g_a, ir, ic);
+        fx_matrix_init(&ker, g_b, kr, kc);
+        fill(g_a, (size_t)ir * ic);
+        fill(g_b, (size_t)kr * kc);
+
+        fx_matrix_init(&out, g_ref, orows, ocols);
+        fx_conv2d_ref(&in, &ker, &out);
+
+        const size_t bytes = (size_t)orows * ocols * sizeof(fixed_t);
+        bool ok = true;
+
+        for (size_t t = 0; t < NUM_THREAD_COUNTS; t++) {
+            if (k_thread_counts[t] > 1 && !g_threads_supported) {
+                continue;
+            }
+            if (k_thread_counts[t] > 1) {
+                fx_pool_start(k_thread_counts[t]);
+            }
+            fx_matrix_init(&out, g_out, orows, ocols);
+            fx_conv2d(&in, &ker, &out);
+            fx_pool_stop();
+
+            ok = ok && memcmp(g_out, g_ref, bytes) == 0;
+        }
+
+        snprintf(msg, sizeof(msg), "%u×%u input, %u×%u kernel: equals fx_conv2d_ref()",
+                 (unsigned)ir, (unsigned)ic, (unsigned)kr, (unsigned)kc);
+        TEST_ASSERT(ok, msg);
+    }
+}
+
+/* ─────────────────────────────────────────────────────────────────────── */
+
+static void test_conv2d_multi_bit_identical(void) {
+    printf("\nTiled multi-channel convolution for 1 … 8 threads\n");
+    printf("─────────────────────────────────────────────────\n");
+
+    static fixed_t fused_serial[MAX_ELEMS], fused_out[MAX_ELEMS];
+    const fx_layout_t layouts[] = { FX_LAYOUT_NCHW, FX_LAYOUT_NHWC };
+
+    for (size_t l = 0; l < 2; l++) {
+        fx_tensor_t in, w, out, pooled;
+        fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+        const fx_conv_epilogue_t epi = { FX_ACT_RELU, FIXED_ZERO, true };
+        char msg[128];
+
+        p.pad_h = 1;
+        p.pad_w = 1;
+
+        fx_tensor_init(&in, g_a, 2, 3, 22, 20, layouts[l]);
+        fx_tensor_init(&w, g_b, 11, 3, 3, 3, layouts[l]);
+        fill(g_a, fx_tensor_size(&in));
+        fill(g_b, fx_tensor_size(&w));
+        fill(g_bias, 11);
+
+        fx_tensor_init(&out, g_ref, 2, 11, 22, 20, layouts[l]);
+        fx_conv2d_multi_ref(&in, &w, g_bias, &p, &out);
+
+        fx_tensor_init(&pooled, fused_serial, 2, 11, 11, 10, layouts[l]);
+        fx_conv2d_fused(&in, &w, g_bias, &p, &epi, &pooled);
+
+        const size_t bytes = fx_tensor_size(&out) * sizeof(fixed_t);
+        const size_t pooled_bytes = fx_tensor_size(&pooled) * sizeof(fixed_t);
+        bool ok = true;
+
+        for (size_t t = 0; t < NUM_THREAD_COUNTS; t++) {
+            if (k_thread_counts[t] > 1 && !g_threads_supported) {
+                continue;
+            }
+            if (k_thread_counts[t] > 1) {
+                fx_pool_start(k_thread_counts[t]);
+            }
+            fx_tensor_init(&out, g_out, 2, 11, 22, 20, layouts[l]);
+            ok = ok && fx_conv2d_multi(&in, &w, g_bias, &p, &out) == FX_CONV_OK;
+
+            fx_tensor_init(&pooled, fused_out, 2, 11, 11, 10, layouts[l]);
+            ok = ok && fx_conv2d_fused(&in, &w, g_bias, &p, &epi, &pooled) == FX_CONV_OK;
+            fx_pool_stop();
+
+            ok = ok && memcmp(g_out, g_ref, bytes) == 0 &&
+                 memcmp(fused_out, fused_serial, pooled_bytes) == 0;
+        }
+
+        snprintf(msg, sizeof(msg), "%s 2×3×22×20, 11 filters: multi and fused match serial",
+                 l == 0 ? "NCHW" : "NHWC");
+        TEST_ASSERT(ok, msg);
+    }
+}
+
+/* ─────────────────────────────────────────────────────────────────────── */
+
+static void test_repeatable_under_reuse(void) {
+    printf("\nPool reuse\n");
+    printf("─────────────────────────────────────────────────\n");
+
+    fx_matrix_t A, B, C;
+    bool ok = true;
+
+    fx_matrix_init(&A, g_a, 64, 128);
+    fx_matrix_init(&B, g_b, 128, 64);
+    fill(g_a, 64 * 128);
+    fill(g_b, 128 * 64);
+
+    fx_matrix_init(&C, g_serial, 64, 64);
+    fx_matrix_mul(&A, &B, &C);
+
+    if (g_threads_supported) {
+        fx_pool_start(5);
+    }
+    for (int i = 0; i < 200 && ok; i++) {
+        fx_matrix_init(&C, g_out, 64, 64);
+        fx_matrix_mul(&A, &B, &C);
+        ok = memcmp(g_out, g_serial, 64 * 64 * sizeof(fixed_t)) == 0;
+    }
+    fx_pool_stop();
+
+    TEST_ASSERT(ok, "200 calls on one pool: identical every time");
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("  SRS-013 Deterministic Threading Verification\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    test_pool_api();
+    test_gemm_bit_identical();
+    test_conv2d_bit_identical();
+    test_conv2d_multi_bit_identical();
+    test_repeatable_under_reuse();
+
+    /* Print summary */
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-013 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-013 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
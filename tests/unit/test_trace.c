@@ -0,0 +1,363 @@
+/**
+ * @file test_trace.c
+ * @project Certifiable Inference Engine
+ * @brief Unit tests for kernel tracing.
+ *
+ * @details Test suite verifying:
+ * - Ring construction over caller storage
+ * - Nesting: parents, nested ticks and the depth limit
+ * - Wrap-around: oldest events overwritten and counted as lost
+ * - Chrome trace JSON and folded-stack exports, including truncation
+ * - With CI_TRACE: kernel and graph-layer events carrying dims, layer
+ *   and backend; without: no kernel events at all
+ *
+ * @traceability SRS-007.12
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "trace.h"
+#include "dispatch.h"
+#include "graph.h"
+#include "matrix.h"
+#include "pooling.h"
+#include "qformat.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+#define RING_CAP 64
+
+static fx_trace_event_t g_events[RING_CAP];
+static fx_trace_ring_t g_ring;
+static char g_text[8192];
+
+/**
+ * @brief Empty ring, attached.
+ */
+static void ring_reset(void) {
+    (void)fx_trace_ring_init(&g_ring, g_events, RING_CAP);
+    fx_trace_attach(&g_ring);
+}
+
+/**
+ * @test Ring construction
+ * @traceability SRS-007.12
+ */
+static void test_ring_init(void) {
+    printf("\nTest: Ring construction\n");
+    printf("───────────────────────\n");
+
+    fx_trace_ring_t r;
+    TEST_ASSERT(fx_trace_ring_init(&r, g_events, RING_CAP) == FX_TRACE_OK &&
+                r.mask == RING_CAP - 1u && r.head == 0, "Power-of-two capacity accepted");
+    TEST_ASSERT(fx_trace_ring_init(&r, g_events, 48) == FX_TRACE_INVALID_PARAM,
+                "Capacity 48 rejected");
+    TEST_ASSERT(fx_trace_ring_init(&r, g_events, 0) == FX_TRACE_INVALID_PARAM,
+                "Capacity 0 rejected");
+    TEST_ASSERT(fx_trace_ring_init(&r, NULL, RING_CAP) == FX_TRACE_INVALID_PARAM &&
+                fx_trace_ring_init(NULL, g_events, RING_CAP) == FX_TRACE_INVALID_PARAM,
+                "NULL ring or storage rejected");
+    TEST_ASSERT(fx_trace_count(&r) == 0 && fx_trace_lost(&r) == 0 &&
+                fx_trace_event_at(&r, 0) == NULL, "New ring is empty");
+    TEST_ASSERT(strcmp(fx_trace_kernel_name(FX_TRACE_CONV2D_IM2COL), "conv2d_im2col") == 0 &&
+                strcmp(fx_trace_kernel_name(FX_TRACE_KERNEL_COUNT), "unknown") == 0,
+                "Kernel names");
+
+    fx_trace_attach(NULL);
+    TEST_ASSERT(fx_trace_begin(FX_TRACE_USER, 1, 2, 3) == 0, "Nothing recorded while detached");
+}
+
+/**
+ * @test Parents, nested ticks and depth limit
+ * @traceability SRS-007.12
+ */
+static void test_nesting(void) {
+    printf("\nTest: Nesting\n");
+    printf("─────────────\n");
+
+    ring_reset();
+    fx_trace_set_layer(7);
+    const uint64_t outer = fx_trace_begin(FX_TRACE_USER, 10, 20, 30);
+    fx_trace_set_layer(FX_TRACE_NO_LAYER);
+    const uint64_t inner = fx_trace_begin(FX_TRACE_MATMUL, 4, 5, 6);
+    volatile uint32_t spin = 0;
+    for (uint32_t i = 0; i < 20000; i++) {
+        spin += i;
+    }
+    fx_trace_end(inner);
+    fx_trace_end(outer);
+    fx_trace_attach(NULL);
+
+    const fx_trace_event_t* a = fx_trace_event_at(&g_ring, 0);
+    const fx_trace_event_t* b = fx_trace_event_at(&g_ring, 1);
+    TEST_ASSERT(outer == 1 && inner == 2 && fx_trace_count(&g_ring) == 2, "Two events recorded");
+    TEST_ASSERT(a && b && a->kernel == FX_TRACE_USER && a->dims[0] == 10 && a->dims[1] == 20 &&
+                a->dims[2] == 30 && a->layer == 7, "Outer kernel, dims and layer");
+    TEST_ASSERT(b && b->parent == outer && a->parent == 0 && b->layer == FX_TRACE_NO_LAYER,
+                "Inner event parented to outer");
+    TEST_ASSERT(a->end >= b->end && b->end >= b->begin && b->begin >= a->begin,
+                "Inner interval within outer");
+    TEST_ASSERT(a->nested == b->end - b->begin && b->nested == 0,
+                "Outer's nested ticks are the inner duration");
+    TEST_ASSERT(a->backend == (uint8_t)fx_dispatch_active(), "Active backend recorded");
+
+    /* Beyond FX_TRACE_MAX_DEPTH nothing is recorded and nothing breaks */
+    ring_reset();
+    uint64_t tok[FX_TRACE_MAX_DEPTH + 2];
+    for (int d = 0; d < FX_TRACE_MAX_DEPTH + 2; d++) {
+        tok[d] = fx_trace_begin(FX_TRACE_USER, (uint32_t)d, 0, 0);
+    }
+    for (int d = FX_TRACE_MAX_DEPTH + 1; d >= 0; d--) {
+        fx_trace_end(tok[d]);
+    }
+    fx_trace_attach(NULL);
+    bool closed = true;
+    for (size_t i = 0; i < fx_trace_count(&g_ring); i++) {
+        closed = closed && fx_trace_event_at(&g_ring, i)->end != 0;
+    }
+    TEST_ASSERT(fx_trace_count(&g_ring) == FX_TRACE_MAX_DEPTH && tok[FX_TRACE_MAX_DEPTH] == 0 &&
+                closed, "Depth limited to FX_TRACE_MAX_DEPTH, all closed");
+}
+
+/**
+ * @test Wrap-around
+ * @traceability SRS-007.12
+ */
+static void test_wrap(void) {
+    printf("\nTest: Wrap-around\n");
+    printf("─────────────────\n");
+
+    ring_reset();
+    for (uint32_t i = 0; i < RING_CAP + 10; i++) {
+        const uint64_t t = fx_trace_begin(FX_TRACE_USER, i, 0, 0);
+        fx_trace_end(t);
+    }
+
+    /* An event open while the ring wraps past it leaves the newer slot alone */
+    const uint64_t open = fx_trace_begin(FX_TRACE_USER, 999, 0, 0);
+    for (uint32_t i = 0; i < RING_CAP; i++) {
+        (void)fx_trace_begin(FX_TRACE_USER, 2000u + i, 0, 0);
+        fx_trace_end(open + 1u + i);
+    }
+    fx_trace_end(open);
+    fx_trace_attach(NULL);
+
+    TEST_ASSERT(fx_trace_count(&g_ring) == RING_CAP, "Count capped at capacity");
+    TEST_ASSERT(fx_trace_lost(&g_ring) == 2u * RING_CAP + 11u - RING_CAP, "Overwritten events counted");
+    TEST_ASSERT(fx_trace_event_at(&g_ring, 0)->dims[0] == 2000u &&
+                fx_trace_event_at(&g_ring, RING_CAP - 1u)->dims[0] == 2000u + RING_CAP - 1u,
+                "Oldest first, newest last");
+    TEST_ASSERT(fx_trace_event_at(&g_ring, 0)->parent == open,
+                "Parent token kept after the parent was overwritten");
+}
+
+/**
+ * @test Chrome and folded exports
+ * @traceability SRS-007.12
+ */
+static void test_export(void) {
+    printf("\nTest: Exports\n");
+    printf("─────────────\n");
+
+    ring_reset();
+    fx_trace_set_layer(3);
+    const uint64_t layer = fx_trace_begin(FX_TRACE_LAYER, 8, 16, 16);
+    const uint64_t conv = fx_trace_begin(FX_TRACE_CONV2D_IM2COL, 8, 16, 16);
+    const uint64_t gemm = fx_trace_begin(FX_TRACE_MATMUL, 256, 8, 27);
+    fx_trace_end(gemm);
+    fx_trace_end(conv);
+    fx_trace_end(layer);
+    const uint64_t open = fx_trace_begin(FX_TRACE_RELU, 64, 0, 0);   /* Not exported */
+    fx_trace_attach(NULL);
+    fx_trace_set_layer(FX_TRACE_NO_LAYER);
+
+    const size_t n = fx_trace_export_chrome(&g_ring, 1000.0, g_text, sizeof(g_text));
+    TEST_ASSERT(n == strlen(g_text) && n > 0, "Chrome length matches output");
+    TEST_ASSERT(strncmp(g_text, "{\"displayTimeUnit\"", 18) == 0 &&
+                strstr(g_text, "\"traceEvents\":[") && strcmp(g_text + n - 4, "\n]}\n") == 0,
+                "Chrome JSON object with traceEvents");
+    TEST_ASSERT(strstr(g_text, "\"name\":\"layer 3\",\"cat\":\"layer\",\"ph\":\"X\"") &&
+                strstr(g_text, "\"name\":\"conv2d_im2col\"") &&
+                strstr(g_text, "\"dims\":[256,8,27]"), "Complete events with names and dims");
+    TEST_ASSERT(strstr(g_text, "\"relu\"") == NULL, "Open event not exported");
+
+    char small[32];
+    TEST_ASSERT(fx_trace_export_chrome(&g_ring, 1000.0, small, sizeof(small)) == n &&
+                strlen(small) == sizeof(small) - 1u && strncmp(small, g_text, sizeof(small) - 1u) == 0,
+                "Chrome output truncated as snprintf()");
+    TEST_ASSERT(fx_trace_export_chrome(&g_ring, 1000.0, NULL, 0) == n, "Size query with NULL buffer");
+
+    const fx_trace_event_t* el = fx_trace_event_at(&g_ring, 0);
+    const fx_trace_event_t* ec = fx_trace_event_at(&g_ring, 1);
+    const fx_trace_event_t* eg = fx_trace_event_at(&g_ring, 2);
+    char expect[256];
+    snprintf(expect, sizeof(expect),
+             "layer 3 %llu\nlayer 3;conv2d_im2col %llu\nlayer 3;conv2d_im2col;matmul %llu\n",
+             (unsigned long long)(el->end - el->begin - el->nested),
+             (unsigned long long)(ec->end - ec->begin - ec->nested),
+             (unsigned long long)(eg->end - eg->begin));
+    const size_t f = fx_trace_export_folded(&g_ring, g_text, sizeof(g_text));
+    TEST_ASSERT(f == strlen(expect) && strcmp(g_text, expect) == 0,
+                "Folded stacks with self ticks");
+    TEST_ASSERT(fx_trace_export_folded(&g_ring, small, 8) == f && strcmp(small, "layer 3") == 0,
+                "Folded output truncated as snprintf()");
+    fx_trace_end(open);
+}
+
+/**
+ * @test Hooks in library kernels and graph layers
+ * @traceability SRS-007.12
+ */
+static void test_kernel_hooks(void) {
+    printf("\nTest: Kernel hooks (%s)\n", fx_trace_hooks_compiled() ? "CI_TRACE" : "compiled out");
+    printf("──────────────────────────────────\n");
+
+    fixed_t a[6 * 5], b[5 * 4], c[6 * 4];
+    fx_matrix_t A, B, C;
+    for (int i = 0; i < 30; i++) {
+        a[i] = (fixed_t)(i * 1000);
+    }
+    for (int i = 0; i < 20; i++) {
+        b[i] = (fixed_t)(i * 700 - 5000);
+    }
+    fx_matrix_attach(&A, a, 6, 5);
+    fx_matrix_attach(&B, b, 5, 4);
+    fx_matrix_attach(&C, c, 6, 4);
+
+    /* 1×2×4×4 → maxpool per plane (layer 0) → global average (layer 1) */
+    static fx_graph_t g;
+    fx_tensor_id_t x, p, y;
+    fx_graph_stats_t st;
+    fixed_t image[2 * 4 * 4], logits[2], arena[64];
+    for (int i = 0; i < 32; i++) {
+        image[i] = (fixed_t)(i << 12);
+    }
+    (void)fx_graph_init(&g);
+    (void)fx_graph_input(&g, 1, 2, 4, 4, FX_LAYOUT_NCHW, &x);
+    (void)fx_graph_maxpool_2x2(&g, x, &p);
+    (void)fx_graph_global_avgpool(&g, p, &y);
+    (void)fx_graph_output(&g, y);
+    TEST_ASSERT(fx_graph_plan(&g, &st) == FX_GRAPH_OK && st.arena_len <= 64, "Graph planned");
+    (void)fx_graph_bind(&g, x, image);
+    (void)fx_graph_bind(&g, y, logits);
+
+    ring_reset();
+    fx_matrix_mul(&A, &B, &C);
+    const fx_graph_res_t res = fx_graph_run(&g, arena, 64);
+    fx_trace_attach(NULL);
+    TEST_ASSERT(res == FX_GRAPH_OK, "Graph ran");
+    TEST_ASSERT(fx_trace_layer() == FX_TRACE_NO_LAYER, "Layer reset after the graph");
+
+    if (!fx_trace_hooks_compiled()) {
+        TEST_ASSERT(fx_trace_count(&g_ring) == 0, "No kernel events without CI_TRACE");
+        return;
+    }
+
+    /* matmul, layer 0, 2 × maxpool, layer 1, global_avgpool */
+    const size_t n = fx_trace_count(&g_ring);
+    const fx_trace_event_t* e[6] = { 0 };
+    for (size_t i = 0; i < n && i < 6; i++) {
+        e[i] = fx_trace_event_at(&g_ring, i);
+    }
+    TEST_ASSERT(n == 6, "Six events: matmul, two layers and their kernels");
+    if (n != 6) {
+        return;
+    }
+    TEST_ASSERT(e[0]->kernel == FX_TRACE_MATMUL && e[0]->dims[0] == 6 && e[0]->dims[1] == 4 &&
+                e[0]->dims[2] == 5 && e[0]->layer == FX_TRACE_NO_LAYER && e[0]->end != 0,
+                "Matmul event with M, N, K outside any layer");
+    TEST_ASSERT(e[0]->backend == (uint8_t)fx_dispatch_active(), "Matmul records the active backend");
+    TEST_ASSERT(e[1]->kernel == FX_TRACE_LAYER && e[1]->layer == 0 && e[1]->dims[0] == 2 &&
+                e[1]->dims[1] == 2 && e[1]->dims[2] == 2, "Layer 0 span with output C, H, W");
+    TEST_ASSERT(e[2]->kernel == FX_TRACE_MAXPOOL_2X2 && e[3]->kernel == FX_TRACE_MAXPOOL_2X2 &&
+                e[2]->parent == 2 && e[3]->parent == 2 && e[2]->layer == 0 &&
+                e[2]->dims[0] == 4 && e[2]->dims[1] == 4, "Per-plane maxpool inside layer 0");
+    TEST_ASSERT(e[4]->kernel == FX_TRACE_LAYER && e[4]->layer == 1 &&
+                e[5]->kernel == FX_TRACE_GLOBAL_AVGPOOL && e[5]->parent == 5 && e[5]->layer == 1 &&
+                e[5]->dims[0] == 1 && e[5]->dims[1] == 2 && e[5]->dims[2] == 4,
+                "Global average pool inside layer 1");
+    TEST_ASSERT(e[1]->nested == (e[2]->end - e[2]->begin) + (e[3]->end - e[3]->begin),
+                "Layer nested ticks are its kernels' durations");
+
+    (void)fx_trace_export_folded(&g_ring, g_text, sizeof(g_text));
+    TEST_ASSERT(strstr(g_text, "matmul ") == g_text && strstr(g_text, "\nlayer 0;maxpool_2x2 ") &&
+                strstr(g_text, "\nlayer 1;global_avgpool "), "Folded stacks grouped by layer");
+}
+
+/**
+ * @test Hook in the kernels generated by FX_QGEMM_DEFINE
+ * @traceability SRS-007.12, SRS-012
+ */
+static void test_qgemm_hook(void) {
+    printf("\nTest: Q-format GEMM hook\n");
+    printf("────────────────────────\n");
+
+    fx_q16_16_t a[3 * 2] = { 1 << 16, 2 << 16, 3 << 16, 4 << 16, 5 << 16, 6 << 16 };
+    fx_q1_15_t b[2 * 4] = { 1 << 14, -(1 << 14), 1 << 13, 0, 0, 1 << 12, -(1 << 13), 1 << 14 };
+    fx_q16_16_t c[3 * 4];
+
+    ring_reset();
+    fx_matrix_mul_q16_16_q1_15(a, b, c, 3, 2, 4);
+    fx_trace_attach(NULL);
+
+    if (!fx_trace_hooks_compiled()) {
+        TEST_ASSERT(fx_trace_count(&g_ring) == 0, "No Q-format events without CI_TRACE");
+        return;
+    }
+
+    const fx_trace_event_t* e = fx_trace_event_at(&g_ring, 0);
+    TEST_ASSERT(fx_trace_count(&g_ring) == 1, "One event per Q-format matmul");
+    TEST_ASSERT(e && e->kernel == FX_TRACE_QGEMM && e->dims[0] == 3 && e->dims[1] == 4 &&
+                e->dims[2] == 2 && e->end != 0, "QGEMM event with M, N, K");
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════\n");
+    printf("  SRS-007.12 Kernel Trace Verification Suite\n");
+    printf("═══════════════════════════════════════════\n");
+    printf("\n");
+
+    test_ring_init();
+    test_nesting();
+    test_wrap();
+    test_export();
+    test_kernel_hooks();
+    test_qgemm_hook();
+
+    printf("\n");
+    printf("═══════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-007.12 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-007.12 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════\n");
+    printf("\n");
+    printf("Requirements validated:\n");
+    printf("  • SRS-007.12: Per-kernel events in a caller-owned ring\n");
+    printf("  • SRS-007.12: Nesting, layer IDs and backend per event\n");
+    printf("  • SRS-007.12: Chrome trace and folded-stack exports\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,524 @@
+/**
+ * @file test_view.c
+ * @project Certifiable Inference Engine
+ * @brief Unit tests for strided N-D views.
+ *
+ * @details Test suite verifying:
+ * - Dense, pitched, matrix and tensor (NCHW / NHWC) construction
+ * - ROI crops, channel selects and padded interiors as views of one buffer
+ * - Copy, fill and op chains on strided views
+ * - Matmul, convolution and max pooling on views bit-identical to the
+ *   matrix functions on copies of the regions
+ * - Planes beyond 16-bit offsets (1920×1080, 70000-wide rows)
+ * - Rejection of invalid, out-of-range and mismatched arguments
+ *
+ * @traceability SRS-016
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "view.h"
+#include "convolution.h"
+#include "pooling.h"
+#include "fixed_point.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+#define HD_ROWS 1080
+#define HD_COLS 1920
+#define WIDE_COLS 70000
+
+static fixed_t g_big[HD_ROWS * HD_COLS];
+static fixed_t g_pool[(HD_ROWS / 2) * (HD_COLS / 2)];
+
+static uint32_t g_lcg = 0x51DEu;
+
+/**
+ * @brief Signed pseudo-random values of at most @p bits magnitude.
+ */
+static void fill_random(fixed_t* buf, size_t n, unsigned bits) {
+    for (size_t i = 0; i < n; i++) {
+        g_lcg = g_lcg * 1664525u + 1013904223u;
+        const uint32_t r = g_lcg >> (32u - bits);
+        buf[i] = (fixed_t)((int64_t)r - ((int64_t)1 << (bits - 1u)));
+    }
+}
+
+/**
+ * @brief Copy a rank-2 view into a dense buffer.
+ */
+static void gather(const fx_view_t* v, fixed_t* dense) {
+    fx_view_t d;
+    (void)fx_view_init_2d(&d, dense, v->shape[0], v->shape[1], v->shape[1]);
+    (void)fx_view_copy(&d, v);
+}
+
+/**
+ * @test Strides of the constructors
+ * @traceability SRS-016.1
+ */
+static void test_construction(void) {
+    printf("\nTest: Construction\n");
+    printf("──────────────────\n");
+
+    fixed_t buf[2 * 3 * 4 * 5];
+    fx_view_t v;
+    const uint32_t shape[4] = { 2, 3, 4, 5 };
+
+    TEST_ASSERT(fx_view_init(&v, buf, 4, shape) == FX_VIEW_OK, "Rank-4 view accepted");
+    TEST_ASSERT(v.stride[0] == 60 && v.stride[1] == 20 && v.stride[2] == 5 && v.stride[3] == 1,
+                "Dense row-major strides");
+    TEST_ASSERT(fx_view_size(&v) == 120 && fx_view_is_contiguous(&v), "Size and contiguity");
+
+    const uint32_t idx[4] = { 1, 2, 3, 4 };
+    TEST_ASSERT(fx_view_at(&v, idx) == &buf[119], "Last element addressed");
+
+    TEST_ASSERT(fx_view_init_2d(&v, buf, 4, 5, 8) == FX_VIEW_OK && v.stride[0] == 8 &&
+                v.stride[1] == 1, "Pitched 2D view");
+    TEST_ASSERT(!fx_view_is_contiguous(&v), "Padded rows are not contiguous");
+    TEST_ASSERT(fx_view_init_2d(&v, buf, 4, 5, 4) == FX_VIEW_INVALID_PARAM, "Pitch below width rejected");
+
+    fx_matrix_t m;
+    fx_matrix_attach(&m, buf, 6, 7);
+    TEST_ASSERT(fx_view_from_matrix(&v, &m) == FX_VIEW_OK && v.rank == 2 && v.shape[0] == 6 &&
+                v.shape[1] == 7 && v.stride[0] == 7 && fx_view_is_contiguous(&v),
+                "Matrix lifted to a contiguous rank-2 view");
+}
+
+/**
+ * @test ROI crop and select address the parent storage
+ * @traceability SRS-016.2
+ */
+static void test_slicing(void) {
+    printf("\nTest: ROI crop and select\n");
+    printf("─────────────────────────\n");
+
+    fixed_t img[8 * 10];
+    for (int i = 0; i < 80; i++) {
+        img[i] = i;
+    }
+
+    fx_view_t v, roi, row, col;
+    (void)fx_view_init_2d(&v, img, 8, 10, 10);
+
+    TEST_ASSERT(fx_view_slice(&roi, &v, 0, 2, 4) == FX_VIEW_OK &&
+                fx_view_slice(&roi, &roi, 1, 3, 5) == FX_VIEW_OK, "4×5 crop at (2, 3)");
+
+    bool ok = roi.shape[0] == 4 && roi.shape[1] == 5 && roi.data == &img[23];
+    for (uint32_t y = 0; y < 4; y++) {
+        for (uint32_t x = 0; x < 5; x++) {
+            const uint32_t idx[2] = { y, x };
+            ok = ok && *fx_view_at(&roi, idx) == (fixed_t)((y + 2) * 10 + x + 3);
+        }
+    }
+    TEST_ASSERT(ok, "Crop elements address the image");
+
+    TEST_ASSERT(fx_view_select(&row, &roi, 0, 1) == FX_VIEW_OK && row.rank == 1 &&
+                row.shape[0] == 5 && row.data[0] == 33, "Row select");
+    TEST_ASSERT(fx_view_select(&col, &roi, 1, 4) == FX_VIEW_OK && col.rank == 1 &&
+                col.shape[0] == 4 && col.stride[0] == 10 && col.data[0] == 27, "Column select");
+
+    fx_view_t before = roi;
+    TEST_ASSERT(fx_view_slice(&roi, &v, 1, 8, 3) == FX_VIEW_OUT_OF_RANGE, "Slice past the edge rejected");
+    TEST_ASSERT(fx_view_select(&roi, &v, 0, 8) == FX_VIEW_OUT_OF_RANGE, "Select past the edge rejected");
+    TEST_ASSERT(memcmp(&roi, &before, sizeof(roi)) == 0, "View unchanged on error");
+    TEST_ASSERT(fx_view_slice(&roi, &v, 0, 0xFFFFFFFFu, 2) == FX_VIEW_OUT_OF_RANGE,
+                "Start + len overflow rejected");
+    TEST_ASSERT(fx_view_select(&roi, &row, 0, 0) == FX_VIEW_INVALID_PARAM, "Select on rank 1 rejected");
+    TEST_ASSERT(fx_view_slice(&roi, &v, 2, 0, 1) == FX_VIEW_INVALID_PARAM, "Dimension past rank rejected");
+}
+
+/**
+ * @test One channel of NCHW and NHWC tensors of the same content
+ * @traceability SRS-016.1, SRS-016.2
+ */
+static void test_tensor_channel(void) {
+    printf("\nTest: Tensor channel select\n");
+    printf("───────────────────────────\n");
+
+    enum { N = 2, C = 3, H = 5, W = 7 };
+    static fixed_t nchw[N * C * H * W], nhwc[N * C * H * W];
+    fx_tensor_t tc, tl;
+    fx_tensor_attach(&tc, nchw, N, C, H, W, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&tl, nhwc, N, C, H, W, FX_LAYOUT_NHWC);
+
+    for (size_t n = 0; n < N; n++) {
+        for (size_t c = 0; c < C; c++) {
+            for (size_t h = 0; h < H; h++) {
+                for (size_t w = 0; w < W; w++) {
+                    const fixed_t x = (fixed_t)(((n * C + c) * H + h) * W + w) * 3;
+                    nchw[fx_tensor_offset(&tc, n, c, h, w)] = x;
+                    nhwc[fx_tensor_offset(&tl, n, c, h, w)] = x;
+                }
+            }
+        }
+    }
+
+    fx_view_t vc, vl, pc, pl;
+    TEST_ASSERT(fx_view_from_tensor(&vc, &tc) == FX_VIEW_OK && fx_view_is_contiguous(&vc),
+                "NCHW view contiguous");
+    TEST_ASSERT(fx_view_from_tensor(&vl, &tl) == FX_VIEW_OK && !fx_view_is_contiguous(&vl) &&
+                vl.stride[1] == 1, "NHWC view strided in N, C, H, W order");
+
+    /* Image 1, channel 2 as an H×W plane */
+    (void)fx_view_select(&pc, &vc, 0, 1);
+    (void)fx_view_select(&pc, &pc, 0, 2);
+    (void)fx_view_select(&pl, &vl, 0, 1);
+    (void)fx_view_select(&pl, &pl, 0, 2);
+
+    fixed_t a[H * W], b[H * W];
+    gather(&pc, a);
+    gather(&pl, b);
+    TEST_ASSERT(pc.rank == 2 && pl.rank == 2 && pl.stride[1] == C, "Planes are rank 2");
+    TEST_ASSERT(memcmp(a, b, sizeof(a)) == 0 && a[0] == (fixed_t)((1 * C + 2) * H * W) * 3,
+                "Same plane from both layouts");
+}
+
+/**
+ * @test Padded border: fill the frame, copy into the interior view
+ * @traceability SRS-016.2, SRS-016.3
+ */
+static void test_padded_border(void) {
+    printf("\nTest: Padded border\n");
+    printf("───────────────────\n");
+
+    enum { H = 6, W = 9, P = 2 };
+    fixed_t src[H * W];
+    fixed_t frame[(H + 2 * P) * (W + 2 * P)];
+    fill_random(src, H * W, 20);
+
+    fx_view_t s, f, inner;
+    (void)fx_view_init_2d(&s, src, H, W, W);
+    (void)fx_view_init_2d(&f, frame, H + 2 * P, W + 2 * P, W + 2 * P);
+    (void)fx_view_slice(&inner, &f, 0, P, H);
+    (void)fx_view_slice(&inner, &inner, 1, P, W);
+
+    TEST_ASSERT(fx_view_fill(&f, -FIXED_ONE) == FX_VIEW_OK, "Frame filled");
+    TEST_ASSERT(fx_view_copy(&inner, &s) == FX_VIEW_OK, "Interior written through the view");
+
+    bool ok = true;
+    for (int y = 0; y < H + 2 * P; y++) {
+        for (int x = 0; x < W + 2 * P; x++) {
+            const bool in = y >= P && y < H + P && x >= P && x < W + P;
+            const fixed_t want = in ? src[(y - P) * W + (x - P)] : -FIXED_ONE;
+            ok = ok && frame[y * (W + 2 * P) + x] == want;
+        }
+    }
+    TEST_ASSERT(ok, "Border kept, interior equals source");
+
+    fx_view_t small;
+    (void)fx_view_init_2d(&small, src, H, W - 1, W);
+    TEST_ASSERT(fx_view_copy(&inner, &small) == FX_VIEW_DIM_MISMATCH, "Shape mismatch rejected");
+}
+
+/**
+ * @test Op chain on a column (inner stride ≠ 1) longer than one block
+ * @traceability SRS-016.3
+ */
+static void test_apply_ops(void) {
+    printf("\nTest: Op chain on strided views\n");
+    printf("───────────────────────────────\n");
+
+    enum { ROWS = 2 * FX_EW_BLOCK + 37, COLS = 3 };
+    static fixed_t buf[ROWS * COLS], orig[ROWS * COLS], col[ROWS], want[ROWS];
+    fill_random(buf, ROWS * COLS, 22);
+    memcpy(orig, buf, sizeof(buf));
+
+    const fx_ew_op_t ops[] = {
+        FX_EW_OP_SCALE(FIXED_ONE + FIXED_HALF),
+        FX_EW_OP_ADD(FIXED_ONE / 3),
+        FX_EW_OP_ACT(FX_ACT_LEAKY_RELU, FIXED_ONE / 8),
+        FX_EW_OP_CLAMP(-4 * FIXED_ONE, 4 * FIXED_ONE),
+    };
+
+    for (int r = 0; r < ROWS; r++) {
+        col[r] = buf[r * COLS + 1];
+    }
+    (void)fx_ew_apply_ref(col, want, ROWS, ops, 4);
+
+    fx_view_t v, c;
+    (void)fx_view_init_2d(&v, buf, ROWS, COLS, COLS);
+    (void)fx_view_select(&c, &v, 1, 1);
+    TEST_ASSERT(fx_view_apply_ops(&c, ops, 4) == FX_VIEW_OK, "Chain applied to column");
+
+    bool ok = true, rest = true;
+    for (int r = 0; r < ROWS; r++) {
+        ok = ok && buf[r * COLS + 1] == want[r];
+        rest = rest && buf[r * COLS] == orig[r * COLS] && buf[r * COLS + 2] == orig[r * COLS + 2];
+    }
+    TEST_ASSERT(ok, "Column matches the reference chain");
+    TEST_ASSERT(rest, "Other columns untouched");
+
+    /* Dense rows of a crop go through the engine row by row */
+    fx_view_t roi;
+    memcpy(buf, orig, sizeof(buf));
+    (void)fx_view_slice(&roi, &v, 0, 5, 100);
+    (void)fx_view_slice(&roi, &roi, 1, 1, 2);
+    TEST_ASSERT(fx_view_apply_ops(&roi, ops, 4) == FX_VIEW_OK, "Chain applied to crop");
+    ok = true;
+    for (int r = 0; r < ROWS; r++) {
+        fixed_t w[2];
+        (void)fx_ew_apply_ref(&orig[r * COLS + 1], w, 2, ops, 4);
+        const bool in = r >= 5 && r < 105;
+        ok = ok && buf[r * COLS] == orig[r * COLS] &&
+             buf[r * COLS + 1] == (in ? w[0] : orig[r * COLS + 1]) &&
+             buf[r * COLS + 2] == (in ? w[1] : orig[r * COLS + 2]);
+    }
+    TEST_ASSERT(ok, "Crop matches the reference, outside untouched");
+
+    const fx_ew_op_t bad[] = { FX_EW_OP_CLAMP(FIXED_ONE, 0) };
+    memcpy(buf, orig, sizeof(buf));
+    TEST_ASSERT(fx_view_apply_ops(&c, bad, 1) == FX_VIEW_INVALID_PARAM, "Invalid chain rejected");
+    TEST_ASSERT(memcmp(buf, orig, sizeof(buf)) == 0, "Data untouched on error");
+}
+
+/**
+ * @test Matmul on sub-views and a transposed view
+ * @traceability SRS-016.4
+ */
+static void test_matmul(void) {
+    printf("\nTest: Matmul on views\n");
+    printf("─────────────────────\n");
+
+    enum { M = 13, K = 21, N = 9, PITCH = 40 };
+    static fixed_t a_buf[30 * PITCH], b_buf[30 * PITCH], c_buf[30 * PITCH];
+    fixed_t a[M * K], b[K * N], c_ref[M * N], c[M * N];
+    fill_random(a_buf, sizeof(a_buf) / sizeof(a_buf[0]), 20);
+    fill_random(b_buf, sizeof(b_buf) / sizeof(b_buf[0]), 20);
+    memset(c_buf, 0, sizeof(c_buf));
+
+    fx_view_t va, vb, vc;
+    (void)fx_view_init_2d(&va, a_buf + 3 * PITCH + 5, M, K, PITCH);
+    (void)fx_view_init_2d(&vb, b_buf + 2 * PITCH + 7, K, N, PITCH);
+    (void)fx_view_init_2d(&vc, c_buf + 1 * PITCH + 11, M, N, PITCH);
+
+    gather(&va, a);
+    gather(&vb, b);
+    fx_matrix_t ma, mb, mc;
+    fx_matrix_attach(&ma, a, M, K);
+    fx_matrix_attach(&mb, b, K, N);
+    fx_matrix_attach(&mc, c_ref, M, N);
+    fx_matrix_mul(&ma, &mb, &mc);
+
+    TEST_ASSERT(fx_view_matmul(&va, &vb, &vc) == FX_VIEW_OK, "Pitched operands accepted");
+    gather(&vc, c);
+    TEST_ASSERT(memcmp(c, c_ref, sizeof(c)) == 0, "Pitched result matches fx_matrix_mul");
+    TEST_ASSERT(c_buf[1 * PITCH + 10] == 0 && c_buf[1 * PITCH + 11 + N] == 0, "Outside of C untouched");
+
+    /* Bᵀ stored N×K, read as K×N with swapped strides (scalar path) */
+    fixed_t bt[N * K];
+    for (int k = 0; k < K; k++) {
+        for (int j = 0; j < N; j++) {
+            bt[j * K + k] = b[k * N + j];
+        }
+    }
+    fx_view_t vbt = { bt, 2, { K, N }, { 1, K } };
+    memset(c_buf, 0, sizeof(c_buf));
+    TEST_ASSERT(fx_view_matmul(&va, &vbt, &vc) == FX_VIEW_OK, "Transposed operand accepted");
+    gather(&vc, c);
+    TEST_ASSERT(memcmp(c, c_ref, sizeof(c)) == 0, "Transposed result matches fx_matrix_mul");
+
+    fx_view_t wrong;
+    (void)fx_view_init_2d(&wrong, c_buf, M, N + 1, PITCH);
+    TEST_ASSERT(fx_view_matmul(&va, &vb, &wrong) == FX_VIEW_DIM_MISMATCH, "Output shape mismatch rejected");
+    TEST_ASSERT(fx_view_matmul(&va, &va, &vc) == FX_VIEW_DIM_MISMATCH, "Inner dimension mismatch rejected");
+    fx_view_t row;
+    (void)fx_view_select(&row, &va, 0, 0);
+    TEST_ASSERT(fx_view_matmul(&row, &vb, &vc) == FX_VIEW_INVALID_PARAM, "Rank 1 rejected");
+}
+
+/**
+ * @test Convolution and max pooling on crops versus copies
+ * @traceability SRS-016.4
+ */
+static void test_conv_pool(void) {
+    printf("\nTest: Convolution and pooling on views\n");
+    printf("──────────────────────────────────────\n");
+
+    enum { IH = 20, IW = 26, KH = 3, KW = 5, PITCH = 48 };
+    static fixed_t img[40 * PITCH];
+    fixed_t in[IH * IW], ker[KH * KW];
+    fixed_t out_ref[(IH - KH + 1) * (IW - KW + 1)], out_buf[(IH - KH + 1) * 64];
+    fixed_t out[(IH - KH + 1) * (IW - KW + 1)];
+    fill_random(img, sizeof(img) / sizeof(img[0]), 20);
+    fill_random(ker, KH * KW, 17);
+
+    fx_view_t vi, vk, vo;
+    (void)fx_view_init_2d(&vi, img + 7 * PITCH + 9, IH, IW, PITCH);
+    (void)fx_view_init_2d(&vk, ker, KH, KW, KW);
+    (void)fx_view_init_2d(&vo, out_buf, IH - KH + 1, IW - KW + 1, 64);
+    gather(&vi, in);
+
+    fx_matrix_t mi, mk, mo;
+    fx_matrix_attach(&mi, in, IH, IW);
+    fx_matrix_attach(&mk, ker, KH, KW);
+    fx_matrix_attach(&mo, out_ref, IH - KH + 1, IW - KW + 1);
+    fx_conv2d(&mi, &mk, &mo);
+
+    TEST_ASSERT(fx_view_conv2d(&vi, &vk, &vo) == FX_VIEW_OK, "Convolution on a crop");
+    gather(&vo, out);
+    TEST_ASSERT(memcmp(out, out_ref, sizeof(out)) == 0, "Crop convolution matches fx_conv2d");
+
+    fx_view_t dense_in, dense_out;
+    (void)fx_view_init_2d(&dense_in, in, IH, IW, IW);
+    (void)fx_view_init_2d(&dense_out, out, IH - KH + 1, IW - KW + 1, IW - KW + 1);
+    memset(out, 0, sizeof(out));
+    TEST_ASSERT(fx_view_conv2d(&dense_in, &vk, &dense_out) == FX_VIEW_OK &&
+                memcmp(out, out_ref, sizeof(out)) == 0, "Whole-matrix convolution matches");
+
+    TEST_ASSERT(fx_view_conv2d(&vi, &vk, &vi) == FX_VIEW_DIM_MISMATCH, "Convolution output shape checked");
+
+    fixed_t pin[IH * IW], pref[(IH / 2) * (IW / 2)], pout[(IH / 2) * (IW / 2)];
+    fixed_t pbuf[(IH / 2) * 32];
+    fx_view_t vp;
+    (void)fx_view_init_2d(&vp, pbuf, IH / 2, IW / 2, 32);
+    memcpy(pin, in, sizeof(pin));
+    fx_matrix_attach(&mi, pin, IH, IW);
+    fx_matrix_attach(&mo, pref, IH / 2, IW / 2);
+    fx_maxpool_2x2(&mi, &mo);
+
+    TEST_ASSERT(fx_view_maxpool_2x2(&vi, &vp) == FX_VIEW_OK, "Max pooling on a crop");
+    gather(&vp, pout);
+    TEST_ASSERT(memcmp(pout, pref, sizeof(pout)) == 0, "Crop pooling matches fx_maxpool_2x2");
+
+    fx_view_t odd;
+    (void)fx_view_slice(&odd, &vi, 1, 0, IW - 1);
+    TEST_ASSERT(fx_view_maxpool_2x2(&odd, &vp) == FX_VIEW_DIM_MISMATCH, "Odd extent rejected");
+}
+
+/**
+ * @test Planes whose offsets exceed 16 bits
+ * @traceability SRS-016.1, SRS-016.4
+ */
+static void test_large_planes(void) {
+    printf("\nTest: Planes beyond 16-bit offsets\n");
+    printf("──────────────────────────────────\n");
+
+    fill_random(g_big, HD_ROWS * HD_COLS, 24);
+
+    fx_view_t in, out;
+    (void)fx_view_init_2d(&in, g_big, HD_ROWS, HD_COLS, HD_COLS);
+    (void)fx_view_init_2d(&out, g_pool, HD_ROWS / 2, HD_COLS / 2, HD_COLS / 2);
+    TEST_ASSERT(fx_view_maxpool_2x2(&in, &out) == FX_VIEW_OK, "1920×1080 pooling accepted");
+
+    bool ok = true;
+    for (size_t y = 0; y < HD_ROWS / 2; y++) {
+        for (size_t x = 0; x < HD_COLS / 2; x++) {
+            const fixed_t* p = &g_big[2 * y * HD_COLS + 2 * x];
+            fixed_t m = p[0];
+            m = p[1] > m ? p[1] : m;
+            m = p[HD_COLS] > m ? p[HD_COLS] : m;
+            m = p[HD_COLS + 1] > m ? p[HD_COLS + 1] : m;
+            ok = ok && g_pool[y * (HD_COLS / 2) + x] == m;
+        }
+    }
+    TEST_ASSERT(ok, "1920×1080 pooling matches the 2×2 maxima");
+
+    /* 2 × 70000 does not fit fx_matrix_t; the view takes the strided loop */
+    fx_view_t wide, half;
+    (void)fx_view_init_2d(&wide, g_big, 2, WIDE_COLS, WIDE_COLS);
+    (void)fx_view_init_2d(&half, g_pool, 1, WIDE_COLS / 2, WIDE_COLS / 2);
+    TEST_ASSERT(fx_view_maxpool_2x2(&wide, &half) == FX_VIEW_OK, "70000-wide pooling accepted");
+    ok = true;
+    for (size_t x = 0; x < WIDE_COLS / 2; x++) {
+        const fixed_t* p = &g_big[2 * x];
+        fixed_t m = p[0];
+        m = p[1] > m ? p[1] : m;
+        m = p[WIDE_COLS] > m ? p[WIDE_COLS] : m;
+        m = p[WIDE_COLS + 1] > m ? p[WIDE_COLS + 1] : m;
+        ok = ok && g_pool[x] == m;
+    }
+    TEST_ASSERT(ok, "70000-wide pooling matches the 2×2 maxima");
+
+    const fx_ew_op_t ops[] = { FX_EW_OP_ADD(FIXED_ONE) };
+    fx_view_t row;
+    (void)fx_view_select(&row, &wide, 0, 1);
+    const fixed_t last = g_big[2 * WIDE_COLS - 1];
+    TEST_ASSERT(fx_view_apply_ops(&row, ops, 1) == FX_VIEW_OK &&
+                g_big[2 * WIDE_COLS - 1] == last + FIXED_ONE, "Last element of a 70000-wide row reached");
+}
+
+/**
+ * @test NULL and malformed views
+ * @traceability SRS-016.1
+ */
+static void test_invalid(void) {
+    printf("\nTest: Invalid parameters\n");
+    printf("────────────────────────\n");
+
+    fixed_t buf[16];
+    fx_view_t v;
+    const uint32_t shape[5] = { 1, 1, 1, 1, 1 };
+
+    TEST_ASSERT(fx_view_init(&v, buf, 0, shape) == FX_VIEW_INVALID_PARAM, "Rank 0 rejected");
+    TEST_ASSERT(fx_view_init(&v, buf, 5, shape) == FX_VIEW_INVALID_PARAM, "Rank 5 rejected");
+    TEST_ASSERT(fx_view_init(&v, NULL, 2, shape) == FX_VIEW_INVALID_PARAM, "NULL data rejected");
+    TEST_ASSERT(fx_view_init(NULL, buf, 2, shape) == FX_VIEW_INVALID_PARAM, "NULL view rejected");
+    TEST_ASSERT(fx_view_from_matrix(&v, NULL) == FX_VIEW_INVALID_PARAM, "NULL matrix rejected");
+    TEST_ASSERT(fx_view_from_tensor(&v, NULL) == FX_VIEW_INVALID_PARAM, "NULL tensor rejected");
+    TEST_ASSERT(fx_view_copy(NULL, &v) == FX_VIEW_INVALID_PARAM, "NULL copy target rejected");
+    TEST_ASSERT(fx_view_fill(NULL, 0) == FX_VIEW_INVALID_PARAM, "NULL fill target rejected");
+    TEST_ASSERT(!fx_view_is_contiguous(NULL), "NULL view not contiguous");
+
+    fx_view_t bad = { buf, 7, { 1, 1, 1, 1 }, { 1, 1, 1, 1 } };
+    TEST_ASSERT(fx_view_fill(&bad, 0) == FX_VIEW_INVALID_PARAM, "Corrupt rank rejected");
+
+    const uint32_t empty[2] = { 0, 4 };
+    TEST_ASSERT(fx_view_init(&v, buf, 2, empty) == FX_VIEW_OK && fx_view_size(&v) == 0 &&
+                fx_view_fill(&v, 1) == FX_VIEW_OK, "Empty view accepted");
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════\n");
+    printf("  SRS-016 Strided View Verification Suite\n");
+    printf("═══════════════════════════════════════════\n");
+    printf("\n");
+
+    test_construction();
+    test_slicing();
+    test_tensor_channel();
+    test_padded_border();
+    test_apply_ops();
+    test_matmul();
+    test_conv_pool();
+    test_large_planes();
+    test_invalid();
+
+    printf("\n");
+    printf("═══════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-016 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-016 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════\n");
+    printf("\n");
+    printf("Requirements validated:\n");
+    printf("  • SRS-016.1: Wide dimensions and explicit strides\n");
+    printf("  • SRS-016.2: Slices and selects without copies\n");
+    printf("  • SRS-016.3: Copy, fill and op chains on views\n");
+    printf("  • SRS-016.4: Layer primitives bit-identical to the matrix API\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
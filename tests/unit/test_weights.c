@@ -0,0 +1,497 @@
+/**
+ * @file test_weights.c
+ * @project Certifiable Inference Engine
+ * @brief Verification of the binary weight container.
+ *
+ * @details Images are built in memory for the validation cases. When the
+ * build packs tests/unit/weights_pack.json with tools/pack_weights.py
+ * (CI_WEIGHTS_FILE), that file is also opened, so the Python writer and
+ * the C reader are checked against each other.
+ *
+ * @traceability SRS-010
+ * @compliance DO-178C, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "weights.h"
+#include "convolution.h"
+#include "fixed_point.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Image storage, 8-byte aligned */
+static uint64_t g_words[256];
+static uint8_t* const g_image = (uint8_t*)g_words;
+static size_t g_image_len;
+
+#define ALIGNMENT   64u
+#define DATA_OFFSET 320u     /* 64 + 3 × 72 = 280, aligned up */
+
+/* Deterministic pseudo-random Q16.16 values */
+static uint32_t g_lcg_state = 0x3C6EF372u;
+static fixed_t lcg_fixed(void) {
+    g_lcg_state = g_lcg_state * 1664525u + 1013904223u;
+    return (fixed_t)(int32_t)(g_lcg_state >> 12) - (fixed_t)(1 << 19);
+}
+
+static fx_weights_header_t* image_header(void) {
+    return (fx_weights_header_t*)g_image;
+}
+
+static fx_weights_entry_t* image_entry(uint32_t i) {
+    return (fx_weights_entry_t*)(g_image + sizeof(fx_weights_header_t)) + i;
+}
+
+static void set_entry(uint32_t i, const char* name, uint8_t rank, const uint32_t* dims, uint64_t offset) {
+    fx_weights_entry_t* e = image_entry(i);
+    uint64_t count = 1;
+
+    memset(e, 0, sizeof(*e));
+    strncpy(e->name, name, FX_WEIGHTS_NAME_LEN - 1);
+    e->dtype = FX_WEIGHTS_DTYPE_I32;
+    e->frac_bits = FIXED_SHIFT;
+    e->rank = rank;
+    for (uint8_t d = 0; d < FX_WEIGHTS_MAX_RANK; d++) {
+        e->dims[d] = (d < rank) ? dims[d] : 1u;
+        count *= e->dims[d];
+    }
+    e->offset = offset;
+    e->count = count;
+}
+
+static void reseal(void) {
+    image_header()->checksum = fx_weights_crc32(0, g_image + 8, g_image_len - 8);
+}
+
+/**
+ * @brief Container with conv filters (2×1×3×3), a bias (2) and a dense
+ *        matrix (3×2), random payloads.
+ */
+static void build_image(void) {
+    static const uint32_t conv_dims[4] = { 2, 1, 3, 3 };
+    static const uint32_t bias_dims[1] = { 2 };
+    static const uint32_t fc_dims[2] = { 3, 2 };
+    fx_weights_header_t* h = image_header();
+
+    memset(g_words, 0, sizeof(g_words));
+    memcpy(h->magic, "CIEW", 4);
+    h->version_major = FX_WEIGHTS_VERSION_MAJOR;
+    h->version_minor = FX_WEIGHTS_VERSION_MINOR;
+    h->byte_order = FX_WEIGHTS_BYTE_ORDER;
+    h->header_size = sizeof(fx_weights_header_t);
+    h->entry_size = sizeof(fx_weights_entry_t);
+    h->tensor_count = 3;
+    h->alignment = ALIGNMENT;
+    h->table_offset = sizeof(fx_weights_header_t);
+    h->data_offset = DATA_OFFSET;
+
+    set_entry(0, "conv1.weight", 4, conv_dims, DATA_OFFSET);
+    set_entry(1, "conv1.bias", 1, bias_dims, DATA_OFFSET + 128);
+    set_entry(2, "fc.weight", 2, fc_dims, DATA_OFFSET + 192);
+    g_image_len = DATA_OFFSET + 256;
+    h->file_size = g_image_len;
+
+    fixed_t* payload = (fixed_t*)(g_image + DATA_OFFSET);
+    for (size_t i = 0; i < (g_image_len - DATA_OFFSET) / sizeof(fixed_t); i++) {
+        payload[i] = lcg_fixed();
+    }
+    reseal();
+}
+
+/**
+ * @test CRC-32 check value and chaining
+ * @traceability SRS-010.3
+ */
+static void test_crc32(void) {
+    printf("\nTest: CRC-32\n");
+    printf("────────────\n");
+
+    const char* check = "123456789";
+    const uint32_t whole = fx_weights_crc32(0, check, 9);
+    const uint32_t chained = fx_weights_crc32(fx_weights_crc32(0, check, 4), check + 4, 5);
+
+    TEST_ASSERT(whole == 0xCBF43926u, "Standard check value 0xCBF43926");
+    TEST_ASSERT(chained == whole, "Chained calls equal one call");
+    TEST_ASSERT(fx_weights_crc32(0, check, 0) == 0, "Empty input gives 0");
+}
+
+/**
+ * @test Open a valid image and attach views into it
+ * @traceability SRS-010.1, SRS-010.4
+ */
+static void test_open_and_attach(void) {
+    printf("\nTest: Open and zero-copy attach\n");
+    printf("───────────────────────────────\n");
+
+    fx_weights_t wf;
+    fx_matrix_t fc, bias;
+    fx_tensor_t conv;
+
+    build_image();
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, FX_WEIGHTS_VERIFY) == FX_WEIGHTS_OK,
+                "Valid image opens with CRC verification");
+    TEST_ASSERT(wf.count == 3, "Three tensors");
+
+    TEST_ASSERT(fx_weights_attach_tensor(&wf, "conv1.weight", &conv) == FX_WEIGHTS_OK &&
+                conv.n == 2 && conv.c == 1 && conv.h == 3 && conv.w == 3 &&
+                conv.layout == FX_LAYOUT_NCHW,
+                "Rank-4 filters attach as 2×1×3×3 NCHW");
+    TEST_ASSERT((const uint8_t*)conv.data == g_image + DATA_OFFSET,
+                "Tensor data points into the image (no copy)");
+
+    TEST_ASSERT(fx_weights_attach_matrix(&wf, "fc.weight", &fc) == FX_WEIGHTS_OK &&
+                fc.rows == 3 && fc.cols == 2 &&
+                (const uint8_t*)fc.data == g_image + DATA_OFFSET + 192,
+                "Rank-2 tensor attaches as 3×2 matrix in place");
+    TEST_ASSERT(fx_weights_attach_matrix(&wf, "conv1.bias", &bias) == FX_WEIGHTS_OK &&
+                bias.rows == 1 && bias.cols == 2,
+                "Rank-1 tensor attaches as 1×n bias row");
+
+    const fx_weights_entry_t* e = fx_weights_find(&wf, "conv1.bias");
+    TEST_ASSERT(e && fx_weights_data(&wf, e) == bias.data, "find + data agree with attach");
+
+    TEST_ASSERT(fx_weights_attach_matrix(&wf, "conv1.weight", &fc) == FX_WEIGHTS_SHAPE,
+                "Rank-4 tensor rejected as matrix");
+    TEST_ASSERT(fx_weights_attach_matrix(&wf, "missing", &fc) == FX_WEIGHTS_NOT_FOUND,
+                "Unknown name reported");
+    TEST_ASSERT(fx_weights_find(&wf, "conv1") == NULL, "Prefix does not match");
+
+    image_entry(2)->frac_bits = 8;
+    TEST_ASSERT(fx_weights_attach_matrix(&wf, "fc.weight", &fc) == FX_WEIGHTS_FORMAT,
+                "Non-Q16.16 payload rejected for fixed_t views");
+}
+
+/**
+ * @test Header-level rejections
+ * @traceability SRS-010.1, SRS-010.2
+ */
+static void test_header_rejected(void) {
+    printf("\nTest: Header validation\n");
+    printf("───────────────────────\n");
+
+    fx_weights_t wf;
+
+    build_image();
+    TEST_ASSERT(fx_weights_open(&wf, NULL, g_image_len, 0) == FX_WEIGHTS_INVALID_PARAM,
+                "NULL image rejected");
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0x80u) == FX_WEIGHTS_INVALID_PARAM,
+                "Unknown flag rejected");
+    TEST_ASSERT(fx_weights_open(&wf, g_image + 4, g_image_len, 0) == FX_WEIGHTS_MISALIGNED,
+                "Misaligned base rejected");
+    TEST_ASSERT(fx_weights_open(&wf, g_image, 32, 0) == FX_WEIGHTS_TRUNCATED,
+                "Image shorter than a header rejected");
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len - 1, 0) == FX_WEIGHTS_TRUNCATED,
+                "Image shorter than file_size rejected");
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len + 64, 0) == FX_WEIGHTS_OK,
+                "Larger region (flash partition) accepted");
+
+    g_image[0] = 'X';
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_BAD_MAGIC &&
+                wf.table == NULL,
+                "Bad magic rejected, view cleared");
+
+    build_image();
+    image_header()->byte_order = 0x04030201u;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_BAD_ENDIAN,
+                "Foreign byte order rejected");
+
+    build_image();
+    image_header()->version_major = 2;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_BAD_VERSION,
+                "Newer major version rejected");
+
+    build_image();
+    image_header()->version_minor = 7;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_OK,
+                "Minor version accepted");
+
+    build_image();
+    image_header()->tensor_count = 1000;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Table past the end rejected");
+
+    build_image();
+    image_header()->data_offset = 128;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Data region overlapping the table rejected");
+
+    build_image();
+    image_header()->alignment = 48;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Non power-of-two alignment rejected");
+}
+
+/**
+ * @test Table entry rejections
+ * @traceability SRS-010.2
+ */
+static void test_entries_rejected(void) {
+    printf("\nTest: Table entry validation\n");
+    printf("────────────────────────────\n");
+
+    fx_weights_t wf;
+
+    build_image();
+    image_entry(1)->offset = DATA_OFFSET + 132;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Unaligned payload rejected");
+
+    build_image();
+    image_entry(2)->offset = DATA_OFFSET + 256;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Payload past the end rejected");
+
+    build_image();
+    image_entry(2)->offset = 0;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Payload outside the data region rejected");
+
+    build_image();
+    image_entry(0)->count = 17;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Count not equal to product of dims rejected");
+
+    build_image();
+    image_entry(0)->dims[0] = 0x40000000u;
+    image_entry(0)->dims[1] = 0x40000000u;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Overflowing shape rejected");
+
+    build_image();
+    image_entry(1)->dims[2] = 2;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Unused dimension other than 1 rejected");
+
+    build_image();
+    image_entry(1)->dtype = 9;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Unknown dtype rejected");
+
+    build_image();
+    memset(image_entry(1)->name, 'a', FX_WEIGHTS_NAME_LEN);
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Unterminated name rejected");
+
+    build_image();
+    memcpy(image_entry(2)->name, "conv1.bias", 11);
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Duplicate name rejected");
+}
+
+/**
+ * @test Kernel layouts: count implied by the layout, layout-specific attach
+ * @traceability SRS-010.6
+ */
+static void test_layouts(void) {
+    printf("\nTest: Pre-packed layouts\n");
+    printf("────────────────────────\n");
+
+    fx_weights_t wf;
+    fx_matrix_t fc;
+    fx_matrix_packed_t packed;
+    const int64_t* u = NULL;
+    uint16_t cout = 0, cin = 0;
+
+    /* fc.weight (3×2) as 4-column panels: 1 panel × 3 rows × 4 */
+    build_image();
+    image_entry(2)->layout = FX_WEIGHTS_LAYOUT_GEMM_PANELS;
+    image_entry(2)->tile = FX_MATRIX_PANEL_COLS;
+    image_entry(2)->count = 12;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_OK,
+                "Panel entry opens");
+    TEST_ASSERT(fx_weights_attach_packed(&wf, "fc.weight", &packed) == FX_WEIGHTS_OK &&
+                packed.rows == 3 && packed.cols == 2 &&
+                (const uint8_t*)packed.data == g_image + DATA_OFFSET + 192,
+                "Panels attach in place with the logical shape");
+    TEST_ASSERT(fx_weights_attach_matrix(&wf, "fc.weight", &fc) == FX_WEIGHTS_FORMAT,
+                "Packed payload refused as a plain matrix");
+    TEST_ASSERT(fx_weights_attach_packed(&wf, "conv1.bias", &packed) == FX_WEIGHTS_FORMAT,
+                "Dense payload refused as panels");
+
+    image_entry(2)->tile = 3;
+    image_entry(2)->count = 9;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_OK &&
+                fx_weights_attach_packed(&wf, "fc.weight", &packed) == FX_WEIGHTS_FORMAT,
+                "Panel width other than the kernel's refused at attach");
+
+    image_entry(2)->tile = FX_MATRIX_PANEL_COLS;
+    image_entry(2)->count = 6;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Panel count without padding rejected");
+
+    build_image();
+    image_entry(2)->layout = 7;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Unknown layout rejected");
+
+    build_image();
+    image_entry(2)->tile = 4;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Dense entry with a tile rejected");
+
+    /* conv1.weight (2×1×3×3) as transformed filters: 2 × 16 int64 */
+    build_image();
+    image_entry(0)->layout = FX_WEIGHTS_LAYOUT_WINOGRAD_2X2_3X3;
+    image_entry(0)->dtype = FX_WEIGHTS_DTYPE_I64;
+    image_entry(0)->tile = 2;
+    image_entry(0)->count = 32;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_OK &&
+                fx_weights_attach_winograd(&wf, "conv1.weight", &u, &cout, &cin) == FX_WEIGHTS_OK &&
+                (const uint8_t*)u == g_image + DATA_OFFSET && cout == 2 && cin == 1,
+                "Winograd entry attaches in place");
+    TEST_ASSERT(fx_weights_attach_winograd(&wf, "fc.weight", &u, &cout, &cin) == FX_WEIGHTS_FORMAT,
+                "Dense payload refused as Winograd filters");
+
+    image_entry(0)->dtype = FX_WEIGHTS_DTYPE_I32;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Winograd entry must be int64");
+    image_entry(0)->dtype = FX_WEIGHTS_DTYPE_I64;
+    image_entry(0)->dims[3] = 5;
+    image_entry(0)->count = 32;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_CORRUPT,
+                "Winograd entry must be 3×3");
+}
+
+/**
+ * @test Checksum only on request: opening does not read the payload
+ * @traceability SRS-010.3
+ */
+static void test_checksum(void) {
+    printf("\nTest: Integrity check\n");
+    printf("─────────────────────\n");
+
+    fx_weights_t wf;
+
+    build_image();
+    g_image[g_image_len - 1] ^= 0x01u;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, FX_WEIGHTS_VERIFY) == FX_WEIGHTS_CHECKSUM,
+                "Single flipped payload bit detected");
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, 0) == FX_WEIGHTS_OK,
+                "Open without VERIFY does not read payload");
+
+    build_image();
+    image_header()->version_minor ^= 1u;
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, FX_WEIGHTS_VERIFY) == FX_WEIGHTS_CHECKSUM,
+                "Header fields covered by the CRC");
+    reseal();
+    TEST_ASSERT(fx_weights_open(&wf, g_image, g_image_len, FX_WEIGHTS_VERIFY) == FX_WEIGHTS_OK,
+                "Resealed image verifies");
+}
+
+/**
+ * @test File produced by tools/pack_weights.py
+ * @traceability SRS-010.5
+ */
+static void test_packed_file(void) {
+    printf("\nTest: tools/pack_weights.py output\n");
+    printf("──────────────────────────────────\n");
+
+#ifdef CI_WEIGHTS_FILE
+    static uint64_t file_words[256];
+    fx_weights_t wf;
+    fx_tensor_t conv;
+    fx_matrix_t bias, fc;
+    size_t len = 0;
+
+    FILE* f = fopen(CI_WEIGHTS_FILE, "rb");
+    if (f) {
+        len = fread(file_words, 1, sizeof(file_words), f);
+        fclose(f);
+    }
+    TEST_ASSERT(len > 0, "Packed file read");
+    TEST_ASSERT(fx_weights_open(&wf, file_words, len, FX_WEIGHTS_VERIFY) == FX_WEIGHTS_OK,
+                "Packed file opens and verifies");
+
+    TEST_ASSERT(fx_weights_attach_tensor(&wf, "conv1.weight", &conv) == FX_WEIGHTS_OK &&
+                conv.n == 2 && conv.c == 1 && conv.h == 3 && conv.w == 3 &&
+                conv.data[0] == FIXED_ONE && conv.data[4] == fixed_from_int(-3) / 2 &&
+                conv.data[17] == -FIXED_ONE,
+                "Conv filters quantized to Q16.16");
+    TEST_ASSERT(fx_weights_attach_matrix(&wf, "conv1.bias", &bias) == FX_WEIGHTS_OK &&
+                bias.cols == 2 && bias.data[0] == FIXED_HALF && bias.data[1] == -FIXED_ONE / 4,
+                "Bias quantized to Q16.16");
+    TEST_ASSERT(fx_weights_attach_matrix(&wf, "fc.weight", &fc) == FX_WEIGHTS_OK &&
+                fc.rows == 3 && fc.cols == 2 && fc.data[0] == 65536 && fc.data[5] == -1,
+                "Raw values stored unchanged");
+    TEST_ASSERT(((uintptr_t)fc.data - (uintptr_t)file_words) % wf.header->alignment == 0,
+                "Payloads aligned as declared");
+
+    /* Kernel layouts written by the tool match the runtime transforms */
+    fx_matrix_packed_t packed;
+    fixed_t a_buf[2 * 3] = { FIXED_ONE, -FIXED_HALF, 3, 7 * FIXED_ONE, 0, -FIXED_ONE / 3 };
+    fixed_t c_ref[2 * 2], c_pk[2 * 2];
+    fx_matrix_t a, cr, cp;
+    fx_matrix_attach(&a, a_buf, 2, 3);
+    fx_matrix_attach(&cr, c_ref, 2, 2);
+    fx_matrix_attach(&cp, c_pk, 2, 2);
+    TEST_ASSERT(fx_weights_attach_packed(&wf, "fc.packed", &packed) == FX_WEIGHTS_OK &&
+                packed.rows == 3 && packed.cols == 2 && packed.data[4] == 32768 &&
+                packed.data[3] == 0, "GEMM panels written by the tool");
+    fx_matrix_mul(&a, &fc, &cr);
+    fx_matrix_mul_packed(&a, &packed, &cp);
+    TEST_ASSERT(memcmp(c_ref, c_pk, sizeof(c_ref)) == 0, "Packed file operand matches the plain one");
+
+    static int64_t u_rt[2 * FX_WINOGRAD_TILE];
+    const int64_t* u = NULL;
+    uint16_t cout = 0, cin = 0;
+    fx_conv_params_t p = FX_CONV_PARAMS_DEFAULT;
+    fx_winograd_plan_t plan_rt, plan_file;
+    TEST_ASSERT(fx_weights_attach_winograd(&wf, "conv1.wino", &u, &cout, &cin) == FX_WEIGHTS_OK &&
+                cout == 2 && cin == 1, "Winograd filters written by the tool");
+    TEST_ASSERT(fx_winograd_plan(&plan_rt, &conv, &p, FX_WINOGRAD_BOUND_ANY, u_rt, 32) == FX_CONV_OK &&
+                u && memcmp(u, u_rt, sizeof(u_rt)) == 0,
+                "Offline transform equals fx_winograd_plan()");
+    TEST_ASSERT(fx_winograd_plan_transformed(&plan_file, u, cout, cin, &p, FX_WINOGRAD_BOUND_ANY) ==
+                FX_CONV_OK && plan_file.u == u, "Plan uses the mapped filters in place");
+#else
+    printf("  (skipped: python3 not available at configure time)\n");
+#endif
+}
+
+int main(void) {
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("  SRS-010 Weight Container Verification Suite\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    test_crc32();
+    test_open_and_attach();
+    test_header_rejected();
+    test_entries_rejected();
+    test_checksum();
+    test_layouts();
+    test_packed_file();
+
+    /* Print summary */
+    printf("\n");
+    printf("═══════════════════════════════════════════════\n");
+    if (tests_failed == 0) {
+        printf("  ✅ SRS-010 Verified (%d tests passed)\n", tests_passed);
+    } else {
+        printf("  ❌ SRS-010 Failed (%d passed, %d failed)\n", tests_passed, tests_failed);
+    }
+    printf("═══════════════════════════════════════════════\n");
+    printf("\n");
+
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,583 @@
+#!/usr/bin/env python3
+"""
+SpeyTech Model Compiler
+Generate a specialized Q16.16 inference function for a whole model
+
+Every dimension of the generated code is a compile-time constant: kernel
+taps are emitted fully unrolled, loop bounds are literals, padding checks
+are confined to the border pixels, the runtime shape validation of the
+generic API disappears, and the intermediate workspace is sized by a
+macro. The arithmetic is exactly that of the library (one 64-bit
+accumulator per output, a single round-to-nearest, then bias, activation
+and pooling in that order), so the generated model is bit-identical to
+running the same layers through fx_graph_run() or by hand.
+
+Model description (JSON):
+
+    {
+      "name": "lenet",
+      "input": [1, 28, 28],                         C, H, W (NCHW, batch 1)
+      "seed": 1,                                    synthetic weights (optional)
+      "layers": [
+        {"type": "conv2d", "weights": "c1_w.npy", "bias": "c1_b.npy",
+         "stride": 1, "pad": 2, "dilation": 1,
+         "activation": "relu", "maxpool": true},
+        {"type": "maxpool2x2"},
+        {"type": "activation", "activation": "leaky_relu", "alpha": 0.1},
+        {"type": "dense", "weights": "fc_w.npy", "bias": "fc_b.npy",
+         "units": 10, "activation": "none"}
+      ]
+    }
+
+Weight shapes follow the library: conv (C_out, C_in, KH, KW), dense
+(K, N) with y = x × W. "stride", "pad" and "dilation" take an int or an
+[h, w] pair. Weight files (.npy, requires NumPy) are relative to the JSON
+file. Layers without weight files get deterministic synthetic values from
+"seed" (for profiling and tests); conv layers then need "filters" and
+"kernel", dense layers "units".
+
+Usage:
+    python codegen.py model.json output_dir
+
+Author: William Murray
+Copyright (c) 2026 The Murray Family Innovation Trust
+License: GPL-3.0 or Commercial
+"""
+
+import sys
+import json
+import argparse
+from pathlib import Path
+
+FIXED_SHIFT = 16
+FIXED_MIN = -(1 << 31)
+FIXED_MAX = (1 << 31) - 1
+
+# Kernels with at most this many taps per channel are emitted unrolled
+MAX_UNROLLED_TAPS = 49
+
+ACTIVATIONS = ('none', 'relu', 'leaky_relu')
+
+
+class ModelError(Exception):
+    """Invalid model description."""
+
+
+def to_fixed(value: float) -> int:
+    """Round a float to Q16.16, clamped to the int32 range."""
+    return max(FIXED_MIN, min(FIXED_MAX, int(round(value * (1 << FIXED_SHIFT)))))
+
+
+def pair(layer: dict, key: str, default: int) -> tuple:
+    """Read an int or [h, w] layer attribute."""
+    v = layer.get(key, default)
+    if isinstance(v, int):
+        return (v, v)
+    if isinstance(v, list) and len(v) == 2 and all(isinstance(x, int) for x in v):
+        return (v[0], v[1])
+    raise ModelError(f"'{key}' must be an int or an [h, w] pair")
+
+
+def out_dim(size: int, k: int, stride: int, pad: int, dil: int) -> int:
+    """Output extent, as fx_conv2d_out_dim()."""
+    span = (k - 1) * dil + 1
+    if stride == 0 or dil == 0 or size + 2 * pad < span:
+        return 0
+    return (size + 2 * pad - span) // stride + 1
+
+
+class Synthetic:
+    """Deterministic LCG for synthetic weights (values in ±2^(bits-1) LSB)."""
+
+    def __init__(self, seed: int):
+        self.state = seed & 0xFFFFFFFF
+
+    def values(self, count: int, bits: int = 16) -> list:
+        out = []
+        for _ in range(count):
+            self.state = (self.state * 1664525 + 1013904223) & 0xFFFFFFFF
+            out.append((self.state >> (32 - bits)) - (1 << (bits - 1)))
+        return out
+
+
+def load_values(base: Path, layer: dict, key: str, shape: tuple):
+    """Load and quantize a .npy tensor, or return None if not given."""
+    path = layer.get(key)
+    if path is None:
+        return None
+    try:
+        import numpy as np
+    except ImportError:
+        raise ModelError("NumPy is required to read .npy weights (pip install numpy)")
+    arr = np.load(base / path)
+    if tuple(arr.shape) != tuple(shape):
+        raise ModelError(f"{path}: shape {tuple(arr.shape)}, expected {tuple(shape)}")
+    return [to_fixed(float(v)) for v in arr.flatten()]
+
+
+def format_values(values: list, indent: str = "    ", per_line: int = 8) -> str:
+    """Format fixed-point values as a C initializer body."""
+    if not values:
+        return indent + "0"
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        lines.append(indent + ", ".join(f"{v:11d}" for v in chunk))
+    return ",\n".join(lines)
+
+
+def parse_model(path: Path) -> dict:
+    """Validate the description and compute every layer shape."""
+    with open(path) as f:
+        desc = json.load(f)
+
+    name = desc.get('name', '')
+    if not name.isidentifier():
+        raise ModelError("'name' must be a C identifier")
+    shape = desc.get('input')
+    if not (isinstance(shape, list) and len(shape) == 3 and all(isinstance(v, int) and v > 0 for v in shape)):
+        raise ModelError("'input' must be [C, H, W]")
+
+    rng = Synthetic(desc.get('seed', 1))
+    base = path.parent
+    layers = []
+    c, h, w = shape
+
+    for idx, layer in enumerate(desc.get('layers', [])):
+        kind = layer.get('type')
+        act = layer.get('activation', 'none')
+        if act not in ACTIVATIONS:
+            raise ModelError(f"layer {idx}: unknown activation '{act}'")
+        spec = {
+            'index': idx, 'type': kind, 'in': (c, h, w),
+            'act': act, 'alpha': to_fixed(layer.get('alpha', 0.0)),
+        }
+
+        if kind == 'conv2d':
+            sh, sw = pair(layer, 'stride', 1)
+            ph, pw = pair(layer, 'pad', 0)
+            dh, dw = pair(layer, 'dilation', 1)
+            weights = layer.get('weights')
+            if weights is None:
+                cout = layer.get('filters')
+                kh, kw = pair(layer, 'kernel', 3)
+                if not isinstance(cout, int) or cout <= 0:
+                    raise ModelError(f"layer {idx}: synthetic conv needs 'filters'")
+            else:
+                import numpy as np  # shape only; values loaded below
+                kshape = np.load(base / weights, mmap_mode='r').shape
+                if len(kshape) != 4 or kshape[1] != c:
+                    raise ModelError(f"layer {idx}: weights must be (C_out, {c}, KH, KW)")
+                cout, _, kh, kw = kshape
+            wshape = (cout, c, kh, kw)
+            spec['w'] = load_values(base, layer, 'weights', wshape) or rng.values(cout * c * kh * kw)
+            if 'bias' in layer or weights is None:
+                spec['b'] = load_values(base, layer, 'bias', (cout,)) or rng.values(cout, 18)
+            oh = out_dim(h, kh, sh, ph, dh)
+            ow = out_dim(w, kw, sw, pw, dw)
+            if oh == 0 or ow == 0:
+                raise ModelError(f"layer {idx}: kernel larger than padded input")
+            spec.update(cout=cout, k=(kh, kw), stride=(sh, sw), pad=(ph, pw),
+                        dil=(dh, dw), conv=(oh, ow), pool=bool(layer.get('maxpool', False)))
+            if spec['pool']:
+                if oh % 2 or ow % 2:
+                    raise ModelError(f"layer {idx}: fused max pool needs even conv output ({oh}×{ow})")
+                oh, ow = oh // 2, ow // 2
+            c, h, w = cout, oh, ow
+
+        elif kind == 'dense':
+            k = c * h * w
+            weights = layer.get('weights')
+            if weights is None:
+                n = layer.get('units')
+                if not isinstance(n, int) or n <= 0:
+                    raise ModelError(f"layer {idx}: synthetic dense needs 'units'")
+            else:
+                import numpy as np
+                wshape = np.load(base / weights, mmap_mode='r').shape
+                if len(wshape) != 2 or wshape[0] != k:
+                    raise ModelError(f"layer {idx}: weights must be ({k}, N)")
+                n = wshape[1]
+            spec['w'] = load_values(base, layer, 'weights', (k, n)) or rng.values(k * n)
+            if 'bias' in layer or weights is None:
+                spec['b'] = load_values(base, layer, 'bias', (n,)) or rng.values(n, 18)
+            spec.update(k_in=k, units=n)
+            c, h, w = n, 1, 1
+
+        elif kind == 'maxpool2x2':
+            if h % 2 or w % 2:
+                raise ModelError(f"layer {idx}: max pool needs even input ({h}×{w})")
+            h, w = h // 2, w // 2
+
+        elif kind == 'activation':
+            if act == 'none':
+                raise ModelError(f"layer {idx}: activation layer needs an activation")
+
+        else:
+            raise ModelError(f"layer {idx}: unknown type '{kind}'")
+
+        spec['out'] = (c, h, w)
+        layers.append(spec)
+
+    if not layers:
+        raise ModelError("model has no layers")
+    return {'name': name, 'input': tuple(shape), 'layers': layers}
+
+
+def plan_buffers(layers: list) -> tuple:
+    """
+    Assign each layer a source and destination (ping-pong workspace).
+
+    A sequential model needs at most two live intermediates; activation
+    layers run in place. Returns (slot sizes, per-layer (src, dst)) where
+    src/dst are 'input', 'output', 0 or 1.
+    """
+    sizes = [0, 0]
+    routes = []
+    cur = 'input'
+    for i, spec in enumerate(layers):
+        c, h, w = spec['out']
+        if i == len(layers) - 1:
+            dst = 'output'
+        elif spec['type'] == 'activation' and cur != 'input':
+            dst = cur
+        else:
+            dst = 0 if cur in ('input', 1) else 1
+        if dst in (0, 1):
+            sizes[dst] = max(sizes[dst], c * h * w)
+        routes.append((cur, dst))
+        cur = dst
+    align = lambda v: (v + 3) // 4 * 4
+    return [align(s) for s in sizes], routes
+
+
+def emit_finish(spec: dict, prefix: str, bias_index: str) -> list:
+    """Round, bias and activation, in the library's order."""
+    lines = ["    fixed_t v = (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);"]
+    if 'b' in spec:
+        lines.append(f"    v = fixed_add(v, {prefix}_bias[{bias_index}]);")
+    if spec['act'] == 'relu':
+        lines.append("    if (v < 0) {\n        v = FIXED_ZERO;\n    }")
+    elif spec['act'] == 'leaky_relu':
+        lines.append(f"    if (v < 0) {{\n        v = fixed_mul(v, (fixed_t){spec['alpha']});\n    }}")
+    return lines
+
+
+def emit_conv(spec: dict, prefix: str) -> str:
+    c, h, w = spec['in']
+    kh, kw = spec['k']
+    sh, sw = spec['stride']
+    ph, pw = spec['pad']
+    dh, dw = spec['dil']
+    oh, ow = spec['conv']
+    taps = kh * kw
+    plane = h * w
+
+    # Pixels whose whole receptive field is inside the input
+    ylo, xlo = -(-ph // sh), -(-pw // sw)
+    yhi = min(oh, max(0, (h - 1 + ph - (kh - 1) * dh) // sh + 1))
+    xhi = min(ow, max(0, (w - 1 + pw - (kw - 1) * dw) // sw + 1))
+    all_interior = ylo == 0 and xlo == 0 and yhi == oh and xhi == ow
+    no_interior = ylo >= yhi or xlo >= xhi
+
+    L = []
+    L.append(f"/* Conv output (o, y, x): {spec['cout']} filters of {c}×{kh}×{kw}, "
+             f"stride {sh}×{sw}, pad {ph}×{pw}, dilation {dh}×{dw} */")
+    L.append(f"static inline fixed_t {prefix}_at(const fixed_t* in, int o, int y, int x) {{")
+    L.append(f"    const fixed_t* w = {prefix}_weights + o * {c * taps};")
+    L.append("    int64_t acc = 0;")
+    L.append("")
+
+    def interior(indent: str) -> list:
+        body = [f"{indent}const fixed_t* p = in + (y * {sh} - {ph}) * {w} + (x * {sw} - {pw});",
+                f"{indent}const fixed_t* k = w;",
+                f"{indent}for (int c = 0; c < {c}; c++) {{"]
+        if taps <= MAX_UNROLLED_TAPS:
+            for i in range(kh):
+                for j in range(kw):
+                    body.append(f"{indent}    acc += (int64_t)p[{i * dh * w + j * dw}] * k[{i * kw + j}];")
+        else:
+            body.append(f"{indent}    for (int i = 0; i < {kh}; i++) {{")
+            body.append(f"{indent}        for (int j = 0; j < {kw}; j++) {{")
+            body.append(f"{indent}            acc += (int64_t)p[i * {dh * w} + j * {dw}] * k[i * {kw} + j];")
+            body.append(f"{indent}        }}")
+            body.append(f"{indent}    }}")
+        body.append(f"{indent}    p += {plane};")
+        body.append(f"{indent}    k += {taps};")
+        body.append(f"{indent}}}")
+        return body
+
+    def border(indent: str) -> list:
+        return [
+            f"{indent}/* Border: taps in the zero padding contribute nothing; the",
+            f"{indent} * bounds are checked once per tap, not per channel */",
+            f"{indent}for (int i = 0; i < {kh}; i++) {{",
+            f"{indent}    const int iy = y * {sh} - {ph} + i * {dh};",
+            f"{indent}    if (iy < 0 || iy >= {h}) {{",
+            f"{indent}        continue;",
+            f"{indent}    }}",
+            f"{indent}    for (int j = 0; j < {kw}; j++) {{",
+            f"{indent}        const int ix = x * {sw} - {pw} + j * {dw};",
+            f"{indent}        if (ix < 0 || ix >= {w}) {{",
+            f"{indent}            continue;",
+            f"{indent}        }}",
+            f"{indent}        const fixed_t* p = in + iy * {w} + ix;",
+            f"{indent}        const fixed_t* k = w + i * {kw} + j;",
+            f"{indent}        for (int c = 0; c < {c}; c++) {{",
+            f"{indent}            acc += (int64_t)p[c * {plane}] * k[c * {taps}];",
+            f"{indent}        }}",
+            f"{indent}    }}",
+            f"{indent}}}"]
+
+    if all_interior:
+        L.extend(interior("    "))
+    elif no_interior:
+        L.extend(border("    "))
+    else:
+        L.append(f"    if (y >= {ylo} && y < {yhi} && x >= {xlo} && x < {xhi}) {{")
+        L.extend(interior("        "))
+        L.append("    } else {")
+        L.extend(border("        "))
+        L.append("    }")
+    L.append("")
+    L.extend(emit_finish(spec, prefix, "o"))
+    L.append("    return v;")
+    L.append("}")
+    L.append("")
+
+    co, ho, wo = spec['out']
+    L.append(f"static void {prefix}(const fixed_t* restrict in, fixed_t* restrict out) {{")
+    L.append(f"    for (int o = 0; o < {co}; o++) {{")
+    L.append(f"        for (int y = 0; y < {ho}; y++) {{")
+    L.append(f"            for (int x = 0; x < {wo}; x++) {{")
+    if spec['pool']:
+        L.append("                /* Fused 2×2 max pool: only the window maximum is stored */")
+        L.append(f"                fixed_t m = {prefix}_at(in, o, 2 * y, 2 * x);")
+        for dy, dx in ((0, 1), (1, 0), (1, 1)):
+            L.append(f"                const fixed_t v{dy}{dx} = {prefix}_at(in, o, 2 * y + {dy}, 2 * x + {dx});")
+            L.append(f"                m = v{dy}{dx} > m ? v{dy}{dx} : m;")
+        L.append(f"                out[(o * {ho} + y) * {wo} + x] = m;")
+    else:
+        L.append(f"                out[(o * {ho} + y) * {wo} + x] = {prefix}_at(in, o, y, x);")
+    L.append("            }")
+    L.append("        }")
+    L.append("    }")
+    L.append("}")
+    return "\n".join(L)
+
+
+def emit_dense(spec: dict, prefix: str) -> str:
+    k, n = spec['k_in'], spec['units']
+    L = [f"/* Dense {k} → {n} */",
+         f"static void {prefix}(const fixed_t* restrict in, fixed_t* restrict out) {{",
+         f"    for (int n = 0; n < {n}; n++) {{",
+         "        int64_t acc = 0;",
+         f"        for (int k = 0; k < {k}; k++) {{",
+         f"            acc += (int64_t)in[k] * {prefix}_weights[k * {n} + n];",
+         "        }"]
+    L.extend("    " + line.replace("\n", "\n    ") for line in emit_finish(spec, prefix, "n"))
+    L.append("        out[n] = v;")
+    L.append("    }")
+    L.append("}")
+    return "\n".join(L)
+
+
+def emit_maxpool(spec: dict, prefix: str) -> str:
+    c, h, w = spec['in']
+    _, ho, wo = spec['out']
+    return "\n".join([
+        f"/* Max pool 2×2 / 2: {c}×{h}×{w} → {c}×{ho}×{wo} */",
+        f"static void {prefix}(const fixed_t* restrict in, fixed_t* restrict out) {{",
+        f"    for (int c = 0; c < {c}; c++) {{",
+        f"        for (int y = 0; y < {ho}; y++) {{",
+        f"            const fixed_t* r0 = in + (c * {h} + 2 * y) * {w};",
+        f"            const fixed_t* r1 = r0 + {w};",
+        f"            for (int x = 0; x < {wo}; x++) {{",
+        "                const fixed_t a = r0[2 * x], b = r0[2 * x + 1];",
+        "                const fixed_t d = r1[2 * x], e = r1[2 * x + 1];",
+        "                const fixed_t m0 = a > b ? a : b;",
+        "                const fixed_t m1 = d > e ? d : e;",
+        f"                out[(c * {ho} + y) * {wo} + x] = m0 > m1 ? m0 : m1;",
+        "            }",
+        "        }",
+        "    }",
+        "}"])
+
+
+def emit_activation(spec: dict, prefix: str) -> str:
+    c, h, w = spec['out']
+    if spec['act'] == 'relu':
+        expr = "v < 0 ? FIXED_ZERO : v"
+    else:
+        expr = f"v < 0 ? fixed_mul(v, (fixed_t){spec['alpha']}) : v"
+    return "\n".join([
+        f"/* {spec['act']} over {c * h * w} values (may run in place) */",
+        f"static void {prefix}(const fixed_t* in, fixed_t* out) {{",
+        f"    for (int i = 0; i < {c * h * w}; i++) {{",
+        "        const fixed_t v = in[i];",
+        f"        out[i] = {expr};",
+        "    }",
+        "}"])
+
+
+def describe(spec: dict) -> str:
+    c, h, w = spec['out']
+    kind = spec['type']
+    if kind == 'conv2d':
+        kh, kw = spec['k']
+        extra = f"{kh}×{kw}, {spec['act']}" + (", maxpool" if spec['pool'] else "")
+    elif kind == 'dense':
+        extra = spec['act']
+    elif kind == 'activation':
+        extra = spec['act']
+    else:
+        extra = "2×2"
+    return f"{kind:<10} {extra:<24} → {c}×{h}×{w}"
+
+
+def generate(model: dict, out_dir: Path) -> tuple:
+    name = model['name']
+    upper = name.upper()
+    layers = model['layers']
+    sizes, routes = plan_buffers(layers)
+    ic, ih, iw = model['input']
+    oc, oh, ow = layers[-1]['out']
+    summary = [f" *   L{s['index']:<2} {describe(s)}" for s in layers]
+
+    # ---------------------------------------------------------------- header
+    h_path = out_dir / f"{name}_model.h"
+    guard = f"{upper}_MODEL_H"
+    H = [
+        "/**",
+        f" * @file {h_path.name}",
+        f" * @brief Specialized Q16.16 inference for model '{name}'",
+        " *",
+        " * Automatically generated by SpeyTech Model Compiler (tools/codegen.py)",
+        " * DO NOT EDIT MANUALLY",
+        " *",
+        " * Layers:",
+        f" *   input      {ic}×{ih}×{iw}",
+        *summary,
+        " *",
+        " * Bit-identical to the same layers run through the library.",
+        " */",
+        "",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        '#include "fixed_point.h"',
+        "",
+        f"#define {upper}_INPUT_C   {ic}",
+        f"#define {upper}_INPUT_H   {ih}",
+        f"#define {upper}_INPUT_W   {iw}",
+        f"#define {upper}_INPUT_LEN {ic * ih * iw}",
+        f"#define {upper}_OUTPUT_LEN {oc * oh * ow}",
+        "",
+        "/* Intermediate workspace (two ping-pong buffers), fixed_t elements */",
+        f"#define {upper}_WORKSPACE_LEN {max(1, sizes[0] + sizes[1])}",
+        "",
+    ]
+    for s in layers:
+        p = f"{name}_l{s['index']}"
+        if 'w' in s:
+            H.append(f"extern const fixed_t {p}_weights[{len(s['w'])}];")
+        if 'b' in s:
+            H.append(f"extern const fixed_t {p}_bias[{len(s['b'])}];")
+    H += [
+        "",
+        "/**",
+        f" * @brief Run '{name}' on one NCHW input.",
+        " *",
+        f" * @param[in] input {upper}_INPUT_LEN values",
+        f" * @param[out] output {upper}_OUTPUT_LEN values",
+        f" * @param[in,out] workspace {upper}_WORKSPACE_LEN values (contents ignored)",
+        " *",
+        " * @pre Buffers do not overlap",
+        " */",
+        f"void {name}_infer(const fixed_t* input, fixed_t* output, fixed_t* workspace);",
+        "",
+        f"#endif /* {guard} */",
+        "",
+    ]
+
+    # ---------------------------------------------------------------- source
+    c_path = out_dir / f"{name}_model.c"
+    C = [
+        "/**",
+        f" * @file {c_path.name}",
+        f" * @brief Specialized Q16.16 inference for model '{name}'",
+        " *",
+        " * Automatically generated by SpeyTech Model Compiler (tools/codegen.py)",
+        " * DO NOT EDIT MANUALLY",
+        " */",
+        "",
+        f'#include "{h_path.name}"',
+        "#include <stdint.h>",
+        "",
+    ]
+    for s in layers:
+        p = f"{name}_l{s['index']}"
+        if 'w' in s:
+            C.append(f"const fixed_t {p}_weights[{len(s['w'])}] = {{\n{format_values(s['w'])}\n}};\n")
+        if 'b' in s:
+            C.append(f"const fixed_t {p}_bias[{len(s['b'])}] = {{\n{format_values(s['b'])}\n}};\n")
+
+    emitters = {'conv2d': emit_conv, 'dense': emit_dense,
+                'maxpool2x2': emit_maxpool, 'activation': emit_activation}
+    for s in layers:
+        C.append(emitters[s['type']](s, f"{name}_l{s['index']}"))
+        C.append("")
+
+    def ref(where):
+        if where == 'input':
+            return 'input'
+        if where == 'output':
+            return 'output'
+        return 'workspace' if where == 0 else f'workspace + {sizes[0]}'
+
+    C.append(f"void {name}_infer(const fixed_t* input, fixed_t* output, fixed_t* workspace) {{")
+    if not any(dst in (0, 1) for _, dst in routes):
+        C.append("    (void)workspace;")
+    for s, (src, dst) in zip(layers, routes):
+        C.append(f"    {name}_l{s['index']}({ref(src)}, {ref(dst)});")
+    C.append("}")
+    C.append("")
+
+    h_path.write_text("\n".join(H))
+    c_path.write_text("\n".join(C))
+    return h_path, c_path, sizes
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='SpeyTech Model Compiler - generate specialized Q16.16 C for a model',
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  # Generate lenet_model.h / lenet_model.c
+  python codegen.py lenet.json build/generated/
+
+For commercial licensing and support: william@fstopify.com
+        """
+    )
+    parser.add_argument('model', type=str, help='Model description (.json)')
+    parser.add_argument('output_dir', type=str, help='Output directory for .h/.c files')
+    args = parser.parse_args()
+
+    try:
+        model = parse_model(Path(args.model))
+        out_dir = Path(args.output_dir)
+        out_dir.mkdir(parents=True, exist_ok=True)
+        h_path, c_path, sizes = generate(model, out_dir)
+    except (ModelError, OSError, ValueError) as e:
+        print(f"❌ Error: {e}")
+        return 1
+
+    print(f"✅ Generated {h_path} and {c_path}")
+    print(f"   Layers: {len(model['layers'])}")
+    print(f"   Workspace: {sizes[0] + sizes[1]} values ({(sizes[0] + sizes[1]) * 4} bytes)")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,271 @@
+#!/usr/bin/env python3
+"""
+SpeyTech Perfect Hash Generator
+Build a minimal perfect hash of a fixed key set and emit it as a const C
+header for d_phash_get() (include/perfect_hash.h)
+
+The key file has one key per line, optionally followed by whitespace and
+an int32 value; a key without a value gets its line's key index. Blank
+lines and lines starting with '#' are ignored:
+
+    # layer name          value
+    conv1.weight          0
+    conv1.bias
+    fc.weight             -7
+
+The table uses CHD (compress, hash and displace). Keys are split into
+buckets of about --load keys; buckets are placed largest first, each with
+the first displacement pair (d0, d1) that moves all of its keys to free
+slots. For a fixed d0, changing d1 only rotates the bucket, so d1 is
+solved from the free slots instead of searched. If a bucket cannot be
+placed the next seed is tried. The hash and slot formulas are those of
+src/containers/perfect_hash.c and must stay identical to them.
+
+Keys are stored and hashed on their first 31 bytes, like d_table_t; keys
+that are equal on those bytes are rejected.
+
+Usage:
+    python gen_phash.py keys.txt layer_names output_dir
+    python gen_phash.py keys.txt op_ids output_dir --load 4
+
+Author: William Murray
+Copyright (c) 2026 The Murray Family Innovation Trust
+License: GPL-3.0 or Commercial
+"""
+
+import sys
+import math
+import argparse
+from pathlib import Path
+
+KEY_LEN = 32
+MAX_KEYS = 65535
+MASK32 = 0xFFFFFFFF
+FNV_OFFSET = 0x811C9DC5
+FNV_PRIME = 0x01000193
+F1_SALT = 0x9E3779B9
+F2_SALT = 0x85EBCA6B
+MAX_SEEDS = 64
+MAX_LOAD = 6.0      # fuller buckets often cannot all be placed in n slots
+
+
+def fmix32(h: int) -> int:
+    """MurmurHash3 finalizer, as fmix32() in perfect_hash.c."""
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & MASK32
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & MASK32
+    h ^= h >> 16
+    return h
+
+
+def key_hash(key: bytes, seed: int) -> int:
+    """Seeded FNV-1a, as d_phash_hash()."""
+    h = FNV_OFFSET ^ seed
+    for b in key:
+        h = ((h ^ b) * FNV_PRIME) & MASK32
+    return h
+
+
+def read_keys(path: Path) -> list:
+    """Parse the key file into (key bytes, value) pairs."""
+    pairs = []
+    seen = {}
+    for lineno, line in enumerate(path.read_text(encoding='utf-8').splitlines(), 1):
+        fields = line.split()
+        if not fields or fields[0].startswith('#'):
+            continue
+        if len(fields) > 2:
+            raise ValueError(f"{path}:{lineno}: expected 'key [value]'")
+        value = int(fields[1], 0) if len(fields) == 2 else len(pairs)
+        if not -2**31 <= value < 2**31:
+            raise ValueError(f"{path}:{lineno}: value {value} does not fit int32")
+        key = fields[0].encode('utf-8')[:KEY_LEN - 1]
+        if key in seen:
+            raise ValueError(f"{path}:{lineno}: key equals line {seen[key]} "
+                             f"on its first {KEY_LEN - 1} bytes")
+        seen[key] = lineno
+        pairs.append((key, value))
+    if not pairs:
+        raise ValueError(f"{path}: no keys")
+    if len(pairs) > MAX_KEYS:
+        raise ValueError(f"{path}: {len(pairs)} keys, at most {MAX_KEYS}")
+    return pairs
+
+
+def place(keys: list, buckets: int, seed: int):
+    """Slots and displacements for one seed, or None if a bucket fails."""
+    n = len(keys)
+    members = [[] for _ in range(buckets)]
+    for i, key in enumerate(keys):
+        h = key_hash(key, seed)
+        members[fmix32(h) % buckets].append(
+            (i, fmix32(h ^ F1_SALT) % n, fmix32(h ^ F2_SALT) % n))
+
+    displace = [0] * (2 * buckets)
+    slot_of = [0] * n
+    taken = bytearray(n)
+    order = sorted(range(buckets), key=lambda g: (-len(members[g]), g))
+    for g in order:
+        bucket = members[g]
+        if not bucket:
+            break
+        free = [s for s in range(n) if not taken[s]]
+        placed = False
+        for d0 in range(n):
+            base = [(f1 + d0 * f2) % n for _, f1, f2 in bucket]
+            if len(set(base)) != len(base):
+                continue
+            for s in free:
+                d1 = (s - base[0]) % n
+                slots = [(b + d1) % n for b in base]
+                if all(not taken[t] for t in slots):
+                    for (i, _, _), t in zip(bucket, slots):
+                        taken[t] = 1
+                        slot_of[i] = t
+                    displace[2 * g] = d0
+                    displace[2 * g + 1] = d1
+                    placed = True
+                    break
+            if placed:
+                break
+        if not placed:
+            return None
+    return slot_of, displace
+
+
+def build(pairs: list, load: float) -> dict:
+    """Search seeds until every bucket is placed."""
+    keys = [k for k, _ in pairs]
+    n = len(keys)
+    buckets = max(1, math.ceil(n / load))
+    for seed in range(MAX_SEEDS):
+        result = place(keys, buckets, seed)
+        if result is not None:
+            slot_of, displace = result
+            entries = [None] * n
+            for (key, value), slot in zip(pairs, slot_of):
+                entries[slot] = (key, value)
+            return {'seed': seed, 'buckets': buckets, 'displace': displace, 'entries': entries}
+    raise ValueError(f"no perfect hash found in {MAX_SEEDS} seeds; try a smaller --load")
+
+
+def c_string(key: bytes) -> str:
+    """C string literal; octal escapes avoid hex and trigraph pitfalls."""
+    out = []
+    for b in key:
+        c = chr(b)
+        if 0x20 <= b < 0x7F and c not in '"\\?':
+            out.append(c)
+        else:
+            out.append(f"\\{b:03o}")
+    return '"' + ''.join(out) + '"'
+
+
+def format_values(values: list, indent: str = "    ", per_line: int = 12) -> str:
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        line = indent + ", ".join(f"{v:5d}" for v in chunk)
+        if i + per_line < len(values):
+            line += ","
+        lines.append(line)
+    return "\n".join(lines)
+
+
+def render(name: str, source: str, table: dict) -> str:
+    guard = f"{name.upper()}_PHASH_H"
+    n = len(table['entries'])
+    L = [
+        "/**",
+        f" * @file {name}_phash.h",
+        f" * @brief Minimal perfect hash of the keys in {source}",
+        " * ",
+        " * Automatically generated by SpeyTech Perfect Hash Generator",
+        " * DO NOT EDIT MANUALLY",
+        " * ",
+        f" * Keys: {n}, buckets: {table['buckets']}, seed: {table['seed']}",
+        " * Lookup: d_phash_get(&" + name + ", key, &value)",
+        " */",
+        "",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        '#include "perfect_hash.h"',
+        "",
+        f"#define {name.upper()}_SIZE {n}u",
+        "",
+        "/* d0, d1 per bucket */",
+        f"static const uint16_t {name}_displace[{len(table['displace'])}] = {{",
+        format_values(table['displace']),
+        "};",
+        "",
+        "/* Record per slot */",
+        f"static const d_entry_t {name}_entries[{n}] = {{",
+    ]
+    for i, (key, value) in enumerate(table['entries']):
+        sep = "," if i + 1 < n else ""
+        literal = "(-2147483647 - 1)" if value == -2**31 else str(value)
+        L.append(f"    {{ {c_string(key)}, {literal} }}{sep}")
+    L += [
+        "};",
+        "",
+        f"static const d_phash_t {name} = {{",
+        f"    {name}_displace, {name}_entries, {n}u, {table['buckets']}u, {table['seed']}u",
+        "};",
+        "",
+        f"#endif /* {guard} */",
+        "",
+    ]
+    return "\n".join(L)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='SpeyTech Perfect Hash Generator - const minimal perfect hash tables for d_phash_t',
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  # Layer names to tensor indices
+  python gen_phash.py layers.txt layer_names output/
+
+  # Smaller buckets: more displacement data, faster generation
+  python gen_phash.py ops.txt op_ids output/ --load 3
+
+For commercial licensing and support: william@fstopify.com
+        """
+    )
+    parser.add_argument('keys', type=str, help='Key file (one "key [value]" per line)')
+    parser.add_argument('name', type=str, help='C identifier of the table')
+    parser.add_argument('output_dir', type=str, help='Output directory for <name>_phash.h')
+    parser.add_argument('--load', type=float, default=5.0,
+                        help='Average keys per bucket, 1 … 6 (default 5)')
+    args = parser.parse_args()
+
+    if not args.name.isidentifier():
+        print(f"❌ Error: '{args.name}' is not a C identifier")
+        return 1
+    if not 1.0 <= args.load <= MAX_LOAD:
+        print(f"❌ Error: --load must be between 1 and {MAX_LOAD:g}")
+        return 1
+
+    try:
+        pairs = read_keys(Path(args.keys))
+        table = build(pairs, args.load)
+        out_dir = Path(args.output_dir)
+        out_dir.mkdir(parents=True, exist_ok=True)
+        out = out_dir / f"{args.name}_phash.h"
+        out.write_text(render(args.name, Path(args.keys).name, table))
+    except (OSError, ValueError) as e:
+        print(f"❌ Error: {e}")
+        return 1
+
+    n = len(pairs)
+    print(f"✅ Generated {out}")
+    print(f"   {n} keys, {table['buckets']} buckets, seed {table['seed']}")
+    print(f"   {n * (KEY_LEN + 4) + table['buckets'] * 4} bytes of const data")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,326 @@
+#!/usr/bin/env python3
+"""
+SpeyTech Weight Packer
+Pack Q16.16 weights into a binary container for zero-copy loading
+
+The output is the versioned little-endian format read by
+include/weights.h: a 64-byte header (magic "CIEW", CRC-32, version,
+byte-order mark, region offsets), a table of 72-byte tensor entries
+(name, dtype, Q-format, shape, payload offset) and the payloads, each on
+an aligned boundary. Firmware maps or links the file and points matrices
+straight into it, so model updates no longer need a rebuild.
+
+Usage:
+    python pack_weights.py model.ciew fc1.weight=fc1_w.npy fc1.bias=fc1_b.npy
+    python pack_weights.py model.ciew --manifest model.json
+
+Manifest (JSON):
+
+    {
+      "alignment": 64,
+      "tensors": [
+        {"name": "fc1.weight", "file": "fc1_w.npy"},
+        {"name": "fc1.bias", "shape": [4], "values": [0.5, -1.0, 0.25, 0.0]},
+        {"name": "raw", "shape": [2, 2], "values": [65536, 0, 0, 65536], "raw": true},
+        {"name": "fc2.weight", "file": "fc2_w.npy", "layout": "gemm_panels"},
+        {"name": "conv2.wino", "file": "conv2_w.npy", "layout": "winograd_2x2_3x3"}
+      ]
+    }
+
+Float values are quantized as tools/quantize.py does (round to nearest,
+clamped to the Q16.16 range); "raw": true takes them as Q16.16 integers.
+
+"layout" stores a tensor pre-arranged for a kernel (format 1.1), so the
+runtime never repacks weights that do not change:
+
+    gemm_panels        K x N dense weights as 4-column GEMM panels
+                       ("tile" overrides the width), for fx_matrix_mul_packed()
+    winograd_2x2_3x3   C_out x C_in x 3 x 3 filters as int64 U' = G' g G'^T,
+                       for fx_winograd_plan_transformed()
+.npy files must be little-endian float32/float64/int32, C order; numpy
+is not required.
+
+Author: William Murray
+Copyright (c) 2026 The Murray Family Innovation Trust
+License: GPL-3.0 or Commercial
+"""
+
+import argparse
+import ast
+import json
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+MAGIC = b'CIEW'
+VERSION = (1, 1)
+BYTE_ORDER = 0x01020304
+HEADER_SIZE = 64
+ENTRY_SIZE = 72
+NAME_LEN = 32
+MAX_RANK = 4
+DTYPE_I32 = 1
+DTYPE_I64 = 2
+FRAC_BITS = 16
+
+LAYOUT_DENSE = 0
+LAYOUT_GEMM_PANELS = 1
+LAYOUT_WINOGRAD_2X2_3X3 = 2
+LAYOUTS = {'dense': LAYOUT_DENSE, 'gemm_panels': LAYOUT_GEMM_PANELS,
+           'winograd_2x2_3x3': LAYOUT_WINOGRAD_2X2_3X3}
+GEMM_PANEL_COLS = 4          # FX_MATRIX_PANEL_COLS
+MAX_TILE = 256               # FX_WEIGHTS_MAX_TILE
+
+Q16_MIN = -32768.0
+Q16_MAX = 32767.99998
+
+
+class PackError(Exception):
+    pass
+
+
+def float_to_fixed(value: float) -> int:
+    """Q16.16 quantization with the clamping of tools/quantize.py."""
+    value = max(Q16_MIN, min(Q16_MAX, value))
+    return int(round(value * (1 << FRAC_BITS)))
+
+
+def read_npy(path: Path) -> tuple[list[int], list]:
+    """
+    Minimal .npy reader (format 1.x / 2.x, little endian, C order).
+
+    Returns:
+        (shape, flat values)
+    """
+    data = path.read_bytes()
+    if data[:6] != b'\x93NUMPY':
+        raise PackError(f"{path}: not a .npy file")
+    major = data[6]
+    if major == 1:
+        hlen = struct.unpack_from('<H', data, 8)[0]
+        start = 10
+    else:
+        hlen = struct.unpack_from('<I', data, 8)[0]
+        start = 12
+    header = ast.literal_eval(data[start:start + hlen].decode('latin1'))
+    if header.get('fortran_order'):
+        raise PackError(f"{path}: Fortran order not supported")
+    formats = {'<f4': ('f', 4), '<f8': ('d', 8), '<i4': ('i', 4)}
+    descr = header['descr']
+    if descr not in formats:
+        raise PackError(f"{path}: dtype {descr} not supported (use float32, float64 or int32)")
+    code, size = formats[descr]
+    shape = list(header['shape'])
+    count = 1
+    for d in shape:
+        count *= d
+    body = data[start + hlen:]
+    if len(body) < count * size:
+        raise PackError(f"{path}: truncated")
+    values = list(struct.unpack_from(f'<{count}{code}', body, 0))
+    return shape, values
+
+
+def tensor_payload(spec: dict, base_dir: Path) -> tuple[list[int], list[int]]:
+    """Resolve one manifest tensor to (shape, Q16.16 values)."""
+    name = spec.get('name', '')
+    raw = bool(spec.get('raw', False))
+    if 'file' in spec:
+        shape, values = read_npy(base_dir / spec['file'])
+    elif 'values' in spec:
+        values = spec['values']
+        shape = spec.get('shape', [len(values)])
+    else:
+        raise PackError(f"{name}: needs 'file' or 'values'")
+
+    if 'shape' in spec:
+        shape = list(spec['shape'])
+    if not 1 <= len(shape) <= MAX_RANK or any(d < 1 for d in shape):
+        raise PackError(f"{name}: shape {shape} must have 1 to {MAX_RANK} positive dims")
+    count = 1
+    for d in shape:
+        count *= d
+    if count != len(values):
+        raise PackError(f"{name}: {len(values)} values for shape {shape}")
+
+    if raw:
+        fixed = [int(v) for v in values]
+        if any(v < -(1 << 31) or v >= (1 << 31) for v in fixed):
+            raise PackError(f"{name}: raw value outside int32")
+    else:
+        fixed = [float_to_fixed(float(v)) for v in values]
+    return shape, fixed
+
+
+def pack_gemm_panels(shape: list[int], values: list[int], nr: int = GEMM_PANEL_COLS) -> list[int]:
+    """
+    K x N row-major values to the fx_matrix_packed_t panel layout.
+
+    Panel p holds columns [p*nr, p*nr + nr) as K rows of nr values, zero
+    beyond the last column: out[(p*K + k)*nr + j] = B[k][p*nr + j].
+    """
+    k_dim, n_dim = shape
+    out = []
+    for jc in range(0, n_dim, nr):
+        for k in range(k_dim):
+            row = values[k * n_dim:(k + 1) * n_dim]
+            out.extend(row[jc + j] if jc + j < n_dim else 0 for j in range(nr))
+    return out
+
+
+def winograd_filters(shape: list[int], values: list[int]) -> list[int]:
+    """
+    C_out x C_in x 3 x 3 Q16.16 filters to U' = G' g G'^T (G' = 2G), as
+    fx_winograd_plan() computes them: 16 exact integers per filter in
+    (o * C_in + c) order.
+    """
+    cout, cin, kh, kw = shape
+    if (kh, kw) != (3, 3):
+        raise PackError(f"winograd_2x2_3x3 needs 3x3 filters, got {kh}x{kw}")
+    g_prime = [[2, 0, 0], [1, 1, 1], [1, -1, 1], [0, 0, 2]]
+    out = []
+    for f in range(cout * cin):
+        g = [values[f * 9 + i * 3:f * 9 + i * 3 + 3] for i in range(3)]
+        t = [[sum(g_prime[r][i] * g[i][j] for i in range(3)) for j in range(3)] for r in range(4)]
+        out.extend(sum(t[r][j] * g_prime[c][j] for j in range(3)) for r in range(4) for c in range(4))
+    return out
+
+
+def apply_layout(name: str, shape: list[int], values: list[int], layout: str,
+                 tile: int = 0) -> tuple[int, int, int, list[int]]:
+    """
+    Arrange Q16.16 values for a layout.
+
+    Returns:
+        (layout id, tile, dtype, stored values)
+    """
+    if layout not in LAYOUTS:
+        raise PackError(f"{name}: unknown layout '{layout}' (use {', '.join(LAYOUTS)})")
+    if layout == 'gemm_panels':
+        if len(shape) != 2:
+            raise PackError(f"{name}: gemm_panels needs a K x N matrix, got shape {shape}")
+        tile = tile or GEMM_PANEL_COLS
+        if not 1 <= tile <= MAX_TILE:
+            raise PackError(f"{name}: tile must be 1 to {MAX_TILE}")
+        return LAYOUT_GEMM_PANELS, tile, DTYPE_I32, pack_gemm_panels(shape, values, tile)
+    if layout == 'winograd_2x2_3x3':
+        if len(shape) != 4:
+            raise PackError(f"{name}: winograd_2x2_3x3 needs C_out x C_in x 3 x 3, got shape {shape}")
+        return LAYOUT_WINOGRAD_2X2_3X3, 2, DTYPE_I64, winograd_filters(shape, values)
+    return LAYOUT_DENSE, 0, DTYPE_I32, values
+
+
+def align_up(x: int, a: int) -> int:
+    return (x + a - 1) // a * a
+
+
+def pack(tensors: list[tuple], alignment: int = 64) -> bytes:
+    """
+    Build the container image.
+
+    Args:
+        tensors: (name, shape, Q16.16 values) in table order, optionally
+                 followed by a layout name and tile (see apply_layout)
+        alignment: payload alignment in bytes (power of two >= 8)
+    """
+    if alignment < 8 or alignment & (alignment - 1):
+        raise PackError("alignment must be a power of two >= 8")
+    names = set()
+    for name, *_ in tensors:
+        encoded = name.encode('utf-8')
+        if not encoded or len(encoded) >= NAME_LEN:
+            raise PackError(f"name '{name}' must be 1 to {NAME_LEN - 1} bytes")
+        if name in names:
+            raise PackError(f"duplicate tensor name '{name}'")
+        names.add(name)
+
+    table_offset = HEADER_SIZE
+    data_offset = align_up(table_offset + ENTRY_SIZE * len(tensors), alignment)
+
+    table = bytearray()
+    payload = bytearray()
+    offset = data_offset
+    for name, shape, values, *arrangement in tensors:
+        layout, tile, dtype, stored = apply_layout(name, shape, values, *arrangement)
+        dims = list(shape) + [1] * (MAX_RANK - len(shape))
+        table += struct.pack('<32sBBBBI4IQQ', name.encode('utf-8'), dtype, FRAC_BITS,
+                             len(shape), layout, tile, *dims, offset, len(stored))
+        blob = struct.pack(f"<{len(stored)}{'q' if dtype == DTYPE_I64 else 'i'}", *stored)
+        payload += blob
+        offset += len(blob)
+        pad = align_up(offset, alignment) - offset
+        payload += b'\0' * pad
+        offset += pad
+
+    file_size = data_offset + len(payload)
+
+    body = struct.pack('<HHIIIIIQQQ8s', VERSION[0], VERSION[1], BYTE_ORDER, HEADER_SIZE,
+                       ENTRY_SIZE, len(tensors), alignment, table_offset, data_offset,
+                       file_size, b'\0' * 8)
+    body += table
+    body += b'\0' * (data_offset - table_offset - len(table))
+    body += payload
+    crc = zlib.crc32(body) & 0xFFFFFFFF
+    return MAGIC + struct.pack('<I', crc) + body
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description='SpeyTech Weight Packer - Q16.16 weights to a zero-copy binary container',
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  python pack_weights.py model.ciew fc1.weight=fc1_w.npy fc1.bias=fc1_b.npy
+  python pack_weights.py model.ciew --manifest model.json
+
+For commercial licensing and support: william@fstopify.com
+        """
+    )
+    parser.add_argument('output', type=str, help='Output container (.ciew)')
+    parser.add_argument('tensors', nargs='*', help='name=file.npy pairs, in table order')
+    parser.add_argument('--manifest', type=str, help='JSON manifest (see module docs)')
+    parser.add_argument('--alignment', type=int, default=None, help='Payload alignment (default 64)')
+    args = parser.parse_args()
+
+    specs = []
+    alignment = 64
+    base_dir = Path('.')
+    try:
+        if args.manifest:
+            manifest_path = Path(args.manifest)
+            manifest = json.loads(manifest_path.read_text())
+            base_dir = manifest_path.parent
+            alignment = int(manifest.get('alignment', alignment))
+            specs.extend(manifest.get('tensors', []))
+        for pair in args.tensors:
+            if '=' not in pair:
+                raise PackError(f"'{pair}': expected name=file.npy")
+            name, file = pair.split('=', 1)
+            specs.append({'name': name, 'file': file})
+        if args.alignment is not None:
+            alignment = args.alignment
+        if not specs:
+            raise PackError("no tensors given")
+
+        tensors = []
+        for spec in specs:
+            shape, values = tensor_payload(spec, base_dir)
+            tensors.append((spec['name'], shape, values, spec.get('layout', 'dense'),
+                            int(spec.get('tile', 0))))
+        image = pack(tensors, alignment)
+    except (PackError, OSError, ValueError, KeyError) as e:
+        print(f"❌ Error: {e}")
+        return 1
+
+    out = Path(args.output)
+    out.parent.mkdir(parents=True, exist_ok=True)
+    out.write_bytes(image)
+
+    print(f"✅ Packed {len(tensors)} tensors into {out}")
+    print(f"   Size: {len(image)} bytes, CRC-32 0x{struct.unpack_from('<I', image, 4)[0]:08X}")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
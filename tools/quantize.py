@@ -1,10 +1,14 @@
 #!/usr/bin/env python3
 """
 SpeyTech Model Quantizer
-Convert PyTorch model weights to Q16.16 fixed-point C headers
+Convert PyTorch model weights to Q16.16 fixed-point C headers, or to
+int8 / int16 with per-channel scales (--int8, --int16)
 
 Usage:
     python quantize.py model.pth layer_name output_dir
+    python quantize.py w.npy layer_name output_dir --layout gemm_panels
+    python quantize.py w.npy layer_name output_dir --sparse 2:4
+    python quantize.py w.npy layer_name output_dir --int8 --input-scale S --output-scale S
 
 Author: William Murray
 Copyright (c) 2026 The Murray Family Innovation Trust
@@ -12,11 +16,15 @@ License: GPL-3.0 or Commercial
 """
 
 import sys
+import math
 import argparse
 from pathlib import Path
 from typing import Optional
 import numpy as np
 
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+from pack_weights import LAYOUTS, apply_layout  # noqa: E402
+
 def float_to_fixed(value: float, shift: int = 16) -> int:
     """
     Convert floating-point value to Q16.16 fixed-point integer.
@@ -102,12 +110,129 @@ def format_c_array(values: list[int], indent: str = "    ", values_per_line: int
         lines.append(line)
     return "\n".join(lines)
 
+SPARSE_FORMATS = {'csr': 'FX_SPARSE_CSR', '2:4': 'FX_SPARSE_2_4'}
+SPARSE_GROUP = 4
+SPARSE_KEEP = 2
+
+def sparse_rows(shape: tuple, values: list[int]) -> tuple[int, list[list[int]]]:
+    """
+    Arrange Q16.16 weights as the N x K rows of fx_sparse_matrix_t.
+
+    A K x N dense matrix gives one row per output column; C_out x C_in x
+    KH x KW filters give one row per filter in (c, i, j) order.
+
+    Returns:
+        (K, rows)
+    """
+    if len(shape) == 2:
+        k, n = shape
+        return k, [[values[r * n + c] for r in range(k)] for c in range(n)]
+    if len(shape) == 4:
+        k = shape[1] * shape[2] * shape[3]
+        return k, [values[o * k:(o + 1) * k] for o in range(shape[0])]
+    raise ValueError(f"--sparse needs a K x N matrix or C_out x C_in x KH x KW filters, got {shape}")
+
+def prune_2_4(rows: list[list[int]]) -> int:
+    """
+    Zero all but the two largest magnitudes of every group of four, in place.
+    Ties keep the lower k.
+
+    Returns:
+        Number of non-zero weights removed
+    """
+    pruned = 0
+    for row in rows:
+        for k0 in range(0, len(row), SPARSE_GROUP):
+            group = range(k0, min(k0 + SPARSE_GROUP, len(row)))
+            keep = sorted(group, key=lambda k: (-abs(row[k]), k))[:SPARSE_KEEP]
+            for k in group:
+                if k not in keep and row[k] != 0:
+                    row[k] = 0
+                    pruned += 1
+    return pruned
+
+def pack_sparse(rows: list[list[int]], fmt: str) -> dict:
+    """
+    Compress pruned rows as fx_sparse_pack() does.
+
+    Returns:
+        CSR: {'values', 'col_idx', 'row_ptr'}; 2:4: {'values', 'meta'}
+    """
+    if fmt == 'csr':
+        values, col_idx, row_ptr = [], [], [0]
+        for row in rows:
+            for k, v in enumerate(row):
+                if v != 0:
+                    values.append(v)
+                    col_idx.append(k)
+            row_ptr.append(len(values))
+        return {'values': values, 'col_idx': col_idx, 'row_ptr': row_ptr}
+
+    values, meta = [], []
+    for row in rows:
+        for k0 in range(0, len(row), SPARSE_GROUP):
+            width = min(SPARSE_GROUP, len(row) - k0)
+            pos = [j for j in range(width) if row[k0 + j] != 0]
+            if len(pos) > SPARSE_KEEP:
+                raise ValueError(f"group at k = {k0} has {len(pos)} non-zeros")
+            # Canonical fill: lowest free positions; a one-column tail
+            # group repeats its position with a zero second value
+            pos += [j for j in range(width) if j not in pos][:SPARSE_KEEP - len(pos)]
+            pos = sorted(pos) if len(pos) == SPARSE_KEEP else pos * SPARSE_KEEP
+            values.append(row[k0 + pos[0]])
+            values.append(row[k0 + pos[1]] if pos[1] != pos[0] else 0)
+            meta.append(pos[0] | (pos[1] << 2))
+    return {'values': values, 'meta': meta}
+
+def write_sparse(f, layer_name: str, shape: tuple, weight_fixed: list[int], fmt: str,
+                 stats: dict) -> None:
+    """
+    Write the sparse arrays and a {layer}_sparse fx_sparse_matrix_t.
+    """
+    k, rows = sparse_rows(shape, weight_fixed)
+    if k > 65535 or len(rows) > 65535:
+        raise ValueError(f"--sparse supports at most 65535 rows and columns, got {len(rows)} x {k}")
+    stats['pruned'] = prune_2_4(rows) if fmt == '2:4' else 0
+    packed = pack_sparse(rows, fmt)
+    n = len(rows)
+    stats['stored'] = len(packed['values'])
+
+    f.write(f"/* Weights: {shape} as {n} x {k} {fmt} sparse rows, "
+            f"{stats['stored']} stored values */\n")
+    f.write(f"static const fixed_t {layer_name}_values[{max(1, stats['stored'])}] = {{\n")
+    f.write(format_c_array(packed['values'] or [0]))
+    f.write(f"\n}};\n\n")
+    if fmt == 'csr':
+        f.write(f"static const uint16_t {layer_name}_col_idx[{max(1, stats['stored'])}] = {{\n")
+        f.write(format_c_array(packed['col_idx'] or [0]))
+        f.write(f"\n}};\n\n")
+        f.write(f"static const uint32_t {layer_name}_row_ptr[{n + 1}] = {{\n")
+        f.write(format_c_array(packed['row_ptr']))
+        f.write(f"\n}};\n\n")
+    else:
+        f.write(f"static const uint8_t {layer_name}_meta[{len(packed['meta'])}] = {{\n")
+        f.write(format_c_array(packed['meta']))
+        f.write(f"\n}};\n\n")
+
+    csr = fmt == 'csr'
+    f.write(f"static const fx_sparse_matrix_t {layer_name}_sparse = {{\n")
+    f.write(f"    .format = {SPARSE_FORMATS[fmt]},\n")
+    f.write(f"    .rows = {n},\n")
+    f.write(f"    .cols = {k},\n")
+    f.write(f"    .values = {layer_name}_values,\n")
+    f.write(f"    .col_idx = {layer_name + '_col_idx' if csr else 'NULL'},\n")
+    f.write(f"    .row_ptr = {layer_name + '_row_ptr' if csr else 'NULL'},\n")
+    f.write(f"    .meta = {'NULL' if csr else layer_name + '_meta'}\n")
+    f.write(f"}};\n\n")
+
 def export_to_c_header(
     layer_name: str,
     weights: np.ndarray,
     bias: Optional[np.ndarray],
     output_path: Path,
-    add_dimensions: bool = True
+    add_dimensions: bool = True,
+    layout: str = 'dense',
+    sparse: Optional[str] = None
 ) -> dict:
     """
     Generate C header file with fixed-point weights and bias.
@@ -118,6 +243,12 @@ def export_to_c_header(
         bias: Bias vector as numpy array (optional)
         output_path: Path to output .h file
         add_dimensions: Include dimension constants
+        layout: 'dense', or a kernel layout of tools/pack_weights.py:
+                'gemm_panels' emits {layer}_weights_packed for
+                fx_matrix_packed_t, 'winograd_2x2_3x3' emits the int64
+                {layer}_winograd filters for fx_winograd_plan_transformed()
+        sparse: 'csr' or '2:4' emits {layer}_sparse (fx_sparse_matrix_t)
+                instead of the dense array; 2:4 prunes by magnitude
 
     Returns:
         Dictionary with quantization statistics
@@ -165,7 +296,7 @@ def export_to_c_header(
 
         f.write(f"#ifndef {guard}\n")
         f.write(f"#define {guard}\n\n")
-        f.write(f'#include "fixed_point.h"\n\n')
+        f.write(f'#include "{"sparse.h" if sparse else "fixed_point.h"}"\n\n')
 
         # Dimension constants
         if add_dimensions and len(weights.shape) == 2:
@@ -174,10 +305,25 @@ def export_to_c_header(
             f.write(f"#define {layer_name.upper()}_OUTPUT_DIM {weights.shape[1]}\n\n")
 
         # Weights array
-        f.write(f"/* Weights: {weights.shape} = {weights.size} elements */\n")
-        f.write(f"static const fixed_t {layer_name}_weights[{weights.size}] = {{\n")
-        f.write(format_c_array(weight_fixed))
-        f.write(f"\n}};\n\n")
+        if sparse:
+            write_sparse(f, layer_name, weights.shape, weight_fixed, sparse, stats)
+        elif layout == 'dense':
+            f.write(f"/* Weights: {weights.shape} = {weights.size} elements */\n")
+            f.write(f"static const fixed_t {layer_name}_weights[{weights.size}] = {{\n")
+            f.write(format_c_array(weight_fixed))
+            f.write(f"\n}};\n\n")
+        else:
+            _, tile, _, stored = apply_layout(f"{layer_name}_weights", list(weights.shape),
+                                              weight_fixed, layout)
+            if layout == 'gemm_panels':
+                f.write(f"/* Weights: {weights.shape} as {tile}-column GEMM panels (fx_matrix_packed_t) */\n")
+                f.write(f"static const fixed_t {layer_name}_weights_packed[{len(stored)}] = {{\n")
+            else:
+                f.write(f"/* Weights: {weights.shape} as Winograd F(2x2, 3x3) U' = G' g G'^T */\n")
+                f.write(f"static const int64_t {layer_name}_winograd[{len(stored)}] = {{\n")
+            f.write(format_c_array(stored))
+            f.write(f"\n}};\n\n")
+        stats['layout'] = f"{sparse} sparse" if sparse else layout
 
         # Bias array
         if bias_fixed is not None:
@@ -190,6 +336,156 @@ def export_to_c_header(
 
     return stats
 
+def requant_from_scale(scale: float) -> tuple[int, int]:
+    """
+    Express a positive real scale as an fx_requant_t: M * 2^-(31 + shift).
+
+    Args:
+        scale: Scale factor (0 gives the zero multiplier)
+
+    Returns:
+        (multiplier, shift) with multiplier in [2^30, 2^31), shift in [-31, 31]
+
+    Raises:
+        ValueError: If the scale is negative or outside [2^-32, 2^31)
+
+    Example:
+        >>> requant_from_scale(0.25)
+        (1073741824, 1)  # 2^30 * 2^-32
+    """
+    if scale == 0.0:
+        return 0, 0
+    if scale < 0.0 or not math.isfinite(scale):
+        raise ValueError(f"invalid scale {scale}")
+
+    mantissa, exponent = math.frexp(scale)       # scale = mantissa * 2^exponent
+    multiplier = int(round(mantissa * (1 << 31)))
+    if multiplier == 1 << 31:                    # mantissa rounded up to 1.0
+        multiplier //= 2
+        exponent += 1
+    shift = -exponent
+    if not -31 <= shift <= 31:
+        raise ValueError(f"scale {scale} outside the fx_requant_t range")
+    return multiplier, shift
+
+def quantize_per_channel(weights: np.ndarray, axis: int, qmax: int) -> tuple[np.ndarray, np.ndarray]:
+    """
+    Symmetric per-channel quantization: q = round(w / s[c]), s[c] = max|w[c]| / qmax.
+
+    Args:
+        weights: Float weights
+        axis: Output-channel axis
+        qmax: 127 for int8, 32767 for int16
+
+    Returns:
+        Tuple of (integer weights in the original layout, per-channel scales)
+    """
+    moved = np.moveaxis(weights.astype(np.float64), axis, 0)
+    peak = np.abs(moved.reshape(moved.shape[0], -1)).max(axis=1)
+    scales = np.where(peak > 0.0, peak / qmax, 1.0)
+    shape = (-1,) + (1,) * (moved.ndim - 1)
+    q = np.clip(np.floor(moved / scales.reshape(shape) + 0.5), -qmax, qmax).astype(np.int64)
+    return np.moveaxis(q, 0, axis), scales
+
+def export_quantized_c_header(
+    layer_name: str,
+    weights: np.ndarray,
+    bias: Optional[np.ndarray],
+    output_path: Path,
+    bits: int,
+    input_scale: Optional[float],
+    output_scale: Optional[float]
+) -> dict:
+    """
+    Generate a C header for fx_q8_* / fx_q16_* layers.
+
+    Output channels are axis 0 of conv filters (C_out, C_in, K_h, K_w) and
+    axis 1 of dense weights (K x N, as fx_q8_matrix_mul's B). With both
+    activation scales given, also emits the per-channel fx_requant_t array
+    (s_in * s_w[o] / s_out) and the bias as int32 at scale s_in * s_w[o].
+
+    Returns:
+        Dictionary with quantization statistics
+    """
+    if weights.ndim not in (2, 4):
+        raise ValueError(f"expected 2D dense or 4D conv weights, got shape {weights.shape}")
+
+    qmax = (1 << (bits - 1)) - 1
+    ctype = f"int{bits}_t"
+    axis = 0 if weights.ndim == 4 else 1
+    q, w_scales = quantize_per_channel(weights, axis, qmax)
+    channels = len(w_scales)
+    with_requant = input_scale is not None and output_scale is not None
+
+    requant = []
+    bias_q = None
+    if with_requant:
+        requant = [requant_from_scale(input_scale * s / output_scale) for s in w_scales]
+        if bias is not None:
+            if bias.size != channels:
+                raise ValueError(f"bias has {bias.size} values for {channels} channels")
+            bias_q = [max(-(1 << 31), min((1 << 31) - 1, int(math.floor(b / (input_scale * s) + 0.5))))
+                      for b, s in zip(bias.flatten().tolist(), w_scales.tolist())]
+
+    print(f"Quantizing weights to int{bits}: {weights.shape}, {channels} channels")
+
+    with open(output_path, 'w') as f:
+        guard = f"{layer_name.upper()}_WEIGHTS_H"
+        f.write(f"/**\n")
+        f.write(f" * @file {output_path.name}\n")
+        f.write(f" * @brief Quantized weights for {layer_name} layer\n")
+        f.write(f" * \n")
+        f.write(f" * Automatically generated by SpeyTech Quantizer\n")
+        f.write(f" * DO NOT EDIT MANUALLY\n")
+        f.write(f" * \n")
+        f.write(f" * Original shapes:\n")
+        f.write(f" *   Weights: {weights.shape}\n")
+        if bias is not None:
+            f.write(f" *   Bias: {bias.shape}\n")
+        f.write(f" * \n")
+        f.write(f" * Quantization: int{bits} symmetric, per output channel (axis {axis})\n")
+        if with_requant:
+            f.write(f" * Activations: s_in = {input_scale!r}, s_out = {output_scale!r}\n")
+        f.write(f" * Weight scales:\n")
+        for o, sc in enumerate(w_scales.tolist()):
+            f.write(f" *   [{o}] {sc!r}\n")
+        f.write(f" */\n\n")
+
+        f.write(f"#ifndef {guard}\n")
+        f.write(f"#define {guard}\n\n")
+        f.write(f'#include "quantized.h"\n\n')
+
+        f.write(f"/* Output channels */\n")
+        f.write(f"#define {layer_name.upper()}_CHANNELS {channels}\n\n")
+
+        f.write(f"/* Weights: {weights.shape} = {weights.size} elements */\n")
+        f.write(f"static const {ctype} {layer_name}_weights[{weights.size}] = {{\n")
+        f.write(format_c_array(q.flatten().tolist()))
+        f.write(f"\n}};\n\n")
+
+        if with_requant:
+            f.write(f"/* Accumulator to output rescale, per channel */\n")
+            f.write(f"static const fx_requant_t {layer_name}_requant[{channels}] = {{\n")
+            f.write(",\n".join(f"    {{ {m:10d}, {sh:3d} }}" for m, sh in requant))
+            f.write(f"\n}};\n\n")
+
+        if bias_q is not None:
+            f.write(f"/* Bias at scale s_in * s_w[o] */\n")
+            f.write(f"static const int32_t {layer_name}_bias[{channels}] = {{\n")
+            f.write(format_c_array(bias_q))
+            f.write(f"\n}};\n\n")
+
+        f.write(f"#endif /* {guard} */\n")
+
+    return {
+        'layer_name': layer_name,
+        'weights_shape': weights.shape,
+        'weights_count': weights.size,
+        'channels': channels,
+        'requant': with_requant,
+        'bias_count': len(bias_q) if bias_q is not None else 0
+    }
+
 def main():
     parser = argparse.ArgumentParser(
         description='SpeyTech Model Quantizer - Convert PyTorch weights to Q16.16 C headers',
@@ -202,6 +498,16 @@ Examples:
   # Quantize from PyTorch checkpoint
   python quantize.py --torch model.pth layer1 output/
 
+  # Dense weights pre-packed for fx_matrix_mul_packed()
+  python quantize.py fc1.npy fc1 output/ --layout gemm_panels
+
+  # Prune to 2:4 structured sparsity for fx_sparse_matmul()
+  python quantize.py fc1.npy fc1 output/ --sparse 2:4
+
+  # Int8, per-channel scales, with requantization for known activation scales
+  python quantize.py conv1.npy conv1 output/ --bias b.npy --int8 \\
+      --input-scale 0.0078125 --output-scale 0.05
+
 For commercial licensing and support: william@fstopify.com
         """
     )
@@ -212,6 +518,15 @@ For commercial licensing and support: william@fstopify.com
     parser.add_argument('--bias', type=str, help='Path to bias file (optional)')
     parser.add_argument('--torch', action='store_true', help='Input is PyTorch checkpoint')
     parser.add_argument('--no-dims', action='store_true', help='Skip dimension constants')
+    parser.add_argument('--layout', choices=sorted(LAYOUTS), default='dense',
+                        help='Q16.16 weight layout: pre-packed GEMM panels or Winograd filters')
+    parser.add_argument('--sparse', choices=sorted(SPARSE_FORMATS),
+                        help='Q16.16 sparse weights: CSR, or 2:4 structured (prunes by magnitude)')
+    width = parser.add_mutually_exclusive_group()
+    width.add_argument('--int8', action='store_true', help='Emit int8 weights with per-channel scales')
+    width.add_argument('--int16', action='store_true', help='Emit int16 weights with per-channel scales')
+    parser.add_argument('--input-scale', type=float, help='Input activation scale (with --int8/--int16)')
+    parser.add_argument('--output-scale', type=float, help='Output activation scale (with --int8/--int16)')
 
     args = parser.parse_args()
 
@@ -256,18 +571,55 @@ For commercial licensing and support: william@fstopify.com
     print(f"\nSpeyTech Model Quantizer")
     print(f"{'='*50}")
 
+    if args.int8 or args.int16:
+        if args.layout != 'dense' or args.sparse:
+            print(f"\n❌ Error: --layout and --sparse apply to Q16.16 weights only")
+            return 1
+        try:
+            stats = export_quantized_c_header(
+                args.layer_name,
+                weights,
+                bias,
+                output_path,
+                8 if args.int8 else 16,
+                args.input_scale,
+                args.output_scale
+            )
+        except Exception as e:
+            print(f"\n❌ Error: {e}")
+            return 1
+
+        print(f"\n✅ Quantization complete!")
+        print(f"   Output: {output_path}")
+        print(f"   Weights: {stats['weights_count']} values, {stats['channels']} channel scales")
+        if not stats['requant']:
+            print(f"   ⚠️  No --input-scale/--output-scale: requantization array not emitted")
+        if stats['bias_count'] > 0:
+            print(f"   Bias: {stats['bias_count']} values")
+        return 0
+
+    if args.sparse and args.layout != 'dense':
+        print(f"\n❌ Error: --sparse and --layout are exclusive")
+        return 1
+
     try:
         stats = export_to_c_header(
             args.layer_name,
             weights,
             bias,
             output_path,
-            add_dimensions=not args.no_dims
+            add_dimensions=not args.no_dims,
+            layout=args.layout,
+            sparse=args.sparse
         )
 
         print(f"\n✅ Quantization complete!")
         print(f"   Output: {output_path}")
-        print(f"   Weights: {stats['weights_count']} values")
+        print(f"   Weights: {stats['weights_count']} values ({stats['layout']} layout)")
+        if args.sparse:
+            print(f"   Stored: {stats['stored']} values")
+            if stats['pruned'] > 0:
+                print(f"   ⚠️  {stats['pruned']} non-zero weight(s) pruned to fit 2:4")
         if stats['weights_out_of_range'] > 0:
             print(f"   ⚠️  {stats['weights_out_of_range']} weight(s) clamped to Q16.16 range")
         if stats['bias_count'] > 0: